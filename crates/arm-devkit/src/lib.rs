@@ -4,9 +4,13 @@ use std::{
     io::{self, Write},
     path::{Path, PathBuf},
     process::{self, Command},
-    sync::{Arc, Mutex, OnceLock, Weak},
+    sync::{
+        atomic::{AtomicUsize, Ordering},
+        Arc, Mutex, OnceLock, Weak,
+    },
 };
 
+use sha2::{Digest as _, Sha256};
 use tempfile::{NamedTempFile, TempPath};
 
 fn find_arm_binary_uncached(name: &str) -> Option<PathBuf> {
@@ -200,13 +204,180 @@ fn temppath_internal() -> io::Result<TempPath> {
     tempfile_internal().map(|file| file.into_temp_path())
 }
 
+static ASSEMBLY_CACHE_DIRECTORY: OnceLock<PathBuf> = OnceLock::new();
+
+/// Enables caching of assembled binaries in `path`. Entries are keyed by the source, the linker
+/// script, the flags passed to the toolchain and its version, so the directory never has to be
+/// cleared.
+/// Cache hits don't run the toolchain at all, so they also don't print a disassembly.
+pub fn set_assembly_cache_directory<P: AsRef<Path>>(path: P) {
+    let _ = ASSEMBLY_CACHE_DIRECTORY.set(path.as_ref().into());
+}
+
+/// The output of `--version` for every tool that affects the assembled binary, or `None` if the
+/// toolchain couldn't be found.
+fn toolchain_version() -> Option<&'static str> {
+    static VERSION: OnceLock<Option<String>> = OnceLock::new();
+
+    VERSION
+        .get_or_init(|| {
+            let mut version = String::new();
+            for name in ["as", "ld", "objcopy"] {
+                let output = Command::new(find_arm_binary(name)?)
+                    .arg("--version")
+                    .stdin(process::Stdio::null())
+                    .output()
+                    .ok()?;
+                version.push_str(&String::from_utf8_lossy(&output.stdout));
+            }
+            Some(version)
+        })
+        .as_deref()
+}
+
+/// Flags passed to `objcopy` for both instruction sets, not counting the input and output.
+const OBJCOPY_FLAGS: &[&str] = &["-O", "binary"];
+
+/// Part of every key in the assembly cache. This has to be changed whenever the way that
+/// binaries are built changes in a way that isn't already covered by the flags in the key.
+const ASSEMBLY_CACHE_FORMAT: &str = "1";
+
+/// Returns the cached binary for `source` or assembles it with `assemble` and adds it to the
+/// cache. `as_flags` are the flags that `assemble` passes to the assembler.
+fn assemble_cached(
+    as_flags: &[&str],
+    source: &str,
+    linker_script: &LinkerScript,
+    assemble: impl FnOnce() -> io::Result<Vec<u8>>,
+) -> io::Result<Vec<u8>> {
+    let (Some(directory), Some(version)) = (ASSEMBLY_CACHE_DIRECTORY.get(), toolchain_version())
+    else {
+        return assemble();
+    };
+
+    let key = assembly_cache_key(as_flags, source, &linker_script.0.source, version);
+    cached_in(directory, &key, assemble)
+}
+
+/// Everything that the assembled binary depends on: the flags for every tool, the source, the
+/// linker script and the version of the toolchain.
+fn assembly_cache_key(
+    as_flags: &[&str],
+    source: &str,
+    linker_script: &str,
+    version: &str,
+) -> String {
+    cache_key(&[
+        ASSEMBLY_CACHE_FORMAT,
+        &as_flags.join("\n"),
+        &OBJCOPY_FLAGS.join("\n"),
+        source,
+        linker_script,
+        version,
+    ])
+}
+
+/// A SHA-256 of `fields` as hex, which is the same for every build and platform so that the
+/// cache can be shared between them. Each field is prefixed with its length so that moving
+/// text from one field to the next changes the key.
+fn cache_key(fields: &[&str]) -> String {
+    let mut hasher = Sha256::new();
+    for field in fields {
+        hasher.update((field.len() as u64).to_le_bytes());
+        hasher.update(field.as_bytes());
+    }
+    hasher
+        .finalize()
+        .iter()
+        .map(|byte| format!("{byte:02x}"))
+        .collect()
+}
+
+/// Returns the binary stored under `key` in `directory` or assembles it with `assemble` and
+/// stores it there.
+fn cached_in(
+    directory: &Path,
+    key: &str,
+    assemble: impl FnOnce() -> io::Result<Vec<u8>>,
+) -> io::Result<Vec<u8>> {
+    let path = directory.join(format!("{key}.bin"));
+
+    if let Ok(binary) = std::fs::read(&path) {
+        return Ok(binary);
+    }
+
+    let binary = assemble()?;
+
+    // The cache is only an optimization so failing to write to it isn't an error. The entry is
+    // written to a temporary file first so that concurrent readers never see a partial binary.
+    let _ = std::fs::create_dir_all(directory)
+        .and_then(|_| NamedTempFile::new_in(directory))
+        .and_then(|mut file| {
+            file.write_all(&binary)?;
+            file.persist(&path).map_err(|err| err.error)
+        });
+
+    Ok(binary)
+}
+
+/// Runs `assemble` for every source on as many threads as there are CPUs and returns the
+/// results in the same order as `sources`.
+fn assemble_many_parallel<F>(sources: &[&str], assemble: F) -> Vec<io::Result<Vec<u8>>>
+where
+    F: Fn(&str) -> io::Result<Vec<u8>> + Sync,
+{
+    let threads = std::thread::available_parallelism()
+        .map(|threads| threads.get())
+        .unwrap_or(1)
+        .min(sources.len());
+    let next = AtomicUsize::new(0);
+    let results = Mutex::new((0..sources.len()).map(|_| None).collect::<Vec<_>>());
+
+    std::thread::scope(|scope| {
+        for _ in 0..threads {
+            scope.spawn(|| loop {
+                let index = next.fetch_add(1, Ordering::Relaxed);
+                let Some(source) = sources.get(index) else {
+                    break;
+                };
+                let result = assemble(source);
+                results.lock().unwrap()[index] = Some(result);
+            });
+        }
+    });
+
+    results
+        .into_inner()
+        .unwrap()
+        .into_iter()
+        .map(|result| result.expect("source was not assembled"))
+        .collect()
+}
+
 pub mod arm {
-    use crate::temppath_internal;
+    use crate::{assemble_cached, assemble_many_parallel, temppath_internal, OBJCOPY_FLAGS};
 
     use super::{run_arm_executable, LinkerScript};
-    use std::{borrow::Cow, io, path::Path};
+    use std::{borrow::Cow, ffi::OsStr, io, path::Path};
+
+    /// Flags passed to the assembler, which are part of the key in the assembly cache.
+    const AS_FLAGS: &[&str] = &["-mcpu=arm7tdmi", "-march=armv4t", "-mthumb-interwork"];
 
     pub fn assemble(source: &str, linker_script: LinkerScript) -> io::Result<Vec<u8>> {
+        assemble_cached(AS_FLAGS, source, &linker_script, || {
+            assemble_uncached(source, &linker_script)
+        })
+    }
+
+    /// Assembles all of `sources` in parallel, see [`assemble`].
+    pub fn assemble_many(
+        sources: &[&str],
+        linker_script: LinkerScript,
+    ) -> Vec<io::Result<Vec<u8>>> {
+        assemble_many_parallel(sources, |source| assemble(source, linker_script.clone()))
+    }
+
+    fn assemble_uncached(source: &str, linker_script: &LinkerScript) -> io::Result<Vec<u8>> {
         let mut source = Cow::Borrowed(source);
         if !source.ends_with('\n') {
             let mut new_source = String::with_capacity(source.len() + 1);
@@ -214,17 +385,12 @@ pub mod arm {
             new_source.push('\n');
             source = Cow::Owned(new_source);
         }
-        let linker_script_path: &Path = &linker_script.0;
+        let linker_script_path: &Path = &linker_script.0.path;
 
         let object_file_path = temppath_internal()?;
-        let as_args = &[
-            "-mcpu=arm7tdmi".as_ref(),
-            "-march=armv4t".as_ref(),
-            "-mthumb-interwork".as_ref(),
-            "-o".as_ref(),
-            object_file_path.as_ref(),
-        ];
-        let status = run_arm_executable("as", as_args, Some(&*source))?;
+        let mut as_args: Vec<&OsStr> = AS_FLAGS.iter().map(OsStr::new).collect();
+        as_args.extend([OsStr::new("-o"), object_file_path.as_os_str()]);
+        let status = run_arm_executable("as", &as_args, Some(&*source))?;
         if !status.success() {
             return Err(io::Error::new(io::ErrorKind::Other, "failed to assemble"));
         }
@@ -243,13 +409,9 @@ pub mod arm {
         }
 
         let bin_file_path = temppath_internal()?;
-        let objcopy_args = &[
-            "-O".as_ref(),
-            "binary".as_ref(),
-            elf_file_path.as_ref(),
-            bin_file_path.as_ref(),
-        ];
-        let status = run_arm_executable("objcopy", objcopy_args, None)?;
+        let mut objcopy_args: Vec<&OsStr> = OBJCOPY_FLAGS.iter().map(OsStr::new).collect();
+        objcopy_args.extend([elf_file_path.as_os_str(), bin_file_path.as_os_str()]);
+        let status = run_arm_executable("objcopy", &objcopy_args, None)?;
         if !status.success() {
             return Err(io::Error::new(io::ErrorKind::Other, "failed to objcopy"));
         }
@@ -274,12 +436,34 @@ pub mod arm {
 }
 
 pub mod thumb {
-    use crate::temppath_internal;
+    use crate::{assemble_cached, assemble_many_parallel, temppath_internal, OBJCOPY_FLAGS};
 
     use super::{run_arm_executable, LinkerScript};
-    use std::{borrow::Cow, io, path::Path};
+    use std::{borrow::Cow, ffi::OsStr, io, path::Path};
+
+    /// Flags passed to the assembler, which are part of the key in the assembly cache.
+    const AS_FLAGS: &[&str] = &[
+        "-mthumb",
+        "-mcpu=arm7tdmi",
+        "-march=armv4t",
+        "-mthumb-interwork",
+    ];
 
     pub fn assemble(source: &str, linker_script: LinkerScript) -> io::Result<Vec<u8>> {
+        assemble_cached(AS_FLAGS, source, &linker_script, || {
+            assemble_uncached(source, &linker_script)
+        })
+    }
+
+    /// Assembles all of `sources` in parallel, see [`assemble`].
+    pub fn assemble_many(
+        sources: &[&str],
+        linker_script: LinkerScript,
+    ) -> Vec<io::Result<Vec<u8>>> {
+        assemble_many_parallel(sources, |source| assemble(source, linker_script.clone()))
+    }
+
+    fn assemble_uncached(source: &str, linker_script: &LinkerScript) -> io::Result<Vec<u8>> {
         let mut source = Cow::Borrowed(source);
         if !source.ends_with('\n') {
             let mut new_source = String::with_capacity(source.len() + 1);
@@ -287,18 +471,12 @@ pub mod thumb {
             new_source.push('\n');
             source = Cow::Owned(new_source);
         }
-        let linker_script_path: &Path = &linker_script.0;
+        let linker_script_path: &Path = &linker_script.0.path;
 
         let object_file_path = temppath_internal()?;
-        let as_args = &[
-            "-mthumb".as_ref(),
-            "-mcpu=arm7tdmi".as_ref(),
-            "-march=armv4t".as_ref(),
-            "-mthumb-interwork".as_ref(),
-            "-o".as_ref(),
-            object_file_path.as_ref(),
-        ];
-        let status = run_arm_executable("as", as_args, Some(&*source))?;
+        let mut as_args: Vec<&OsStr> = AS_FLAGS.iter().map(OsStr::new).collect();
+        as_args.extend([OsStr::new("-o"), object_file_path.as_os_str()]);
+        let status = run_arm_executable("as", &as_args, Some(&*source))?;
         if !status.success() {
             return Err(io::Error::new(io::ErrorKind::Other, "failed to assemble"));
         }
@@ -317,13 +495,9 @@ pub mod thumb {
         }
 
         let bin_file_path = temppath_internal()?;
-        let objcopy_args = &[
-            "-O".as_ref(),
-            "binary".as_ref(),
-            elf_file_path.as_ref(),
-            bin_file_path.as_ref(),
-        ];
-        let status = run_arm_executable("objcopy", objcopy_args, None)?;
+        let mut objcopy_args: Vec<&OsStr> = OBJCOPY_FLAGS.iter().map(OsStr::new).collect();
+        objcopy_args.extend([elf_file_path.as_os_str(), bin_file_path.as_os_str()]);
+        let status = run_arm_executable("objcopy", &objcopy_args, None)?;
         if !status.success() {
             return Err(io::Error::new(io::ErrorKind::Other, "failed to objcopy"));
         }
@@ -349,16 +523,25 @@ pub mod thumb {
     }
 }
 
+struct LinkerScriptFile {
+    path: TempPath,
+    /// Kept around as part of the key for the assembly cache.
+    source: String,
+}
+
 #[derive(Clone)]
-pub struct LinkerScript(Arc<TempPath>);
+pub struct LinkerScript(Arc<LinkerScriptFile>);
 #[derive(Clone)]
-pub struct LinkerScriptWeakRef(Weak<TempPath>);
+pub struct LinkerScriptWeakRef(Weak<LinkerScriptFile>);
 
 impl LinkerScript {
     pub fn new(source: &str) -> io::Result<LinkerScript> {
         let mut file = tempfile_internal()?;
         file.write_all(source.as_bytes())?;
-        Ok(LinkerScript(Arc::new(file.into_temp_path())))
+        Ok(LinkerScript(Arc::new(LinkerScriptFile {
+            path: file.into_temp_path(),
+            source: source.to_owned(),
+        })))
     }
 
     pub fn weak(&self) -> LinkerScriptWeakRef {
@@ -416,3 +599,98 @@ SECTIONS
         *(.ARM.attributes);
     }
 }"#;
+
+#[cfg(test)]
+mod tests {
+    use std::{cell::Cell, io, time::Duration};
+
+    use crate::{assemble_many_parallel, assembly_cache_key, cache_key, cached_in};
+
+    #[test]
+    fn test_cache_key_is_stable() {
+        // Cache directories are shared between builds, so this can't change between them.
+        assert_eq!(
+            cache_key(&["arm", "mov r0, #1", "SECTIONS {}", "GNU assembler"]),
+            "61f9f381bf94bab04e2d08869bdc4c16fb0c9ec138583dfd106f1c1415d3d61e"
+        );
+
+        let key = cache_key(&["arm", "mov r0, #1"]);
+        assert_ne!(key, cache_key(&["thumb", "mov r0, #1"]));
+        assert_ne!(key, cache_key(&["ar", "mmov r0, #1"]));
+        assert_ne!(key, cache_key(&["arm", "mov r0, #1", ""]));
+    }
+
+    #[test]
+    fn test_assembly_cache_key_covers_flags() {
+        let key = assembly_cache_key(&["-mcpu=arm7tdmi"], "nop", "SECTIONS {}", "GNU assembler");
+        assert_ne!(
+            key,
+            assembly_cache_key(
+                &["-mcpu=arm7tdmi", "-EL"],
+                "nop",
+                "SECTIONS {}",
+                "GNU assembler"
+            )
+        );
+        assert_ne!(
+            key,
+            assembly_cache_key(&[], "-mcpu=arm7tdmi\nnop", "SECTIONS {}", "GNU assembler")
+        );
+    }
+
+    #[test]
+    fn test_cache_hit_and_miss() {
+        let directory = tempfile::tempdir().unwrap();
+        let assembled = Cell::new(0);
+        let assemble = |binary: &[u8]| {
+            assembled.set(assembled.get() + 1);
+            Ok(binary.to_vec())
+        };
+
+        let first = cached_in(directory.path(), "a", || assemble(&[1, 2, 3, 4]));
+        assert_eq!(first.unwrap(), [1, 2, 3, 4]);
+        assert_eq!(assembled.get(), 1);
+
+        // A hit returns what was stored without assembling again.
+        let hit = cached_in(directory.path(), "a", || assemble(&[5, 6, 7, 8]));
+        assert_eq!(hit.unwrap(), [1, 2, 3, 4]);
+        assert_eq!(assembled.get(), 1);
+
+        let miss = cached_in(directory.path(), "b", || assemble(&[5, 6, 7, 8]));
+        assert_eq!(miss.unwrap(), [5, 6, 7, 8]);
+        assert_eq!(assembled.get(), 2);
+
+        // Errors aren't cached.
+        let error = cached_in(directory.path(), "c", || {
+            Err(io::Error::new(io::ErrorKind::Other, "failed to assemble"))
+        });
+        assert!(error.is_err());
+        let retry = cached_in(directory.path(), "c", || assemble(&[9]));
+        assert_eq!(retry.unwrap(), [9]);
+        assert_eq!(assembled.get(), 3);
+    }
+
+    #[test]
+    fn test_assemble_many_keeps_order() {
+        let sources: Vec<String> = (0..64).map(|n| n.to_string()).collect();
+        let sources: Vec<&str> = sources.iter().map(String::as_str).collect();
+
+        // Earlier sources take longer so that they finish out of order on more than one thread.
+        let results = assemble_many_parallel(&sources, |source| {
+            let n: u8 = source.parse().unwrap();
+            std::thread::sleep(Duration::from_micros(64 - n as u64) * 20);
+            if n % 10 == 9 {
+                return Err(io::Error::new(io::ErrorKind::Other, source.to_owned()));
+            }
+            Ok(vec![n])
+        });
+
+        assert_eq!(results.len(), sources.len());
+        for (n, result) in results.into_iter().enumerate() {
+            match result {
+                Ok(binary) => assert_eq!(binary, [n as u8]),
+                Err(err) => assert_eq!(err.to_string(), n.to_string()),
+            }
+        }
+    }
+}
@@ -706,8 +706,11 @@ mod tests {
     use crate::arm::Condition;
 
     use super::disasm;
-    use arm_devkit::LinkerScriptWeakRef;
-    use std::sync::RwLock;
+    use arm_devkit::{LinkerScript, LinkerScriptWeakRef};
+    use std::{
+        collections::BTreeMap,
+        sync::{Mutex, RwLock},
+    };
     use util::bits::BitOps as _;
 
     #[test]
@@ -727,20 +730,20 @@ mod tests {
     }
 
     macro_rules! make_test {
-        ($name:ident, $source:literal, $mnemonic:literal, $arguments:literal) => {
+        ($group:tt, $name:ident, $source:literal, $mnemonic:literal, $arguments:literal) => {
             #[test]
             fn $name() {
-                let asm = assemble_one($source).unwrap();
+                let asm = assemble_one(&$group, $source).unwrap();
                 let dis = disasm(asm, 0x0);
                 assert_eq!($mnemonic, dis.mnemonic().to_string());
                 assert_eq!($arguments, dis.arguments().to_string());
             }
         };
 
-        ($name:ident, $source:literal, $mnemonic:literal, $arguments:literal, $comment:literal) => {
+        ($group:tt, $name:ident, $source:literal, $mnemonic:literal, $arguments:literal, $comment:literal) => {
             #[test]
             fn $name() {
-                let asm = assemble_one($source).unwrap();
+                let asm = assemble_one(&$group, $source).unwrap();
                 let dis = disasm(asm, 0x0);
                 assert_eq!($mnemonic, dis.mnemonic().to_string());
                 assert_eq!($arguments, dis.arguments().to_string());
@@ -751,7 +754,12 @@ mod tests {
 
     macro_rules! make_tests {
         ($([$name:ident, $source:literal, $mnemonic:literal, $arguments:literal $(, $comment:literal)?]),+ $(,)?) => {
-            $(make_test!($name, $source, $mnemonic, $arguments $(, $comment)?);)+
+            make_tests!(@group [$($source),+] $([$name, $source, $mnemonic, $arguments $(, $comment)?])+);
+        };
+
+        // Every test gets the sources of the whole group so that they're assembled together.
+        (@group $group:tt $([$name:ident, $source:literal, $mnemonic:literal, $arguments:literal $(, $comment:literal)?])+) => {
+            $(make_test!($group, $name, $source, $mnemonic, $arguments $(, $comment)?);)+
         };
     }
 
@@ -1343,24 +1351,30 @@ mod tests {
         [disasm_ldr_pc_relative, "ldr r0, [pc, #0x4]", "ldr", "r0, [pc, #0x4]", "r0 = [0x0000000c]"],
     }
 
-    fn assemble_one(source: &str) -> std::io::Result<u32> {
-        static LINKER_SCRIPT: RwLock<Option<LinkerScriptWeakRef>> = RwLock::new(None);
-
-        let guard = LINKER_SCRIPT.read().unwrap();
-        let maybe_linker_script = guard.as_ref().and_then(|ls| ls.upgrade());
-        drop(guard);
-        let linker_script = if let Some(linker_script) = maybe_linker_script {
-            linker_script
-        } else {
-            let linker_script = arm_devkit::LinkerScript::new(arm_devkit::SIMPLE_LINKER_SCRIPT)?;
-            LINKER_SCRIPT
-                .write()
-                .unwrap()
-                .replace(linker_script.clone().weak());
-            linker_script
-        };
+    /// Assembles `source` along with every other source from its `make_tests!` group that
+    /// hasn't been assembled yet, so that the group is assembled in parallel instead of one
+    /// test at a time.
+    fn assemble_one(group: &[&'static str], source: &'static str) -> std::io::Result<u32> {
+        // Failures are kept too so that the rest of the group doesn't try them again.
+        static ASSEMBLED: Mutex<BTreeMap<&str, Result<Vec<u8>, String>>> =
+            Mutex::new(BTreeMap::new());
+
+        let mut assembled = ASSEMBLED.lock().unwrap();
+        if !assembled.contains_key(source) {
+            let missing: Vec<&'static str> = group
+                .iter()
+                .copied()
+                .filter(|source| !assembled.contains_key(source))
+                .collect();
+            let results = arm_devkit::arm::assemble_many(&missing, linker_script()?);
+            for (missing_source, result) in missing.into_iter().zip(results) {
+                assembled.insert(missing_source, result.map_err(|err| err.to_string()));
+            }
+        }
 
-        let assembled = arm_devkit::arm::assemble(source, linker_script)?;
+        let assembled = assembled[source]
+            .as_ref()
+            .map_err(|err| std::io::Error::new(std::io::ErrorKind::Other, err.clone()))?;
         assert!(assembled.len() >= 4);
 
         let instr = (assembled[0] as u32)
@@ -1369,4 +1383,22 @@ mod tests {
             | ((assembled[3] as u32) << 24);
         Ok(instr)
     }
+
+    fn linker_script() -> std::io::Result<LinkerScript> {
+        static LINKER_SCRIPT: RwLock<Option<LinkerScriptWeakRef>> = RwLock::new(None);
+
+        let guard = LINKER_SCRIPT.read().unwrap();
+        let maybe_linker_script = guard.as_ref().and_then(|ls| ls.upgrade());
+        drop(guard);
+        if let Some(linker_script) = maybe_linker_script {
+            return Ok(linker_script);
+        }
+
+        let linker_script = LinkerScript::new(arm_devkit::SIMPLE_LINKER_SCRIPT)?;
+        LINKER_SCRIPT
+            .write()
+            .unwrap()
+            .replace(linker_script.clone().weak());
+        Ok(linker_script)
+    }
 }
@@ -707,8 +707,11 @@ impl ThumbInstr {
 #[cfg(test)]
 mod tests {
     use super::disasm;
-    use arm_devkit::LinkerScriptWeakRef;
-    use std::sync::RwLock;
+    use arm_devkit::{LinkerScript, LinkerScriptWeakRef};
+    use std::{
+        collections::BTreeMap,
+        sync::{Mutex, RwLock},
+    };
 
     #[test]
     fn disasm_undef() {
@@ -753,20 +756,20 @@ mod tests {
     }
 
     macro_rules! make_test {
-        ($name:ident, $source:literal, $mnemonic:literal, $arguments:literal) => {
+        ($group:tt, $name:ident, $source:literal, $mnemonic:literal, $arguments:literal) => {
             #[test]
             fn $name() {
-                let asm = assemble_one($source).unwrap();
+                let asm = assemble_one(&$group, $source).unwrap();
                 let dis = disasm(asm, 0x0);
                 assert_eq!($mnemonic, dis.mnemonic().to_string());
                 assert_eq!($arguments, dis.arguments(0, None).to_string());
             }
         };
 
-        ($name:ident, $source:literal, $mnemonic:literal, $arguments:literal, $comment:literal) => {
+        ($group:tt, $name:ident, $source:literal, $mnemonic:literal, $arguments:literal, $comment:literal) => {
             #[test]
             fn $name() {
-                let asm = assemble_one($source).unwrap();
+                let asm = assemble_one(&$group, $source).unwrap();
                 let dis = disasm(asm, 0x0);
                 assert_eq!($mnemonic, dis.mnemonic().to_string());
                 assert_eq!($arguments, dis.arguments(0, None).to_string());
@@ -777,7 +780,12 @@ mod tests {
 
     macro_rules! make_tests {
         ($([$name:ident, $source:literal, $mnemonic:literal, $arguments:literal $(, $comment:literal)?]),+ $(,)?) => {
-            $(make_test!($name, $source, $mnemonic, $arguments $(, $comment)?);)+
+            make_tests!(@group [$($source),+] $([$name, $source, $mnemonic, $arguments $(, $comment)?])+);
+        };
+
+        // Every test gets the sources of the whole group so that they're assembled together.
+        (@group $group:tt $([$name:ident, $source:literal, $mnemonic:literal, $arguments:literal $(, $comment:literal)?])+) => {
+            $(make_test!($group, $name, $source, $mnemonic, $arguments $(, $comment)?);)+
         };
     }
 
@@ -933,27 +941,33 @@ mod tests {
     }
 
     fn assemble(source: &str) -> std::io::Result<Vec<u8>> {
-        static LINKER_SCRIPT: RwLock<Option<LinkerScriptWeakRef>> = RwLock::new(None);
-
-        let guard = LINKER_SCRIPT.read().unwrap();
-        let maybe_linker_script = guard.as_ref().and_then(|ls| ls.upgrade());
-        drop(guard);
-        let linker_script = if let Some(linker_script) = maybe_linker_script {
-            linker_script
-        } else {
-            let linker_script = arm_devkit::LinkerScript::new(arm_devkit::SIMPLE_LINKER_SCRIPT)?;
-            LINKER_SCRIPT
-                .write()
-                .unwrap()
-                .replace(linker_script.clone().weak());
-            linker_script
-        };
-
-        arm_devkit::thumb::assemble(source, linker_script)
-    }
+        arm_devkit::thumb::assemble(source, linker_script()?)
+    }
+
+    /// Assembles `source` along with every other source from its `make_tests!` group that
+    /// hasn't been assembled yet, so that the group is assembled in parallel instead of one
+    /// test at a time.
+    fn assemble_one(group: &[&'static str], source: &'static str) -> std::io::Result<u16> {
+        // Failures are kept too so that the rest of the group doesn't try them again.
+        static ASSEMBLED: Mutex<BTreeMap<&str, Result<Vec<u8>, String>>> =
+            Mutex::new(BTreeMap::new());
+
+        let mut assembled = ASSEMBLED.lock().unwrap();
+        if !assembled.contains_key(source) {
+            let missing: Vec<&'static str> = group
+                .iter()
+                .copied()
+                .filter(|source| !assembled.contains_key(source))
+                .collect();
+            let results = arm_devkit::thumb::assemble_many(&missing, linker_script()?);
+            for (missing_source, result) in missing.into_iter().zip(results) {
+                assembled.insert(missing_source, result.map_err(|err| err.to_string()));
+            }
+        }
 
-    fn assemble_one(source: &str) -> std::io::Result<u16> {
-        let assembled = assemble(source)?;
+        let assembled = assembled[source]
+            .as_ref()
+            .map_err(|err| std::io::Error::new(std::io::ErrorKind::Other, err.clone()))?;
         assert!(assembled.len() >= 2);
         let instr = (assembled[0] as u16) | ((assembled[1] as u16) << 8);
         Ok(instr)
@@ -966,4 +980,22 @@ mod tests {
         let instr2 = (assembled[2] as u16) | ((assembled[3] as u16) << 8);
         Ok((instr1, instr2))
     }
+
+    fn linker_script() -> std::io::Result<LinkerScript> {
+        static LINKER_SCRIPT: RwLock<Option<LinkerScriptWeakRef>> = RwLock::new(None);
+
+        let guard = LINKER_SCRIPT.read().unwrap();
+        let maybe_linker_script = guard.as_ref().and_then(|ls| ls.upgrade());
+        drop(guard);
+        if let Some(linker_script) = maybe_linker_script {
+            return Ok(linker_script);
+        }
+
+        let linker_script = LinkerScript::new(arm_devkit::SIMPLE_LINKER_SCRIPT)?;
+        LINKER_SCRIPT
+            .write()
+            .unwrap()
+            .replace(linker_script.clone().weak());
+        Ok(linker_script)
+    }
 }
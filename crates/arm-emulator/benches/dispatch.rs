@@ -0,0 +1,235 @@
+//! Measures how quickly the CPU gets through streams of generated instructions. The streams
+//! are a mix of data processing, multiply and load/store instructions with operands from a
+//! fixed seed so that every run executes the same instructions.
+
+use arm_emulator::{CodeTiming, Cpu, CpuMode, Cycles, InstructionSet, Memory, Waitstates};
+use criterion::{black_box, criterion_group, criterion_main, Criterion, Throughput};
+use util::wyhash::WyHash;
+
+/// Number of generated instructions in a stream, not including the branch back to the start.
+const STREAM_LENGTH: u32 = 512;
+
+/// Number of instructions that are executed for each iteration of a benchmark.
+const STEPS: u64 = 4096;
+
+/// Number of cycles that the CPU is run for in each iteration of the `run_until` benchmarks.
+const RUN_CYCLES: u32 = 8192;
+
+/// Base address of the memory that the generated loads and stores access.
+const DATA_ADDRESS: u32 = 0x8000;
+
+/// Memory without any waitstates.
+struct BenchMemory {
+    data: Vec<u8>,
+}
+
+impl BenchMemory {
+    fn new(code: &[u8]) -> Self {
+        let mut data = vec![0; 0x10000];
+        data[..code.len()].copy_from_slice(code);
+        BenchMemory { data }
+    }
+}
+
+impl Memory for BenchMemory {
+    fn load8(&mut self, address: u32, _cpu: &mut Cpu) -> (u8, Waitstates) {
+        let address = address as usize % self.data.len();
+        (self.data[address], Waitstates::zero())
+    }
+
+    fn store8(&mut self, address: u32, value: u8, _cpu: &mut Cpu) -> Waitstates {
+        let address = address as usize % self.data.len();
+        self.data[address] = value;
+        Waitstates::zero()
+    }
+
+    fn code_timing(&mut self, _address: u32, _thumb: bool) -> Option<CodeTiming> {
+        Some(CodeTiming::default())
+    }
+
+    fn as_any(&self) -> &dyn std::any::Any {
+        self
+    }
+
+    fn as_mut_any(&mut self) -> &mut dyn std::any::Any {
+        self
+    }
+}
+
+/// Generates ARM instructions that only write to r0-r11. r12 is the base register for loads and
+/// stores and always points at [`DATA_ADDRESS`].
+fn arm_stream(seed: u64) -> Vec<u8> {
+    let mut rng = WyHash::new(seed);
+    let mut code = Vec::new();
+
+    for _ in 0..STREAM_LENGTH {
+        let r: u32 = rng.generate();
+        let rd = (r >> 12) % 12;
+        let rn = (r >> 16) % 13;
+        let rm = r % 13;
+        // Mostly unconditional with some conditional instructions to exercise condition checks.
+        let cond = if r & 0x300000 == 0 {
+            (r >> 28) % 15
+        } else {
+            0xE
+        };
+
+        let instr = match (r >> 24) % 8 {
+            // Data processing with an immediate operand.
+            0..=2 => {
+                let opcode = (r >> 4) % 16;
+                let s = (opcode & 0xC == 0x8) as u32 | ((r >> 9) & 1);
+                (cond << 28)
+                    | (1 << 25)
+                    | (opcode << 21)
+                    | (s << 20)
+                    | (rn << 16)
+                    | (rd << 12)
+                    | (r & 0xFFF)
+            }
+            // Data processing with a register operand shifted by an immediate.
+            3 | 4 => {
+                let opcode = (r >> 4) % 16;
+                let s = (opcode & 0xC == 0x8) as u32 | ((r >> 9) & 1);
+                let shift = (r >> 5) & 0x7F;
+                (cond << 28)
+                    | (opcode << 21)
+                    | (s << 20)
+                    | (rn << 16)
+                    | (rd << 12)
+                    | (shift << 5)
+                    | rm
+            }
+            // Data processing with a register operand shifted by a register.
+            5 => {
+                let opcode = (r >> 4) % 16;
+                let s = (opcode & 0xC == 0x8) as u32;
+                let rs = (r >> 8) % 13;
+                (cond << 28)
+                    | (opcode << 21)
+                    | (s << 20)
+                    | (rn << 16)
+                    | (rd << 12)
+                    | (rs << 8)
+                    | (((r >> 5) & 0x3) << 5)
+                    | (1 << 4)
+                    | rm
+            }
+            // MUL
+            6 => {
+                let rs = (r >> 8) % 13;
+                (cond << 28) | (rd << 16) | (rs << 8) | 0x90 | rm
+            }
+            // LDR/STR/LDRB/STRB with an immediate offset from r12.
+            _ => {
+                let load = (r >> 20) & 1;
+                let byte = (r >> 22) & 1;
+                let offset = r & 0xFFC;
+                (cond << 28)
+                    | (0x58 << 20)
+                    | (byte << 22)
+                    | (load << 20)
+                    | (12 << 16)
+                    | (rd << 12)
+                    | offset
+            }
+        };
+        code.extend_from_slice(&instr.to_le_bytes());
+    }
+
+    // b <start>
+    let offset = (-(STREAM_LENGTH as i32) - 2) as u32 & 0xFFFFFF;
+    code.extend_from_slice(&(0xEA000000 | offset).to_le_bytes());
+    code
+}
+
+/// Generates THUMB instructions that only write to r0-r6. r7 is the base register for loads and
+/// stores and always points at [`DATA_ADDRESS`].
+fn thumb_stream(seed: u64) -> Vec<u8> {
+    let mut rng = WyHash::new(seed);
+    let mut code = Vec::new();
+
+    for _ in 0..STREAM_LENGTH {
+        let r: u16 = rng.generate();
+        let rd = r % 7;
+        let rs = (r >> 3) & 0x7;
+
+        let instr = match (r >> 13) % 6 {
+            // Move shifted register.
+            0 => ((r >> 11) % 3) << 11 | ((r >> 6) & 0x1F) << 6 | rs << 3 | rd,
+            // Add/subtract.
+            1 => 0x1800 | ((r >> 9) & 0x3) << 9 | ((r >> 6) & 0x7) << 6 | rs << 3 | rd,
+            // Move/compare/add/subtract immediate.
+            2 => 0x2000 | ((r >> 11) & 0x3) << 11 | rd << 8 | (r & 0xFF),
+            // ALU operations.
+            3 | 4 => 0x4000 | ((r >> 6) & 0xF) << 6 | rs << 3 | rd,
+            // Load/store with an immediate offset from r7.
+            _ => 0x6000 | ((r >> 11) & 0x3) << 11 | ((r >> 6) & 0x1F) << 6 | 7 << 3 | rd,
+        };
+        code.extend_from_slice(&instr.to_le_bytes());
+    }
+
+    // b <start>
+    let offset = (-(STREAM_LENGTH as i32) - 2) as u16 & 0x7FF;
+    code.extend_from_slice(&(0xE000 | offset).to_le_bytes());
+    code
+}
+
+fn setup(isa: InstructionSet, code: &[u8], block_cache: bool) -> (Cpu, BenchMemory) {
+    let mut memory = BenchMemory::new(code);
+    let mut cpu = Cpu::new(isa, CpuMode::System, &mut memory);
+    cpu.set_block_cache_enabled(block_cache);
+    cpu.registers.write(7, DATA_ADDRESS);
+    cpu.registers.write(12, DATA_ADDRESS);
+    cpu.branch(0, &mut memory);
+    (cpu, memory)
+}
+
+fn bench_dispatch(c: &mut Criterion) {
+    let mut group = c.benchmark_group("dispatch");
+    group.throughput(Throughput::Elements(STEPS));
+
+    let arm = arm_stream(0x41524D);
+    let thumb = thumb_stream(0x5448554D42);
+    let streams = [
+        ("arm", InstructionSet::Arm, &arm),
+        ("thumb", InstructionSet::Thumb, &thumb),
+    ];
+    for (name, isa, code) in streams {
+        let (mut cpu, mut memory) = setup(isa, code, false);
+        group.bench_function(name, |b| {
+            b.iter(|| {
+                for _ in 0..STEPS {
+                    black_box(cpu.step(&mut memory));
+                }
+            })
+        });
+    }
+    group.finish();
+}
+
+/// Same streams as [`bench_dispatch`] run with [`Cpu::run_until`], which is how the GBA runs
+/// the CPU. Throughput is in cycles instead of instructions here.
+fn bench_run_until(c: &mut Criterion) {
+    let mut group = c.benchmark_group("run_until");
+    group.throughput(Throughput::Elements(RUN_CYCLES as u64));
+
+    let arm = arm_stream(0x41524D);
+    let thumb = thumb_stream(0x5448554D42);
+    let streams = [
+        ("arm", InstructionSet::Arm, &arm),
+        ("thumb", InstructionSet::Thumb, &thumb),
+    ];
+    for (name, isa, code) in streams {
+        for (suffix, block_cache) in [("", false), ("/block_cache", true)] {
+            let (mut cpu, mut memory) = setup(isa, code, block_cache);
+            group.bench_function(format!("{name}{suffix}"), |b| {
+                b.iter(|| black_box(cpu.run_until(Cycles::from(RUN_CYCLES), &mut memory)))
+            });
+        }
+    }
+    group.finish();
+}
+
+criterion_group!(benches, bench_dispatch, bench_run_until);
+criterion_main!(benches);
@@ -37,14 +37,9 @@ impl BinaryOp for AddOp {
     }
 
     fn set_flags(registers: &mut Registers, lhs: u32, rhs: u32, result: u32) {
-        registers.put_flag(CpsrFlag::N, (result >> 31) & 1);
-        registers.put_flag(CpsrFlag::Z, result == 0);
-
-        let (_, carry) = lhs.overflowing_add(rhs);
-        let (_, overflow) = (lhs as i32).overflowing_add(rhs as i32);
-
-        registers.put_flag(CpsrFlag::C, carry);
-        registers.put_flag(CpsrFlag::V, overflow);
+        // The addition overflowed if both operands have the same sign and the result doesn't.
+        let overflow = (lhs ^ result) & !(lhs ^ rhs);
+        registers.set_nzcv_flags(result, result < lhs, overflow);
     }
 }
 
@@ -57,9 +52,6 @@ impl BinaryOp for AdcOp {
     }
 
     fn set_flags(registers: &mut Registers, lhs: u32, rhs: u32, result: u32) {
-        registers.put_flag(CpsrFlag::N, (result >> 31) & 1);
-        registers.put_flag(CpsrFlag::Z, result == 0);
-
         let carry = registers.get_flag(CpsrFlag::C);
 
         let (res_0, carry_0) = lhs.overflowing_add(rhs);
@@ -68,8 +60,8 @@ impl BinaryOp for AdcOp {
         let (_, carry_1) = res_0.overflowing_add(carry as u32);
         let (_, overflow_1) = (res_0 as i32).overflowing_add(carry as i32);
 
-        registers.put_flag(CpsrFlag::C, carry_0 | carry_1);
-        registers.put_flag(CpsrFlag::V, overflow_0 | overflow_1);
+        let overflow = overflow_0 | overflow_1;
+        registers.set_nzcv_flags(result, carry_0 | carry_1, (overflow as u32) << 31);
     }
 }
 
@@ -81,16 +73,14 @@ impl BinaryOp for SubOp {
     }
 
     fn set_flags(registers: &mut Registers, lhs: u32, rhs: u32, result: u32) {
-        registers.put_flag(CpsrFlag::N, (result >> 31) & 1);
-        registers.put_flag(CpsrFlag::Z, result == 0);
-
-        let (_, overflow) = (lhs as i32).overflowing_sub(rhs as i32);
+        // The subtraction overflowed if the operands have different signs and the result
+        // doesn't have the sign of lhs.
+        let overflow = (lhs ^ rhs) & (lhs ^ result);
 
         // #NOTE The concept of a borrow is not the same in ARM as it is in x86.
         //       while in x86 the borrow flag is set if lhs < rhs, in ARM
         //       if is set if lhs >= rhs (when the result of a subtraction is positive).
-        registers.put_flag(CpsrFlag::C, lhs >= rhs);
-        registers.put_flag(CpsrFlag::V, overflow);
+        registers.set_nzcv_flags(result, lhs >= rhs, overflow);
     }
 }
 
@@ -103,19 +93,14 @@ impl BinaryOp for SbcOp {
     }
 
     fn set_flags(registers: &mut Registers, lhs: u32, rhs: u32, result: u32) {
-        registers.put_flag(CpsrFlag::N, (result >> 31) & 1);
-        registers.put_flag(CpsrFlag::Z, result == 0);
-
         let carry = registers.get_flag(CpsrFlag::C);
 
         // #NOTE The concept of a borrow is not the same in ARM as it is in x86.
         //       while in x86 the borrow flag is set if lhs < rhs, in ARM
         //       if is set if lhs >= rhs (when the result of a subtraction is positive).
-        registers.put_flag(CpsrFlag::C, (lhs as u64) >= (rhs as u64 + (!carry) as u64));
-        registers.put_flag(
-            CpsrFlag::V,
-            (((lhs >> 31) ^ rhs) & ((lhs >> 31) ^ result)) != 0,
-        );
+        let carry = (lhs as u64) >= (rhs as u64 + (!carry) as u64);
+        let overflow = (((lhs >> 31) ^ rhs) & ((lhs >> 31) ^ result)) != 0;
+        registers.set_nzcv_flags(result, carry, (overflow as u32) << 31);
     }
 }
 
@@ -451,8 +436,7 @@ pub trait BinaryOp {
         if let Some(carry) = Self::get_carry_out(lhs, rhs) {
             registers.put_flag(CpsrFlag::C, carry);
         }
-        registers.put_flag(CpsrFlag::N, (result >> 31) & 1);
-        registers.put_flag(CpsrFlag::Z, result == 0);
+        registers.set_nz_flags(result);
     }
 
     /// Some immediate forms of the shift operations use #0 to encode
@@ -392,11 +392,13 @@ pub fn arm_swp<const BYTE: bool>(instr: u32, cpu: &mut Cpu, memory: &mut dyn Mem
         let (temp, wait_load) = memory.load8(address, cpu);
         cpu.registers.write(rd, temp as u32);
         let wait_store = memory.store8(address, source as u8, cpu);
+        cpu.invalidate_code(address, 1);
         Cycles::one() + wait_load + wait_store
     } else {
         let (temp, wait_load) = memory.load32(address, cpu);
         cpu.registers.write(rd, temp);
         let wait_store = memory.store32(address, source, cpu);
+        cpu.invalidate_code(address & !0x3, 4);
         Cycles::one() + wait_load + wait_store
     }
 }
@@ -0,0 +1,345 @@
+use std::{
+    collections::HashMap,
+    hash::{BuildHasherDefault, Hasher},
+};
+
+#[cfg(all(feature = "jit", target_arch = "x86_64", unix))]
+use crate::jit::CompiledBlock;
+use crate::{cpu::InstrFn, lookup};
+
+/// Condition code for instructions that always execute. THUMB instructions (other than
+/// conditional branches, which check their own condition) are always cached with this.
+pub(crate) const COND_ALWAYS: u32 = 0xE;
+
+/// Maximum number of instructions in a single block. Straight-line code that is longer
+/// than this will just be split into multiple blocks.
+pub(crate) const MAX_BLOCK_LENGTH: usize = 256;
+
+/// Blocks never cross a page boundary so that they only have to be registered with one page
+/// and so that every opcode in them can be fetched with the same timing.
+pub(crate) const PAGE_SHIFT: u32 = 10;
+
+#[derive(Clone, Copy)]
+pub(crate) struct CachedInstr {
+    pub opcode: u32,
+    pub cond: u32,
+    pub exec: InstrFn,
+
+    /// False for instructions that only read and write registers other than the PC. Anything
+    /// else might access memory, branch or raise an exception, so skipped fetches have to be
+    /// reported before it runs and the block has to be checked again after it.
+    pub touches_memory: bool,
+}
+
+impl CachedInstr {
+    pub fn decode(opcode: u32, thumb: bool) -> Self {
+        if thumb {
+            CachedInstr {
+                opcode,
+                cond: COND_ALWAYS,
+                exec: lookup::decode_thumb_opcode(opcode),
+                touches_memory: !thumb_only_registers(opcode),
+            }
+        } else {
+            CachedInstr {
+                opcode,
+                cond: opcode >> 28,
+                exec: lookup::decode_arm_opcode(opcode),
+                touches_memory: !arm_only_registers(opcode),
+            }
+        }
+    }
+}
+
+/// Data processing instructions and multiplies that don't write to the PC. This leaves out
+/// the halfword transfers, which share their encoding space with the multiplies, and the PSR
+/// transfers, which share theirs with BX and a lot of undefined instructions.
+fn arm_only_registers(opcode: u32) -> bool {
+    let row = (opcode >> 20) & 0xFF;
+    if opcode & 0x0FC000F0 == 0x00000090 || opcode & 0x0F8000F0 == 0x00800090 {
+        // MUL, MLA and the long multiplies, which write to bits 16-19 and 12-15.
+        return (opcode >> 16) & 0xF != 15 && (opcode >> 12) & 0xF != 15;
+    }
+    let data_processing = row >> 6 == 0;
+    let multiply_or_transfer = row >> 5 == 0 && opcode & 0x90 == 0x90;
+    let psr_transfer = row & 0b11001 == 0b10000;
+    let writes_pc = (opcode >> 12) & 0xF == 15;
+    data_processing && !multiply_or_transfer && !psr_transfer && !writes_pc
+}
+
+/// Shifts, immediate operations, ALU operations and adding to the SP or PC, which can only
+/// write to r0-r7 and the SP.
+fn thumb_only_registers(opcode: u32) -> bool {
+    let opcode = opcode & 0xFFFF;
+    opcode >> 14 == 0b00
+        || opcode >> 10 == 0b010000
+        || opcode >> 12 == 0b1010
+        || opcode >> 8 == 0b10110000
+}
+
+/// Block keys are instruction addresses, which a multiply spreads out well enough. This is
+/// much cheaper than SipHash for a lookup that happens every time that a block is entered.
+#[derive(Default)]
+struct KeyHasher(u64);
+
+impl Hasher for KeyHasher {
+    fn write(&mut self, bytes: &[u8]) {
+        for &byte in bytes {
+            self.write_u32(byte as u32);
+        }
+    }
+
+    #[inline(always)]
+    fn write_u32(&mut self, key: u32) {
+        self.0 = (self.0 ^ key as u64)
+            .wrapping_mul(0x9E3779B97F4A7C15)
+            .rotate_left(32);
+    }
+
+    #[inline(always)]
+    fn finish(&self) -> u64 {
+        self.0
+    }
+}
+
+/// Decoded instructions from a block of straight-line code.
+pub(crate) struct Block {
+    pub instrs: Box<[CachedInstr]>,
+
+    /// False if recording the block stopped before the code left it (e.g. because of a
+    /// deadline), in which case it is extended the next time that it runs to its end.
+    pub complete: bool,
+
+    /// Native code for the instructions that the JIT can compile, if there are any.
+    #[cfg(all(feature = "jit", target_arch = "x86_64", unix))]
+    pub compiled: Option<CompiledBlock>,
+}
+
+/// A cache of decoded instructions grouped into blocks of straight-line code keyed by the
+/// address of their first instruction and the instruction set that they were decoded with.
+///
+/// Blocks are recorded from the opcodes that pass through the CPU pipeline the first time
+/// that they run, so building them never requires reading from memory. After that they are
+/// only checked against the pipeline when they are entered, so anything that changes code
+/// has to go through [`BlockCache::invalidate`].
+#[derive(Default)]
+pub(crate) struct BlockCache {
+    blocks: HashMap<u32, Block, BuildHasherDefault<KeyHasher>>,
+    pages: HashMap<u32, Vec<u32>>,
+
+    /// One bit for each group of pages (see [`page_filter_bit`]) that has a block registered
+    /// with it. This lets most stores to memory that doesn't contain code return without a
+    /// lookup.
+    page_filter: u64,
+}
+
+impl BlockCache {
+    /// Returns the block that starts at `address` if the pipeline still contains the first
+    /// two opcodes that it was recorded with. A block that doesn't match is removed so that
+    /// it can be recorded again.
+    #[inline]
+    pub fn get(&mut self, address: u32, thumb: bool, decoded: u32, fetched: u32) -> Option<&Block> {
+        let key = block_key(address, thumb);
+        let block = self.blocks.get(&key)?;
+        let matches = block.instrs[0].opcode == decoded
+            && block
+                .instrs
+                .get(1)
+                .map_or(true, |instr| instr.opcode == fetched);
+        if !matches {
+            self.blocks.remove(&key);
+            return None;
+        }
+        self.blocks.get(&key)
+    }
+
+    /// Removes the block that starts at `address` so that it can be extended and inserted
+    /// again. It stays registered with its page.
+    pub fn take(&mut self, address: u32, thumb: bool) -> Option<Vec<CachedInstr>> {
+        let block = self.blocks.remove(&block_key(address, thumb))?;
+        Some(block.instrs.into_vec())
+    }
+
+    /// Registers a block that is about to be recorded with its page, so that a store to the
+    /// page while it is being recorded is noticed.
+    pub fn watch(&mut self, address: u32, thumb: bool) {
+        let key = block_key(address, thumb);
+        let page = address >> PAGE_SHIFT;
+        let keys = self.pages.entry(page).or_default();
+        if !keys.contains(&key) {
+            keys.push(key);
+        }
+        self.page_filter |= page_filter_bit(page);
+    }
+
+    /// Adds a block that was recorded after calling [`BlockCache::watch`] for it. With the
+    /// `jit` feature ARM blocks are compiled here, since a block is only recorded by running
+    /// it and most code that runs once runs again.
+    pub fn insert(&mut self, address: u32, thumb: bool, instrs: Vec<CachedInstr>, complete: bool) {
+        debug_assert!(!instrs.is_empty() && instrs.len() <= MAX_BLOCK_LENGTH);
+        let block = Block {
+            #[cfg(all(feature = "jit", target_arch = "x86_64", unix))]
+            compiled: (!thumb).then(|| CompiledBlock::compile(&instrs)).flatten(),
+            instrs: instrs.into_boxed_slice(),
+            complete,
+        };
+        self.blocks.insert(block_key(address, thumb), block);
+    }
+
+    /// Removes all blocks that contain instructions decoded from `address..address+len`.
+    /// Returns true if any blocks were registered with those pages.
+    #[inline]
+    pub fn invalidate(&mut self, address: u32, len: u32) -> bool {
+        let first_page = address >> PAGE_SHIFT;
+        let last_page = address.wrapping_add(len.max(1) - 1) >> PAGE_SHIFT;
+
+        let mut invalidated = false;
+        for page in first_page..=last_page {
+            if self.page_filter & page_filter_bit(page) != 0 {
+                invalidated |= self.invalidate_page(page);
+            }
+        }
+        invalidated
+    }
+
+    #[cold]
+    fn invalidate_page(&mut self, page: u32) -> bool {
+        let Some(keys) = self.pages.remove(&page) else {
+            return false;
+        };
+
+        for key in keys {
+            self.blocks.remove(&key);
+        }
+        true
+    }
+
+    pub fn clear(&mut self) {
+        self.blocks.clear();
+        self.pages.clear();
+        self.page_filter = 0;
+    }
+}
+
+/// Mixes the 16MB region that a page is in into its bit, so that code at the start of one
+/// region doesn't share a bit with data at the start of another.
+#[inline(always)]
+fn page_filter_bit(page: u32) -> u64 {
+    1 << ((page ^ (page >> (24 - PAGE_SHIFT))) & 63)
+}
+
+/// ARM and THUMB instructions are at least 2 byte aligned, so bit 0 of the address is
+/// used to store the instruction set that the block was decoded with.
+#[inline(always)]
+fn block_key(address: u32, thumb: bool) -> u32 {
+    address | (thumb as u32)
+}
+
+#[cfg(test)]
+mod test {
+    use super::{BlockCache, CachedInstr};
+
+    const ARM_MOV_R0_R0: u32 = 0xE1A00000;
+    const ARM_MOV_R1_R1: u32 = 0xE1A01001;
+
+    fn record(cache: &mut BlockCache, address: u32, thumb: bool, opcodes: &[u32]) {
+        cache.watch(address, thumb);
+        let instrs = opcodes
+            .iter()
+            .map(|&opcode| CachedInstr::decode(opcode, thumb))
+            .collect();
+        cache.insert(address, thumb, instrs, true);
+    }
+
+    #[test]
+    fn test_blocks_are_reused() {
+        let mut cache = BlockCache::default();
+        record(&mut cache, 0x100, false, &[ARM_MOV_R0_R0, ARM_MOV_R1_R1]);
+
+        let block = cache
+            .get(0x100, false, ARM_MOV_R0_R0, ARM_MOV_R1_R1)
+            .unwrap();
+        assert_eq!(block.instrs.len(), 2);
+        assert_eq!(block.instrs[1].opcode, ARM_MOV_R1_R1);
+        assert_eq!(block.instrs[1].cond, 0xE);
+        assert!(cache.get(0x104, false, ARM_MOV_R1_R1, 0).is_none());
+    }
+
+    #[test]
+    fn test_isa_is_part_of_key() {
+        let mut cache = BlockCache::default();
+        record(&mut cache, 0x100, false, &[ARM_MOV_R0_R0]);
+        assert!(cache.get(0x100, true, ARM_MOV_R0_R0, 0).is_none());
+        assert!(cache.get(0x100, false, ARM_MOV_R0_R0, 0).is_some());
+    }
+
+    #[test]
+    fn test_store_invalidates_block() {
+        let mut cache = BlockCache::default();
+        record(
+            &mut cache,
+            0x03000000,
+            false,
+            &[ARM_MOV_R0_R0, ARM_MOV_R1_R1],
+        );
+
+        assert!(!cache.invalidate(0x03001000, 4));
+        assert!(cache.invalidate(0x03000004, 4));
+        assert!(cache.blocks.is_empty());
+        assert!(cache.pages.is_empty());
+    }
+
+    #[test]
+    fn test_taken_block_stays_registered() {
+        let mut cache = BlockCache::default();
+        record(&mut cache, 0x03000000, false, &[ARM_MOV_R0_R0]);
+
+        let instrs = cache.take(0x03000000, false).unwrap();
+        assert_eq!(instrs.len(), 1);
+        assert!(cache.get(0x03000000, false, ARM_MOV_R0_R0, 0).is_none());
+        assert!(cache.invalidate(0x03000004, 4));
+    }
+
+    #[test]
+    fn test_store_invalidates_block_being_recorded() {
+        let mut cache = BlockCache::default();
+        cache.watch(0x03000000, true);
+        assert!(cache.invalidate(0x03000002, 2));
+    }
+
+    #[test]
+    fn test_modified_opcode_is_not_reused() {
+        let mut cache = BlockCache::default();
+        record(&mut cache, 0x100, false, &[ARM_MOV_R0_R0, ARM_MOV_R1_R1]);
+
+        assert!(cache.get(0x100, false, ARM_MOV_R0_R0, 0x01A01001).is_none());
+        assert!(cache.blocks.is_empty());
+    }
+
+    #[test]
+    fn test_register_only_instructions() {
+        let arm = |opcode| !CachedInstr::decode(opcode, false).touches_memory;
+        assert!(arm(0xE0800001)); // add r0, r0, r1
+        assert!(arm(0xE3A00010)); // mov r0, #16
+        assert!(arm(0xE1510002)); // cmp r1, r2
+        assert!(!arm(0xE1A0F00E)); // mov pc, lr
+        assert!(!arm(0xE12FFF1E)); // bx lr
+        assert!(!arm(0xE10F0000)); // mrs r0, cpsr
+        assert!(arm(0xE0000291)); // mul r0, r1, r2
+        assert!(arm(0xE0821392)); // umull r1, r2, r2, r3
+        assert!(!arm(0xE00F0291)); // mul pc, r1, r2
+        assert!(!arm(0xE1D000B0)); // ldrh r0, [r0]
+        assert!(!arm(0xE5900000)); // ldr r0, [r0]
+        assert!(!arm(0xEAFFFFFE)); // b .
+
+        let thumb = |opcode| !CachedInstr::decode(opcode, true).touches_memory;
+        assert!(thumb(0x1840)); // adds r0, r0, r1
+        assert!(thumb(0x2010)); // movs r0, #16
+        assert!(thumb(0x4348)); // muls r0, r1
+        assert!(thumb(0xA801)); // add r0, sp, #4
+        assert!(!thumb(0x4687)); // mov pc, r0
+        assert!(!thumb(0x6800)); // ldr r0, [r0]
+        assert!(!thumb(0xD0FE)); // beq .
+        assert!(!thumb(0xDF00)); // swi 0
+    }
+}
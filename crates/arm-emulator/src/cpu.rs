@@ -1,11 +1,21 @@
 use crate::{
-    clock::Cycles,
-    exception::{CpuException, ExceptionHandler, ExceptionHandlerResult, EXCEPTION_BASE},
+    block::{BlockCache, CachedInstr, COND_ALWAYS, MAX_BLOCK_LENGTH, PAGE_SHIFT},
+    clock::{Cycles, Waitstates},
+    exception::{
+        CpuException, ExceptionHandler, ExceptionHandlerResult, CPU_EXCEPTION_COUNT, EXCEPTION_BASE,
+    },
+    idle::IdleLoopDetector,
     lookup,
-    memory::{AccessType, Memory},
+    memory::{AccessType, Memory, SkippedFetches},
     CpsrFlag, CpuMode, Registers,
 };
 
+#[cfg(all(feature = "jit", target_arch = "x86_64", unix))]
+use crate::jit::CompiledBlock;
+
+#[cfg(feature = "trace")]
+use crate::trace::{TraceEvent, TraceProducer, TracedMemory};
+
 pub type InstrFn = fn(u32, &mut Cpu, &mut dyn Memory) -> Cycles;
 
 /// mov r0, r0 -- opcode for an ARM instruction that does nothing.
@@ -23,6 +33,78 @@ pub struct Cpu {
 
     decoded: u32,
     exception_handler: Option<ExceptionHandler>,
+
+    /// Decoded instructions, only present if the block cache has been enabled
+    /// with [`Cpu::set_block_cache_enabled`].
+    block_cache: Option<Box<BlockCache>>,
+
+    /// Changes whenever blocks are removed from the block cache, so that a block that is
+    /// running can tell that it might not exist anymore.
+    code_generation: u32,
+
+    /// Only present if idle loop detection has been enabled with
+    /// [`Cpu::set_idle_loop_detection_enabled`].
+    idle_loop_detector: Option<Box<IdleLoopDetector>>,
+
+    /// Set by [`Cpu::halt`]. [`Cpu::run_until`] returns early while this is set.
+    halted: bool,
+
+    /// Number of times that [`Cpu::step`] has been called.
+    instruction_count: u64,
+
+    counters: CpuCounters,
+
+    /// Set by [`Cpu::set_tracer`].
+    #[cfg(feature = "trace")]
+    tracer: Option<TraceProducer>,
+}
+
+/// Everything about a [`Cpu`] that changes while it runs, for saving and restoring it with
+/// [`Cpu::save_state`] and [`Cpu::load_state`]. The exception handler and the block cache and
+/// idle loop detection settings aren't part of it.
+#[derive(Clone, PartialEq, Eq)]
+pub struct CpuState {
+    pub registers: Registers,
+    /// The opcodes in the fetch and decode stages of the pipeline.
+    pub fetched: u32,
+    pub decoded: u32,
+    /// True if the next memory access is sequential.
+    pub sequential: bool,
+    pub halted: bool,
+    pub instruction_count: u64,
+}
+
+/// Counts of what the CPU has done since it was created, for seeing where time goes while
+/// it runs. Unlike [`Cpu::instruction_count`] these aren't part of [`CpuState`], so loading
+/// a state doesn't change them.
+#[derive(Clone, Copy, Default, Debug, PartialEq, Eq)]
+pub struct CpuCounters {
+    pub arm_instructions: u64,
+    pub thumb_instructions: u64,
+    /// Exceptions that were taken (including ones handled by the exception handler), indexed
+    /// by `CpuException as usize`.
+    pub exceptions: [u64; CPU_EXCEPTION_COUNT],
+}
+
+impl CpuCounters {
+    pub fn instructions(&self) -> u64 {
+        self.arm_instructions + self.thumb_instructions
+    }
+
+    pub fn exceptions_taken(&self) -> u64 {
+        self.exceptions.iter().sum()
+    }
+
+    /// The counts since `earlier`, which must have been taken from the same CPU.
+    pub fn since(&self, earlier: &CpuCounters) -> CpuCounters {
+        CpuCounters {
+            arm_instructions: self.arm_instructions - earlier.arm_instructions,
+            thumb_instructions: self.thumb_instructions - earlier.thumb_instructions,
+            exceptions: std::array::from_fn(|index| {
+                self.exceptions[index] - earlier.exceptions[index]
+            }),
+        }
+    }
 }
 
 #[derive(PartialEq, Clone, Copy, Eq)]
@@ -52,6 +134,14 @@ impl Cpu {
             access_type: AccessType::NonSequential,
             fetched: noop_opcode,
             decoded: noop_opcode,
+            block_cache: None,
+            code_generation: 0,
+            idle_loop_detector: None,
+            halted: false,
+            instruction_count: 0,
+            counters: CpuCounters::default(),
+            #[cfg(feature = "trace")]
+            tracer: None,
         }
     }
 
@@ -70,6 +160,21 @@ impl Cpu {
     /// ahead.
     #[inline]
     pub fn step(&mut self, memory: &mut dyn Memory) -> Cycles {
+        #[cfg(feature = "trace")]
+        if self.tracer.is_some() {
+            return self.step_traced(memory);
+        }
+        self.step_untraced(memory)
+    }
+
+    #[inline(always)]
+    fn step_untraced(&mut self, memory: &mut dyn Memory) -> Cycles {
+        self.instruction_count += 1;
+        if self.registers.get_flag(CpsrFlag::T) {
+            self.counters.thumb_instructions += 1;
+        } else {
+            self.counters.arm_instructions += 1;
+        }
         if self.registers.get_flag(CpsrFlag::T) {
             self.step_thumb(memory)
         } else {
@@ -77,23 +182,459 @@ impl Cpu {
         }
     }
 
-    /// Returns the number of cycles required to step the CPU in the ARM state.
+    /// Same as [`Cpu::step`] but pushes every load and store and then the instruction itself
+    /// to the tracer.
+    #[cfg(feature = "trace")]
     #[inline(never)]
-    fn step_arm(&mut self, memory: &mut dyn Memory) -> Cycles {
+    fn step_traced(&mut self, memory: &mut dyn Memory) -> Cycles {
+        let Some(mut tracer) = self.tracer.take() else {
+            return self.step_untraced(memory);
+        };
+        let address = self.next_execution_address();
         let opcode = self.decoded;
-        self.decoded = self.fetched;
+        let thumb = self.registers.get_flag(CpsrFlag::T);
+        let cycles = self.step_untraced(&mut TracedMemory {
+            memory,
+            tracer: &mut tracer,
+        });
+        tracer.push(TraceEvent::Instruction {
+            address,
+            opcode,
+            thumb,
+            cycles: u32::from(cycles),
+        });
+        self.tracer = Some(tracer);
+        cycles
+    }
+
+    /// Steps the CPU until at least `deadline` cycles have elapsed or until the CPU is halted.
+    /// This returns the number of cycles that actually elapsed, which can overshoot `deadline`
+    /// by however many cycles the last instruction took.
+    ///
+    /// If idle loop detection is enabled, this may skip over iterations of a loop that can't exit
+    /// before `deadline` without executing them. The cycles for those iterations are still
+    /// included in the returned value.
+    pub fn run_until(&mut self, deadline: Cycles, memory: &mut dyn Memory) -> Cycles {
+        // Anything could have changed since the last time we were called.
+        if let Some(detector) = self.idle_loop_detector.as_mut() {
+            detector.reset();
+        }
+
+        #[cfg(feature = "trace")]
+        let traced = self.tracer.is_some();
+        #[cfg(not(feature = "trace"))]
+        let traced = false;
 
         let mut cycles = Cycles::zero();
-        let fetch_pc = (self.registers.read(15) & !0x3).wrapping_add(4);
-        self.registers.write(15, fetch_pc);
+        if traced {
+            // The tracer needs the checks in `step` for every instruction.
+            while cycles < deadline && !self.halted {
+                let address = self.next_execution_address();
+                cycles += self.step(memory);
+                self.check_idle_loop(address, &mut cycles, deadline);
+            }
+            return cycles;
+        }
 
-        let (fetched, wait) = memory.load32(fetch_pc, self);
-        self.access_type = AccessType::Sequential;
+        while cycles < deadline && !self.halted {
+            if self.block_cache.is_some() {
+                self.run_cached_until(&mut cycles, deadline, memory);
+            } else if self.registers.get_flag(CpsrFlag::T) {
+                self.run_thumb_until(&mut cycles, deadline, memory);
+            } else {
+                self.run_arm_until(&mut cycles, deadline, memory);
+            }
+        }
+        cycles
+    }
 
-        self.fetched = fetched;
-        cycles += Cycles::one() + wait;
+    /// Steps the CPU in the ARM state until the deadline, the CPU halts or it switches to
+    /// THUMB. Instructions return straight back into this loop, so the only work between
+    /// them is the decode table lookup and the checks here. `cycles` is updated as
+    /// instructions are executed.
+    ///
+    /// Idle loops can only start with a jump, so the idle loop detector is only checked
+    /// after instructions that didn't continue to the next one.
+    #[inline(never)]
+    fn run_arm_until(&mut self, cycles: &mut Cycles, deadline: Cycles, memory: &mut dyn Memory) {
+        let mut executed = 0;
+        loop {
+            let pc = self.registers.read(15);
+            *cycles += self.step_arm(memory);
+            executed += 1;
+            if self.registers.read(15) != pc.wrapping_add(4) {
+                self.check_idle_loop(pc.wrapping_sub(4), cycles, deadline);
+            }
+            if *cycles >= deadline || self.halted || self.registers.get_flag(CpsrFlag::T) {
+                break;
+            }
+        }
+        self.instruction_count += executed;
+        self.counters.arm_instructions += executed;
+    }
+
+    /// Same as [`Cpu::run_arm_until`] for the THUMB state.
+    #[inline(never)]
+    fn run_thumb_until(&mut self, cycles: &mut Cycles, deadline: Cycles, memory: &mut dyn Memory) {
+        let mut executed = 0;
+        loop {
+            let pc = self.registers.read(15);
+            *cycles += self.step_thumb(memory);
+            executed += 1;
+            if self.registers.read(15) != pc.wrapping_add(2) {
+                self.check_idle_loop(pc.wrapping_sub(2), cycles, deadline);
+            }
+            if *cycles >= deadline || self.halted || !self.registers.get_flag(CpsrFlag::T) {
+                break;
+            }
+        }
+        self.instruction_count += executed;
+        self.counters.thumb_instructions += executed;
+    }
+
+    /// Runs the block from the block cache that starts at the next instruction, or records
+    /// one there if there isn't one yet.
+    #[inline(always)]
+    fn run_cached_until(&mut self, cycles: &mut Cycles, deadline: Cycles, memory: &mut dyn Memory) {
+        let thumb = self.registers.get_flag(CpsrFlag::T);
+        let address = self.next_execution_address();
+        let (decoded, fetched) = (self.decoded, self.fetched);
+        let block = match self.block_cache.as_mut() {
+            Some(cache) => cache.get(address, thumb, decoded, fetched),
+            None => return,
+        };
+
+        #[cfg(all(feature = "jit", target_arch = "x86_64", unix))]
+        let compiled = block
+            .and_then(|block| block.compiled.as_ref())
+            .map_or(std::ptr::null(), |compiled| {
+                compiled as *const CompiledBlock
+            });
+        let Some((instrs, complete)) =
+            block.map(|block| (&*block.instrs as *const [CachedInstr], block.complete))
+        else {
+            return self.record_block(address, Vec::new(), cycles, deadline, memory);
+        };
+
+        let len = instrs.len();
+        let executed = if thumb {
+            self.run_cached_block::<true>(
+                instrs,
+                #[cfg(all(feature = "jit", target_arch = "x86_64", unix))]
+                compiled,
+                cycles,
+                deadline,
+                memory,
+            )
+        } else {
+            self.run_cached_block::<false>(
+                instrs,
+                #[cfg(all(feature = "jit", target_arch = "x86_64", unix))]
+                compiled,
+                cycles,
+                deadline,
+                memory,
+            )
+        };
+
+        let size = if thumb { 2 } else { 4 };
+        let last = address.wrapping_add((executed as u32 - 1) * size);
+        if self.next_execution_address() != last.wrapping_add(size) {
+            self.check_idle_loop(last, cycles, deadline);
+        } else if executed == len
+            && !complete
+            && *cycles < deadline
+            && !self.halted
+            && self.registers.get_flag(CpsrFlag::T) == thumb
+        {
+            let instrs = self
+                .block_cache
+                .as_mut()
+                .and_then(|cache| cache.take(address, thumb));
+            if let Some(instrs) = instrs {
+                self.record_block(address, instrs, cycles, deadline, memory);
+            }
+        }
+    }
+
+    /// Runs the instructions in `block` until the deadline or until one of them leaves the
+    /// block. Opcodes that the block already has are moved into the pipeline without fetching
+    /// them if the memory provides their timing with [`Memory::code_timing`], which leaves
+    /// only the last two instructions to fetch their successors from memory.
+    ///
+    /// With the `jit` feature, runs of instructions that `compiled` has native code for are
+    /// run all at once when the deadline can't come before the end of them.
+    ///
+    /// Returns the number of instructions that ran.
+    #[inline(never)]
+    fn run_cached_block<const THUMB: bool>(
+        &mut self,
+        block: *const [CachedInstr],
+        #[cfg(all(feature = "jit", target_arch = "x86_64", unix))] compiled: *const CompiledBlock,
+        cycles: &mut Cycles,
+        deadline: Cycles,
+        memory: &mut dyn Memory,
+    ) -> usize {
+        let size = if THUMB { 2 } else { 4 };
+        let generation = self.code_generation;
+        // SAFETY: blocks are only dropped when `code_generation` changes, and that is checked
+        // after every instruction that could have changed it before the block is used again.
+        let instrs = unsafe { &*block };
+        // SAFETY: the compiled code belongs to the block and is dropped with it.
+        #[cfg(all(feature = "jit", target_arch = "x86_64", unix))]
+        let compiled = unsafe { compiled.as_ref() };
+        let mut len = instrs.len();
+        let mut executed = 0;
+
+        'block: {
+            if let Some(timing) = memory.code_timing(self.next_execution_address(), THUMB) {
+                // Kept in locals instead of `self` and `cycles` so that they can stay in
+                // registers while the instructions run.
+                let mut elapsed = Cycles::zero();
+                let mut skipped = 0;
+                let mut skipped_wait = Waitstates::zero();
+                let mut stopped = false;
+                while executed + 2 < len {
+                    #[cfg(all(feature = "jit", target_arch = "x86_64", unix))]
+                    if let Some(compiled) = compiled {
+                        // Compiled instructions are register-only data processing
+                        // instructions, which take one cycle each and don't change the
+                        // access type, so everything but their results can be done up front.
+                        let end = compiled.run_end(executed);
+                        let count = (end - executed) as u32;
+                        let wait = u32::from(timing.sequential);
+                        if count != 0
+                            && self.access_type == AccessType::Sequential
+                            && *cycles + elapsed + Cycles::from((count - 1) * (1 + wait)) < deadline
+                        {
+                            // SAFETY: `executed` was compiled since its run doesn't end there.
+                            unsafe { compiled.run(executed, &mut self.registers) };
+                            let pc = self.registers.read(15).wrapping_add(size * count);
+                            self.registers.write(15, pc);
+                            self.decoded = instrs[end].opcode;
+                            self.fetched = instrs[end + 1].opcode;
+                            skipped += count;
+                            skipped_wait += Waitstates::from(wait * count);
+                            elapsed += Cycles::from((1 + wait) * count);
+                            executed = end;
+                            if *cycles + elapsed >= deadline {
+                                stopped = true;
+                                break;
+                            }
+                            continue;
+                        }
+                    }
+
+                    let instr = instrs[executed];
+                    let wait = timing.get(self.access_type);
+                    let pc = self.registers.read(15).wrapping_add(size);
+                    self.registers.write(15, pc);
+                    self.decoded = self.fetched;
+                    self.fetched = instrs[executed + 2].opcode;
+                    self.access_type = AccessType::Sequential;
+                    skipped += 1;
+                    skipped_wait += wait;
+                    elapsed += Cycles::one() + wait;
+
+                    if instr.touches_memory {
+                        self.report_skipped_fetches::<THUMB>(skipped, skipped_wait, memory);
+                        skipped = 0;
+                        skipped_wait = Waitstates::zero();
+                    }
+                    if instr.cond == COND_ALWAYS || check_condition(instr.cond, &self.registers) {
+                        elapsed += (instr.exec)(instr.opcode, self, memory);
+                    }
+                    executed += 1;
+
+                    if (instr.touches_memory && self.left_block(pc, generation, THUMB))
+                        || *cycles + elapsed >= deadline
+                    {
+                        stopped = true;
+                        break;
+                    }
+                }
+                *cycles += elapsed;
+                self.report_skipped_fetches::<THUMB>(skipped, skipped_wait, memory);
+                if stopped {
+                    break 'block;
+                }
+            }
+
+            while executed < len {
+                let instr = instrs[executed];
+                *cycles += if THUMB {
+                    self.advance_thumb_pipeline(memory)
+                } else {
+                    self.advance_arm_pipeline(memory)
+                };
+                // Without timings the memory might not report every change to the code, so
+                // stop before running an opcode that doesn't match the one that was fetched.
+                if executed + 2 < len && self.fetched != instrs[executed + 2].opcode {
+                    len = executed + 2;
+                }
+                let pc = self.registers.read(15);
+
+                if instr.cond == COND_ALWAYS || check_condition(instr.cond, &self.registers) {
+                    *cycles += (instr.exec)(instr.opcode, self, memory);
+                }
+                executed += 1;
+
+                if (instr.touches_memory && self.left_block(pc, generation, THUMB))
+                    || *cycles >= deadline
+                {
+                    break;
+                }
+            }
+        }
+
+        self.instruction_count += executed as u64;
+        if THUMB {
+            self.counters.thumb_instructions += executed as u64;
+        } else {
+            self.counters.arm_instructions += executed as u64;
+        }
+        executed
+    }
+
+    /// Passes the fetches that the block cache skipped on to the memory. The last one is
+    /// always the opcode that is in the fetch stage of the pipeline.
+    #[inline(always)]
+    fn report_skipped_fetches<const THUMB: bool>(
+        &mut self,
+        count: u32,
+        wait: Waitstates,
+        memory: &mut dyn Memory,
+    ) {
+        if count != 0 {
+            memory.skipped_fetches(SkippedFetches {
+                count,
+                wait,
+                address: self.registers.read(15),
+                opcode: self.fetched,
+                thumb: THUMB,
+            });
+        }
+    }
+
+    /// Returns true if the instruction that just ran might have changed the block that it
+    /// came from or left it.
+    #[inline(always)]
+    fn left_block(&self, pc: u32, generation: u32, thumb: bool) -> bool {
+        self.code_generation != generation
+            || self.registers.read(15) != pc
+            || self.registers.get_flag(CpsrFlag::T) != thumb
+            || self.halted
+    }
+
+    /// Steps the CPU until it leaves a block of straight-line code and adds the instructions
+    /// that it executed to the block cache, after the ones in `instrs` if this is extending a
+    /// block that starts at `address`. A block that is cut short by the deadline is still
+    /// added, since long blocks might never fit before one, but blocks that changed while
+    /// they ran are thrown away.
+    #[cold]
+    #[inline(never)]
+    fn record_block(
+        &mut self,
+        address: u32,
+        mut instrs: Vec<CachedInstr>,
+        cycles: &mut Cycles,
+        deadline: Cycles,
+        memory: &mut dyn Memory,
+    ) {
+        let thumb = self.registers.get_flag(CpsrFlag::T);
+        let size = if thumb { 2 } else { 4 };
+        let generation = self.code_generation;
+        if let Some(cache) = self.block_cache.as_mut() {
+            cache.watch(address, thumb);
+        }
+
+        let recorded = instrs.len();
+        let complete = loop {
+            let opcode = self.decoded;
+            let pc = self.registers.read(15);
+            *cycles += if thumb {
+                self.step_thumb(memory)
+            } else {
+                self.step_arm(memory)
+            };
+            instrs.push(CachedInstr::decode(opcode, thumb));
+
+            let next_pc = pc.wrapping_add(size);
+            if self.registers.read(15) != next_pc {
+                self.check_idle_loop(pc.wrapping_sub(size), cycles, deadline);
+                break true;
+            }
+            if self.registers.get_flag(CpsrFlag::T) != thumb
+                || instrs.len() == MAX_BLOCK_LENGTH
+                || (next_pc.wrapping_sub(size) >> PAGE_SHIFT) != (address >> PAGE_SHIFT)
+            {
+                break true;
+            }
+            if *cycles >= deadline || self.halted || self.code_generation != generation {
+                break false;
+            }
+        };
+
+        let executed = (instrs.len() - recorded) as u64;
+        self.instruction_count += executed;
+        if thumb {
+            self.counters.thumb_instructions += executed;
+        } else {
+            self.counters.arm_instructions += executed;
+        }
+        if self.code_generation == generation {
+            if let Some(cache) = self.block_cache.as_mut() {
+                cache.insert(address, thumb, instrs, complete);
+            }
+        }
+    }
+
+    /// Called after the instruction at `address` jumped. If it jumped back to the start of an
+    /// idle loop, this skips as many iterations of the loop as fit before the deadline.
+    #[inline(always)]
+    fn check_idle_loop(&mut self, address: u32, cycles: &mut Cycles, deadline: Cycles) {
+        let next_address = self.next_execution_address();
+        let Some(detector) = self.idle_loop_detector.as_mut() else {
+            return;
+        };
+        if let Some(iteration) = detector.check(address, next_address, &self.registers, *cycles) {
+            // Only whole iterations are skipped so that the remaining instructions
+            // still run at the same cycles that they would have without skipping.
+            let remaining = u32::from(deadline.saturating_sub(*cycles));
+            let iteration = u32::from(iteration);
+            *cycles += Cycles::from(remaining - remaining % iteration);
+        }
+    }
+
+    /// Steps the CPU until it leaves a block of straight-line code (e.g. because of a branch or an
+    /// exception) or until at least `max_cycles` cycles have elapsed. This returns the number of
+    /// cycles that were required to execute every one of the steps.
+    pub fn run_block(&mut self, max_cycles: Cycles, memory: &mut dyn Memory) -> Cycles {
+        let mut cycles = Cycles::zero();
+        loop {
+            let address = self.next_execution_address();
+            let thumb = self.registers.get_flag(CpsrFlag::T);
+            cycles += self.step(memory);
+
+            let expected = address.wrapping_add(if thumb { 2 } else { 4 });
+            if cycles >= max_cycles
+                || self.registers.get_flag(CpsrFlag::T) != thumb
+                || self.next_execution_address() != expected
+            {
+                break cycles;
+            }
+        }
+    }
 
-        if check_condition(opcode >> 28, &self.registers) {
+    /// Returns the number of cycles required to step the CPU in the ARM state.
+    #[inline(always)]
+    fn step_arm(&mut self, memory: &mut dyn Memory) -> Cycles {
+        let opcode = self.decoded;
+        let cycles = self.advance_arm_pipeline(memory);
+
+        // Most instructions are unconditional, so skip the condition check for those.
+        let cond = opcode >> 28;
+        if cond == COND_ALWAYS || check_condition(cond, &self.registers) {
             let exec_fn = lookup::decode_arm_opcode(opcode);
             cycles + exec_fn(opcode, self, memory)
         } else {
@@ -102,23 +643,182 @@ impl Cpu {
     }
 
     /// Returns the number of cycles required to step the CPU in the THUMB state.
-    #[inline]
+    #[inline(always)]
     fn step_thumb(&mut self, memory: &mut dyn Memory) -> Cycles {
         let opcode = self.decoded;
         let exec_fn = lookup::decode_thumb_opcode(opcode);
+        let cycles = self.advance_thumb_pipeline(memory);
+        cycles + exec_fn(opcode, self, memory)
+    }
+
+    /// Moves the fetched opcode into the decode stage and fetches the next ARM opcode.
+    /// Returns the number of cycles required for the fetch.
+    #[inline(always)]
+    fn advance_arm_pipeline(&mut self, memory: &mut dyn Memory) -> Cycles {
+        self.decoded = self.fetched;
+
+        let fetch_pc = (self.registers.read(15) & !0x3).wrapping_add(4);
+        self.registers.write(15, fetch_pc);
+
+        let (fetched, wait) = memory.fetch32(fetch_pc, self);
+        self.access_type = AccessType::Sequential;
+
+        self.fetched = fetched;
+        Cycles::one() + wait
+    }
+
+    /// Moves the fetched opcode into the decode stage and fetches the next THUMB opcode.
+    /// Returns the number of cycles required for the fetch.
+    #[inline(always)]
+    fn advance_thumb_pipeline(&mut self, memory: &mut dyn Memory) -> Cycles {
         self.decoded = self.fetched;
 
-        let mut cycles = Cycles::zero();
         let fetch_pc = (self.registers.read(15) & !0x1).wrapping_add(2);
         self.registers.write(15, fetch_pc);
 
-        let (fetched, wait) = memory.load16(fetch_pc, self);
+        let (fetched, wait) = memory.fetch16(fetch_pc, self);
         self.access_type = AccessType::Sequential;
 
         self.fetched = fetched as u32;
-        cycles += Cycles::one() + wait;
+        Cycles::one() + wait
+    }
 
-        cycles + exec_fn(opcode, self, memory)
+    /// Enables or disables the block cache. While the block cache is enabled, [`Cpu::run_until`]
+    /// records blocks of straight-line code the first time that it runs them and runs them
+    /// from the cache after that, without decoding them again or fetching opcodes that the
+    /// cache already has (see [`Memory::code_timing`]). [`Cpu::step`] doesn't use the cache.
+    ///
+    /// This is off by default. How much it saves depends on how expensive opcode fetches are
+    /// for the memory, and code that mostly loads and stores runs about as fast either way.
+    ///
+    /// **IMPORTANT**: [`Cpu::invalidate_code`] must be called when memory that might contain code is
+    /// written to by anything other than the CPU (e.g. DMA). Stores done by the CPU itself
+    /// are handled automatically.
+    pub fn set_block_cache_enabled(&mut self, enabled: bool) {
+        if enabled {
+            self.block_cache.get_or_insert_with(Box::default);
+        } else {
+            self.block_cache = None;
+            self.code_generation = self.code_generation.wrapping_add(1);
+        }
+    }
+
+    pub fn block_cache_enabled(&self) -> bool {
+        self.block_cache.is_some()
+    }
+
+    /// Removes any cached instructions that were decoded from the `len` bytes starting
+    /// at `address`. This does nothing if the block cache is disabled.
+    ///
+    /// This also lets the idle loop detector know that memory has changed.
+    #[inline]
+    pub fn invalidate_code(&mut self, address: u32, len: u32) {
+        if let Some(cache) = self.block_cache.as_mut() {
+            if cache.invalidate(address, len) {
+                self.code_generation = self.code_generation.wrapping_add(1);
+            }
+        }
+
+        if let Some(detector) = self.idle_loop_detector.as_mut() {
+            detector.store();
+        }
+    }
+
+    /// Removes all cached instructions.
+    pub fn clear_block_cache(&mut self) {
+        if let Some(cache) = self.block_cache.as_mut() {
+            cache.clear();
+        }
+        self.code_generation = self.code_generation.wrapping_add(1);
+    }
+
+    /// Enables or disables idle loop detection in [`Cpu::run_until`]. While this is enabled,
+    /// short loops that run with the same registers every iteration and don't write to memory
+    /// are skipped until the deadline.
+    ///
+    /// **IMPORTANT**: This assumes that loads from memory always return the same value until
+    /// the next deadline. Anything that changes memory on its own (e.g. a timer counter that
+    /// is read directly) has to end the current [`Cpu::run_until`] call when it changes, and
+    /// writes by anything other than the CPU must call [`Cpu::invalidate_code`].
+    pub fn set_idle_loop_detection_enabled(&mut self, enabled: bool) {
+        if enabled {
+            self.idle_loop_detector.get_or_insert_with(Box::default);
+        } else {
+            self.idle_loop_detector = None;
+        }
+    }
+
+    pub fn idle_loop_detection_enabled(&self) -> bool {
+        self.idle_loop_detector.is_some()
+    }
+
+    /// Stops [`Cpu::run_until`] after the current instruction and keeps it from running
+    /// instructions until [`Cpu::resume`] is called. [`Cpu::step`] ignores this so whatever
+    /// is driving the CPU is responsible for not stepping it while it is halted.
+    pub fn halt(&mut self) {
+        self.halted = true;
+    }
+
+    pub fn resume(&mut self) {
+        self.halted = false;
+    }
+
+    #[inline]
+    pub fn halted(&self) -> bool {
+        self.halted
+    }
+
+    /// Starts pushing an event for every instruction that [`Cpu::step`] executes and every load
+    /// and store that it makes into `tracer`, or stops if it is `None`. This returns the
+    /// previous tracer. Something has to be draining the other half of the buffer while the
+    /// CPU runs or it will stop once the buffer is full.
+    ///
+    /// Iterations of idle loops that are skipped by idle loop detection aren't traced.
+    #[cfg(feature = "trace")]
+    pub fn set_tracer(&mut self, tracer: Option<TraceProducer>) -> Option<TraceProducer> {
+        std::mem::replace(&mut self.tracer, tracer)
+    }
+
+    pub fn save_state(&self) -> CpuState {
+        CpuState {
+            registers: self.registers.clone(),
+            fetched: self.fetched,
+            decoded: self.decoded,
+            sequential: self.access_type == AccessType::Sequential,
+            halted: self.halted,
+            instruction_count: self.instruction_count,
+        }
+    }
+
+    /// Restores a state returned by [`Cpu::save_state`]. Cached instructions are kept, so
+    /// [`Cpu::invalidate_code`] has to be called for any code that the memory doesn't have
+    /// in common with the memory at the time that the state was saved.
+    pub fn load_state(&mut self, state: &CpuState) {
+        self.registers = state.registers.clone();
+        self.fetched = state.fetched;
+        self.decoded = state.decoded;
+        self.access_type = if state.sequential {
+            AccessType::Sequential
+        } else {
+            AccessType::NonSequential
+        };
+        self.halted = state.halted;
+        self.instruction_count = state.instruction_count;
+        if let Some(detector) = self.idle_loop_detector.as_mut() {
+            detector.reset();
+        }
+    }
+
+    /// Returns the number of instructions that the CPU has executed since it was created.
+    /// Iterations of idle loops that were skipped by idle loop detection aren't counted.
+    #[inline]
+    pub fn instruction_count(&self) -> u64 {
+        self.instruction_count
+    }
+
+    #[inline]
+    pub fn counters(&self) -> &CpuCounters {
+        &self.counters
     }
 
     pub fn branch(&mut self, address: u32, memory: &mut dyn Memory) -> Cycles {
@@ -136,11 +836,11 @@ impl Cpu {
 
         self.registers.write(15, address);
         self.access_type = AccessType::NonSequential;
-        let (decoded, wait) = memory.load32(address.wrapping_sub(4), self);
+        let (decoded, wait) = memory.fetch32(address.wrapping_sub(4), self);
         cycles += Cycles::one() + wait;
 
         self.access_type = AccessType::Sequential;
-        let (fetched, wait) = memory.load32(address, self);
+        let (fetched, wait) = memory.fetch32(address, self);
         cycles += Cycles::one() + wait;
 
         self.decoded = decoded;
@@ -155,11 +855,11 @@ impl Cpu {
         let mut cycles = Cycles::zero();
 
         self.access_type = AccessType::NonSequential;
-        let (decoded, wait) = memory.load16(address, self);
+        let (decoded, wait) = memory.fetch16(address, self);
         cycles += Cycles::one() + wait;
 
         self.access_type = AccessType::Sequential;
-        let (fetched, wait) = memory.load16(address.wrapping_add(2), self);
+        let (fetched, wait) = memory.fetch16(address.wrapping_add(2), self);
         cycles += Cycles::one() + wait;
 
         self.decoded = decoded as u32;
@@ -240,6 +940,7 @@ impl Cpu {
         return_addr: u32,
         memory: &mut dyn Memory,
     ) -> Cycles {
+        self.counters.exceptions[exception as usize] += 1;
         let exception_info = exception.info();
         let exception_vector = EXCEPTION_BASE + exception_info.offset;
 
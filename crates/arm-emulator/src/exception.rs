@@ -21,6 +21,8 @@ pub enum CpuException {
     AddressExceeds26Bit,
 }
 
+pub(crate) const CPU_EXCEPTION_COUNT: usize = 8;
+
 impl CpuException {
     fn name(self) -> &'static str {
         match self {
@@ -0,0 +1,148 @@
+use crate::{clock::Cycles, Registers};
+
+/// Only backwards branches that jump at most this many bytes are considered to be loops
+/// that might be idle. Idle loops are usually only a few instructions long.
+const MAX_IDLE_LOOP_BYTES: u32 = 32;
+
+/// Detects loops that can't exit until something other than the CPU changes the state of
+/// the system (e.g. a loop that waits for `VCOUNT` to change).
+///
+/// A loop is idle if the CPU arrives at the start of the loop twice with the exact same
+/// registers and without having written to memory in between. Memory can only be changed by
+/// something outside of the CPU, so every iteration after that will be identical to the last
+/// one, down to the number of cycles that it takes.
+#[derive(Default)]
+pub(crate) struct IdleLoopDetector {
+    /// The state of the CPU the last time that it jumped back to the start of a loop.
+    start: Option<LoopStart>,
+
+    /// Set whenever memory is written to while a loop is being checked.
+    stored: bool,
+}
+
+struct LoopStart {
+    address: u32,
+    registers: Registers,
+    cycles: Cycles,
+}
+
+impl IdleLoopDetector {
+    /// Forgets about the current loop. This should be called whenever something outside of
+    /// the CPU might have changed the state of the system.
+    pub fn reset(&mut self) {
+        self.start = None;
+    }
+
+    #[inline(always)]
+    pub fn store(&mut self) {
+        self.stored = true;
+    }
+
+    /// Called after an instruction with the address of the instruction that was executed,
+    /// the address of the next instruction and the number of cycles that have elapsed.
+    /// Returns the number of cycles that each iteration of the loop takes if the CPU is
+    /// in an idle loop. This only does anything for short backwards jumps, so it can be
+    /// skipped for instructions that continued to the next one.
+    #[inline(always)]
+    pub fn check(
+        &mut self,
+        address: u32,
+        next_address: u32,
+        registers: &Registers,
+        cycles: Cycles,
+    ) -> Option<Cycles> {
+        if next_address > address || address - next_address > MAX_IDLE_LOOP_BYTES {
+            return None;
+        }
+        self.check_loop(next_address, registers, cycles)
+    }
+
+    #[cold]
+    fn check_loop(
+        &mut self,
+        address: u32,
+        registers: &Registers,
+        cycles: Cycles,
+    ) -> Option<Cycles> {
+        if let Some(start) = self.start.as_mut() {
+            if start.address == address && !self.stored && start.registers == *registers {
+                let iteration = cycles.saturating_sub(start.cycles);
+                start.cycles = cycles;
+                return (!iteration.is_zero()).then_some(iteration);
+            }
+        }
+
+        self.stored = false;
+        self.start = Some(LoopStart {
+            address,
+            registers: registers.clone(),
+            cycles,
+        });
+        None
+    }
+}
+
+#[cfg(test)]
+mod test {
+    use crate::{clock::Cycles, CpuMode, Registers};
+
+    use super::IdleLoopDetector;
+
+    #[test]
+    fn test_repeated_state_is_idle() {
+        let registers = Registers::new(CpuMode::System);
+        let mut detector = IdleLoopDetector::default();
+        assert_eq!(
+            detector.check(0x108, 0x100, &registers, Cycles::from(10)),
+            None
+        );
+        assert_eq!(
+            detector.check(0x108, 0x100, &registers, Cycles::from(16)),
+            Some(Cycles::from(6))
+        );
+    }
+
+    #[test]
+    fn test_changed_registers_are_not_idle() {
+        let mut registers = Registers::new(CpuMode::System);
+        let mut detector = IdleLoopDetector::default();
+        detector.check(0x108, 0x100, &registers, Cycles::from(10));
+        registers.write(0, 1);
+        assert_eq!(
+            detector.check(0x108, 0x100, &registers, Cycles::from(16)),
+            None
+        );
+    }
+
+    #[test]
+    fn test_stores_are_not_idle() {
+        let registers = Registers::new(CpuMode::System);
+        let mut detector = IdleLoopDetector::default();
+        detector.check(0x108, 0x100, &registers, Cycles::from(10));
+        detector.store();
+        assert_eq!(
+            detector.check(0x108, 0x100, &registers, Cycles::from(16)),
+            None
+        );
+        assert_eq!(
+            detector.check(0x108, 0x100, &registers, Cycles::from(22)),
+            Some(Cycles::from(6))
+        );
+    }
+
+    #[test]
+    fn test_long_and_forward_jumps_are_ignored() {
+        let registers = Registers::new(CpuMode::System);
+        let mut detector = IdleLoopDetector::default();
+        for cycles in [10, 16] {
+            assert_eq!(
+                detector.check(0x200, 0x100, &registers, Cycles::from(cycles)),
+                None
+            );
+            assert_eq!(
+                detector.check(0x100, 0x108, &registers, Cycles::from(cycles)),
+                None
+            );
+        }
+    }
+}
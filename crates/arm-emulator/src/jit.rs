@@ -0,0 +1,423 @@
+//! An experimental x86-64 backend for the block cache, enabled with the `jit` feature.
+//!
+//! Only runs of ARM data processing instructions that take an immediate or a register
+//! shifted by an immediate and don't read or write the PC are compiled, since those never
+//! touch memory, can't leave their block and always take one cycle. Everything else in a
+//! block is still run by the interpreter, which also does the timing and the pipeline for
+//! compiled instructions so that they run at the same cycles that they would have without
+//! this. ADC, SBC and RSC are left to the interpreter as well.
+//!
+//! The generated code doesn't use the stack and only touches caller-saved registers, so a
+//! run can be entered at any of its instructions. It takes a pointer to the general purpose
+//! registers in `rdi` and a pointer to the N, Z, C and V flags, packed the way that they are
+//! in the CPSR, in `rsi`.
+
+use std::ptr::NonNull;
+
+use crate::{
+    block::CachedInstr,
+    cpu::check_condition,
+    registers::{CpuMode, Registers},
+};
+
+type RunFn = unsafe extern "sysv64" fn(*mut u32, *mut u32);
+
+const SETC_R8B: [u8; 4] = [0x41, 0x0F, 0x92, 0xC0];
+
+/// Where the code for an instruction starts and the index of the first instruction after
+/// the run that it is in. `end` is zero for instructions that weren't compiled.
+#[derive(Clone, Copy, Default)]
+struct Entry {
+    offset: u32,
+    end: u16,
+}
+
+/// Native code for the runs of compilable instructions in a block.
+pub(crate) struct CompiledBlock {
+    code: ExecutableMemory,
+    entries: Box<[Entry]>,
+}
+
+impl CompiledBlock {
+    /// Compiles an ARM block. The last two instructions are never compiled because their
+    /// successors have to be fetched from memory. Returns `None` if there is nothing else
+    /// to compile.
+    pub fn compile(instrs: &[CachedInstr]) -> Option<CompiledBlock> {
+        let compiled = instrs.len().saturating_sub(2);
+        let mut entries = vec![Entry::default(); instrs.len()].into_boxed_slice();
+        let mut code = Vec::new();
+        let mut index = 0;
+        while index < compiled {
+            if !compilable(&instrs[index]) {
+                index += 1;
+                continue;
+            }
+            let start = index;
+            while index < compiled && compilable(&instrs[index]) {
+                entries[index].offset = code.len() as u32;
+                emit_instr(&mut code, instrs[index].opcode);
+                index += 1;
+            }
+            code.push(0xC3); // ret
+            for entry in &mut entries[start..index] {
+                entry.end = index as u16;
+            }
+        }
+
+        if code.is_empty() {
+            return None;
+        }
+        Some(CompiledBlock {
+            code: ExecutableMemory::new(&code)?,
+            entries,
+        })
+    }
+
+    /// The index of the first instruction after the compiled run that `index` is in, or
+    /// `index` if it wasn't compiled.
+    #[inline(always)]
+    pub fn run_end(&self, index: usize) -> usize {
+        match self.entries[index].end {
+            0 => index,
+            end => end as usize,
+        }
+    }
+
+    /// Runs the instructions from `index` up to [`CompiledBlock::run_end`].
+    ///
+    /// # Safety
+    ///
+    /// `index` has to be an instruction that was compiled.
+    #[inline(always)]
+    pub unsafe fn run(&self, index: usize, registers: &mut Registers) {
+        let mut flags = registers.condition_flags();
+        // SAFETY: every compiled instruction's code is followed by the rest of its run and a
+        //         `ret`, and only reads and writes the two pointers that are passed to it.
+        unsafe {
+            let entry = self
+                .code
+                .ptr
+                .as_ptr()
+                .add(self.entries[index].offset as usize);
+            let run: RunFn = std::mem::transmute(entry);
+            run(registers.gp_registers_mut().as_mut_ptr(), &mut flags);
+        }
+        registers.write_condition_flags(flags);
+    }
+}
+
+/// Data processing instructions other than ADC, SBC and RSC with an immediate or a register
+/// shifted by an immediate as their second operand, that don't use the PC.
+fn compilable(instr: &CachedInstr) -> bool {
+    let opcode = instr.opcode;
+    let immediate = opcode & 0x0200_0000 != 0;
+    let operation = (opcode >> 21) & 0xF;
+    !instr.touches_memory
+        && opcode & 0x0C00_0000 == 0
+        // This also leaves out the multiplies, which are register shifts by a register.
+        && (immediate || opcode & 0x10 == 0)
+        && !(0x5..=0x7).contains(&operation)
+        && (opcode >> 16) & 0xF != 15
+        && (immediate || opcode & 0xF != 15)
+}
+
+/// Bit `nzcv` is set for each value of the flags that `cond` passes for.
+fn condition_mask(cond: u32) -> u32 {
+    let mut registers = Registers::new(CpuMode::User);
+    (0..16).fold(0, |mask, nzcv| {
+        registers.write_cpsr((nzcv << 28) | CpuMode::User.bits());
+        mask | ((check_condition(cond, &registers) as u32) << nzcv)
+    })
+}
+
+/// Emits the code for one instruction that [`compilable`] accepted. The second operand is
+/// put into `ecx`, the first into `eax` and the result into `edx`. The flags are collected
+/// into `al` (N), `cl` (Z), `r8b` (C) and `r9b` (V) before being packed.
+fn emit_instr(code: &mut Vec<u8>, opcode: u32) {
+    let mut body = Vec::new();
+    let operation = (opcode >> 21) & 0xF;
+    let set_flags = opcode & 0x0010_0000 != 0;
+    let arithmetic = matches!(operation, 0x2 | 0x3 | 0x4 | 0xA | 0xB);
+    let rd = (opcode >> 12) & 0xF;
+    let rn = (opcode >> 16) & 0xF;
+
+    if !matches!(operation, 0xD | 0xF) {
+        body.extend([0x8B, 0x47, (rn * 4) as u8]); // mov eax, [rdi + rn*4]
+    }
+
+    // The interpreter only takes C from the shifter for shifts that have a carry out, and
+    // never for an immediate, so those are the only ones that set `r8b` here.
+    let mut carry_set = false;
+    if opcode & 0x0200_0000 != 0 {
+        let immediate = (opcode & 0xFF).rotate_right(((opcode >> 8) & 0xF) * 2);
+        body.push(0xB9); // mov ecx, imm32
+        body.extend(immediate.to_le_bytes());
+    } else {
+        let rm = opcode & 0xF;
+        let shift = (opcode >> 5) & 0x3;
+        let amount = ((opcode >> 7) & 0x1F) as u8;
+        body.extend([0x8B, 0x4F, (rm * 4) as u8]); // mov ecx, [rdi + rm*4]
+        match (shift, amount) {
+            (0b00, 0) => {}
+            (0b01 | 0b10, 0) => {
+                // LSR #32 and ASR #32, which carry out bit 31.
+                body.extend([0x0F, 0xBA, 0xE1, 31]); // bt ecx, 31
+                body.extend(SETC_R8B);
+                if shift == 0b01 {
+                    body.extend([0x31, 0xC9]); // xor ecx, ecx
+                } else {
+                    body.extend([0xC1, 0xF9, 31]); // sar ecx, 31
+                }
+                carry_set = true;
+            }
+            _ => {
+                if (shift, amount) == (0b11, 0) {
+                    // RRX
+                    body.extend([0x0F, 0xBA, 0x26, 29]); // bt dword [rsi], 29
+                    body.extend([0xD1, 0xD9]); // rcr ecx, 1
+                } else {
+                    // shl, shr, sar or ror ecx, amount
+                    body.extend([0xC1, [0xE1, 0xE9, 0xF9, 0xC9][shift as usize], amount]);
+                }
+                // These all leave their carry out in CF.
+                body.extend(SETC_R8B);
+                carry_set = true;
+            }
+        }
+    }
+
+    match operation {
+        0x0 | 0x8 => body.extend([0x89, 0xC2, 0x21, 0xCA]), // mov edx, eax; and edx, ecx
+        0x1 | 0x9 => body.extend([0x89, 0xC2, 0x31, 0xCA]), // mov edx, eax; xor edx, ecx
+        0x2 | 0xA => body.extend([0x89, 0xC2, 0x29, 0xCA]), // mov edx, eax; sub edx, ecx
+        0x3 => body.extend([0x89, 0xCA, 0x29, 0xC2]),       // mov edx, ecx; sub edx, eax
+        0x4 | 0xB => body.extend([0x89, 0xC2, 0x01, 0xCA]), // mov edx, eax; add edx, ecx
+        0xC => body.extend([0x89, 0xC2, 0x09, 0xCA]),       // mov edx, eax; or edx, ecx
+        0xD => body.extend([0x89, 0xCA]),                   // mov edx, ecx
+        0xE => body.extend([0x89, 0xCA, 0xF7, 0xD2, 0x21, 0xC2]), // mov edx, ecx; not edx; and edx, eax
+        _ => body.extend([0x89, 0xCA, 0xF7, 0xD2]),               // mov edx, ecx; not edx
+    }
+
+    if set_flags {
+        if arithmetic {
+            body.extend([0x0F, 0x98, 0xC0]); // sets al
+            body.extend([0x0F, 0x94, 0xC1]); // setz cl
+                                             // ARM's carry for a subtraction is the inverse of x86's borrow.
+            let subtraction = matches!(operation, 0x2 | 0x3 | 0xA);
+            body.extend([0x41, 0x0F, if subtraction { 0x93 } else { 0x92 }, 0xC0]); // setnc/setc r8b
+            body.extend([0x41, 0x0F, 0x90, 0xC1]); // seto r9b
+        } else {
+            body.extend([0x85, 0xD2]); // test edx, edx
+            body.extend([0x0F, 0x98, 0xC0]); // sets al
+            body.extend([0x0F, 0x94, 0xC1]); // setz cl
+            if !carry_set {
+                body.extend([0x0F, 0xBA, 0x26, 29]); // bt dword [rsi], 29
+                body.extend(SETC_R8B);
+            }
+            body.extend([0x0F, 0xBA, 0x26, 28]); // bt dword [rsi], 28
+            body.extend([0x41, 0x0F, 0x92, 0xC1]); // setc r9b
+        }
+        body.extend([
+            0x0F, 0xB6, 0xC0, // movzx eax, al
+            0x0F, 0xB6, 0xC9, // movzx ecx, cl
+            0x45, 0x0F, 0xB6, 0xC0, // movzx r8d, r8b
+            0x45, 0x0F, 0xB6, 0xC9, // movzx r9d, r9b
+            0xC1, 0xE0, 3, // shl eax, 3
+            0xC1, 0xE1, 2, // shl ecx, 2
+            0x41, 0xD1, 0xE0, // shl r8d, 1
+            0x09, 0xC8, // or eax, ecx
+            0x44, 0x09, 0xC0, // or eax, r8d
+            0x44, 0x09, 0xC8, // or eax, r9d
+            0xC1, 0xE0, 28, // shl eax, 28
+            0x89, 0x06, // mov [rsi], eax
+        ]);
+    }
+
+    if !(0x8..=0xB).contains(&operation) {
+        body.extend([0x89, 0x57, (rd * 4) as u8]); // mov [rdi + rd*4], edx
+    }
+
+    let cond = opcode >> 28;
+    if cond != 0xE {
+        code.extend([0x8B, 0x06]); // mov eax, [rsi]
+        code.extend([0xC1, 0xE8, 28]); // shr eax, 28
+        code.push(0xB9); // mov ecx, imm32
+        code.extend(condition_mask(cond).to_le_bytes());
+        code.extend([0x0F, 0xA3, 0xC1]); // bt ecx, eax
+        code.extend([0x0F, 0x83]); // jnc rel32
+        code.extend((body.len() as u32).to_le_bytes());
+    }
+    code.extend(body);
+}
+
+/// A read-only and executable copy of some code.
+struct ExecutableMemory {
+    ptr: NonNull<u8>,
+    len: usize,
+}
+
+impl ExecutableMemory {
+    fn new(code: &[u8]) -> Option<ExecutableMemory> {
+        // SAFETY: the mapping is only made executable after the code has been copied into
+        //         it, and it is only unmapped when this is dropped.
+        unsafe {
+            let ptr = libc::mmap(
+                std::ptr::null_mut(),
+                code.len(),
+                libc::PROT_READ | libc::PROT_WRITE,
+                libc::MAP_PRIVATE | libc::MAP_ANONYMOUS,
+                -1,
+                0,
+            );
+            if ptr == libc::MAP_FAILED {
+                return None;
+            }
+            let memory = ExecutableMemory {
+                ptr: NonNull::new_unchecked(ptr as *mut u8),
+                len: code.len(),
+            };
+            std::ptr::copy_nonoverlapping(code.as_ptr(), memory.ptr.as_ptr(), code.len());
+            if libc::mprotect(ptr, code.len(), libc::PROT_READ | libc::PROT_EXEC) != 0 {
+                return None;
+            }
+            Some(memory)
+        }
+    }
+}
+
+impl Drop for ExecutableMemory {
+    fn drop(&mut self) {
+        // SAFETY: this is the whole region that was mapped in `ExecutableMemory::new`.
+        unsafe { libc::munmap(self.ptr.as_ptr() as *mut libc::c_void, self.len) };
+    }
+}
+
+// SAFETY: the memory is never written to after it is created.
+unsafe impl Send for ExecutableMemory {}
+unsafe impl Sync for ExecutableMemory {}
+
+#[cfg(test)]
+mod test {
+    use super::CompiledBlock;
+    use crate::{block::CachedInstr, registers::CpuMode, Registers};
+
+    /// Runs `opcodes` compiled and interpreted from the same registers and checks that they
+    /// end up the same.
+    fn assert_same_as_interpreter(opcodes: &[u32], setup: impl Fn(&mut Registers)) {
+        let mut instrs: Vec<_> = opcodes
+            .iter()
+            .map(|&opcode| CachedInstr::decode(opcode, false))
+            .collect();
+        // The last two instructions are never compiled.
+        instrs.extend([CachedInstr::decode(0xE1A00000, false); 2]);
+        let compiled = CompiledBlock::compile(&instrs).unwrap();
+        assert_eq!(compiled.run_end(0), opcodes.len());
+
+        for flags in 0..16 {
+            let mut registers = Registers::new(CpuMode::System);
+            registers.write_cpsr((flags << 28) | CpuMode::System.bits());
+            setup(&mut registers);
+
+            let mut cpu = crate::Cpu::uninitialized(crate::InstructionSet::Arm, CpuMode::System);
+            cpu.registers = registers.clone();
+            let mut memory = NoMemory;
+            for instr in &instrs[..opcodes.len()] {
+                if crate::cpu::check_condition(instr.cond, &cpu.registers) {
+                    (instr.exec)(instr.opcode, &mut cpu, &mut memory);
+                }
+            }
+
+            // SAFETY: the first instruction was compiled.
+            unsafe { compiled.run(0, &mut registers) };
+            assert!(
+                registers == cpu.registers,
+                "flags = {flags:04b}, {opcodes:08X?}: {:08X} != {:08X}",
+                registers.read_cpsr(),
+                cpu.registers.read_cpsr()
+            );
+        }
+    }
+
+    struct NoMemory;
+
+    impl crate::Memory for NoMemory {
+        fn load8(&mut self, _address: u32, _cpu: &mut crate::Cpu) -> (u8, crate::Waitstates) {
+            unreachable!()
+        }
+
+        fn store8(
+            &mut self,
+            _address: u32,
+            _value: u8,
+            _cpu: &mut crate::Cpu,
+        ) -> crate::Waitstates {
+            unreachable!()
+        }
+
+        fn as_any(&self) -> &dyn std::any::Any {
+            self
+        }
+
+        fn as_mut_any(&mut self) -> &mut dyn std::any::Any {
+            self
+        }
+    }
+
+    #[test]
+    fn test_operations_match_interpreter() {
+        let operands = [0, 1, 0x7FFFFFFF, 0x80000000, 0xFFFFFFFF, 0x12345678];
+        for operation in (0x0..=0xF).filter(|operation| !(0x5..=0x7).contains(operation)) {
+            for s in [0, 1] {
+                if (0x8..=0xB).contains(&operation) && s == 0 {
+                    continue;
+                }
+                for shift in [0x000, 0x080, 0x020, 0x7A0, 0x040, 0x0C0, 0x060, 0x3E0] {
+                    // <op>{s} r0, r1, r2, <shift>
+                    let opcode = 0xE0000002 | (operation << 21) | (s << 20) | 0x10000 | shift;
+                    for (&lhs, &rhs) in operands.iter().zip(operands.iter().rev()) {
+                        assert_same_as_interpreter(&[opcode], |registers| {
+                            registers.write(1, lhs);
+                            registers.write(2, rhs);
+                        });
+                    }
+                }
+                // <op>{s} r0, r1, #0xFF000000
+                let opcode = 0xE20104FF | (operation << 21) | (s << 20);
+                for &lhs in &operands {
+                    assert_same_as_interpreter(&[opcode], |registers| registers.write(1, lhs));
+                }
+            }
+        }
+    }
+
+    #[test]
+    fn test_conditions_match_interpreter() {
+        for cond in 0x0..=0xE {
+            // subs r0, r0, #1; add<cond> r1, r1, #1; movs<cond> r2, r0, lsl #1
+            let opcodes = [
+                0xE2500001,
+                0x02811001 | (cond << 28),
+                0x01B02080 | (cond << 28),
+            ];
+            for value in [0, 1, 2, 0x80000000, 0x80000001] {
+                assert_same_as_interpreter(&opcodes, |registers| registers.write(0, value));
+            }
+        }
+    }
+
+    #[test]
+    fn test_only_register_instructions_are_compiled() {
+        let compiled = |opcode| {
+            let instrs =
+                [opcode, 0xE1A00000, 0xE1A00000].map(|opcode| CachedInstr::decode(opcode, false));
+            CompiledBlock::compile(&instrs).is_some()
+        };
+        assert!(compiled(0xE0800001)); // add r0, r0, r1
+        assert!(compiled(0xE1B00140)); // asrs r0, r0, #2
+        assert!(!compiled(0xE0A00001)); // adc r0, r0, r1
+        assert!(!compiled(0xE0800211)); // add r0, r0, r1, lsl r2
+        assert!(!compiled(0xE08F0001)); // add r0, pc, r1
+        assert!(!compiled(0xE0000291)); // mul r0, r1, r2
+        assert!(!compiled(0xE5900000)); // ldr r0, [r0]
+    }
+}
@@ -1,17 +1,22 @@
 mod alu;
 mod arm;
+mod block;
 mod clock;
 mod cpu;
 mod exception;
+mod idle;
+#[cfg(all(feature = "jit", target_arch = "x86_64", unix))]
+mod jit;
 mod lookup;
 mod memory;
 mod registers;
 mod thumb;
+pub mod trace;
 mod transfer;
 
 pub use alu::{ArithmeticShr, RotateRightExtended};
 pub use clock::{Cycles, Waitstates};
-pub use cpu::{Cpu, InstructionSet};
+pub use cpu::{Cpu, CpuCounters, CpuState, InstructionSet};
 pub use exception::{CpuException, ExceptionHandler, ExceptionHandlerResult};
-pub use memory::{AccessType, Memory};
+pub use memory::{AccessType, CodeTiming, Memory, SkippedFetches};
 pub use registers::{CpsrFlag, CpuMode, Registers};
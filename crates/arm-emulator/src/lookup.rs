@@ -1,18 +1,30 @@
-// GENERATED BY scripts/generate-lookup-tables.py
+//! Tables mapping opcodes to the functions that execute them.
+//!
+//! The tables are built by the `const fn`s below while the crate is compiled, so every entry
+//! is a fully monomorphized instruction function and nothing has to be decoded at runtime
+//! other than the table index.
+
 use super::cpu::InstrFn;
 use super::{alu, arm, thumb};
 use crate::alu::{
-    ConstReg, RegAt, RegAtValue, RegValue, ThumbRegisterList, ThumbRegisterListWithLr,
+    BinaryOp, ConstReg, RegAt, RegAtValue, RegValue, ThumbRegisterList, ThumbRegisterListWithLr,
     ThumbRegisterListWithPc, WordAlignedPc,
 };
 use crate::transfer::{
-    HalfwordAndSignedImmOffset, HalfwordAndSignedRegOffset, Ldm, Ldr, Ldrb, Ldrh, Ldrsb, Ldrsh,
-    PostDecrement, PostIncrement, PreDecrement, PreIncrement, SDTImmOffset, Stm, Str, Strb, Strh,
-    ThumbImm5, ThumbImm5ExtendedTo6, ThumbImm5ExtendedTo7, ThumbImm8ExtendedTo10,
-    ThumbRegisterOffset,
+    BlockDataTransfer, HalfwordAndSignedImmOffset, HalfwordAndSignedRegOffset, IndexingMode, Ldm,
+    Ldr, Ldrb, Ldrh, Ldrsb, Ldrsh, PostDecrement, PostIncrement, PreDecrement, PreIncrement,
+    SDTCalculateOffset, SDTImmOffset, SingleDataTransfer, Stm, Str, Strb, Strh, ThumbImm5,
+    ThumbImm5ExtendedTo6, ThumbImm5ExtendedTo7, ThumbImm8ExtendedTo10, ThumbRegisterOffset,
 };
 use util::bits::BitOps as _;
 
+/// Indexed by bits 20-27 and 4-7 of the opcode.
+static ARM_OPCODE_TABLE: [InstrFn; 4096] = build_arm_table();
+
+/// Indexed by bits 6-15 of the opcode. Bits 6-9 are only needed by the ALU and hi register
+/// operations, which have their operation and the high bits of their registers there.
+static THUMB_OPCODE_TABLE: [InstrFn; 1024] = build_thumb_table();
+
 pub fn decode_arm_opcode(opcode: u32) -> InstrFn {
     let opcode_row = opcode.get_bit_range(20..=27);
     let opcode_col = opcode.get_bit_range(4..=7);
@@ -21,9 +33,7 @@ pub fn decode_arm_opcode(opcode: u32) -> InstrFn {
 }
 
 pub fn decode_thumb_opcode(opcode: u32) -> InstrFn {
-    let opcode_row = opcode.get_bit_range(12..=15);
-    let opcode_col = opcode.get_bit_range(8..=11);
-    let opcode_idx = (opcode_row * 16) + opcode_col;
+    let opcode_idx = opcode.get_bit_range(6..=15);
     THUMB_OPCODE_TABLE[opcode_idx as usize]
 }
 
@@ -35,4381 +45,496 @@ const SIGNED: bool = true;
 const UNSIGNED: bool = false;
 const WRITEBACK: bool = true;
 const NO_WRITEBACK: bool = false;
-const FORCE_USER_MODE: bool = false;
 const SWP_WORD: bool = false;
 const SWP_BYTE: bool = true;
 
-const COND_EQ: u32 = 0x0;
-const COND_NE: u32 = 0x1;
-const COND_CS: u32 = 0x2;
-const COND_CC: u32 = 0x3;
-const COND_MI: u32 = 0x4;
-const COND_PL: u32 = 0x5;
-const COND_VS: u32 = 0x6;
-const COND_VC: u32 = 0x7;
-const COND_HI: u32 = 0x8;
-const COND_LS: u32 = 0x9;
-const COND_GE: u32 = 0xA;
-const COND_LT: u32 = 0xB;
-const COND_GT: u32 = 0xC;
-const COND_LE: u32 = 0xD;
+const fn build_arm_table() -> [InstrFn; 4096] {
+    let mut table: [InstrFn; 4096] = [arm::arm_undefined; 4096];
+    let mut index = 0;
+    while index < table.len() {
+        table[index] = arm_entry(index as u32 >> 4, index as u32 & 0xF);
+        index += 1;
+    }
+    table
+}
+
+const fn build_thumb_table() -> [InstrFn; 1024] {
+    let mut table: [InstrFn; 1024] = [thumb::thumb_undefined; 1024];
+    let mut index = 0;
+    while index < table.len() {
+        table[index] = thumb_entry((index as u32) << 6);
+        index += 1;
+    }
+    table
+}
+
+/// `row` is bits 20-27 and `col` is bits 4-7 of the opcode.
+const fn arm_entry(row: u32, col: u32) -> InstrFn {
+    match row >> 5 {
+        0b000 if col == 0b1001 => arm_multiply_or_swap(row),
+        0b000 if col & 0b1001 == 0b1001 => arm_halfword_transfer(row, col),
+        // TST, TEQ, CMP and CMN without the S flag set.
+        0b000 if row & 0b11001 == 0b10000 => arm_misc(row, col),
+        0b000 => arm_dataproc(row, Operand2::from_col(col)),
+
+        0b001 if row & 0b11001 == 0b10000 => match row {
+            0x32 => arm::arm_msr::<alu::Cpsr, alu::ImmOp2>,
+            0x36 => arm::arm_msr::<alu::Spsr, alu::ImmOp2>,
+            _ => arm::arm_undefined,
+        },
+        0b001 => arm_dataproc(row, Operand2::Imm),
 
-#[rustfmt::skip]
-pub const ARM_OPCODE_TABLE: [InstrFn; 4096] = [
-    arm::arm_dataproc::<alu::AndOp, S_FLAG_CLR, alu::LliOp2>,
-    arm::arm_dataproc::<alu::AndOp, S_FLAG_CLR, alu::LlrOp2>,
-    arm::arm_dataproc::<alu::AndOp, S_FLAG_CLR, alu::LriOp2>,
-    arm::arm_dataproc::<alu::AndOp, S_FLAG_CLR, alu::LrrOp2>,
-    arm::arm_dataproc::<alu::AndOp, S_FLAG_CLR, alu::AriOp2>,
-    arm::arm_dataproc::<alu::AndOp, S_FLAG_CLR, alu::ArrOp2>,
-    arm::arm_dataproc::<alu::AndOp, S_FLAG_CLR, alu::RriOp2>,
-    arm::arm_dataproc::<alu::AndOp, S_FLAG_CLR, alu::RrrOp2>,
-    arm::arm_dataproc::<alu::AndOp, S_FLAG_CLR, alu::LliOp2>,
-    arm::arm_mul::<S_FLAG_CLR, A_FLAG_CLR>,
-    arm::arm_dataproc::<alu::AndOp, S_FLAG_CLR, alu::LriOp2>,
-    arm::arm_single_data_transfer::<Strh, HalfwordAndSignedRegOffset, PostDecrement, WRITEBACK>,
-    arm::arm_dataproc::<alu::AndOp, S_FLAG_CLR, alu::AriOp2>,
-    arm::arm_m_extension_undefined,
-    arm::arm_dataproc::<alu::AndOp, S_FLAG_CLR, alu::RriOp2>,
-    arm::arm_m_extension_undefined,
-    arm::arm_dataproc::<alu::AndOp, S_FLAG_SET, alu::LliOp2>,
-    arm::arm_dataproc::<alu::AndOp, S_FLAG_SET, alu::LlrOp2>,
-    arm::arm_dataproc::<alu::AndOp, S_FLAG_SET, alu::LriOp2>,
-    arm::arm_dataproc::<alu::AndOp, S_FLAG_SET, alu::LrrOp2>,
-    arm::arm_dataproc::<alu::AndOp, S_FLAG_SET, alu::AriOp2>,
-    arm::arm_dataproc::<alu::AndOp, S_FLAG_SET, alu::ArrOp2>,
-    arm::arm_dataproc::<alu::AndOp, S_FLAG_SET, alu::RriOp2>,
-    arm::arm_dataproc::<alu::AndOp, S_FLAG_SET, alu::RrrOp2>,
-    arm::arm_dataproc::<alu::AndOp, S_FLAG_SET, alu::LliOp2>,
-    arm::arm_mul::<S_FLAG_SET, A_FLAG_CLR>,
-    arm::arm_dataproc::<alu::AndOp, S_FLAG_SET, alu::LriOp2>,
-    arm::arm_single_data_transfer::<Ldrh, HalfwordAndSignedRegOffset, PostDecrement, WRITEBACK>,
-    arm::arm_dataproc::<alu::AndOp, S_FLAG_SET, alu::AriOp2>,
-    arm::arm_single_data_transfer::<Ldrsb, HalfwordAndSignedRegOffset, PostDecrement, WRITEBACK>,
-    arm::arm_dataproc::<alu::AndOp, S_FLAG_SET, alu::RriOp2>,
-    arm::arm_single_data_transfer::<Ldrsh, HalfwordAndSignedRegOffset, PostDecrement, WRITEBACK>,
-    arm::arm_dataproc::<alu::EorOp, S_FLAG_CLR, alu::LliOp2>,
-    arm::arm_dataproc::<alu::EorOp, S_FLAG_CLR, alu::LlrOp2>,
-    arm::arm_dataproc::<alu::EorOp, S_FLAG_CLR, alu::LriOp2>,
-    arm::arm_dataproc::<alu::EorOp, S_FLAG_CLR, alu::LrrOp2>,
-    arm::arm_dataproc::<alu::EorOp, S_FLAG_CLR, alu::AriOp2>,
-    arm::arm_dataproc::<alu::EorOp, S_FLAG_CLR, alu::ArrOp2>,
-    arm::arm_dataproc::<alu::EorOp, S_FLAG_CLR, alu::RriOp2>,
-    arm::arm_dataproc::<alu::EorOp, S_FLAG_CLR, alu::RrrOp2>,
-    arm::arm_dataproc::<alu::EorOp, S_FLAG_CLR, alu::LliOp2>,
-    arm::arm_mul::<S_FLAG_CLR, A_FLAG_SET>,
-    arm::arm_dataproc::<alu::EorOp, S_FLAG_CLR, alu::LriOp2>,
-    arm::arm_single_data_transfer::<Strh, HalfwordAndSignedRegOffset, PostDecrement, WRITEBACK>,
-    arm::arm_dataproc::<alu::EorOp, S_FLAG_CLR, alu::AriOp2>,
-    arm::arm_m_extension_undefined,
-    arm::arm_dataproc::<alu::EorOp, S_FLAG_CLR, alu::RriOp2>,
-    arm::arm_m_extension_undefined,
-    arm::arm_dataproc::<alu::EorOp, S_FLAG_SET, alu::LliOp2>,
-    arm::arm_dataproc::<alu::EorOp, S_FLAG_SET, alu::LlrOp2>,
-    arm::arm_dataproc::<alu::EorOp, S_FLAG_SET, alu::LriOp2>,
-    arm::arm_dataproc::<alu::EorOp, S_FLAG_SET, alu::LrrOp2>,
-    arm::arm_dataproc::<alu::EorOp, S_FLAG_SET, alu::AriOp2>,
-    arm::arm_dataproc::<alu::EorOp, S_FLAG_SET, alu::ArrOp2>,
-    arm::arm_dataproc::<alu::EorOp, S_FLAG_SET, alu::RriOp2>,
-    arm::arm_dataproc::<alu::EorOp, S_FLAG_SET, alu::RrrOp2>,
-    arm::arm_dataproc::<alu::EorOp, S_FLAG_SET, alu::LliOp2>,
-    arm::arm_mul::<S_FLAG_SET, A_FLAG_SET>,
-    arm::arm_dataproc::<alu::EorOp, S_FLAG_SET, alu::LriOp2>,
-    arm::arm_single_data_transfer::<Ldrh, HalfwordAndSignedRegOffset, PostDecrement, WRITEBACK>,
-    arm::arm_dataproc::<alu::EorOp, S_FLAG_SET, alu::AriOp2>,
-    arm::arm_single_data_transfer::<Ldrsb, HalfwordAndSignedRegOffset, PostDecrement, WRITEBACK>,
-    arm::arm_dataproc::<alu::EorOp, S_FLAG_SET, alu::RriOp2>,
-    arm::arm_single_data_transfer::<Ldrsh, HalfwordAndSignedRegOffset, PostDecrement, WRITEBACK>,
-    arm::arm_dataproc::<alu::SubOp, S_FLAG_CLR, alu::LliOp2>,
-    arm::arm_dataproc::<alu::SubOp, S_FLAG_CLR, alu::LlrOp2>,
-    arm::arm_dataproc::<alu::SubOp, S_FLAG_CLR, alu::LriOp2>,
-    arm::arm_dataproc::<alu::SubOp, S_FLAG_CLR, alu::LrrOp2>,
-    arm::arm_dataproc::<alu::SubOp, S_FLAG_CLR, alu::AriOp2>,
-    arm::arm_dataproc::<alu::SubOp, S_FLAG_CLR, alu::ArrOp2>,
-    arm::arm_dataproc::<alu::SubOp, S_FLAG_CLR, alu::RriOp2>,
-    arm::arm_dataproc::<alu::SubOp, S_FLAG_CLR, alu::RrrOp2>,
-    arm::arm_dataproc::<alu::SubOp, S_FLAG_CLR, alu::LliOp2>,
-    arm::arm_undefined,
-    arm::arm_dataproc::<alu::SubOp, S_FLAG_CLR, alu::LriOp2>,
-    arm::arm_single_data_transfer::<Strh, HalfwordAndSignedImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_dataproc::<alu::SubOp, S_FLAG_CLR, alu::AriOp2>,
-    arm::arm_m_extension_undefined,
-    arm::arm_dataproc::<alu::SubOp, S_FLAG_CLR, alu::RriOp2>,
-    arm::arm_m_extension_undefined,
-    arm::arm_dataproc::<alu::SubOp, S_FLAG_SET, alu::LliOp2>,
-    arm::arm_dataproc::<alu::SubOp, S_FLAG_SET, alu::LlrOp2>,
-    arm::arm_dataproc::<alu::SubOp, S_FLAG_SET, alu::LriOp2>,
-    arm::arm_dataproc::<alu::SubOp, S_FLAG_SET, alu::LrrOp2>,
-    arm::arm_dataproc::<alu::SubOp, S_FLAG_SET, alu::AriOp2>,
-    arm::arm_dataproc::<alu::SubOp, S_FLAG_SET, alu::ArrOp2>,
-    arm::arm_dataproc::<alu::SubOp, S_FLAG_SET, alu::RriOp2>,
-    arm::arm_dataproc::<alu::SubOp, S_FLAG_SET, alu::RrrOp2>,
-    arm::arm_dataproc::<alu::SubOp, S_FLAG_SET, alu::LliOp2>,
-    arm::arm_undefined,
-    arm::arm_dataproc::<alu::SubOp, S_FLAG_SET, alu::LriOp2>,
-    arm::arm_single_data_transfer::<Ldrh, HalfwordAndSignedImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_dataproc::<alu::SubOp, S_FLAG_SET, alu::AriOp2>,
-    arm::arm_single_data_transfer::<Ldrsb, HalfwordAndSignedImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_dataproc::<alu::SubOp, S_FLAG_SET, alu::RriOp2>,
-    arm::arm_single_data_transfer::<Ldrsh, HalfwordAndSignedImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_dataproc::<alu::RsbOp, S_FLAG_CLR, alu::LliOp2>,
-    arm::arm_dataproc::<alu::RsbOp, S_FLAG_CLR, alu::LlrOp2>,
-    arm::arm_dataproc::<alu::RsbOp, S_FLAG_CLR, alu::LriOp2>,
-    arm::arm_dataproc::<alu::RsbOp, S_FLAG_CLR, alu::LrrOp2>,
-    arm::arm_dataproc::<alu::RsbOp, S_FLAG_CLR, alu::AriOp2>,
-    arm::arm_dataproc::<alu::RsbOp, S_FLAG_CLR, alu::ArrOp2>,
-    arm::arm_dataproc::<alu::RsbOp, S_FLAG_CLR, alu::RriOp2>,
-    arm::arm_dataproc::<alu::RsbOp, S_FLAG_CLR, alu::RrrOp2>,
-    arm::arm_dataproc::<alu::RsbOp, S_FLAG_CLR, alu::LliOp2>,
-    arm::arm_undefined,
-    arm::arm_dataproc::<alu::RsbOp, S_FLAG_CLR, alu::LriOp2>,
-    arm::arm_single_data_transfer::<Strh, HalfwordAndSignedImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_dataproc::<alu::RsbOp, S_FLAG_CLR, alu::AriOp2>,
-    arm::arm_m_extension_undefined,
-    arm::arm_dataproc::<alu::RsbOp, S_FLAG_CLR, alu::RriOp2>,
-    arm::arm_m_extension_undefined,
-    arm::arm_dataproc::<alu::RsbOp, S_FLAG_SET, alu::LliOp2>,
-    arm::arm_dataproc::<alu::RsbOp, S_FLAG_SET, alu::LlrOp2>,
-    arm::arm_dataproc::<alu::RsbOp, S_FLAG_SET, alu::LriOp2>,
-    arm::arm_dataproc::<alu::RsbOp, S_FLAG_SET, alu::LrrOp2>,
-    arm::arm_dataproc::<alu::RsbOp, S_FLAG_SET, alu::AriOp2>,
-    arm::arm_dataproc::<alu::RsbOp, S_FLAG_SET, alu::ArrOp2>,
-    arm::arm_dataproc::<alu::RsbOp, S_FLAG_SET, alu::RriOp2>,
-    arm::arm_dataproc::<alu::RsbOp, S_FLAG_SET, alu::RrrOp2>,
-    arm::arm_dataproc::<alu::RsbOp, S_FLAG_SET, alu::LliOp2>,
-    arm::arm_undefined,
-    arm::arm_dataproc::<alu::RsbOp, S_FLAG_SET, alu::LriOp2>,
-    arm::arm_single_data_transfer::<Ldrh, HalfwordAndSignedImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_dataproc::<alu::RsbOp, S_FLAG_SET, alu::AriOp2>,
-    arm::arm_single_data_transfer::<Ldrsb, HalfwordAndSignedImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_dataproc::<alu::RsbOp, S_FLAG_SET, alu::RriOp2>,
-    arm::arm_single_data_transfer::<Ldrsh, HalfwordAndSignedImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_dataproc::<alu::AddOp, S_FLAG_CLR, alu::LliOp2>,
-    arm::arm_dataproc::<alu::AddOp, S_FLAG_CLR, alu::LlrOp2>,
-    arm::arm_dataproc::<alu::AddOp, S_FLAG_CLR, alu::LriOp2>,
-    arm::arm_dataproc::<alu::AddOp, S_FLAG_CLR, alu::LrrOp2>,
-    arm::arm_dataproc::<alu::AddOp, S_FLAG_CLR, alu::AriOp2>,
-    arm::arm_dataproc::<alu::AddOp, S_FLAG_CLR, alu::ArrOp2>,
-    arm::arm_dataproc::<alu::AddOp, S_FLAG_CLR, alu::RriOp2>,
-    arm::arm_dataproc::<alu::AddOp, S_FLAG_CLR, alu::RrrOp2>,
-    arm::arm_dataproc::<alu::AddOp, S_FLAG_CLR, alu::LliOp2>,
-    arm::arm_mul_long::<UNSIGNED, S_FLAG_CLR, A_FLAG_CLR>,
-    arm::arm_dataproc::<alu::AddOp, S_FLAG_CLR, alu::LriOp2>,
-    arm::arm_single_data_transfer::<Strh, HalfwordAndSignedRegOffset, PostIncrement, WRITEBACK>,
-    arm::arm_dataproc::<alu::AddOp, S_FLAG_CLR, alu::AriOp2>,
-    arm::arm_m_extension_undefined,
-    arm::arm_dataproc::<alu::AddOp, S_FLAG_CLR, alu::RriOp2>,
-    arm::arm_m_extension_undefined,
-    arm::arm_dataproc::<alu::AddOp, S_FLAG_SET, alu::LliOp2>,
-    arm::arm_dataproc::<alu::AddOp, S_FLAG_SET, alu::LlrOp2>,
-    arm::arm_dataproc::<alu::AddOp, S_FLAG_SET, alu::LriOp2>,
-    arm::arm_dataproc::<alu::AddOp, S_FLAG_SET, alu::LrrOp2>,
-    arm::arm_dataproc::<alu::AddOp, S_FLAG_SET, alu::AriOp2>,
-    arm::arm_dataproc::<alu::AddOp, S_FLAG_SET, alu::ArrOp2>,
-    arm::arm_dataproc::<alu::AddOp, S_FLAG_SET, alu::RriOp2>,
-    arm::arm_dataproc::<alu::AddOp, S_FLAG_SET, alu::RrrOp2>,
-    arm::arm_dataproc::<alu::AddOp, S_FLAG_SET, alu::LliOp2>,
-    arm::arm_mul_long::<UNSIGNED, S_FLAG_SET, A_FLAG_CLR>,
-    arm::arm_dataproc::<alu::AddOp, S_FLAG_SET, alu::LriOp2>,
-    arm::arm_single_data_transfer::<Ldrh, HalfwordAndSignedRegOffset, PostIncrement, WRITEBACK>,
-    arm::arm_dataproc::<alu::AddOp, S_FLAG_SET, alu::AriOp2>,
-    arm::arm_single_data_transfer::<Ldrsb, HalfwordAndSignedRegOffset, PostIncrement, WRITEBACK>,
-    arm::arm_dataproc::<alu::AddOp, S_FLAG_SET, alu::RriOp2>,
-    arm::arm_single_data_transfer::<Ldrsh, HalfwordAndSignedRegOffset, PostIncrement, WRITEBACK>,
-    arm::arm_dataproc::<alu::AdcOp, S_FLAG_CLR, alu::LliOp2>,
-    arm::arm_dataproc::<alu::AdcOp, S_FLAG_CLR, alu::LlrOp2>,
-    arm::arm_dataproc::<alu::AdcOp, S_FLAG_CLR, alu::LriOp2>,
-    arm::arm_dataproc::<alu::AdcOp, S_FLAG_CLR, alu::LrrOp2>,
-    arm::arm_dataproc::<alu::AdcOp, S_FLAG_CLR, alu::AriOp2>,
-    arm::arm_dataproc::<alu::AdcOp, S_FLAG_CLR, alu::ArrOp2>,
-    arm::arm_dataproc::<alu::AdcOp, S_FLAG_CLR, alu::RriOp2>,
-    arm::arm_dataproc::<alu::AdcOp, S_FLAG_CLR, alu::RrrOp2>,
-    arm::arm_dataproc::<alu::AdcOp, S_FLAG_CLR, alu::LliOp2>,
-    arm::arm_mul_long::<UNSIGNED, S_FLAG_CLR, A_FLAG_SET>,
-    arm::arm_dataproc::<alu::AdcOp, S_FLAG_CLR, alu::LriOp2>,
-    arm::arm_single_data_transfer::<Strh, HalfwordAndSignedRegOffset, PostIncrement, WRITEBACK>,
-    arm::arm_dataproc::<alu::AdcOp, S_FLAG_CLR, alu::AriOp2>,
-    arm::arm_m_extension_undefined,
-    arm::arm_dataproc::<alu::AdcOp, S_FLAG_CLR, alu::RriOp2>,
-    arm::arm_m_extension_undefined,
-    arm::arm_dataproc::<alu::AdcOp, S_FLAG_SET, alu::LliOp2>,
-    arm::arm_dataproc::<alu::AdcOp, S_FLAG_SET, alu::LlrOp2>,
-    arm::arm_dataproc::<alu::AdcOp, S_FLAG_SET, alu::LriOp2>,
-    arm::arm_dataproc::<alu::AdcOp, S_FLAG_SET, alu::LrrOp2>,
-    arm::arm_dataproc::<alu::AdcOp, S_FLAG_SET, alu::AriOp2>,
-    arm::arm_dataproc::<alu::AdcOp, S_FLAG_SET, alu::ArrOp2>,
-    arm::arm_dataproc::<alu::AdcOp, S_FLAG_SET, alu::RriOp2>,
-    arm::arm_dataproc::<alu::AdcOp, S_FLAG_SET, alu::RrrOp2>,
-    arm::arm_dataproc::<alu::AdcOp, S_FLAG_SET, alu::LliOp2>,
-    arm::arm_mul_long::<UNSIGNED, S_FLAG_SET, A_FLAG_SET>,
-    arm::arm_dataproc::<alu::AdcOp, S_FLAG_SET, alu::LriOp2>,
-    arm::arm_single_data_transfer::<Ldrh, HalfwordAndSignedRegOffset, PostIncrement, WRITEBACK>,
-    arm::arm_dataproc::<alu::AdcOp, S_FLAG_SET, alu::AriOp2>,
-    arm::arm_single_data_transfer::<Ldrsb, HalfwordAndSignedRegOffset, PostIncrement, WRITEBACK>,
-    arm::arm_dataproc::<alu::AdcOp, S_FLAG_SET, alu::RriOp2>,
-    arm::arm_single_data_transfer::<Ldrsh, HalfwordAndSignedRegOffset, PostIncrement, WRITEBACK>,
-    arm::arm_dataproc::<alu::SbcOp, S_FLAG_CLR, alu::LliOp2>,
-    arm::arm_dataproc::<alu::SbcOp, S_FLAG_CLR, alu::LlrOp2>,
-    arm::arm_dataproc::<alu::SbcOp, S_FLAG_CLR, alu::LriOp2>,
-    arm::arm_dataproc::<alu::SbcOp, S_FLAG_CLR, alu::LrrOp2>,
-    arm::arm_dataproc::<alu::SbcOp, S_FLAG_CLR, alu::AriOp2>,
-    arm::arm_dataproc::<alu::SbcOp, S_FLAG_CLR, alu::ArrOp2>,
-    arm::arm_dataproc::<alu::SbcOp, S_FLAG_CLR, alu::RriOp2>,
-    arm::arm_dataproc::<alu::SbcOp, S_FLAG_CLR, alu::RrrOp2>,
-    arm::arm_dataproc::<alu::SbcOp, S_FLAG_CLR, alu::LliOp2>,
-    arm::arm_mul_long::<SIGNED, S_FLAG_CLR, A_FLAG_CLR>,
-    arm::arm_dataproc::<alu::SbcOp, S_FLAG_CLR, alu::LriOp2>,
-    arm::arm_single_data_transfer::<Strh, HalfwordAndSignedImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_dataproc::<alu::SbcOp, S_FLAG_CLR, alu::AriOp2>,
-    arm::arm_m_extension_undefined,
-    arm::arm_dataproc::<alu::SbcOp, S_FLAG_CLR, alu::RriOp2>,
-    arm::arm_m_extension_undefined,
-    arm::arm_dataproc::<alu::SbcOp, S_FLAG_SET, alu::LliOp2>,
-    arm::arm_dataproc::<alu::SbcOp, S_FLAG_SET, alu::LlrOp2>,
-    arm::arm_dataproc::<alu::SbcOp, S_FLAG_SET, alu::LriOp2>,
-    arm::arm_dataproc::<alu::SbcOp, S_FLAG_SET, alu::LrrOp2>,
-    arm::arm_dataproc::<alu::SbcOp, S_FLAG_SET, alu::AriOp2>,
-    arm::arm_dataproc::<alu::SbcOp, S_FLAG_SET, alu::ArrOp2>,
-    arm::arm_dataproc::<alu::SbcOp, S_FLAG_SET, alu::RriOp2>,
-    arm::arm_dataproc::<alu::SbcOp, S_FLAG_SET, alu::RrrOp2>,
-    arm::arm_dataproc::<alu::SbcOp, S_FLAG_SET, alu::LliOp2>,
-    arm::arm_mul_long::<SIGNED, S_FLAG_SET, A_FLAG_CLR>,
-    arm::arm_dataproc::<alu::SbcOp, S_FLAG_SET, alu::LriOp2>,
-    arm::arm_single_data_transfer::<Ldrh, HalfwordAndSignedImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_dataproc::<alu::SbcOp, S_FLAG_SET, alu::AriOp2>,
-    arm::arm_single_data_transfer::<Ldrsb, HalfwordAndSignedImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_dataproc::<alu::SbcOp, S_FLAG_SET, alu::RriOp2>,
-    arm::arm_single_data_transfer::<Ldrsh, HalfwordAndSignedImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_dataproc::<alu::RscOp, S_FLAG_CLR, alu::LliOp2>,
-    arm::arm_dataproc::<alu::RscOp, S_FLAG_CLR, alu::LlrOp2>,
-    arm::arm_dataproc::<alu::RscOp, S_FLAG_CLR, alu::LriOp2>,
-    arm::arm_dataproc::<alu::RscOp, S_FLAG_CLR, alu::LrrOp2>,
-    arm::arm_dataproc::<alu::RscOp, S_FLAG_CLR, alu::AriOp2>,
-    arm::arm_dataproc::<alu::RscOp, S_FLAG_CLR, alu::ArrOp2>,
-    arm::arm_dataproc::<alu::RscOp, S_FLAG_CLR, alu::RriOp2>,
-    arm::arm_dataproc::<alu::RscOp, S_FLAG_CLR, alu::RrrOp2>,
-    arm::arm_dataproc::<alu::RscOp, S_FLAG_CLR, alu::LliOp2>,
-    arm::arm_mul_long::<SIGNED, S_FLAG_CLR, A_FLAG_SET>,
-    arm::arm_dataproc::<alu::RscOp, S_FLAG_CLR, alu::LriOp2>,
-    arm::arm_single_data_transfer::<Strh, HalfwordAndSignedImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_dataproc::<alu::RscOp, S_FLAG_CLR, alu::AriOp2>,
-    arm::arm_m_extension_undefined,
-    arm::arm_dataproc::<alu::RscOp, S_FLAG_CLR, alu::RriOp2>,
-    arm::arm_m_extension_undefined,
-    arm::arm_dataproc::<alu::RscOp, S_FLAG_SET, alu::LliOp2>,
-    arm::arm_dataproc::<alu::RscOp, S_FLAG_SET, alu::LlrOp2>,
-    arm::arm_dataproc::<alu::RscOp, S_FLAG_SET, alu::LriOp2>,
-    arm::arm_dataproc::<alu::RscOp, S_FLAG_SET, alu::LrrOp2>,
-    arm::arm_dataproc::<alu::RscOp, S_FLAG_SET, alu::AriOp2>,
-    arm::arm_dataproc::<alu::RscOp, S_FLAG_SET, alu::ArrOp2>,
-    arm::arm_dataproc::<alu::RscOp, S_FLAG_SET, alu::RriOp2>,
-    arm::arm_dataproc::<alu::RscOp, S_FLAG_SET, alu::RrrOp2>,
-    arm::arm_dataproc::<alu::RscOp, S_FLAG_SET, alu::LliOp2>,
-    arm::arm_mul_long::<SIGNED, S_FLAG_SET, A_FLAG_SET>,
-    arm::arm_dataproc::<alu::RscOp, S_FLAG_SET, alu::LriOp2>,
-    arm::arm_single_data_transfer::<Ldrh, HalfwordAndSignedImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_dataproc::<alu::RscOp, S_FLAG_SET, alu::AriOp2>,
-    arm::arm_single_data_transfer::<Ldrsb, HalfwordAndSignedImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_dataproc::<alu::RscOp, S_FLAG_SET, alu::RriOp2>,
-    arm::arm_single_data_transfer::<Ldrsh, HalfwordAndSignedImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_mrs::<alu::Cpsr>,
-    arm::arm_undefined,
-    arm::arm_undefined,
-    arm::arm_undefined,
-    arm::arm_undefined,
-    arm::arm_m_extension_undefined,
-    arm::arm_undefined,
-    arm::arm_undefined,
-    arm::arm_m_extension_undefined,
-    arm::arm_swp::<SWP_WORD>,
-    arm::arm_m_extension_undefined,
-    arm::arm_single_data_transfer::<Strh, HalfwordAndSignedRegOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_m_extension_undefined,
-    arm::arm_m_extension_undefined,
-    arm::arm_m_extension_undefined,
-    arm::arm_m_extension_undefined,
-    arm::arm_dataproc::<alu::TstOp, S_FLAG_SET, alu::LliOp2>,
-    arm::arm_dataproc::<alu::TstOp, S_FLAG_SET, alu::LlrOp2>,
-    arm::arm_dataproc::<alu::TstOp, S_FLAG_SET, alu::LriOp2>,
-    arm::arm_dataproc::<alu::TstOp, S_FLAG_SET, alu::LrrOp2>,
-    arm::arm_dataproc::<alu::TstOp, S_FLAG_SET, alu::AriOp2>,
-    arm::arm_dataproc::<alu::TstOp, S_FLAG_SET, alu::ArrOp2>,
-    arm::arm_dataproc::<alu::TstOp, S_FLAG_SET, alu::RriOp2>,
-    arm::arm_dataproc::<alu::TstOp, S_FLAG_SET, alu::RrrOp2>,
-    arm::arm_dataproc::<alu::TstOp, S_FLAG_SET, alu::LliOp2>,
-    arm::arm_undefined,
-    arm::arm_dataproc::<alu::TstOp, S_FLAG_SET, alu::LriOp2>,
-    arm::arm_single_data_transfer::<Ldrh, HalfwordAndSignedRegOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_dataproc::<alu::TstOp, S_FLAG_SET, alu::AriOp2>,
-    arm::arm_single_data_transfer::<Ldrsb, HalfwordAndSignedRegOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_dataproc::<alu::TstOp, S_FLAG_SET, alu::RriOp2>,
-    arm::arm_single_data_transfer::<Ldrsh, HalfwordAndSignedRegOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_msr::<alu::Cpsr, alu::LliOp2>,
-    arm::arm_bx,
-    arm::arm_undefined,
-    arm::arm_blx,
-    arm::arm_undefined,
-    arm::arm_m_extension_undefined,
-    arm::arm_undefined,
-    arm::arm_bkpt,
-    arm::arm_m_extension_undefined,
-    arm::arm_undefined,
-    arm::arm_m_extension_undefined,
-    arm::arm_single_data_transfer::<Strh, HalfwordAndSignedRegOffset, PreDecrement, WRITEBACK>,
-    arm::arm_m_extension_undefined,
-    arm::arm_m_extension_undefined,
-    arm::arm_m_extension_undefined,
-    arm::arm_m_extension_undefined,
-    arm::arm_dataproc::<alu::TeqOp, S_FLAG_SET, alu::LliOp2>,
-    arm::arm_dataproc::<alu::TeqOp, S_FLAG_SET, alu::LlrOp2>,
-    arm::arm_dataproc::<alu::TeqOp, S_FLAG_SET, alu::LriOp2>,
-    arm::arm_dataproc::<alu::TeqOp, S_FLAG_SET, alu::LrrOp2>,
-    arm::arm_dataproc::<alu::TeqOp, S_FLAG_SET, alu::AriOp2>,
-    arm::arm_dataproc::<alu::TeqOp, S_FLAG_SET, alu::ArrOp2>,
-    arm::arm_dataproc::<alu::TeqOp, S_FLAG_SET, alu::RriOp2>,
-    arm::arm_dataproc::<alu::TeqOp, S_FLAG_SET, alu::RrrOp2>,
-    arm::arm_dataproc::<alu::TeqOp, S_FLAG_SET, alu::LliOp2>,
-    arm::arm_undefined,
-    arm::arm_dataproc::<alu::TeqOp, S_FLAG_SET, alu::LriOp2>,
-    arm::arm_single_data_transfer::<Ldrh, HalfwordAndSignedRegOffset, PreDecrement, WRITEBACK>,
-    arm::arm_dataproc::<alu::TeqOp, S_FLAG_SET, alu::AriOp2>,
-    arm::arm_single_data_transfer::<Ldrsb, HalfwordAndSignedRegOffset, PreDecrement, WRITEBACK>,
-    arm::arm_dataproc::<alu::TeqOp, S_FLAG_SET, alu::RriOp2>,
-    arm::arm_single_data_transfer::<Ldrsh, HalfwordAndSignedRegOffset, PreDecrement, WRITEBACK>,
-    arm::arm_mrs::<alu::Spsr>,
-    arm::arm_undefined,
-    arm::arm_undefined,
-    arm::arm_undefined,
-    arm::arm_undefined,
-    arm::arm_m_extension_undefined,
-    arm::arm_undefined,
-    arm::arm_undefined,
-    arm::arm_m_extension_undefined,
-    arm::arm_swp::<SWP_BYTE>,
-    arm::arm_m_extension_undefined,
-    arm::arm_single_data_transfer::<Strh, HalfwordAndSignedImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_m_extension_undefined,
-    arm::arm_m_extension_undefined,
-    arm::arm_m_extension_undefined,
-    arm::arm_m_extension_undefined,
-    arm::arm_dataproc::<alu::CmpOp, S_FLAG_SET, alu::LliOp2>,
-    arm::arm_dataproc::<alu::CmpOp, S_FLAG_SET, alu::LlrOp2>,
-    arm::arm_dataproc::<alu::CmpOp, S_FLAG_SET, alu::LriOp2>,
-    arm::arm_dataproc::<alu::CmpOp, S_FLAG_SET, alu::LrrOp2>,
-    arm::arm_dataproc::<alu::CmpOp, S_FLAG_SET, alu::AriOp2>,
-    arm::arm_dataproc::<alu::CmpOp, S_FLAG_SET, alu::ArrOp2>,
-    arm::arm_dataproc::<alu::CmpOp, S_FLAG_SET, alu::RriOp2>,
-    arm::arm_dataproc::<alu::CmpOp, S_FLAG_SET, alu::RrrOp2>,
-    arm::arm_dataproc::<alu::CmpOp, S_FLAG_SET, alu::LliOp2>,
-    arm::arm_undefined,
-    arm::arm_dataproc::<alu::CmpOp, S_FLAG_SET, alu::LriOp2>,
-    arm::arm_single_data_transfer::<Ldrh, HalfwordAndSignedImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_dataproc::<alu::CmpOp, S_FLAG_SET, alu::AriOp2>,
-    arm::arm_single_data_transfer::<Ldrsb, HalfwordAndSignedImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_dataproc::<alu::CmpOp, S_FLAG_SET, alu::RriOp2>,
-    arm::arm_single_data_transfer::<Ldrsh, HalfwordAndSignedImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_msr::<alu::Spsr, alu::LliOp2>,
-    arm::arm_clz,
-    arm::arm_undefined,
-    arm::arm_undefined,
-    arm::arm_undefined,
-    arm::arm_m_extension_undefined,
-    arm::arm_undefined,
-    arm::arm_undefined,
-    arm::arm_m_extension_undefined,
-    arm::arm_undefined,
-    arm::arm_m_extension_undefined,
-    arm::arm_single_data_transfer::<Strh, HalfwordAndSignedImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_m_extension_undefined,
-    arm::arm_m_extension_undefined,
-    arm::arm_m_extension_undefined,
-    arm::arm_m_extension_undefined,
-    arm::arm_dataproc::<alu::CmnOp, S_FLAG_SET, alu::LliOp2>,
-    arm::arm_dataproc::<alu::CmnOp, S_FLAG_SET, alu::LlrOp2>,
-    arm::arm_dataproc::<alu::CmnOp, S_FLAG_SET, alu::LriOp2>,
-    arm::arm_dataproc::<alu::CmnOp, S_FLAG_SET, alu::LrrOp2>,
-    arm::arm_dataproc::<alu::CmnOp, S_FLAG_SET, alu::AriOp2>,
-    arm::arm_dataproc::<alu::CmnOp, S_FLAG_SET, alu::ArrOp2>,
-    arm::arm_dataproc::<alu::CmnOp, S_FLAG_SET, alu::RriOp2>,
-    arm::arm_dataproc::<alu::CmnOp, S_FLAG_SET, alu::RrrOp2>,
-    arm::arm_dataproc::<alu::CmnOp, S_FLAG_SET, alu::LliOp2>,
-    arm::arm_undefined,
-    arm::arm_dataproc::<alu::CmnOp, S_FLAG_SET, alu::LriOp2>,
-    arm::arm_single_data_transfer::<Ldrh, HalfwordAndSignedImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_dataproc::<alu::CmnOp, S_FLAG_SET, alu::AriOp2>,
-    arm::arm_single_data_transfer::<Ldrsb, HalfwordAndSignedImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_dataproc::<alu::CmnOp, S_FLAG_SET, alu::RriOp2>,
-    arm::arm_single_data_transfer::<Ldrsh, HalfwordAndSignedImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_dataproc::<alu::OrrOp, S_FLAG_CLR, alu::LliOp2>,
-    arm::arm_dataproc::<alu::OrrOp, S_FLAG_CLR, alu::LlrOp2>,
-    arm::arm_dataproc::<alu::OrrOp, S_FLAG_CLR, alu::LriOp2>,
-    arm::arm_dataproc::<alu::OrrOp, S_FLAG_CLR, alu::LrrOp2>,
-    arm::arm_dataproc::<alu::OrrOp, S_FLAG_CLR, alu::AriOp2>,
-    arm::arm_dataproc::<alu::OrrOp, S_FLAG_CLR, alu::ArrOp2>,
-    arm::arm_dataproc::<alu::OrrOp, S_FLAG_CLR, alu::RriOp2>,
-    arm::arm_dataproc::<alu::OrrOp, S_FLAG_CLR, alu::RrrOp2>,
-    arm::arm_dataproc::<alu::OrrOp, S_FLAG_CLR, alu::LliOp2>,
-    arm::arm_undefined,
-    arm::arm_dataproc::<alu::OrrOp, S_FLAG_CLR, alu::LriOp2>,
-    arm::arm_single_data_transfer::<Strh, HalfwordAndSignedRegOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_dataproc::<alu::OrrOp, S_FLAG_CLR, alu::AriOp2>,
-    arm::arm_m_extension_undefined,
-    arm::arm_dataproc::<alu::OrrOp, S_FLAG_CLR, alu::RriOp2>,
-    arm::arm_m_extension_undefined,
-    arm::arm_dataproc::<alu::OrrOp, S_FLAG_SET, alu::LliOp2>,
-    arm::arm_dataproc::<alu::OrrOp, S_FLAG_SET, alu::LlrOp2>,
-    arm::arm_dataproc::<alu::OrrOp, S_FLAG_SET, alu::LriOp2>,
-    arm::arm_dataproc::<alu::OrrOp, S_FLAG_SET, alu::LrrOp2>,
-    arm::arm_dataproc::<alu::OrrOp, S_FLAG_SET, alu::AriOp2>,
-    arm::arm_dataproc::<alu::OrrOp, S_FLAG_SET, alu::ArrOp2>,
-    arm::arm_dataproc::<alu::OrrOp, S_FLAG_SET, alu::RriOp2>,
-    arm::arm_dataproc::<alu::OrrOp, S_FLAG_SET, alu::RrrOp2>,
-    arm::arm_dataproc::<alu::OrrOp, S_FLAG_SET, alu::LliOp2>,
-    arm::arm_undefined,
-    arm::arm_dataproc::<alu::OrrOp, S_FLAG_SET, alu::LriOp2>,
-    arm::arm_single_data_transfer::<Ldrh, HalfwordAndSignedRegOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_dataproc::<alu::OrrOp, S_FLAG_SET, alu::AriOp2>,
-    arm::arm_single_data_transfer::<Ldrsb, HalfwordAndSignedRegOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_dataproc::<alu::OrrOp, S_FLAG_SET, alu::RriOp2>,
-    arm::arm_single_data_transfer::<Ldrsh, HalfwordAndSignedRegOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_dataproc::<alu::MovOp, S_FLAG_CLR, alu::LliOp2>,
-    arm::arm_dataproc::<alu::MovOp, S_FLAG_CLR, alu::LlrOp2>,
-    arm::arm_dataproc::<alu::MovOp, S_FLAG_CLR, alu::LriOp2>,
-    arm::arm_dataproc::<alu::MovOp, S_FLAG_CLR, alu::LrrOp2>,
-    arm::arm_dataproc::<alu::MovOp, S_FLAG_CLR, alu::AriOp2>,
-    arm::arm_dataproc::<alu::MovOp, S_FLAG_CLR, alu::ArrOp2>,
-    arm::arm_dataproc::<alu::MovOp, S_FLAG_CLR, alu::RriOp2>,
-    arm::arm_dataproc::<alu::MovOp, S_FLAG_CLR, alu::RrrOp2>,
-    arm::arm_dataproc::<alu::MovOp, S_FLAG_CLR, alu::LliOp2>,
-    arm::arm_undefined,
-    arm::arm_dataproc::<alu::MovOp, S_FLAG_CLR, alu::LriOp2>,
-    arm::arm_single_data_transfer::<Strh, HalfwordAndSignedRegOffset, PreIncrement, WRITEBACK>,
-    arm::arm_dataproc::<alu::MovOp, S_FLAG_CLR, alu::AriOp2>,
-    arm::arm_m_extension_undefined,
-    arm::arm_dataproc::<alu::MovOp, S_FLAG_CLR, alu::RriOp2>,
-    arm::arm_m_extension_undefined,
-    arm::arm_dataproc::<alu::MovOp, S_FLAG_SET, alu::LliOp2>,
-    arm::arm_dataproc::<alu::MovOp, S_FLAG_SET, alu::LlrOp2>,
-    arm::arm_dataproc::<alu::MovOp, S_FLAG_SET, alu::LriOp2>,
-    arm::arm_dataproc::<alu::MovOp, S_FLAG_SET, alu::LrrOp2>,
-    arm::arm_dataproc::<alu::MovOp, S_FLAG_SET, alu::AriOp2>,
-    arm::arm_dataproc::<alu::MovOp, S_FLAG_SET, alu::ArrOp2>,
-    arm::arm_dataproc::<alu::MovOp, S_FLAG_SET, alu::RriOp2>,
-    arm::arm_dataproc::<alu::MovOp, S_FLAG_SET, alu::RrrOp2>,
-    arm::arm_dataproc::<alu::MovOp, S_FLAG_SET, alu::LliOp2>,
-    arm::arm_undefined,
-    arm::arm_dataproc::<alu::MovOp, S_FLAG_SET, alu::LriOp2>,
-    arm::arm_single_data_transfer::<Ldrh, HalfwordAndSignedRegOffset, PreIncrement, WRITEBACK>,
-    arm::arm_dataproc::<alu::MovOp, S_FLAG_SET, alu::AriOp2>,
-    arm::arm_single_data_transfer::<Ldrsb, HalfwordAndSignedRegOffset, PreIncrement, WRITEBACK>,
-    arm::arm_dataproc::<alu::MovOp, S_FLAG_SET, alu::RriOp2>,
-    arm::arm_single_data_transfer::<Ldrsh, HalfwordAndSignedRegOffset, PreIncrement, WRITEBACK>,
-    arm::arm_dataproc::<alu::BicOp, S_FLAG_CLR, alu::LliOp2>,
-    arm::arm_dataproc::<alu::BicOp, S_FLAG_CLR, alu::LlrOp2>,
-    arm::arm_dataproc::<alu::BicOp, S_FLAG_CLR, alu::LriOp2>,
-    arm::arm_dataproc::<alu::BicOp, S_FLAG_CLR, alu::LrrOp2>,
-    arm::arm_dataproc::<alu::BicOp, S_FLAG_CLR, alu::AriOp2>,
-    arm::arm_dataproc::<alu::BicOp, S_FLAG_CLR, alu::ArrOp2>,
-    arm::arm_dataproc::<alu::BicOp, S_FLAG_CLR, alu::RriOp2>,
-    arm::arm_dataproc::<alu::BicOp, S_FLAG_CLR, alu::RrrOp2>,
-    arm::arm_dataproc::<alu::BicOp, S_FLAG_CLR, alu::LliOp2>,
-    arm::arm_undefined,
-    arm::arm_dataproc::<alu::BicOp, S_FLAG_CLR, alu::LriOp2>,
-    arm::arm_single_data_transfer::<Strh, HalfwordAndSignedImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_dataproc::<alu::BicOp, S_FLAG_CLR, alu::AriOp2>,
-    arm::arm_m_extension_undefined,
-    arm::arm_dataproc::<alu::BicOp, S_FLAG_CLR, alu::RriOp2>,
-    arm::arm_m_extension_undefined,
-    arm::arm_dataproc::<alu::BicOp, S_FLAG_SET, alu::LliOp2>,
-    arm::arm_dataproc::<alu::BicOp, S_FLAG_SET, alu::LlrOp2>,
-    arm::arm_dataproc::<alu::BicOp, S_FLAG_SET, alu::LriOp2>,
-    arm::arm_dataproc::<alu::BicOp, S_FLAG_SET, alu::LrrOp2>,
-    arm::arm_dataproc::<alu::BicOp, S_FLAG_SET, alu::AriOp2>,
-    arm::arm_dataproc::<alu::BicOp, S_FLAG_SET, alu::ArrOp2>,
-    arm::arm_dataproc::<alu::BicOp, S_FLAG_SET, alu::RriOp2>,
-    arm::arm_dataproc::<alu::BicOp, S_FLAG_SET, alu::RrrOp2>,
-    arm::arm_dataproc::<alu::BicOp, S_FLAG_SET, alu::LliOp2>,
-    arm::arm_undefined,
-    arm::arm_dataproc::<alu::BicOp, S_FLAG_SET, alu::LriOp2>,
-    arm::arm_single_data_transfer::<Ldrh, HalfwordAndSignedImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_dataproc::<alu::BicOp, S_FLAG_SET, alu::AriOp2>,
-    arm::arm_single_data_transfer::<Ldrsb, HalfwordAndSignedImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_dataproc::<alu::BicOp, S_FLAG_SET, alu::RriOp2>,
-    arm::arm_single_data_transfer::<Ldrsh, HalfwordAndSignedImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_dataproc::<alu::MvnOp, S_FLAG_CLR, alu::LliOp2>,
-    arm::arm_dataproc::<alu::MvnOp, S_FLAG_CLR, alu::LlrOp2>,
-    arm::arm_dataproc::<alu::MvnOp, S_FLAG_CLR, alu::LriOp2>,
-    arm::arm_dataproc::<alu::MvnOp, S_FLAG_CLR, alu::LrrOp2>,
-    arm::arm_dataproc::<alu::MvnOp, S_FLAG_CLR, alu::AriOp2>,
-    arm::arm_dataproc::<alu::MvnOp, S_FLAG_CLR, alu::ArrOp2>,
-    arm::arm_dataproc::<alu::MvnOp, S_FLAG_CLR, alu::RriOp2>,
-    arm::arm_dataproc::<alu::MvnOp, S_FLAG_CLR, alu::RrrOp2>,
-    arm::arm_dataproc::<alu::MvnOp, S_FLAG_CLR, alu::LliOp2>,
-    arm::arm_undefined,
-    arm::arm_dataproc::<alu::MvnOp, S_FLAG_CLR, alu::LriOp2>,
-    arm::arm_single_data_transfer::<Strh, HalfwordAndSignedImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_dataproc::<alu::MvnOp, S_FLAG_CLR, alu::AriOp2>,
-    arm::arm_m_extension_undefined,
-    arm::arm_dataproc::<alu::MvnOp, S_FLAG_CLR, alu::RriOp2>,
-    arm::arm_m_extension_undefined,
-    arm::arm_dataproc::<alu::MvnOp, S_FLAG_SET, alu::LliOp2>,
-    arm::arm_dataproc::<alu::MvnOp, S_FLAG_SET, alu::LlrOp2>,
-    arm::arm_dataproc::<alu::MvnOp, S_FLAG_SET, alu::LriOp2>,
-    arm::arm_dataproc::<alu::MvnOp, S_FLAG_SET, alu::LrrOp2>,
-    arm::arm_dataproc::<alu::MvnOp, S_FLAG_SET, alu::AriOp2>,
-    arm::arm_dataproc::<alu::MvnOp, S_FLAG_SET, alu::ArrOp2>,
-    arm::arm_dataproc::<alu::MvnOp, S_FLAG_SET, alu::RriOp2>,
-    arm::arm_dataproc::<alu::MvnOp, S_FLAG_SET, alu::RrrOp2>,
-    arm::arm_dataproc::<alu::MvnOp, S_FLAG_SET, alu::LliOp2>,
-    arm::arm_undefined,
-    arm::arm_dataproc::<alu::MvnOp, S_FLAG_SET, alu::LriOp2>,
-    arm::arm_single_data_transfer::<Ldrh, HalfwordAndSignedImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_dataproc::<alu::MvnOp, S_FLAG_SET, alu::AriOp2>,
-    arm::arm_single_data_transfer::<Ldrsb, HalfwordAndSignedImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_dataproc::<alu::MvnOp, S_FLAG_SET, alu::RriOp2>,
-    arm::arm_single_data_transfer::<Ldrsh, HalfwordAndSignedImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_dataproc::<alu::AndOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AndOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AndOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AndOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AndOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AndOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AndOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AndOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AndOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AndOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AndOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AndOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AndOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AndOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AndOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AndOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AndOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AndOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AndOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AndOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AndOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AndOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AndOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AndOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AndOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AndOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AndOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AndOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AndOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AndOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AndOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AndOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::EorOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::EorOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::EorOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::EorOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::EorOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::EorOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::EorOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::EorOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::EorOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::EorOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::EorOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::EorOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::EorOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::EorOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::EorOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::EorOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::EorOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::EorOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::EorOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::EorOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::EorOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::EorOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::EorOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::EorOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::EorOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::EorOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::EorOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::EorOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::EorOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::EorOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::EorOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::EorOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::SubOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::SubOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::SubOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::SubOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::SubOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::SubOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::SubOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::SubOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::SubOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::SubOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::SubOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::SubOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::SubOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::SubOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::SubOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::SubOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::SubOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::SubOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::SubOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::SubOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::SubOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::SubOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::SubOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::SubOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::SubOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::SubOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::SubOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::SubOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::SubOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::SubOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::SubOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::SubOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::RsbOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::RsbOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::RsbOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::RsbOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::RsbOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::RsbOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::RsbOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::RsbOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::RsbOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::RsbOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::RsbOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::RsbOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::RsbOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::RsbOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::RsbOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::RsbOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::RsbOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::RsbOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::RsbOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::RsbOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::RsbOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::RsbOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::RsbOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::RsbOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::RsbOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::RsbOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::RsbOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::RsbOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::RsbOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::RsbOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::RsbOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::RsbOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AddOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AddOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AddOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AddOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AddOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AddOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AddOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AddOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AddOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AddOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AddOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AddOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AddOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AddOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AddOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AddOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AddOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AddOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AddOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AddOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AddOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AddOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AddOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AddOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AddOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AddOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AddOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AddOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AddOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AddOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AddOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AddOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AdcOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AdcOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AdcOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AdcOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AdcOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AdcOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AdcOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AdcOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AdcOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AdcOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AdcOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AdcOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AdcOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AdcOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AdcOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AdcOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AdcOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AdcOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AdcOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AdcOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AdcOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AdcOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AdcOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AdcOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AdcOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AdcOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AdcOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AdcOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AdcOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AdcOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AdcOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::AdcOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::SbcOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::SbcOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::SbcOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::SbcOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::SbcOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::SbcOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::SbcOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::SbcOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::SbcOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::SbcOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::SbcOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::SbcOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::SbcOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::SbcOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::SbcOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::SbcOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::SbcOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::SbcOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::SbcOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::SbcOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::SbcOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::SbcOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::SbcOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::SbcOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::SbcOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::SbcOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::SbcOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::SbcOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::SbcOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::SbcOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::SbcOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::SbcOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::RscOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::RscOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::RscOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::RscOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::RscOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::RscOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::RscOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::RscOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::RscOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::RscOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::RscOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::RscOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::RscOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::RscOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::RscOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::RscOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::RscOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::RscOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::RscOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::RscOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::RscOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::RscOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::RscOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::RscOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::RscOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::RscOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::RscOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::RscOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::RscOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::RscOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::RscOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::RscOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_undefined,
-    arm::arm_undefined,
-    arm::arm_undefined,
-    arm::arm_undefined,
-    arm::arm_undefined,
-    arm::arm_undefined,
-    arm::arm_undefined,
-    arm::arm_undefined,
-    arm::arm_undefined,
-    arm::arm_undefined,
-    arm::arm_undefined,
-    arm::arm_undefined,
-    arm::arm_undefined,
-    arm::arm_undefined,
-    arm::arm_undefined,
-    arm::arm_undefined,
-    arm::arm_dataproc::<alu::TstOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::TstOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::TstOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::TstOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::TstOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::TstOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::TstOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::TstOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::TstOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::TstOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::TstOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::TstOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::TstOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::TstOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::TstOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::TstOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_msr::<alu::Cpsr, alu::ImmOp2>,
-    arm::arm_msr::<alu::Cpsr, alu::ImmOp2>,
-    arm::arm_msr::<alu::Cpsr, alu::ImmOp2>,
-    arm::arm_msr::<alu::Cpsr, alu::ImmOp2>,
-    arm::arm_msr::<alu::Cpsr, alu::ImmOp2>,
-    arm::arm_msr::<alu::Cpsr, alu::ImmOp2>,
-    arm::arm_msr::<alu::Cpsr, alu::ImmOp2>,
-    arm::arm_msr::<alu::Cpsr, alu::ImmOp2>,
-    arm::arm_msr::<alu::Cpsr, alu::ImmOp2>,
-    arm::arm_msr::<alu::Cpsr, alu::ImmOp2>,
-    arm::arm_msr::<alu::Cpsr, alu::ImmOp2>,
-    arm::arm_msr::<alu::Cpsr, alu::ImmOp2>,
-    arm::arm_msr::<alu::Cpsr, alu::ImmOp2>,
-    arm::arm_msr::<alu::Cpsr, alu::ImmOp2>,
-    arm::arm_msr::<alu::Cpsr, alu::ImmOp2>,
-    arm::arm_msr::<alu::Cpsr, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::TeqOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::TeqOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::TeqOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::TeqOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::TeqOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::TeqOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::TeqOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::TeqOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::TeqOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::TeqOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::TeqOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::TeqOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::TeqOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::TeqOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::TeqOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::TeqOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_undefined,
-    arm::arm_undefined,
-    arm::arm_undefined,
-    arm::arm_undefined,
-    arm::arm_undefined,
-    arm::arm_undefined,
-    arm::arm_undefined,
-    arm::arm_undefined,
-    arm::arm_undefined,
-    arm::arm_undefined,
-    arm::arm_undefined,
-    arm::arm_undefined,
-    arm::arm_undefined,
-    arm::arm_undefined,
-    arm::arm_undefined,
-    arm::arm_undefined,
-    arm::arm_dataproc::<alu::CmpOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::CmpOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::CmpOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::CmpOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::CmpOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::CmpOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::CmpOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::CmpOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::CmpOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::CmpOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::CmpOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::CmpOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::CmpOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::CmpOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::CmpOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::CmpOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_msr::<alu::Spsr, alu::ImmOp2>,
-    arm::arm_msr::<alu::Spsr, alu::ImmOp2>,
-    arm::arm_msr::<alu::Spsr, alu::ImmOp2>,
-    arm::arm_msr::<alu::Spsr, alu::ImmOp2>,
-    arm::arm_msr::<alu::Spsr, alu::ImmOp2>,
-    arm::arm_msr::<alu::Spsr, alu::ImmOp2>,
-    arm::arm_msr::<alu::Spsr, alu::ImmOp2>,
-    arm::arm_msr::<alu::Spsr, alu::ImmOp2>,
-    arm::arm_msr::<alu::Spsr, alu::ImmOp2>,
-    arm::arm_msr::<alu::Spsr, alu::ImmOp2>,
-    arm::arm_msr::<alu::Spsr, alu::ImmOp2>,
-    arm::arm_msr::<alu::Spsr, alu::ImmOp2>,
-    arm::arm_msr::<alu::Spsr, alu::ImmOp2>,
-    arm::arm_msr::<alu::Spsr, alu::ImmOp2>,
-    arm::arm_msr::<alu::Spsr, alu::ImmOp2>,
-    arm::arm_msr::<alu::Spsr, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::CmnOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::CmnOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::CmnOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::CmnOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::CmnOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::CmnOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::CmnOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::CmnOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::CmnOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::CmnOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::CmnOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::CmnOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::CmnOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::CmnOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::CmnOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::CmnOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::OrrOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::OrrOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::OrrOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::OrrOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::OrrOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::OrrOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::OrrOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::OrrOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::OrrOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::OrrOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::OrrOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::OrrOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::OrrOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::OrrOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::OrrOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::OrrOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::OrrOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::OrrOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::OrrOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::OrrOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::OrrOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::OrrOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::OrrOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::OrrOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::OrrOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::OrrOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::OrrOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::OrrOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::OrrOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::OrrOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::OrrOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::OrrOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::MovOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::MovOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::MovOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::MovOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::MovOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::MovOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::MovOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::MovOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::MovOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::MovOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::MovOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::MovOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::MovOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::MovOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::MovOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::MovOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::MovOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::MovOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::MovOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::MovOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::MovOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::MovOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::MovOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::MovOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::MovOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::MovOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::MovOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::MovOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::MovOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::MovOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::MovOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::MovOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::BicOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::BicOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::BicOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::BicOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::BicOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::BicOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::BicOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::BicOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::BicOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::BicOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::BicOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::BicOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::BicOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::BicOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::BicOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::BicOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::BicOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::BicOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::BicOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::BicOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::BicOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::BicOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::BicOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::BicOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::BicOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::BicOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::BicOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::BicOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::BicOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::BicOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::BicOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::BicOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::MvnOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::MvnOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::MvnOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::MvnOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::MvnOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::MvnOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::MvnOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::MvnOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::MvnOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::MvnOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::MvnOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::MvnOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::MvnOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::MvnOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::MvnOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::MvnOp, S_FLAG_CLR, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::MvnOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::MvnOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::MvnOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::MvnOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::MvnOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::MvnOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::MvnOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::MvnOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::MvnOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::MvnOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::MvnOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::MvnOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::MvnOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::MvnOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::MvnOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_dataproc::<alu::MvnOp, S_FLAG_SET, alu::ImmOp2>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str<FORCE_USER_MODE>, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str<FORCE_USER_MODE>, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str<FORCE_USER_MODE>, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str<FORCE_USER_MODE>, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str<FORCE_USER_MODE>, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str<FORCE_USER_MODE>, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str<FORCE_USER_MODE>, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str<FORCE_USER_MODE>, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str<FORCE_USER_MODE>, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str<FORCE_USER_MODE>, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str<FORCE_USER_MODE>, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str<FORCE_USER_MODE>, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str<FORCE_USER_MODE>, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str<FORCE_USER_MODE>, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str<FORCE_USER_MODE>, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str<FORCE_USER_MODE>, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr<FORCE_USER_MODE>, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr<FORCE_USER_MODE>, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr<FORCE_USER_MODE>, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr<FORCE_USER_MODE>, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr<FORCE_USER_MODE>, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr<FORCE_USER_MODE>, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr<FORCE_USER_MODE>, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr<FORCE_USER_MODE>, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr<FORCE_USER_MODE>, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr<FORCE_USER_MODE>, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr<FORCE_USER_MODE>, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr<FORCE_USER_MODE>, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr<FORCE_USER_MODE>, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr<FORCE_USER_MODE>, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr<FORCE_USER_MODE>, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr<FORCE_USER_MODE>, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb<FORCE_USER_MODE>, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb<FORCE_USER_MODE>, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb<FORCE_USER_MODE>, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb<FORCE_USER_MODE>, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb<FORCE_USER_MODE>, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb<FORCE_USER_MODE>, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb<FORCE_USER_MODE>, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb<FORCE_USER_MODE>, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb<FORCE_USER_MODE>, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb<FORCE_USER_MODE>, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb<FORCE_USER_MODE>, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb<FORCE_USER_MODE>, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb<FORCE_USER_MODE>, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb<FORCE_USER_MODE>, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb<FORCE_USER_MODE>, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb<FORCE_USER_MODE>, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb<FORCE_USER_MODE>, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb<FORCE_USER_MODE>, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb<FORCE_USER_MODE>, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb<FORCE_USER_MODE>, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb<FORCE_USER_MODE>, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb<FORCE_USER_MODE>, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb<FORCE_USER_MODE>, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb<FORCE_USER_MODE>, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb<FORCE_USER_MODE>, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb<FORCE_USER_MODE>, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb<FORCE_USER_MODE>, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb<FORCE_USER_MODE>, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb<FORCE_USER_MODE>, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb<FORCE_USER_MODE>, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb<FORCE_USER_MODE>, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb<FORCE_USER_MODE>, SDTImmOffset, PostDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str<FORCE_USER_MODE>, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str<FORCE_USER_MODE>, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str<FORCE_USER_MODE>, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str<FORCE_USER_MODE>, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str<FORCE_USER_MODE>, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str<FORCE_USER_MODE>, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str<FORCE_USER_MODE>, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str<FORCE_USER_MODE>, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str<FORCE_USER_MODE>, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str<FORCE_USER_MODE>, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str<FORCE_USER_MODE>, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str<FORCE_USER_MODE>, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str<FORCE_USER_MODE>, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str<FORCE_USER_MODE>, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str<FORCE_USER_MODE>, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str<FORCE_USER_MODE>, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr<FORCE_USER_MODE>, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr<FORCE_USER_MODE>, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr<FORCE_USER_MODE>, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr<FORCE_USER_MODE>, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr<FORCE_USER_MODE>, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr<FORCE_USER_MODE>, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr<FORCE_USER_MODE>, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr<FORCE_USER_MODE>, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr<FORCE_USER_MODE>, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr<FORCE_USER_MODE>, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr<FORCE_USER_MODE>, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr<FORCE_USER_MODE>, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr<FORCE_USER_MODE>, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr<FORCE_USER_MODE>, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr<FORCE_USER_MODE>, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr<FORCE_USER_MODE>, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb<FORCE_USER_MODE>, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb<FORCE_USER_MODE>, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb<FORCE_USER_MODE>, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb<FORCE_USER_MODE>, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb<FORCE_USER_MODE>, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb<FORCE_USER_MODE>, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb<FORCE_USER_MODE>, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb<FORCE_USER_MODE>, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb<FORCE_USER_MODE>, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb<FORCE_USER_MODE>, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb<FORCE_USER_MODE>, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb<FORCE_USER_MODE>, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb<FORCE_USER_MODE>, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb<FORCE_USER_MODE>, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb<FORCE_USER_MODE>, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb<FORCE_USER_MODE>, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb<FORCE_USER_MODE>, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb<FORCE_USER_MODE>, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb<FORCE_USER_MODE>, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb<FORCE_USER_MODE>, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb<FORCE_USER_MODE>, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb<FORCE_USER_MODE>, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb<FORCE_USER_MODE>, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb<FORCE_USER_MODE>, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb<FORCE_USER_MODE>, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb<FORCE_USER_MODE>, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb<FORCE_USER_MODE>, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb<FORCE_USER_MODE>, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb<FORCE_USER_MODE>, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb<FORCE_USER_MODE>, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb<FORCE_USER_MODE>, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb<FORCE_USER_MODE>, SDTImmOffset, PostIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PreDecrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PreDecrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, SDTImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldr, SDTImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PreIncrement, NO_WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Strb, SDTImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Ldrb, SDTImmOffset, PreIncrement, WRITEBACK>,
-    arm::arm_single_data_transfer::<Str, alu::LliOp2, PostDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Str, alu::LriOp2, PostDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Str, alu::AriOp2, PostDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Str, alu::RriOp2, PostDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Str, alu::LliOp2, PostDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Str, alu::LriOp2, PostDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Str, alu::AriOp2, PostDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Str, alu::RriOp2, PostDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldr, alu::LliOp2, PostDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldr, alu::LriOp2, PostDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldr, alu::AriOp2, PostDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldr, alu::RriOp2, PostDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldr, alu::LliOp2, PostDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldr, alu::LriOp2, PostDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldr, alu::AriOp2, PostDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldr, alu::RriOp2, PostDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Str<FORCE_USER_MODE>, alu::LliOp2, PostDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Str<FORCE_USER_MODE>, alu::LriOp2, PostDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Str<FORCE_USER_MODE>, alu::AriOp2, PostDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Str<FORCE_USER_MODE>, alu::RriOp2, PostDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Str<FORCE_USER_MODE>, alu::LliOp2, PostDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Str<FORCE_USER_MODE>, alu::LriOp2, PostDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Str<FORCE_USER_MODE>, alu::AriOp2, PostDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Str<FORCE_USER_MODE>, alu::RriOp2, PostDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldr<FORCE_USER_MODE>, alu::LliOp2, PostDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldr<FORCE_USER_MODE>, alu::LriOp2, PostDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldr<FORCE_USER_MODE>, alu::AriOp2, PostDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldr<FORCE_USER_MODE>, alu::RriOp2, PostDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldr<FORCE_USER_MODE>, alu::LliOp2, PostDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldr<FORCE_USER_MODE>, alu::LriOp2, PostDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldr<FORCE_USER_MODE>, alu::AriOp2, PostDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldr<FORCE_USER_MODE>, alu::RriOp2, PostDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Strb, alu::LliOp2, PostDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Strb, alu::LriOp2, PostDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Strb, alu::AriOp2, PostDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Strb, alu::RriOp2, PostDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Strb, alu::LliOp2, PostDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Strb, alu::LriOp2, PostDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Strb, alu::AriOp2, PostDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Strb, alu::RriOp2, PostDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldrb, alu::LliOp2, PostDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldrb, alu::LriOp2, PostDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldrb, alu::AriOp2, PostDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldrb, alu::RriOp2, PostDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldrb, alu::LliOp2, PostDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldrb, alu::LriOp2, PostDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldrb, alu::AriOp2, PostDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldrb, alu::RriOp2, PostDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Strb<FORCE_USER_MODE>, alu::LliOp2, PostDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Strb<FORCE_USER_MODE>, alu::LriOp2, PostDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Strb<FORCE_USER_MODE>, alu::AriOp2, PostDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Strb<FORCE_USER_MODE>, alu::RriOp2, PostDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Strb<FORCE_USER_MODE>, alu::LliOp2, PostDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Strb<FORCE_USER_MODE>, alu::LriOp2, PostDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Strb<FORCE_USER_MODE>, alu::AriOp2, PostDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Strb<FORCE_USER_MODE>, alu::RriOp2, PostDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldrb<FORCE_USER_MODE>, alu::LliOp2, PostDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldrb<FORCE_USER_MODE>, alu::LriOp2, PostDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldrb<FORCE_USER_MODE>, alu::AriOp2, PostDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldrb<FORCE_USER_MODE>, alu::RriOp2, PostDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldrb<FORCE_USER_MODE>, alu::LliOp2, PostDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldrb<FORCE_USER_MODE>, alu::LriOp2, PostDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldrb<FORCE_USER_MODE>, alu::AriOp2, PostDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldrb<FORCE_USER_MODE>, alu::RriOp2, PostDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Str, alu::LliOp2, PostIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Str, alu::LriOp2, PostIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Str, alu::AriOp2, PostIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Str, alu::RriOp2, PostIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Str, alu::LliOp2, PostIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Str, alu::LriOp2, PostIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Str, alu::AriOp2, PostIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Str, alu::RriOp2, PostIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldr, alu::LliOp2, PostIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldr, alu::LriOp2, PostIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldr, alu::AriOp2, PostIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldr, alu::RriOp2, PostIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldr, alu::LliOp2, PostIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldr, alu::LriOp2, PostIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldr, alu::AriOp2, PostIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldr, alu::RriOp2, PostIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Str<FORCE_USER_MODE>, alu::LliOp2, PostIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Str<FORCE_USER_MODE>, alu::LriOp2, PostIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Str<FORCE_USER_MODE>, alu::AriOp2, PostIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Str<FORCE_USER_MODE>, alu::RriOp2, PostIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Str<FORCE_USER_MODE>, alu::LliOp2, PostIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Str<FORCE_USER_MODE>, alu::LriOp2, PostIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Str<FORCE_USER_MODE>, alu::AriOp2, PostIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Str<FORCE_USER_MODE>, alu::RriOp2, PostIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldr<FORCE_USER_MODE>, alu::LliOp2, PostIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldr<FORCE_USER_MODE>, alu::LriOp2, PostIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldr<FORCE_USER_MODE>, alu::AriOp2, PostIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldr<FORCE_USER_MODE>, alu::RriOp2, PostIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldr<FORCE_USER_MODE>, alu::LliOp2, PostIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldr<FORCE_USER_MODE>, alu::LriOp2, PostIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldr<FORCE_USER_MODE>, alu::AriOp2, PostIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldr<FORCE_USER_MODE>, alu::RriOp2, PostIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Strb, alu::LliOp2, PostIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Strb, alu::LriOp2, PostIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Strb, alu::AriOp2, PostIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Strb, alu::RriOp2, PostIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Strb, alu::LliOp2, PostIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Strb, alu::LriOp2, PostIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Strb, alu::AriOp2, PostIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Strb, alu::RriOp2, PostIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldrb, alu::LliOp2, PostIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldrb, alu::LriOp2, PostIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldrb, alu::AriOp2, PostIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldrb, alu::RriOp2, PostIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldrb, alu::LliOp2, PostIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldrb, alu::LriOp2, PostIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldrb, alu::AriOp2, PostIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldrb, alu::RriOp2, PostIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Strb<FORCE_USER_MODE>, alu::LliOp2, PostIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Strb<FORCE_USER_MODE>, alu::LriOp2, PostIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Strb<FORCE_USER_MODE>, alu::AriOp2, PostIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Strb<FORCE_USER_MODE>, alu::RriOp2, PostIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Strb<FORCE_USER_MODE>, alu::LliOp2, PostIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Strb<FORCE_USER_MODE>, alu::LriOp2, PostIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Strb<FORCE_USER_MODE>, alu::AriOp2, PostIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Strb<FORCE_USER_MODE>, alu::RriOp2, PostIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldrb<FORCE_USER_MODE>, alu::LliOp2, PostIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldrb<FORCE_USER_MODE>, alu::LriOp2, PostIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldrb<FORCE_USER_MODE>, alu::AriOp2, PostIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldrb<FORCE_USER_MODE>, alu::RriOp2, PostIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldrb<FORCE_USER_MODE>, alu::LliOp2, PostIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldrb<FORCE_USER_MODE>, alu::LriOp2, PostIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldrb<FORCE_USER_MODE>, alu::AriOp2, PostIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldrb<FORCE_USER_MODE>, alu::RriOp2, PostIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Str, alu::LliOp2, PreDecrement, NO_WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Str, alu::LriOp2, PreDecrement, NO_WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Str, alu::AriOp2, PreDecrement, NO_WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Str, alu::RriOp2, PreDecrement, NO_WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Str, alu::LliOp2, PreDecrement, NO_WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Str, alu::LriOp2, PreDecrement, NO_WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Str, alu::AriOp2, PreDecrement, NO_WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Str, alu::RriOp2, PreDecrement, NO_WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldr, alu::LliOp2, PreDecrement, NO_WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldr, alu::LriOp2, PreDecrement, NO_WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldr, alu::AriOp2, PreDecrement, NO_WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldr, alu::RriOp2, PreDecrement, NO_WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldr, alu::LliOp2, PreDecrement, NO_WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldr, alu::LriOp2, PreDecrement, NO_WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldr, alu::AriOp2, PreDecrement, NO_WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldr, alu::RriOp2, PreDecrement, NO_WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Str, alu::LliOp2, PreDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Str, alu::LriOp2, PreDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Str, alu::AriOp2, PreDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Str, alu::RriOp2, PreDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Str, alu::LliOp2, PreDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Str, alu::LriOp2, PreDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Str, alu::AriOp2, PreDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Str, alu::RriOp2, PreDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldr, alu::LliOp2, PreDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldr, alu::LriOp2, PreDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldr, alu::AriOp2, PreDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldr, alu::RriOp2, PreDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldr, alu::LliOp2, PreDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldr, alu::LriOp2, PreDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldr, alu::AriOp2, PreDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldr, alu::RriOp2, PreDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Strb, alu::LliOp2, PreDecrement, NO_WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Strb, alu::LriOp2, PreDecrement, NO_WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Strb, alu::AriOp2, PreDecrement, NO_WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Strb, alu::RriOp2, PreDecrement, NO_WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Strb, alu::LliOp2, PreDecrement, NO_WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Strb, alu::LriOp2, PreDecrement, NO_WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Strb, alu::AriOp2, PreDecrement, NO_WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Strb, alu::RriOp2, PreDecrement, NO_WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldrb, alu::LliOp2, PreDecrement, NO_WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldrb, alu::LriOp2, PreDecrement, NO_WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldrb, alu::AriOp2, PreDecrement, NO_WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldrb, alu::RriOp2, PreDecrement, NO_WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldrb, alu::LliOp2, PreDecrement, NO_WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldrb, alu::LriOp2, PreDecrement, NO_WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldrb, alu::AriOp2, PreDecrement, NO_WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldrb, alu::RriOp2, PreDecrement, NO_WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Strb, alu::LliOp2, PreDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Strb, alu::LriOp2, PreDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Strb, alu::AriOp2, PreDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Strb, alu::RriOp2, PreDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Strb, alu::LliOp2, PreDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Strb, alu::LriOp2, PreDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Strb, alu::AriOp2, PreDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Strb, alu::RriOp2, PreDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldrb, alu::LliOp2, PreDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldrb, alu::LriOp2, PreDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldrb, alu::AriOp2, PreDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldrb, alu::RriOp2, PreDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldrb, alu::LliOp2, PreDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldrb, alu::LriOp2, PreDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldrb, alu::AriOp2, PreDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldrb, alu::RriOp2, PreDecrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Str, alu::LliOp2, PreIncrement, NO_WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Str, alu::LriOp2, PreIncrement, NO_WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Str, alu::AriOp2, PreIncrement, NO_WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Str, alu::RriOp2, PreIncrement, NO_WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Str, alu::LliOp2, PreIncrement, NO_WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Str, alu::LriOp2, PreIncrement, NO_WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Str, alu::AriOp2, PreIncrement, NO_WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Str, alu::RriOp2, PreIncrement, NO_WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldr, alu::LliOp2, PreIncrement, NO_WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldr, alu::LriOp2, PreIncrement, NO_WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldr, alu::AriOp2, PreIncrement, NO_WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldr, alu::RriOp2, PreIncrement, NO_WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldr, alu::LliOp2, PreIncrement, NO_WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldr, alu::LriOp2, PreIncrement, NO_WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldr, alu::AriOp2, PreIncrement, NO_WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldr, alu::RriOp2, PreIncrement, NO_WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Str, alu::LliOp2, PreIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Str, alu::LriOp2, PreIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Str, alu::AriOp2, PreIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Str, alu::RriOp2, PreIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Str, alu::LliOp2, PreIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Str, alu::LriOp2, PreIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Str, alu::AriOp2, PreIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Str, alu::RriOp2, PreIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldr, alu::LliOp2, PreIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldr, alu::LriOp2, PreIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldr, alu::AriOp2, PreIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldr, alu::RriOp2, PreIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldr, alu::LliOp2, PreIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldr, alu::LriOp2, PreIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldr, alu::AriOp2, PreIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldr, alu::RriOp2, PreIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Strb, alu::LliOp2, PreIncrement, NO_WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Strb, alu::LriOp2, PreIncrement, NO_WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Strb, alu::AriOp2, PreIncrement, NO_WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Strb, alu::RriOp2, PreIncrement, NO_WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Strb, alu::LliOp2, PreIncrement, NO_WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Strb, alu::LriOp2, PreIncrement, NO_WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Strb, alu::AriOp2, PreIncrement, NO_WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Strb, alu::RriOp2, PreIncrement, NO_WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldrb, alu::LliOp2, PreIncrement, NO_WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldrb, alu::LriOp2, PreIncrement, NO_WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldrb, alu::AriOp2, PreIncrement, NO_WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldrb, alu::RriOp2, PreIncrement, NO_WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldrb, alu::LliOp2, PreIncrement, NO_WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldrb, alu::LriOp2, PreIncrement, NO_WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldrb, alu::AriOp2, PreIncrement, NO_WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldrb, alu::RriOp2, PreIncrement, NO_WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Strb, alu::LliOp2, PreIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Strb, alu::LriOp2, PreIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Strb, alu::AriOp2, PreIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Strb, alu::RriOp2, PreIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Strb, alu::LliOp2, PreIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Strb, alu::LriOp2, PreIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Strb, alu::AriOp2, PreIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Strb, alu::RriOp2, PreIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldrb, alu::LliOp2, PreIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldrb, alu::LriOp2, PreIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldrb, alu::AriOp2, PreIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldrb, alu::RriOp2, PreIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldrb, alu::LliOp2, PreIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldrb, alu::LriOp2, PreIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldrb, alu::AriOp2, PreIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_single_data_transfer::<Ldrb, alu::RriOp2, PreIncrement, WRITEBACK>,
-    arm::arm_undefined,
-    arm::arm_block_data_transfer::<Stm, PostDecrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PostDecrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PostDecrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PostDecrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PostDecrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PostDecrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PostDecrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PostDecrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PostDecrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PostDecrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PostDecrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PostDecrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PostDecrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PostDecrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PostDecrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PostDecrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PostDecrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PostDecrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PostDecrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PostDecrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PostDecrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PostDecrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PostDecrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PostDecrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PostDecrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PostDecrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PostDecrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PostDecrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PostDecrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PostDecrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PostDecrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PostDecrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PostDecrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PostDecrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PostDecrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PostDecrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PostDecrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PostDecrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PostDecrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PostDecrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PostDecrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PostDecrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PostDecrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PostDecrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PostDecrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PostDecrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PostDecrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PostDecrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PostDecrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PostDecrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PostDecrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PostDecrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PostDecrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PostDecrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PostDecrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PostDecrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PostDecrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PostDecrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PostDecrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PostDecrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PostDecrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PostDecrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PostDecrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PostDecrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PostDecrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PostDecrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PostDecrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PostDecrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PostDecrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PostDecrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PostDecrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PostDecrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PostDecrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PostDecrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PostDecrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PostDecrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PostDecrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PostDecrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PostDecrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PostDecrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PostDecrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PostDecrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PostDecrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PostDecrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PostDecrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PostDecrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PostDecrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PostDecrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PostDecrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PostDecrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PostDecrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PostDecrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PostDecrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PostDecrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PostDecrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PostDecrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PostDecrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PostDecrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PostDecrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PostDecrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PostDecrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PostDecrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PostDecrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PostDecrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PostDecrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PostDecrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PostDecrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PostDecrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PostDecrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PostDecrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PostDecrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PostDecrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PostDecrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PostDecrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PostDecrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PostDecrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PostDecrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PostDecrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PostDecrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PostDecrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PostDecrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PostDecrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PostDecrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PostDecrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PostDecrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PostDecrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PostDecrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PostDecrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PostIncrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PostIncrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PostIncrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PostIncrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PostIncrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PostIncrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PostIncrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PostIncrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PostIncrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PostIncrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PostIncrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PostIncrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PostIncrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PostIncrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PostIncrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PostIncrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PostIncrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PostIncrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PostIncrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PostIncrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PostIncrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PostIncrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PostIncrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PostIncrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PostIncrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PostIncrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PostIncrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PostIncrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PostIncrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PostIncrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PostIncrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PostIncrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PostIncrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PostIncrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PostIncrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PostIncrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PostIncrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PostIncrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PostIncrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PostIncrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PostIncrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PostIncrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PostIncrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PostIncrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PostIncrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PostIncrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PostIncrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PostIncrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PostIncrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PostIncrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PostIncrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PostIncrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PostIncrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PostIncrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PostIncrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PostIncrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PostIncrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PostIncrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PostIncrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PostIncrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PostIncrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PostIncrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PostIncrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PostIncrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PostIncrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PostIncrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PostIncrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PostIncrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PostIncrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PostIncrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PostIncrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PostIncrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PostIncrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PostIncrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PostIncrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PostIncrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PostIncrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PostIncrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PostIncrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PostIncrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PostIncrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PostIncrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PostIncrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PostIncrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PostIncrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PostIncrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PostIncrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PostIncrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PostIncrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PostIncrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PostIncrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PostIncrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PostIncrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PostIncrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PostIncrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PostIncrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PostIncrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PostIncrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PostIncrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PostIncrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PostIncrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PostIncrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PostIncrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PostIncrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PostIncrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PostIncrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PostIncrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PostIncrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PostIncrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PostIncrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PostIncrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PostIncrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PostIncrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PostIncrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PostIncrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PostIncrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PostIncrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PostIncrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PostIncrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PostIncrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PostIncrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PostIncrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PostIncrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PostIncrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PostIncrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PostIncrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PostIncrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PostIncrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PreDecrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PreDecrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PreDecrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PreDecrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PreDecrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PreDecrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PreDecrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PreDecrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PreDecrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PreDecrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PreDecrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PreDecrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PreDecrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PreDecrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PreDecrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PreDecrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PreDecrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PreDecrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PreDecrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PreDecrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PreDecrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PreDecrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PreDecrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PreDecrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PreDecrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PreDecrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PreDecrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PreDecrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PreDecrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PreDecrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PreDecrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PreDecrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PreDecrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PreDecrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PreDecrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PreDecrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PreDecrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PreDecrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PreDecrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PreDecrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PreDecrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PreDecrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PreDecrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PreDecrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PreDecrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PreDecrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PreDecrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PreDecrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PreDecrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PreDecrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PreDecrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PreDecrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PreDecrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PreDecrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PreDecrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PreDecrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PreDecrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PreDecrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PreDecrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PreDecrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PreDecrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PreDecrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PreDecrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PreDecrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PreDecrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PreDecrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PreDecrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PreDecrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PreDecrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PreDecrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PreDecrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PreDecrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PreDecrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PreDecrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PreDecrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PreDecrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PreDecrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PreDecrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PreDecrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PreDecrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PreDecrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PreDecrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PreDecrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PreDecrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PreDecrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PreDecrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PreDecrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PreDecrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PreDecrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PreDecrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PreDecrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PreDecrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PreDecrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PreDecrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PreDecrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PreDecrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PreDecrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PreDecrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PreDecrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PreDecrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PreDecrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PreDecrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PreDecrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PreDecrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PreDecrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PreDecrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PreDecrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PreDecrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PreDecrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PreDecrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PreDecrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PreDecrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PreDecrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PreDecrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PreDecrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PreDecrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PreDecrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PreDecrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PreDecrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PreDecrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PreDecrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PreDecrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PreDecrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PreDecrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PreDecrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PreDecrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PreDecrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PreDecrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PreIncrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PreIncrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PreIncrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PreIncrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PreIncrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PreIncrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PreIncrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PreIncrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PreIncrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PreIncrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PreIncrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PreIncrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PreIncrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PreIncrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PreIncrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PreIncrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PreIncrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PreIncrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PreIncrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PreIncrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PreIncrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PreIncrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PreIncrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PreIncrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PreIncrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PreIncrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PreIncrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PreIncrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PreIncrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PreIncrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PreIncrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PreIncrement, NO_WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PreIncrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PreIncrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PreIncrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PreIncrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PreIncrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PreIncrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PreIncrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PreIncrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PreIncrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PreIncrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PreIncrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PreIncrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PreIncrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PreIncrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PreIncrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PreIncrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PreIncrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PreIncrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PreIncrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PreIncrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PreIncrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PreIncrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PreIncrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PreIncrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PreIncrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PreIncrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PreIncrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PreIncrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PreIncrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PreIncrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PreIncrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Ldm, PreIncrement, WRITEBACK, S_FLAG_CLR>,
-    arm::arm_block_data_transfer::<Stm, PreIncrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PreIncrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PreIncrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PreIncrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PreIncrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PreIncrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PreIncrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PreIncrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PreIncrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PreIncrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PreIncrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PreIncrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PreIncrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PreIncrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PreIncrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PreIncrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PreIncrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PreIncrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PreIncrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PreIncrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PreIncrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PreIncrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PreIncrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PreIncrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PreIncrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PreIncrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PreIncrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PreIncrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PreIncrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PreIncrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PreIncrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PreIncrement, NO_WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PreIncrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PreIncrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PreIncrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PreIncrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PreIncrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PreIncrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PreIncrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PreIncrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PreIncrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PreIncrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PreIncrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PreIncrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PreIncrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PreIncrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PreIncrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Stm, PreIncrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PreIncrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PreIncrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PreIncrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PreIncrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PreIncrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PreIncrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PreIncrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PreIncrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PreIncrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PreIncrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PreIncrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PreIncrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PreIncrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PreIncrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PreIncrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_block_data_transfer::<Ldm, PreIncrement, WRITEBACK, S_FLAG_SET>,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_b,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_bl,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_coprocessor_instr,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-    arm::arm_swi,
-];
+        0b010 => arm_word_transfer::<SDTImmOffset>(row),
+        0b011 if col & 0b0001 != 0 => arm::arm_undefined,
+        0b011 => match (col >> 1) & 0b11 {
+            0b00 => arm_word_transfer::<alu::LliOp2>(row),
+            0b01 => arm_word_transfer::<alu::LriOp2>(row),
+            0b10 => arm_word_transfer::<alu::AriOp2>(row),
+            _ => arm_word_transfer::<alu::RriOp2>(row),
+        },
+
+        0b100 if row & 0x01 == 0 => arm_block_transfer::<Stm>(row),
+        0b100 => arm_block_transfer::<Ldm>(row),
+        0b101 if row & 0x10 == 0 => arm::arm_b,
+        0b101 => arm::arm_bl,
+        0b110 => arm::arm_coprocessor_instr,
+        _ if row & 0x10 == 0 => arm::arm_coprocessor_instr,
+        _ => arm::arm_swi,
+    }
+}
+
+const fn arm_multiply_or_swap(row: u32) -> InstrFn {
+    match row {
+        0x00 => arm::arm_mul::<S_FLAG_CLR, A_FLAG_CLR>,
+        0x01 => arm::arm_mul::<S_FLAG_SET, A_FLAG_CLR>,
+        0x02 => arm::arm_mul::<S_FLAG_CLR, A_FLAG_SET>,
+        0x03 => arm::arm_mul::<S_FLAG_SET, A_FLAG_SET>,
+        0x08 => arm::arm_mul_long::<UNSIGNED, S_FLAG_CLR, A_FLAG_CLR>,
+        0x09 => arm::arm_mul_long::<UNSIGNED, S_FLAG_SET, A_FLAG_CLR>,
+        0x0A => arm::arm_mul_long::<UNSIGNED, S_FLAG_CLR, A_FLAG_SET>,
+        0x0B => arm::arm_mul_long::<UNSIGNED, S_FLAG_SET, A_FLAG_SET>,
+        0x0C => arm::arm_mul_long::<SIGNED, S_FLAG_CLR, A_FLAG_CLR>,
+        0x0D => arm::arm_mul_long::<SIGNED, S_FLAG_SET, A_FLAG_CLR>,
+        0x0E => arm::arm_mul_long::<SIGNED, S_FLAG_CLR, A_FLAG_SET>,
+        0x0F => arm::arm_mul_long::<SIGNED, S_FLAG_SET, A_FLAG_SET>,
+        0x10 => arm::arm_swp::<SWP_WORD>,
+        0x14 => arm::arm_swp::<SWP_BYTE>,
+        _ => arm::arm_undefined,
+    }
+}
+
+/// MRS, MSR, BX and the ARMv5 instructions that share their encoding space.
+const fn arm_misc(row: u32, col: u32) -> InstrFn {
+    match (row, col) {
+        (0x10, 0x0) => arm::arm_mrs::<alu::Cpsr>,
+        (0x14, 0x0) => arm::arm_mrs::<alu::Spsr>,
+        (0x12, 0x0) => arm::arm_msr::<alu::Cpsr, alu::LliOp2>,
+        (0x16, 0x0) => arm::arm_msr::<alu::Spsr, alu::LliOp2>,
+        (0x12, 0x1) => arm::arm_bx,
+        (0x12, 0x3) => arm::arm_blx,
+        (0x12, 0x7) => arm::arm_bkpt,
+        (0x16, 0x1) => arm::arm_clz,
+        // QADD and friends, and the halfword multiplies.
+        (_, 0x5) | (_, 0x8) | (_, 0xA) | (_, 0xC) | (_, 0xE) => arm::arm_m_extension_undefined,
+        _ => arm::arm_undefined,
+    }
+}
+
+#[derive(Clone, Copy)]
+enum Operand2 {
+    Imm,
+    Lli,
+    Llr,
+    Lri,
+    Lrr,
+    Ari,
+    Arr,
+    Rri,
+    Rrr,
+}
+
+impl Operand2 {
+    /// The shifted register operand selected by bits 4-6 of the opcode.
+    const fn from_col(col: u32) -> Operand2 {
+        match col & 0b111 {
+            0 => Operand2::Lli,
+            1 => Operand2::Llr,
+            2 => Operand2::Lri,
+            3 => Operand2::Lrr,
+            4 => Operand2::Ari,
+            5 => Operand2::Arr,
+            6 => Operand2::Rri,
+            _ => Operand2::Rrr,
+        }
+    }
+}
+
+const fn arm_dataproc(row: u32, op2: Operand2) -> InstrFn {
+    let s = row & 0x01 != 0;
+    match (row >> 1) & 0xF {
+        0x0 => arm_dataproc_flags::<alu::AndOp>(s, op2),
+        0x1 => arm_dataproc_flags::<alu::EorOp>(s, op2),
+        0x2 => arm_dataproc_flags::<alu::SubOp>(s, op2),
+        0x3 => arm_dataproc_flags::<alu::RsbOp>(s, op2),
+        0x4 => arm_dataproc_flags::<alu::AddOp>(s, op2),
+        0x5 => arm_dataproc_flags::<alu::AdcOp>(s, op2),
+        0x6 => arm_dataproc_flags::<alu::SbcOp>(s, op2),
+        0x7 => arm_dataproc_flags::<alu::RscOp>(s, op2),
+        0x8 => arm_dataproc_flags::<alu::TstOp>(s, op2),
+        0x9 => arm_dataproc_flags::<alu::TeqOp>(s, op2),
+        0xA => arm_dataproc_flags::<alu::CmpOp>(s, op2),
+        0xB => arm_dataproc_flags::<alu::CmnOp>(s, op2),
+        0xC => arm_dataproc_flags::<alu::OrrOp>(s, op2),
+        0xD => arm_dataproc_flags::<alu::MovOp>(s, op2),
+        0xE => arm_dataproc_flags::<alu::BicOp>(s, op2),
+        _ => arm_dataproc_flags::<alu::MvnOp>(s, op2),
+    }
+}
+
+const fn arm_dataproc_flags<O: BinaryOp>(s: bool, op2: Operand2) -> InstrFn {
+    if s {
+        arm_dataproc_op2::<O, S_FLAG_SET>(op2)
+    } else {
+        arm_dataproc_op2::<O, S_FLAG_CLR>(op2)
+    }
+}
+
+const fn arm_dataproc_op2<O: BinaryOp, const S: bool>(op2: Operand2) -> InstrFn {
+    match op2 {
+        Operand2::Imm => arm::arm_dataproc::<O, S, alu::ImmOp2>,
+        Operand2::Lli => arm::arm_dataproc::<O, S, alu::LliOp2>,
+        Operand2::Llr => arm::arm_dataproc::<O, S, alu::LlrOp2>,
+        Operand2::Lri => arm::arm_dataproc::<O, S, alu::LriOp2>,
+        Operand2::Lrr => arm::arm_dataproc::<O, S, alu::LrrOp2>,
+        Operand2::Ari => arm::arm_dataproc::<O, S, alu::AriOp2>,
+        Operand2::Arr => arm::arm_dataproc::<O, S, alu::ArrOp2>,
+        Operand2::Rri => arm::arm_dataproc::<O, S, alu::RriOp2>,
+        Operand2::Rrr => arm::arm_dataproc::<O, S, alu::RrrOp2>,
+    }
+}
+
+/// LDR, STR, LDRB and STRB. The T variants (post-indexed with the W bit set) only differ in
+/// the mode used for the access, which doesn't matter on the GBA, so they share the
+/// functions of the normal post-indexed transfers.
+const fn arm_word_transfer<O: SDTCalculateOffset>(row: u32) -> InstrFn {
+    let byte = row & 0x04 != 0;
+    let load = row & 0x01 != 0;
+    match (byte, load) {
+        (false, false) => arm_transfer_indexing::<Str, O>(row),
+        (false, true) => arm_transfer_indexing::<Ldr, O>(row),
+        (true, false) => arm_transfer_indexing::<Strb, O>(row),
+        (true, true) => arm_transfer_indexing::<Ldrb, O>(row),
+    }
+}
+
+/// LDRH, STRH, LDRSB and LDRSH. The LDRD and STRD encodings are undefined on the ARM7TDMI.
+const fn arm_halfword_transfer(row: u32, col: u32) -> InstrFn {
+    let load = row & 0x01 != 0;
+    let imm = row & 0x04 != 0;
+    match (col, load, imm) {
+        (0xB, false, false) => arm_transfer_indexing::<Strh, HalfwordAndSignedRegOffset>(row),
+        (0xB, false, true) => arm_transfer_indexing::<Strh, HalfwordAndSignedImmOffset>(row),
+        (0xB, true, false) => arm_transfer_indexing::<Ldrh, HalfwordAndSignedRegOffset>(row),
+        (0xB, true, true) => arm_transfer_indexing::<Ldrh, HalfwordAndSignedImmOffset>(row),
+        (0xD, true, false) => arm_transfer_indexing::<Ldrsb, HalfwordAndSignedRegOffset>(row),
+        (0xD, true, true) => arm_transfer_indexing::<Ldrsb, HalfwordAndSignedImmOffset>(row),
+        (0xF, true, false) => arm_transfer_indexing::<Ldrsh, HalfwordAndSignedRegOffset>(row),
+        (0xF, true, true) => arm_transfer_indexing::<Ldrsh, HalfwordAndSignedImmOffset>(row),
+        _ => arm::arm_m_extension_undefined,
+    }
+}
+
+/// Post-indexed transfers always write back.
+const fn arm_transfer_indexing<T, O>(row: u32) -> InstrFn
+where
+    T: SingleDataTransfer,
+    O: SDTCalculateOffset,
+{
+    let pre = row & 0x10 != 0;
+    let up = row & 0x08 != 0;
+    let writeback = row & 0x02 != 0;
+    match (pre, up, writeback) {
+        (false, false, _) => arm::arm_single_data_transfer::<T, O, PostDecrement, WRITEBACK>,
+        (false, true, _) => arm::arm_single_data_transfer::<T, O, PostIncrement, WRITEBACK>,
+        (true, false, false) => arm::arm_single_data_transfer::<T, O, PreDecrement, NO_WRITEBACK>,
+        (true, false, true) => arm::arm_single_data_transfer::<T, O, PreDecrement, WRITEBACK>,
+        (true, true, false) => arm::arm_single_data_transfer::<T, O, PreIncrement, NO_WRITEBACK>,
+        (true, true, true) => arm::arm_single_data_transfer::<T, O, PreIncrement, WRITEBACK>,
+    }
+}
+
+const fn arm_block_transfer<T: BlockDataTransfer>(row: u32) -> InstrFn {
+    let pre = row & 0x10 != 0;
+    let up = row & 0x08 != 0;
+    match (pre, up) {
+        (false, false) => arm_block_transfer_flags::<T, PostDecrement>(row),
+        (false, true) => arm_block_transfer_flags::<T, PostIncrement>(row),
+        (true, false) => arm_block_transfer_flags::<T, PreDecrement>(row),
+        (true, true) => arm_block_transfer_flags::<T, PreIncrement>(row),
+    }
+}
 
-#[rustfmt::skip]
-pub const THUMB_OPCODE_TABLE: [InstrFn; 256] = [
-    thumb::thumb_move_shifted_register::<alu::LslOp>,
-    thumb::thumb_move_shifted_register::<alu::LslOp>,
-    thumb::thumb_move_shifted_register::<alu::LslOp>,
-    thumb::thumb_move_shifted_register::<alu::LslOp>,
-    thumb::thumb_move_shifted_register::<alu::LslOp>,
-    thumb::thumb_move_shifted_register::<alu::LslOp>,
-    thumb::thumb_move_shifted_register::<alu::LslOp>,
-    thumb::thumb_move_shifted_register::<alu::LslOp>,
-    thumb::thumb_move_shifted_register::<alu::LsrOp>,
-    thumb::thumb_move_shifted_register::<alu::LsrOp>,
-    thumb::thumb_move_shifted_register::<alu::LsrOp>,
-    thumb::thumb_move_shifted_register::<alu::LsrOp>,
-    thumb::thumb_move_shifted_register::<alu::LsrOp>,
-    thumb::thumb_move_shifted_register::<alu::LsrOp>,
-    thumb::thumb_move_shifted_register::<alu::LsrOp>,
-    thumb::thumb_move_shifted_register::<alu::LsrOp>,
-    thumb::thumb_move_shifted_register::<alu::AsrOp>,
-    thumb::thumb_move_shifted_register::<alu::AsrOp>,
-    thumb::thumb_move_shifted_register::<alu::AsrOp>,
-    thumb::thumb_move_shifted_register::<alu::AsrOp>,
-    thumb::thumb_move_shifted_register::<alu::AsrOp>,
-    thumb::thumb_move_shifted_register::<alu::AsrOp>,
-    thumb::thumb_move_shifted_register::<alu::AsrOp>,
-    thumb::thumb_move_shifted_register::<alu::AsrOp>,
-    thumb::thumb_add_subtract::<alu::AddSubtractReg3, alu::AddOp>,
-    thumb::thumb_add_subtract::<alu::AddSubtractReg3, alu::AddOp>,
-    thumb::thumb_add_subtract::<alu::AddSubtractReg3, alu::SubOp>,
-    thumb::thumb_add_subtract::<alu::AddSubtractReg3, alu::SubOp>,
-    thumb::thumb_add_subtract::<alu::AddSubtractImm3, alu::AddOp>,
-    thumb::thumb_add_subtract::<alu::AddSubtractImm3, alu::AddOp>,
-    thumb::thumb_add_subtract::<alu::AddSubtractImm3, alu::SubOp>,
-    thumb::thumb_add_subtract::<alu::AddSubtractImm3, alu::SubOp>,
-    thumb::thumb_mov_compare_add_subtract_imm::<0, alu::MovOp>,
-    thumb::thumb_mov_compare_add_subtract_imm::<1, alu::MovOp>,
-    thumb::thumb_mov_compare_add_subtract_imm::<2, alu::MovOp>,
-    thumb::thumb_mov_compare_add_subtract_imm::<3, alu::MovOp>,
-    thumb::thumb_mov_compare_add_subtract_imm::<4, alu::MovOp>,
-    thumb::thumb_mov_compare_add_subtract_imm::<5, alu::MovOp>,
-    thumb::thumb_mov_compare_add_subtract_imm::<6, alu::MovOp>,
-    thumb::thumb_mov_compare_add_subtract_imm::<7, alu::MovOp>,
-    thumb::thumb_mov_compare_add_subtract_imm::<0, alu::CmpOp>,
-    thumb::thumb_mov_compare_add_subtract_imm::<1, alu::CmpOp>,
-    thumb::thumb_mov_compare_add_subtract_imm::<2, alu::CmpOp>,
-    thumb::thumb_mov_compare_add_subtract_imm::<3, alu::CmpOp>,
-    thumb::thumb_mov_compare_add_subtract_imm::<4, alu::CmpOp>,
-    thumb::thumb_mov_compare_add_subtract_imm::<5, alu::CmpOp>,
-    thumb::thumb_mov_compare_add_subtract_imm::<6, alu::CmpOp>,
-    thumb::thumb_mov_compare_add_subtract_imm::<7, alu::CmpOp>,
-    thumb::thumb_mov_compare_add_subtract_imm::<0, alu::AddOp>,
-    thumb::thumb_mov_compare_add_subtract_imm::<1, alu::AddOp>,
-    thumb::thumb_mov_compare_add_subtract_imm::<2, alu::AddOp>,
-    thumb::thumb_mov_compare_add_subtract_imm::<3, alu::AddOp>,
-    thumb::thumb_mov_compare_add_subtract_imm::<4, alu::AddOp>,
-    thumb::thumb_mov_compare_add_subtract_imm::<5, alu::AddOp>,
-    thumb::thumb_mov_compare_add_subtract_imm::<6, alu::AddOp>,
-    thumb::thumb_mov_compare_add_subtract_imm::<7, alu::AddOp>,
-    thumb::thumb_mov_compare_add_subtract_imm::<0, alu::SubOp>,
-    thumb::thumb_mov_compare_add_subtract_imm::<1, alu::SubOp>,
-    thumb::thumb_mov_compare_add_subtract_imm::<2, alu::SubOp>,
-    thumb::thumb_mov_compare_add_subtract_imm::<3, alu::SubOp>,
-    thumb::thumb_mov_compare_add_subtract_imm::<4, alu::SubOp>,
-    thumb::thumb_mov_compare_add_subtract_imm::<5, alu::SubOp>,
-    thumb::thumb_mov_compare_add_subtract_imm::<6, alu::SubOp>,
-    thumb::thumb_mov_compare_add_subtract_imm::<7, alu::SubOp>,
-    thumb::thumb_alu_operation,
-    thumb::thumb_alu_operation,
-    thumb::thumb_alu_operation,
-    thumb::thumb_alu_operation,
-    thumb::thumb_hi_register_op::<alu::AddOp>,
-    thumb::thumb_hi_register_op::<alu::CmpOp>,
-    thumb::thumb_hi_register_op::<alu::MovOp>,
-    thumb::thumb_bx,
-    thumb::thumb_single_data_transfer::<Ldr, ConstReg<0>, WordAlignedPc, ThumbImm8ExtendedTo10, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Ldr, ConstReg<1>, WordAlignedPc, ThumbImm8ExtendedTo10, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Ldr, ConstReg<2>, WordAlignedPc, ThumbImm8ExtendedTo10, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Ldr, ConstReg<3>, WordAlignedPc, ThumbImm8ExtendedTo10, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Ldr, ConstReg<4>, WordAlignedPc, ThumbImm8ExtendedTo10, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Ldr, ConstReg<5>, WordAlignedPc, ThumbImm8ExtendedTo10, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Ldr, ConstReg<6>, WordAlignedPc, ThumbImm8ExtendedTo10, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Ldr, ConstReg<7>, WordAlignedPc, ThumbImm8ExtendedTo10, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Str, RegAt<0, 2>, RegAtValue<3, 5>, ThumbRegisterOffset, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Str, RegAt<0, 2>, RegAtValue<3, 5>, ThumbRegisterOffset, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Strh, RegAt<0, 2>, RegAtValue<3, 5>, ThumbRegisterOffset, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Strh, RegAt<0, 2>, RegAtValue<3, 5>, ThumbRegisterOffset, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Strb, RegAt<0, 2>, RegAtValue<3, 5>, ThumbRegisterOffset, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Strb, RegAt<0, 2>, RegAtValue<3, 5>, ThumbRegisterOffset, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Ldrsb, RegAt<0, 2>, RegAtValue<3, 5>, ThumbRegisterOffset, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Ldrsb, RegAt<0, 2>, RegAtValue<3, 5>, ThumbRegisterOffset, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Ldr, RegAt<0, 2>, RegAtValue<3, 5>, ThumbRegisterOffset, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Ldr, RegAt<0, 2>, RegAtValue<3, 5>, ThumbRegisterOffset, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Ldrh, RegAt<0, 2>, RegAtValue<3, 5>, ThumbRegisterOffset, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Ldrh, RegAt<0, 2>, RegAtValue<3, 5>, ThumbRegisterOffset, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Ldrb, RegAt<0, 2>, RegAtValue<3, 5>, ThumbRegisterOffset, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Ldrb, RegAt<0, 2>, RegAtValue<3, 5>, ThumbRegisterOffset, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Ldrsh, RegAt<0, 2>, RegAtValue<3, 5>, ThumbRegisterOffset, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Ldrsh, RegAt<0, 2>, RegAtValue<3, 5>, ThumbRegisterOffset, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Str, RegAt<0, 2>, RegAtValue<3, 5>, ThumbImm5ExtendedTo7, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Str, RegAt<0, 2>, RegAtValue<3, 5>, ThumbImm5ExtendedTo7, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Str, RegAt<0, 2>, RegAtValue<3, 5>, ThumbImm5ExtendedTo7, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Str, RegAt<0, 2>, RegAtValue<3, 5>, ThumbImm5ExtendedTo7, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Str, RegAt<0, 2>, RegAtValue<3, 5>, ThumbImm5ExtendedTo7, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Str, RegAt<0, 2>, RegAtValue<3, 5>, ThumbImm5ExtendedTo7, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Str, RegAt<0, 2>, RegAtValue<3, 5>, ThumbImm5ExtendedTo7, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Str, RegAt<0, 2>, RegAtValue<3, 5>, ThumbImm5ExtendedTo7, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Ldr, RegAt<0, 2>, RegAtValue<3, 5>, ThumbImm5ExtendedTo7, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Ldr, RegAt<0, 2>, RegAtValue<3, 5>, ThumbImm5ExtendedTo7, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Ldr, RegAt<0, 2>, RegAtValue<3, 5>, ThumbImm5ExtendedTo7, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Ldr, RegAt<0, 2>, RegAtValue<3, 5>, ThumbImm5ExtendedTo7, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Ldr, RegAt<0, 2>, RegAtValue<3, 5>, ThumbImm5ExtendedTo7, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Ldr, RegAt<0, 2>, RegAtValue<3, 5>, ThumbImm5ExtendedTo7, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Ldr, RegAt<0, 2>, RegAtValue<3, 5>, ThumbImm5ExtendedTo7, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Ldr, RegAt<0, 2>, RegAtValue<3, 5>, ThumbImm5ExtendedTo7, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Strb, RegAt<0, 2>, RegAtValue<3, 5>, ThumbImm5, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Strb, RegAt<0, 2>, RegAtValue<3, 5>, ThumbImm5, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Strb, RegAt<0, 2>, RegAtValue<3, 5>, ThumbImm5, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Strb, RegAt<0, 2>, RegAtValue<3, 5>, ThumbImm5, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Strb, RegAt<0, 2>, RegAtValue<3, 5>, ThumbImm5, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Strb, RegAt<0, 2>, RegAtValue<3, 5>, ThumbImm5, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Strb, RegAt<0, 2>, RegAtValue<3, 5>, ThumbImm5, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Strb, RegAt<0, 2>, RegAtValue<3, 5>, ThumbImm5, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Ldrb, RegAt<0, 2>, RegAtValue<3, 5>, ThumbImm5, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Ldrb, RegAt<0, 2>, RegAtValue<3, 5>, ThumbImm5, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Ldrb, RegAt<0, 2>, RegAtValue<3, 5>, ThumbImm5, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Ldrb, RegAt<0, 2>, RegAtValue<3, 5>, ThumbImm5, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Ldrb, RegAt<0, 2>, RegAtValue<3, 5>, ThumbImm5, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Ldrb, RegAt<0, 2>, RegAtValue<3, 5>, ThumbImm5, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Ldrb, RegAt<0, 2>, RegAtValue<3, 5>, ThumbImm5, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Ldrb, RegAt<0, 2>, RegAtValue<3, 5>, ThumbImm5, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Strh, RegAt<0, 2>, RegAtValue<3, 5>, ThumbImm5ExtendedTo6, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Strh, RegAt<0, 2>, RegAtValue<3, 5>, ThumbImm5ExtendedTo6, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Strh, RegAt<0, 2>, RegAtValue<3, 5>, ThumbImm5ExtendedTo6, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Strh, RegAt<0, 2>, RegAtValue<3, 5>, ThumbImm5ExtendedTo6, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Strh, RegAt<0, 2>, RegAtValue<3, 5>, ThumbImm5ExtendedTo6, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Strh, RegAt<0, 2>, RegAtValue<3, 5>, ThumbImm5ExtendedTo6, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Strh, RegAt<0, 2>, RegAtValue<3, 5>, ThumbImm5ExtendedTo6, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Strh, RegAt<0, 2>, RegAtValue<3, 5>, ThumbImm5ExtendedTo6, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Ldrh, RegAt<0, 2>, RegAtValue<3, 5>, ThumbImm5ExtendedTo6, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Ldrh, RegAt<0, 2>, RegAtValue<3, 5>, ThumbImm5ExtendedTo6, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Ldrh, RegAt<0, 2>, RegAtValue<3, 5>, ThumbImm5ExtendedTo6, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Ldrh, RegAt<0, 2>, RegAtValue<3, 5>, ThumbImm5ExtendedTo6, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Ldrh, RegAt<0, 2>, RegAtValue<3, 5>, ThumbImm5ExtendedTo6, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Ldrh, RegAt<0, 2>, RegAtValue<3, 5>, ThumbImm5ExtendedTo6, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Ldrh, RegAt<0, 2>, RegAtValue<3, 5>, ThumbImm5ExtendedTo6, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Ldrh, RegAt<0, 2>, RegAtValue<3, 5>, ThumbImm5ExtendedTo6, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Str, RegAt<8, 9>, RegValue<13>, ThumbImm8ExtendedTo10, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Str, RegAt<8, 9>, RegValue<13>, ThumbImm8ExtendedTo10, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Str, RegAt<8, 9>, RegValue<13>, ThumbImm8ExtendedTo10, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Str, RegAt<8, 9>, RegValue<13>, ThumbImm8ExtendedTo10, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Str, RegAt<8, 9>, RegValue<13>, ThumbImm8ExtendedTo10, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Str, RegAt<8, 9>, RegValue<13>, ThumbImm8ExtendedTo10, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Str, RegAt<8, 9>, RegValue<13>, ThumbImm8ExtendedTo10, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Str, RegAt<8, 9>, RegValue<13>, ThumbImm8ExtendedTo10, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Ldr, RegAt<8, 9>, RegValue<13>, ThumbImm8ExtendedTo10, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Ldr, RegAt<8, 9>, RegValue<13>, ThumbImm8ExtendedTo10, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Ldr, RegAt<8, 9>, RegValue<13>, ThumbImm8ExtendedTo10, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Ldr, RegAt<8, 9>, RegValue<13>, ThumbImm8ExtendedTo10, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Ldr, RegAt<8, 9>, RegValue<13>, ThumbImm8ExtendedTo10, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Ldr, RegAt<8, 9>, RegValue<13>, ThumbImm8ExtendedTo10, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Ldr, RegAt<8, 9>, RegValue<13>, ThumbImm8ExtendedTo10, PreIncrement>,
-    thumb::thumb_single_data_transfer::<Ldr, RegAt<8, 9>, RegValue<13>, ThumbImm8ExtendedTo10, PreIncrement>,
-    thumb::thumb_load_address::<0, WordAlignedPc>,
-    thumb::thumb_load_address::<1, WordAlignedPc>,
-    thumb::thumb_load_address::<2, WordAlignedPc>,
-    thumb::thumb_load_address::<3, WordAlignedPc>,
-    thumb::thumb_load_address::<4, WordAlignedPc>,
-    thumb::thumb_load_address::<5, WordAlignedPc>,
-    thumb::thumb_load_address::<6, WordAlignedPc>,
-    thumb::thumb_load_address::<7, WordAlignedPc>,
-    thumb::thumb_load_address::<0, RegValue<13>>,
-    thumb::thumb_load_address::<1, RegValue<13>>,
-    thumb::thumb_load_address::<2, RegValue<13>>,
-    thumb::thumb_load_address::<3, RegValue<13>>,
-    thumb::thumb_load_address::<4, RegValue<13>>,
-    thumb::thumb_load_address::<5, RegValue<13>>,
-    thumb::thumb_load_address::<6, RegValue<13>>,
-    thumb::thumb_load_address::<7, RegValue<13>>,
-    thumb::thumb_add_sp,
-    thumb::thumb_undefined,
-    thumb::thumb_undefined,
-    thumb::thumb_undefined,
-    thumb::thumb_block_data_transfer::<Stm, ConstReg<13>, ThumbRegisterList, PreDecrement>,
-    thumb::thumb_block_data_transfer::<Stm, ConstReg<13>, ThumbRegisterListWithLr, PreDecrement>,
-    thumb::thumb_undefined,
-    thumb::thumb_undefined,
-    thumb::thumb_undefined,
-    thumb::thumb_undefined,
-    thumb::thumb_undefined,
-    thumb::thumb_undefined,
-    thumb::thumb_block_data_transfer::<Ldm, ConstReg<13>, ThumbRegisterList, PostIncrement>,
-    thumb::thumb_block_data_transfer::<Ldm, ConstReg<13>, ThumbRegisterListWithPc, PostIncrement>,
-    thumb::thumb_bkpt,
-    thumb::thumb_undefined,
-    thumb::thumb_block_data_transfer::<Stm, ConstReg<0>, ThumbRegisterList, PostIncrement>,
-    thumb::thumb_block_data_transfer::<Stm, ConstReg<1>, ThumbRegisterList, PostIncrement>,
-    thumb::thumb_block_data_transfer::<Stm, ConstReg<2>, ThumbRegisterList, PostIncrement>,
-    thumb::thumb_block_data_transfer::<Stm, ConstReg<3>, ThumbRegisterList, PostIncrement>,
-    thumb::thumb_block_data_transfer::<Stm, ConstReg<4>, ThumbRegisterList, PostIncrement>,
-    thumb::thumb_block_data_transfer::<Stm, ConstReg<5>, ThumbRegisterList, PostIncrement>,
-    thumb::thumb_block_data_transfer::<Stm, ConstReg<6>, ThumbRegisterList, PostIncrement>,
-    thumb::thumb_block_data_transfer::<Stm, ConstReg<7>, ThumbRegisterList, PostIncrement>,
-    thumb::thumb_block_data_transfer::<Ldm, ConstReg<0>, ThumbRegisterList, PostIncrement>,
-    thumb::thumb_block_data_transfer::<Ldm, ConstReg<1>, ThumbRegisterList, PostIncrement>,
-    thumb::thumb_block_data_transfer::<Ldm, ConstReg<2>, ThumbRegisterList, PostIncrement>,
-    thumb::thumb_block_data_transfer::<Ldm, ConstReg<3>, ThumbRegisterList, PostIncrement>,
-    thumb::thumb_block_data_transfer::<Ldm, ConstReg<4>, ThumbRegisterList, PostIncrement>,
-    thumb::thumb_block_data_transfer::<Ldm, ConstReg<5>, ThumbRegisterList, PostIncrement>,
-    thumb::thumb_block_data_transfer::<Ldm, ConstReg<6>, ThumbRegisterList, PostIncrement>,
-    thumb::thumb_block_data_transfer::<Ldm, ConstReg<7>, ThumbRegisterList, PostIncrement>,
-    thumb::thumb_conditional_branch::<COND_EQ>,
-    thumb::thumb_conditional_branch::<COND_NE>,
-    thumb::thumb_conditional_branch::<COND_CS>,
-    thumb::thumb_conditional_branch::<COND_CC>,
-    thumb::thumb_conditional_branch::<COND_MI>,
-    thumb::thumb_conditional_branch::<COND_PL>,
-    thumb::thumb_conditional_branch::<COND_VS>,
-    thumb::thumb_conditional_branch::<COND_VC>,
-    thumb::thumb_conditional_branch::<COND_HI>,
-    thumb::thumb_conditional_branch::<COND_LS>,
-    thumb::thumb_conditional_branch::<COND_GE>,
-    thumb::thumb_conditional_branch::<COND_LT>,
-    thumb::thumb_conditional_branch::<COND_GT>,
-    thumb::thumb_conditional_branch::<COND_LE>,
-    thumb::thumb_undefined,
-    thumb::thumb_swi,
-    thumb::thumb_unconditional_branch,
-    thumb::thumb_unconditional_branch,
-    thumb::thumb_unconditional_branch,
-    thumb::thumb_unconditional_branch,
-    thumb::thumb_unconditional_branch,
-    thumb::thumb_unconditional_branch,
-    thumb::thumb_unconditional_branch,
-    thumb::thumb_unconditional_branch,
-    thumb::thumb_blx,
-    thumb::thumb_blx,
-    thumb::thumb_blx,
-    thumb::thumb_blx,
-    thumb::thumb_blx,
-    thumb::thumb_blx,
-    thumb::thumb_blx,
-    thumb::thumb_blx,
-    thumb::thumb_bl_setup,
-    thumb::thumb_bl_setup,
-    thumb::thumb_bl_setup,
-    thumb::thumb_bl_setup,
-    thumb::thumb_bl_setup,
-    thumb::thumb_bl_setup,
-    thumb::thumb_bl_setup,
-    thumb::thumb_bl_setup,
-    thumb::thumb_bl_complete,
-    thumb::thumb_bl_complete,
-    thumb::thumb_bl_complete,
-    thumb::thumb_bl_complete,
-    thumb::thumb_bl_complete,
-    thumb::thumb_bl_complete,
-    thumb::thumb_bl_complete,
-    thumb::thumb_bl_complete,
-];
+const fn arm_block_transfer_flags<T, I>(row: u32) -> InstrFn
+where
+    T: BlockDataTransfer,
+    I: IndexingMode,
+{
+    let s = row & 0x04 != 0;
+    let writeback = row & 0x02 != 0;
+    match (writeback, s) {
+        (false, false) => arm::arm_block_data_transfer::<T, I, NO_WRITEBACK, S_FLAG_CLR>,
+        (false, true) => arm::arm_block_data_transfer::<T, I, NO_WRITEBACK, S_FLAG_SET>,
+        (true, false) => arm::arm_block_data_transfer::<T, I, WRITEBACK, S_FLAG_CLR>,
+        (true, true) => arm::arm_block_data_transfer::<T, I, WRITEBACK, S_FLAG_SET>,
+    }
+}
+
+/// `opcode` only has bits 6-15 set.
+const fn thumb_entry(opcode: u32) -> InstrFn {
+    match opcode >> 13 {
+        0b000 if (opcode >> 11) & 0b11 == 0b11 => match (opcode >> 9) & 0b11 {
+            0b00 => thumb::thumb_add_subtract::<alu::AddSubtractReg3, alu::AddOp>,
+            0b01 => thumb::thumb_add_subtract::<alu::AddSubtractReg3, alu::SubOp>,
+            0b10 => thumb::thumb_add_subtract::<alu::AddSubtractImm3, alu::AddOp>,
+            _ => thumb::thumb_add_subtract::<alu::AddSubtractImm3, alu::SubOp>,
+        },
+        0b000 => match (opcode >> 11) & 0b11 {
+            0b00 => thumb::thumb_move_shifted_register::<alu::LslOp>,
+            0b01 => thumb::thumb_move_shifted_register::<alu::LsrOp>,
+            _ => thumb::thumb_move_shifted_register::<alu::AsrOp>,
+        },
+
+        0b001 => {
+            let rd = (opcode >> 8) & 0x7;
+            match (opcode >> 11) & 0b11 {
+                0b00 => thumb_immediate_op::<alu::MovOp>(rd),
+                0b01 => thumb_immediate_op::<alu::CmpOp>(rd),
+                0b10 => thumb_immediate_op::<alu::AddOp>(rd),
+                _ => thumb_immediate_op::<alu::SubOp>(rd),
+            }
+        }
+
+        0b010 if opcode >> 10 == 0b010000 => thumb_alu_operation(opcode),
+        0b010 if opcode >> 10 == 0b010001 => thumb_hi_register_op(opcode),
+        0b010 if opcode >> 11 == 0b01001 => thumb_ldr_pc_relative((opcode >> 8) & 0x7),
+        0b010 => match (opcode >> 9) & 0b111 {
+            0b000 => thumb_register_offset_transfer::<Str>(),
+            0b001 => thumb_register_offset_transfer::<Strh>(),
+            0b010 => thumb_register_offset_transfer::<Strb>(),
+            0b011 => thumb_register_offset_transfer::<Ldrsb>(),
+            0b100 => thumb_register_offset_transfer::<Ldr>(),
+            0b101 => thumb_register_offset_transfer::<Ldrh>(),
+            0b110 => thumb_register_offset_transfer::<Ldrb>(),
+            _ => thumb_register_offset_transfer::<Ldrsh>(),
+        },
+
+        0b011 => match (opcode >> 11) & 0b11 {
+            0b00 => thumb_immediate_offset_transfer::<Str, ThumbImm5ExtendedTo7>(),
+            0b01 => thumb_immediate_offset_transfer::<Ldr, ThumbImm5ExtendedTo7>(),
+            0b10 => thumb_immediate_offset_transfer::<Strb, ThumbImm5>(),
+            _ => thumb_immediate_offset_transfer::<Ldrb, ThumbImm5>(),
+        },
+
+        0b100 => match (opcode >> 11) & 0b11 {
+            0b00 => thumb_immediate_offset_transfer::<Strh, ThumbImm5ExtendedTo6>(),
+            0b01 => thumb_immediate_offset_transfer::<Ldrh, ThumbImm5ExtendedTo6>(),
+            0b10 => thumb_sp_relative_transfer::<Str>(),
+            _ => thumb_sp_relative_transfer::<Ldr>(),
+        },
+
+        0b101 if opcode & 0x1000 == 0 => {
+            let rd = (opcode >> 8) & 0x7;
+            if opcode & 0x0800 == 0 {
+                thumb_load_address::<WordAlignedPc>(rd)
+            } else {
+                thumb_load_address::<RegValue<13>>(rd)
+            }
+        }
+        0b101 => match (opcode >> 8) & 0xF {
+            0x0 => thumb::thumb_add_sp,
+            0x4 => thumb_stack_transfer::<Stm, ThumbRegisterList, PreDecrement>(),
+            0x5 => thumb_stack_transfer::<Stm, ThumbRegisterListWithLr, PreDecrement>(),
+            0xC => thumb_stack_transfer::<Ldm, ThumbRegisterList, PostIncrement>(),
+            0xD => thumb_stack_transfer::<Ldm, ThumbRegisterListWithPc, PostIncrement>(),
+            0xE => thumb::thumb_bkpt,
+            _ => thumb::thumb_undefined,
+        },
+
+        0b110 if opcode & 0x1000 == 0 => {
+            let rb = (opcode >> 8) & 0x7;
+            if opcode & 0x0800 == 0 {
+                thumb_multiple_transfer::<Stm>(rb)
+            } else {
+                thumb_multiple_transfer::<Ldm>(rb)
+            }
+        }
+        0b110 => match (opcode >> 8) & 0xF {
+            0x0 => thumb::thumb_conditional_branch::<0x0>,
+            0x1 => thumb::thumb_conditional_branch::<0x1>,
+            0x2 => thumb::thumb_conditional_branch::<0x2>,
+            0x3 => thumb::thumb_conditional_branch::<0x3>,
+            0x4 => thumb::thumb_conditional_branch::<0x4>,
+            0x5 => thumb::thumb_conditional_branch::<0x5>,
+            0x6 => thumb::thumb_conditional_branch::<0x6>,
+            0x7 => thumb::thumb_conditional_branch::<0x7>,
+            0x8 => thumb::thumb_conditional_branch::<0x8>,
+            0x9 => thumb::thumb_conditional_branch::<0x9>,
+            0xA => thumb::thumb_conditional_branch::<0xA>,
+            0xB => thumb::thumb_conditional_branch::<0xB>,
+            0xC => thumb::thumb_conditional_branch::<0xC>,
+            0xD => thumb::thumb_conditional_branch::<0xD>,
+            0xE => thumb::thumb_undefined,
+            _ => thumb::thumb_swi,
+        },
+
+        _ => match (opcode >> 11) & 0b11 {
+            0b00 => thumb::thumb_unconditional_branch,
+            0b01 => thumb::thumb_blx,
+            0b10 => thumb::thumb_bl_setup,
+            _ => thumb::thumb_bl_complete,
+        },
+    }
+}
+
+const fn thumb_immediate_op<O: BinaryOp>(rd: u32) -> InstrFn {
+    match rd {
+        0 => thumb::thumb_mov_compare_add_subtract_imm::<0, O>,
+        1 => thumb::thumb_mov_compare_add_subtract_imm::<1, O>,
+        2 => thumb::thumb_mov_compare_add_subtract_imm::<2, O>,
+        3 => thumb::thumb_mov_compare_add_subtract_imm::<3, O>,
+        4 => thumb::thumb_mov_compare_add_subtract_imm::<4, O>,
+        5 => thumb::thumb_mov_compare_add_subtract_imm::<5, O>,
+        6 => thumb::thumb_mov_compare_add_subtract_imm::<6, O>,
+        _ => thumb::thumb_mov_compare_add_subtract_imm::<7, O>,
+    }
+}
+
+const fn thumb_alu_operation(opcode: u32) -> InstrFn {
+    match (opcode >> 6) & 0xF {
+        0x0 => thumb::thumb_alu_operation::<alu::AndOp>,
+        0x1 => thumb::thumb_alu_operation::<alu::EorOp>,
+        0x2 => thumb::thumb_alu_operation::<alu::LslOp>,
+        0x3 => thumb::thumb_alu_operation::<alu::LsrOp>,
+        0x4 => thumb::thumb_alu_operation::<alu::AsrOp>,
+        0x5 => thumb::thumb_alu_operation::<alu::AdcOp>,
+        0x6 => thumb::thumb_alu_operation::<alu::SbcOp>,
+        0x7 => thumb::thumb_alu_operation::<alu::RorOp>,
+        0x8 => thumb::thumb_alu_operation::<alu::TstOp>,
+        0x9 => thumb::thumb_alu_operation::<alu::NegOp>,
+        0xA => thumb::thumb_alu_operation::<alu::CmpOp>,
+        0xB => thumb::thumb_alu_operation::<alu::CmnOp>,
+        0xC => thumb::thumb_alu_operation::<alu::OrrOp>,
+        0xD => thumb::thumb_mul,
+        0xE => thumb::thumb_alu_operation::<alu::BicOp>,
+        _ => thumb::thumb_alu_operation::<alu::MvnOp>,
+    }
+}
+
+const fn thumb_hi_register_op(opcode: u32) -> InstrFn {
+    let rd_hi = opcode & 0x80 != 0;
+    let rs_hi = opcode & 0x40 != 0;
+    match ((opcode >> 8) & 0b11, rd_hi, rs_hi) {
+        (0b00, false, false) => thumb::thumb_hi_register_op::<alu::AddOp, false, false>,
+        (0b00, false, true) => thumb::thumb_hi_register_op::<alu::AddOp, false, true>,
+        (0b00, true, false) => thumb::thumb_hi_register_op::<alu::AddOp, true, false>,
+        (0b00, true, true) => thumb::thumb_hi_register_op::<alu::AddOp, true, true>,
+        (0b01, false, false) => thumb::thumb_hi_register_op::<alu::CmpOp, false, false>,
+        (0b01, false, true) => thumb::thumb_hi_register_op::<alu::CmpOp, false, true>,
+        (0b01, true, false) => thumb::thumb_hi_register_op::<alu::CmpOp, true, false>,
+        (0b01, true, true) => thumb::thumb_hi_register_op::<alu::CmpOp, true, true>,
+        (0b10, false, false) => thumb::thumb_hi_register_op::<alu::MovOp, false, false>,
+        (0b10, false, true) => thumb::thumb_hi_register_op::<alu::MovOp, false, true>,
+        (0b10, true, false) => thumb::thumb_hi_register_op::<alu::MovOp, true, false>,
+        (0b10, true, true) => thumb::thumb_hi_register_op::<alu::MovOp, true, true>,
+        (_, _, false) => thumb::thumb_bx::<false>,
+        (_, _, true) => thumb::thumb_bx::<true>,
+    }
+}
+
+const fn thumb_ldr_pc_relative(rd: u32) -> InstrFn {
+    match rd {
+        0 => thumb_ldr_pc_relative_to::<0>(),
+        1 => thumb_ldr_pc_relative_to::<1>(),
+        2 => thumb_ldr_pc_relative_to::<2>(),
+        3 => thumb_ldr_pc_relative_to::<3>(),
+        4 => thumb_ldr_pc_relative_to::<4>(),
+        5 => thumb_ldr_pc_relative_to::<5>(),
+        6 => thumb_ldr_pc_relative_to::<6>(),
+        _ => thumb_ldr_pc_relative_to::<7>(),
+    }
+}
+
+const fn thumb_ldr_pc_relative_to<const RD: u32>() -> InstrFn {
+    thumb::thumb_single_data_transfer::<
+        Ldr,
+        ConstReg<RD>,
+        WordAlignedPc,
+        ThumbImm8ExtendedTo10,
+        PreIncrement,
+    >
+}
+
+const fn thumb_register_offset_transfer<T: SingleDataTransfer>() -> InstrFn {
+    thumb::thumb_single_data_transfer::<
+        T,
+        RegAt<0, 2>,
+        RegAtValue<3, 5>,
+        ThumbRegisterOffset,
+        PreIncrement,
+    >
+}
+
+const fn thumb_immediate_offset_transfer<T, O>() -> InstrFn
+where
+    T: SingleDataTransfer,
+    O: SDTCalculateOffset,
+{
+    thumb::thumb_single_data_transfer::<T, RegAt<0, 2>, RegAtValue<3, 5>, O, PreIncrement>
+}
+
+const fn thumb_sp_relative_transfer<T: SingleDataTransfer>() -> InstrFn {
+    thumb::thumb_single_data_transfer::<
+        T,
+        RegAt<8, 9>,
+        RegValue<13>,
+        ThumbImm8ExtendedTo10,
+        PreIncrement,
+    >
+}
+
+const fn thumb_load_address<L: alu::ExtractThumbOperand>(rd: u32) -> InstrFn {
+    match rd {
+        0 => thumb::thumb_load_address::<0, L>,
+        1 => thumb::thumb_load_address::<1, L>,
+        2 => thumb::thumb_load_address::<2, L>,
+        3 => thumb::thumb_load_address::<3, L>,
+        4 => thumb::thumb_load_address::<4, L>,
+        5 => thumb::thumb_load_address::<5, L>,
+        6 => thumb::thumb_load_address::<6, L>,
+        _ => thumb::thumb_load_address::<7, L>,
+    }
+}
+
+/// PUSH and POP
+const fn thumb_stack_transfer<T, R, I>() -> InstrFn
+where
+    T: BlockDataTransfer,
+    R: alu::ExtractThumbOperand,
+    I: IndexingMode,
+{
+    thumb::thumb_block_data_transfer::<T, ConstReg<13>, R, I>
+}
+
+/// STMIA and LDMIA
+const fn thumb_multiple_transfer<T: BlockDataTransfer>(rb: u32) -> InstrFn {
+    match rb {
+        0 => thumb::thumb_block_data_transfer::<T, ConstReg<0>, ThumbRegisterList, PostIncrement>,
+        1 => thumb::thumb_block_data_transfer::<T, ConstReg<1>, ThumbRegisterList, PostIncrement>,
+        2 => thumb::thumb_block_data_transfer::<T, ConstReg<2>, ThumbRegisterList, PostIncrement>,
+        3 => thumb::thumb_block_data_transfer::<T, ConstReg<3>, ThumbRegisterList, PostIncrement>,
+        4 => thumb::thumb_block_data_transfer::<T, ConstReg<4>, ThumbRegisterList, PostIncrement>,
+        5 => thumb::thumb_block_data_transfer::<T, ConstReg<5>, ThumbRegisterList, PostIncrement>,
+        6 => thumb::thumb_block_data_transfer::<T, ConstReg<6>, ThumbRegisterList, PostIncrement>,
+        _ => thumb::thumb_block_data_transfer::<T, ConstReg<7>, ThumbRegisterList, PostIncrement>,
+    }
+}
@@ -17,6 +17,40 @@ pub trait Memory {
 
     fn load8(&mut self, address: u32, cpu: &mut Cpu) -> (u8, Waitstates);
 
+    /// Loads an ARM opcode into the CPU pipeline. This is only used for instruction fetches
+    /// so implementations can give it a faster path than [`Memory::load32`].
+    fn fetch32(&mut self, address: u32, cpu: &mut Cpu) -> (u32, Waitstates) {
+        self.load32(address, cpu)
+    }
+
+    /// Loads a THUMB opcode into the CPU pipeline. This is only used for instruction fetches
+    /// so implementations can give it a faster path than [`Memory::load16`].
+    fn fetch16(&mut self, address: u32, cpu: &mut Cpu) -> (u16, Waitstates) {
+        self.load16(address, cpu)
+    }
+
+    /// Returns the waitstates for fetching ARM or THUMB opcodes from the 1KB page that
+    /// contains `address`, or `None` if every opcode there has to go through
+    /// [`Memory::fetch32`] or [`Memory::fetch16`].
+    ///
+    /// The block cache uses this to skip fetching opcodes that it already has. Skipped fetches
+    /// are reported with [`Memory::skipped_fetches`] before the CPU touches memory again, so
+    /// this should only return timings for memory where a fetch has no other side effects.
+    /// The timings are used for the rest of the block, so anything that changes them while
+    /// the CPU is running has to call [`Cpu::clear_block_cache`].
+    ///
+    /// **IMPORTANT**: Opcodes from memory that this returns timings for are only checked
+    /// again after [`Cpu::invalidate_code`] is called for them. Memory that is mirrored has to
+    /// call it for the address that the code runs from when it is written through a mirror,
+    /// or return `None` for the mirrors.
+    fn code_timing(&mut self, _address: u32, _thumb: bool) -> Option<CodeTiming> {
+        None
+    }
+
+    /// Catches up on fetches that the block cache skipped since the last time that it
+    /// called this.
+    fn skipped_fetches(&mut self, _fetches: SkippedFetches) {}
+
     fn store32(&mut self, address: u32, value: u32, cpu: &mut Cpu) -> Waitstates {
         let wait_lo = self.store16(address, value as u16, cpu);
         let wait_hi = self.store16(address.wrapping_add(2), (value >> 16) as u16, cpu);
@@ -35,6 +69,36 @@ pub trait Memory {
     fn as_mut_any(&mut self) -> &mut dyn Any;
 }
 
+/// Waitstates for fetching one opcode, see [`Memory::code_timing`].
+#[derive(Clone, Copy, Default, Debug, PartialEq, Eq)]
+pub struct CodeTiming {
+    pub sequential: Waitstates,
+    pub nonsequential: Waitstates,
+}
+
+impl CodeTiming {
+    #[inline(always)]
+    pub fn get(&self, access_type: AccessType) -> Waitstates {
+        match access_type {
+            AccessType::Sequential => self.sequential,
+            AccessType::NonSequential => self.nonsequential,
+        }
+    }
+}
+
+/// Opcode fetches that the block cache skipped, see [`Memory::skipped_fetches`].
+#[derive(Clone, Copy, Default, Debug, PartialEq, Eq)]
+pub struct SkippedFetches {
+    /// Number of fetches that were skipped. They were all from the same 1KB page.
+    pub count: u32,
+    /// Total waitstates of all of the skipped fetches.
+    pub wait: Waitstates,
+    /// The address and opcode of the last skipped fetch.
+    pub address: u32,
+    pub opcode: u32,
+    pub thumb: bool,
+}
+
 #[derive(Copy, Clone, PartialEq, Eq)]
 pub enum AccessType {
     Sequential,
@@ -102,6 +102,52 @@ pub enum CpsrFlag {
     T = 5,
 }
 
+/// The N, Z, C and V bits of the CPSR.
+const CONDITION_FLAGS_MASK: u32 = 0xF0000000;
+
+/// The condition flags in the form that the ALU produces them in, so that flag setting
+/// instructions only have to store their result instead of packing each flag into the CPSR.
+/// They are packed when a flag or the CPSR is read.
+#[derive(Clone, Copy)]
+struct ConditionFlags {
+    /// N is bit 31.
+    n: u32,
+    /// Z is set if this is zero.
+    z: u32,
+    c: bool,
+    /// V is bit 31.
+    v: u32,
+}
+
+impl ConditionFlags {
+    #[inline(always)]
+    fn from_cpsr(cpsr: u32) -> ConditionFlags {
+        ConditionFlags {
+            n: cpsr & 0x80000000,
+            z: !cpsr.get_bit(CpsrFlag::Z as u8) as u32,
+            c: cpsr.get_bit(CpsrFlag::C as u8),
+            v: cpsr << 3,
+        }
+    }
+
+    #[inline(always)]
+    fn to_cpsr(self) -> u32 {
+        (self.n & 0x80000000)
+            | ((self.z == 0) as u32) << 30
+            | (self.c as u32) << 29
+            | (self.v >> 31) << 28
+    }
+}
+
+impl PartialEq for ConditionFlags {
+    fn eq(&self, other: &Self) -> bool {
+        self.to_cpsr() == other.to_cpsr()
+    }
+}
+
+impl Eq for ConditionFlags {}
+
+#[derive(Clone, PartialEq, Eq)]
 pub struct Registers {
     /// The currently in use general purpose registers (r0-r15).
     gp_registers: [u32; 16],
@@ -118,9 +164,12 @@ pub struct Registers {
     /// banked Saved Program Status Registers (SPSR)
     bk_spsr: [u32; 5],
 
-    /// Current Program Status Register
+    /// Current Program Status Register, without the condition flags.
     cpsr: u32,
 
+    /// The condition flags of the CPSR.
+    flags: ConditionFlags,
+
     /// Saved Program Status Register
     spsr: u32,
 
@@ -140,6 +189,7 @@ impl Registers {
             bk_registers: [0; 15],
             bk_spsr: [0; 5],
             cpsr: mode.bits(),
+            flags: ConditionFlags::from_cpsr(0),
             spsr: 0,
 
             #[cfg(feature = "track-register-writes")]
@@ -149,6 +199,34 @@ impl Registers {
         }
     }
 
+    /// Number of words returned by [`Registers::to_words`].
+    pub const WORD_COUNT: usize = 38;
+
+    /// Every register including the banked ones and the SPSRs, in an order that's only
+    /// meaningful to [`Registers::from_words`]. This is meant for saving and restoring the
+    /// state of the CPU.
+    pub fn to_words(&self) -> [u32; Self::WORD_COUNT] {
+        let mut words = [0; Self::WORD_COUNT];
+        words[0..16].copy_from_slice(&self.gp_registers);
+        words[16..31].copy_from_slice(&self.bk_registers);
+        words[31..36].copy_from_slice(&self.bk_spsr);
+        words[36] = self.read_cpsr();
+        words[37] = self.spsr;
+        words
+    }
+
+    /// Registers that were returned by [`Registers::to_words`].
+    pub fn from_words(words: &[u32; Self::WORD_COUNT]) -> Registers {
+        let mut registers = Registers::new(CpuMode::System);
+        registers.gp_registers.copy_from_slice(&words[0..16]);
+        registers.bk_registers.copy_from_slice(&words[16..31]);
+        registers.bk_spsr.copy_from_slice(&words[31..36]);
+        registers.cpsr = words[36] & !CONDITION_FLAGS_MASK;
+        registers.flags = ConditionFlags::from_cpsr(words[36]);
+        registers.spsr = words[37];
+        registers
+    }
+
     /// Reads and returns the value of a general purpose register.
     #[inline(always)]
     #[must_use]
@@ -196,25 +274,76 @@ impl Registers {
         value
     }
 
-    #[inline]
+    #[inline(always)]
     #[must_use]
     pub fn get_flag(&self, flag: CpsrFlag) -> bool {
-        self.cpsr.get_bit(flag as u8)
+        match flag {
+            CpsrFlag::N => self.flags.n >> 31 != 0,
+            CpsrFlag::Z => self.flags.z == 0,
+            CpsrFlag::C => self.flags.c,
+            CpsrFlag::V => self.flags.v >> 31 != 0,
+            _ => self.cpsr.get_bit(flag as u8),
+        }
     }
 
     #[inline]
     pub fn set_flag(&mut self, flag: CpsrFlag) {
-        self.cpsr = self.cpsr.set_bit(flag as u8);
+        self.put_flag(flag, true);
     }
 
     #[inline]
     pub fn clear_flag(&mut self, flag: CpsrFlag) {
-        self.cpsr = self.cpsr.clear_bit(flag as u8);
+        self.put_flag(flag, false);
     }
 
-    #[inline]
+    #[inline(always)]
     pub fn put_flag(&mut self, flag: CpsrFlag, value: impl IntoBit) {
-        self.cpsr = self.cpsr.put_bit(flag as u8, value.into_bit());
+        let value = value.into_bit();
+        match flag {
+            CpsrFlag::N => self.flags.n = (value as u32) << 31,
+            CpsrFlag::Z => self.flags.z = !value as u32,
+            CpsrFlag::C => self.flags.c = value,
+            CpsrFlag::V => self.flags.v = (value as u32) << 31,
+            _ => self.cpsr = self.cpsr.put_bit(flag as u8, value),
+        }
+    }
+
+    /// Sets N and Z from the result of an ALU operation.
+    #[inline(always)]
+    pub fn set_nz_flags(&mut self, result: u32) {
+        self.flags.n = result;
+        self.flags.z = result;
+    }
+
+    /// Sets N and Z from the result of an ALU operation, C to `carry` and V to bit 31 of
+    /// `overflow`, which is usually an XOR of the operands and the result.
+    #[inline(always)]
+    pub fn set_nzcv_flags(&mut self, result: u32, carry: bool, overflow: u32) {
+        self.set_nz_flags(result);
+        self.flags.c = carry;
+        self.flags.v = overflow;
+    }
+
+    /// The general purpose registers, for code generated by the JIT. Writes made through this
+    /// aren't recorded by `track-register-writes`.
+    #[cfg(all(feature = "jit", target_arch = "x86_64", unix))]
+    #[inline(always)]
+    pub(crate) fn gp_registers_mut(&mut self) -> &mut [u32; 16] {
+        &mut self.gp_registers
+    }
+
+    /// The N, Z, C and V flags in bits 28-31 with every other bit clear.
+    #[cfg(all(feature = "jit", target_arch = "x86_64", unix))]
+    #[inline(always)]
+    pub(crate) fn condition_flags(&self) -> u32 {
+        self.flags.to_cpsr()
+    }
+
+    /// Sets the N, Z, C and V flags from bits 28-31 of `flags`.
+    #[cfg(all(feature = "jit", target_arch = "x86_64", unix))]
+    #[inline(always)]
+    pub(crate) fn write_condition_flags(&mut self, flags: u32) {
+        self.flags = ConditionFlags::from_cpsr(flags);
     }
 
     /// Sets the mode of the CPU. This will also change the mode bits in the CPSR register
@@ -264,14 +393,15 @@ impl Registers {
     #[inline(always)]
     #[must_use]
     pub fn read_cpsr(&self) -> u32 {
-        self.cpsr
+        self.cpsr | self.flags.to_cpsr()
     }
 
     /// Sets the value of the CPSR. If the mode bits are changed
     /// The mode of the CPU will be changed accordingly and banked registers will be loaded.
     pub fn write_cpsr(&mut self, value: u32) {
         let old_mode_bits = self.read_mode_bits();
-        self.cpsr = value;
+        self.cpsr = value & !CONDITION_FLAGS_MASK;
+        self.flags = ConditionFlags::from_cpsr(value);
         let new_mode_bits = self.read_mode_bits();
 
         if old_mode_bits != new_mode_bits {
@@ -486,4 +616,38 @@ mod tests {
         assert_registers(CpuMode::IRQ);
         assert_registers(CpuMode::Undefined);
     }
+
+    #[test]
+    fn register_words_round_trip() {
+        let mut registers = Registers::new(CpuMode::System);
+        registers.write(0, 0x12345678);
+        registers.write_with_mode(CpuMode::IRQ, 13, 0x03007FA0);
+        registers.write_mode(CpuMode::Supervisor);
+        registers.write_spsr(0x6000001F);
+        registers.set_flag(CpsrFlag::I);
+
+        let restored = Registers::from_words(&registers.to_words());
+        assert!(restored == registers);
+        assert_eq!(restored.read_mode(), CpuMode::Supervisor);
+        assert_eq!(restored.read_spsr(), 0x6000001F);
+    }
+
+    #[test]
+    fn condition_flags_round_trip() {
+        let mut registers = Registers::new(CpuMode::System);
+        for flags in 0..16 {
+            let cpsr = (flags << 28) | CpuMode::IRQ.bits();
+            registers.write_cpsr(cpsr);
+            assert_eq!(registers.read_cpsr(), cpsr);
+            assert_eq!(registers.get_flag(CpsrFlag::N), flags & 0b1000 != 0);
+            assert_eq!(registers.get_flag(CpsrFlag::Z), flags & 0b0100 != 0);
+            assert_eq!(registers.get_flag(CpsrFlag::C), flags & 0b0010 != 0);
+            assert_eq!(registers.get_flag(CpsrFlag::V), flags & 0b0001 != 0);
+        }
+
+        registers.set_nzcv_flags(0, true, 0x80000000);
+        assert_eq!(registers.read_cpsr() >> 28, 0b0111);
+        registers.set_nz_flags(0x80000000);
+        assert_eq!(registers.read_cpsr() >> 28, 0b1011);
+    }
 }
@@ -5,7 +5,7 @@ use crate::{
     cpu::{check_condition, Cpu},
     memory::Memory,
     transfer::{BlockDataTransfer, IndexingMode, SDTCalculateOffset, SingleDataTransfer},
-    AccessType, CpsrFlag, CpuException, Cycles, Registers,
+    AccessType, CpsrFlag, CpuException, Cycles,
 };
 
 /// move shifted register
@@ -93,50 +93,27 @@ where
 /// `MUL Rd, Rs`  
 /// `BIC Rd, Rs`  
 /// `MVN Rd, Rs`  
-pub fn thumb_alu_operation(instr: u32, cpu: &mut Cpu, _memory: &mut dyn Memory) -> Cycles {
+pub fn thumb_alu_operation<O>(instr: u32, cpu: &mut Cpu, _memory: &mut dyn Memory) -> Cycles
+where
+    O: BinaryOp,
+{
     let rd = instr.get_bit_range(0..=2);
     let rs = instr.get_bit_range(3..=5);
     let lhs = cpu.registers.read(rd);
     let rhs = cpu.registers.read(rs);
-
-    let op = instr.get_bit_range(6..=9);
-    let registers = &mut cpu.registers;
-    match op {
-        0x0 => thumb_alu_operation_internal::<alu::AndOp>(lhs, rhs, rd, registers),
-        0x1 => thumb_alu_operation_internal::<alu::EorOp>(lhs, rhs, rd, registers),
-        0x2 => thumb_alu_operation_internal::<alu::LslOp>(lhs, rhs, rd, registers),
-        0x3 => thumb_alu_operation_internal::<alu::LsrOp>(lhs, rhs, rd, registers),
-        0x4 => thumb_alu_operation_internal::<alu::AsrOp>(lhs, rhs, rd, registers),
-        0x5 => thumb_alu_operation_internal::<alu::AdcOp>(lhs, rhs, rd, registers),
-        0x6 => thumb_alu_operation_internal::<alu::SbcOp>(lhs, rhs, rd, registers),
-        0x7 => thumb_alu_operation_internal::<alu::RorOp>(lhs, rhs, rd, registers),
-        0x8 => thumb_alu_operation_internal::<alu::TstOp>(lhs, rhs, rd, registers),
-        0x9 => thumb_alu_operation_internal::<alu::NegOp>(lhs, rhs, rd, registers),
-        0xA => thumb_alu_operation_internal::<alu::CmpOp>(lhs, rhs, rd, registers),
-        0xB => thumb_alu_operation_internal::<alu::CmnOp>(lhs, rhs, rd, registers),
-        0xC => thumb_alu_operation_internal::<alu::OrrOp>(lhs, rhs, rd, registers),
-        0xD => thumb_alu_operation_internal::<alu::MulOp>(lhs, rhs, rd, registers),
-        0xE => thumb_alu_operation_internal::<alu::BicOp>(lhs, rhs, rd, registers),
-        0xF => thumb_alu_operation_internal::<alu::MvnOp>(lhs, rhs, rd, registers),
-        _ => unreachable!(),
-    };
-
-    if op != 0xD {
-        Cycles::zero()
-    } else {
-        alu::multiply::internal_multiply_cycles(rhs)
+    let result = O::execute(&cpu.registers, lhs, rhs);
+    O::set_flags(&mut cpu.registers, lhs, rhs, result);
+    if O::HAS_RESULT {
+        cpu.registers.write(rd, result)
     }
+    Cycles::zero()
 }
 
-fn thumb_alu_operation_internal<O>(lhs: u32, rhs: u32, rd: u32, registers: &mut Registers)
-where
-    O: BinaryOp,
-{
-    let result = O::execute(registers, lhs, rhs);
-    O::set_flags(registers, lhs, rhs, result);
-    if O::HAS_RESULT {
-        registers.write(rd, result)
-    }
+/// `MUL Rd, Rs`, which is an ALU operation that takes extra cycles depending on `Rs`.
+pub fn thumb_mul(instr: u32, cpu: &mut Cpu, memory: &mut dyn Memory) -> Cycles {
+    let rhs = cpu.registers.read(instr.get_bit_range(3..=5));
+    thumb_alu_operation::<alu::MulOp>(instr, cpu, memory);
+    alu::multiply::internal_multiply_cycles(rhs)
 }
 
 /// Hi register operations
@@ -150,15 +127,16 @@ where
 /// `MOV Rd, Hs`  
 /// `MOV Hd, Rs`  
 /// `MOV Hd, Hs`  
-pub fn thumb_hi_register_op<O>(instr: u32, cpu: &mut Cpu, _memory: &mut dyn Memory) -> Cycles
+pub fn thumb_hi_register_op<O, const RD_HI: bool, const RS_HI: bool>(
+    instr: u32,
+    cpu: &mut Cpu,
+    _memory: &mut dyn Memory,
+) -> Cycles
 where
     O: BinaryOp,
 {
-    let rs_hi = instr.get_bit(6);
-    let rd_hi = instr.get_bit(7);
-
-    let rd = instr.get_bit_range(0..=2) + (if rd_hi { 8 } else { 0 });
-    let rs = instr.get_bit_range(3..=5) + (if rs_hi { 8 } else { 0 });
+    let rd = instr.get_bit_range(0..=2) + (if RD_HI { 8 } else { 0 });
+    let rs = instr.get_bit_range(3..=5) + (if RS_HI { 8 } else { 0 });
 
     let lhs = cpu.registers.read(rd);
     let rhs = cpu.registers.read(rs);
@@ -174,9 +152,8 @@ where
 ///
 /// `BX Rs`  
 /// `BX Hs`  
-pub fn thumb_bx(instr: u32, cpu: &mut Cpu, memory: &mut dyn Memory) -> Cycles {
-    let rs_hi = instr.get_bit(6);
-    let rs = instr.get_bit_range(3..=5) + (if rs_hi { 8 } else { 0 });
+pub fn thumb_bx<const RS_HI: bool>(instr: u32, cpu: &mut Cpu, memory: &mut dyn Memory) -> Cycles {
+    let rs = instr.get_bit_range(3..=5) + (if RS_HI { 8 } else { 0 });
     let destination = cpu.registers.read(rs);
 
     if destination.get_bit(0) {
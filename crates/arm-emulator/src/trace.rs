@@ -0,0 +1,598 @@
+//! Recording every instruction that the CPU executes and every load and store that it makes.
+//!
+//! When the `trace` feature is enabled, [`Cpu::set_tracer`](crate::Cpu::set_tracer) can be
+//! given the [`TraceProducer`] half of a [`trace_buffer`] and [`Cpu::step`](crate::Cpu::step)
+//! will push a [`TraceEvent`] for each access and instruction into it. Another thread drains the
+//! [`TraceConsumer`] half into a [`TraceWriter`], which writes them out in a compact format that
+//! can be read back with [`TraceReader`]. Without the feature the CPU has nowhere to keep a
+//! tracer and stepping it doesn't check for one.
+
+use std::{
+    cell::UnsafeCell,
+    io::{self, Read, Write},
+    sync::{
+        atomic::{AtomicBool, AtomicU64, AtomicUsize, Ordering},
+        Arc,
+    },
+};
+
+#[cfg(feature = "trace")]
+use crate::{clock::Waitstates, Cpu, Memory};
+
+/// Written at the start of every trace, followed by [`TRACE_VERSION`].
+pub const TRACE_MAGIC: [u8; 8] = *b"PYRTRACE";
+pub const TRACE_VERSION: u32 = 1;
+
+#[derive(Clone, Copy, Debug, PartialEq, Eq)]
+pub enum TraceEvent {
+    /// An instruction that was executed or skipped because its condition failed. This comes
+    /// after the events for the loads and stores that it made.
+    Instruction {
+        address: u32,
+        opcode: u32,
+        thumb: bool,
+        cycles: u32,
+    },
+    /// A load of `size` bytes (1, 2 or 4). Instruction fetches aren't included.
+    Load { address: u32, value: u32, size: u8 },
+    /// A store of `size` bytes (1, 2 or 4).
+    Store { address: u32, value: u32, size: u8 },
+}
+
+/// Creates a ring buffer that can hold `capacity` events (rounded up to a power of two) that
+/// are pushed by one thread and popped by another.
+pub fn trace_buffer(capacity: usize) -> (TraceProducer, TraceConsumer) {
+    let capacity = capacity.max(1).next_power_of_two();
+    let ring = Arc::new(TraceRing {
+        slots: (0..capacity)
+            .map(|_| {
+                UnsafeCell::new(TraceEvent::Load {
+                    address: 0,
+                    value: 0,
+                    size: 0,
+                })
+            })
+            .collect(),
+        mask: capacity - 1,
+        head: AtomicUsize::new(0),
+        tail: AtomicUsize::new(0),
+        producer_closed: AtomicBool::new(false),
+        consumer_closed: AtomicBool::new(false),
+        waits: AtomicU64::new(0),
+    });
+    (TraceProducer { ring: ring.clone() }, TraceConsumer { ring })
+}
+
+struct TraceRing {
+    slots: Box<[UnsafeCell<TraceEvent>]>,
+    mask: usize,
+    /// Number of events pushed so far. Only written by the producer.
+    head: AtomicUsize,
+    /// Number of events popped so far. Only written by the consumer.
+    tail: AtomicUsize,
+    producer_closed: AtomicBool,
+    consumer_closed: AtomicBool,
+    /// Number of times that the producer found the buffer full.
+    waits: AtomicU64,
+}
+
+// SAFETY: A slot is only written by the producer while it is outside of `tail..head` and only
+// read by the consumer while it is inside, and there's only ever one of each.
+unsafe impl Sync for TraceRing {}
+
+/// The half of a [`trace_buffer`] that events are pushed into.
+pub struct TraceProducer {
+    ring: Arc<TraceRing>,
+}
+
+impl TraceProducer {
+    /// Pushes an event, waiting for the consumer to make room if the buffer is full. Events
+    /// are dropped once the consumer is gone, so this never waits forever unless the consumer
+    /// is kept around without being drained.
+    #[inline]
+    pub fn push(&mut self, event: TraceEvent) {
+        let ring = &*self.ring;
+        let head = ring.head.load(Ordering::Relaxed);
+        if head.wrapping_sub(ring.tail.load(Ordering::Acquire)) == ring.slots.len()
+            && !self.wait_for_room(head)
+        {
+            return;
+        }
+
+        // SAFETY: The slot at `head` is outside of `tail..head` so the consumer isn't reading it.
+        unsafe { *ring.slots[head & ring.mask].get() = event };
+        ring.head.store(head.wrapping_add(1), Ordering::Release);
+    }
+
+    /// Returns false if the consumer was dropped before there was room.
+    #[cold]
+    fn wait_for_room(&self, head: usize) -> bool {
+        let ring = &*self.ring;
+        ring.waits.fetch_add(1, Ordering::Relaxed);
+        while head.wrapping_sub(ring.tail.load(Ordering::Acquire)) == ring.slots.len() {
+            if ring.consumer_closed.load(Ordering::Acquire) {
+                return false;
+            }
+            std::thread::yield_now();
+        }
+        true
+    }
+}
+
+impl Drop for TraceProducer {
+    fn drop(&mut self) {
+        self.ring.producer_closed.store(true, Ordering::Release);
+    }
+}
+
+/// The half of a [`trace_buffer`] that events are popped from.
+pub struct TraceConsumer {
+    ring: Arc<TraceRing>,
+}
+
+impl TraceConsumer {
+    pub fn pop(&mut self) -> Option<TraceEvent> {
+        let ring = &*self.ring;
+        let tail = ring.tail.load(Ordering::Relaxed);
+        if tail == ring.head.load(Ordering::Acquire) {
+            return None;
+        }
+
+        // SAFETY: The slot at `tail` is inside of `tail..head` so the producer isn't writing it.
+        let event = unsafe { *ring.slots[tail & ring.mask].get() };
+        ring.tail.store(tail.wrapping_add(1), Ordering::Release);
+        Some(event)
+    }
+
+    /// Pops events into `writer` until the producer has been dropped and every event that it
+    /// pushed has been written.
+    pub fn drain_into<W: Write>(&mut self, writer: &mut TraceWriter<W>) -> io::Result<()> {
+        loop {
+            // Checked before popping so that nothing pushed before the producer closed is missed.
+            let closed = self.ring.producer_closed.load(Ordering::Acquire);
+            let mut popped = false;
+            while let Some(event) = self.pop() {
+                writer.write(&event)?;
+                popped = true;
+            }
+            if closed {
+                return Ok(());
+            } else if !popped {
+                std::thread::yield_now();
+            }
+        }
+    }
+
+    /// Number of times that the producer had to wait because the buffer was full. If this is
+    /// high the buffer should be bigger or drained faster.
+    pub fn waits(&self) -> u64 {
+        self.ring.waits.load(Ordering::Relaxed)
+    }
+}
+
+impl Drop for TraceConsumer {
+    fn drop(&mut self) {
+        self.ring.consumer_closed.store(true, Ordering::Release);
+    }
+}
+
+/// Wraps the memory passed to [`Cpu::step`](crate::Cpu::step) while tracing so that loads and
+/// stores are pushed as they happen.
+#[cfg(feature = "trace")]
+pub(crate) struct TracedMemory<'a> {
+    pub memory: &'a mut dyn Memory,
+    pub tracer: &'a mut TraceProducer,
+}
+
+#[cfg(feature = "trace")]
+impl Memory for TracedMemory<'_> {
+    fn load32(&mut self, address: u32, cpu: &mut Cpu) -> (u32, Waitstates) {
+        let (value, wait) = self.memory.load32(address, cpu);
+        self.tracer.push(TraceEvent::Load {
+            address,
+            value,
+            size: 4,
+        });
+        (value, wait)
+    }
+
+    fn load16(&mut self, address: u32, cpu: &mut Cpu) -> (u16, Waitstates) {
+        let (value, wait) = self.memory.load16(address, cpu);
+        self.tracer.push(TraceEvent::Load {
+            address,
+            value: value as u32,
+            size: 2,
+        });
+        (value, wait)
+    }
+
+    fn load8(&mut self, address: u32, cpu: &mut Cpu) -> (u8, Waitstates) {
+        let (value, wait) = self.memory.load8(address, cpu);
+        self.tracer.push(TraceEvent::Load {
+            address,
+            value: value as u32,
+            size: 1,
+        });
+        (value, wait)
+    }
+
+    fn fetch32(&mut self, address: u32, cpu: &mut Cpu) -> (u32, Waitstates) {
+        self.memory.fetch32(address, cpu)
+    }
+
+    fn fetch16(&mut self, address: u32, cpu: &mut Cpu) -> (u16, Waitstates) {
+        self.memory.fetch16(address, cpu)
+    }
+
+    fn store32(&mut self, address: u32, value: u32, cpu: &mut Cpu) -> Waitstates {
+        self.tracer.push(TraceEvent::Store {
+            address,
+            value,
+            size: 4,
+        });
+        self.memory.store32(address, value, cpu)
+    }
+
+    fn store16(&mut self, address: u32, value: u16, cpu: &mut Cpu) -> Waitstates {
+        self.tracer.push(TraceEvent::Store {
+            address,
+            value: value as u32,
+            size: 2,
+        });
+        self.memory.store16(address, value, cpu)
+    }
+
+    fn store8(&mut self, address: u32, value: u8, cpu: &mut Cpu) -> Waitstates {
+        self.tracer.push(TraceEvent::Store {
+            address,
+            value: value as u32,
+            size: 1,
+        });
+        self.memory.store8(address, value, cpu)
+    }
+
+    fn as_any(&self) -> &dyn std::any::Any {
+        self.memory.as_any()
+    }
+
+    fn as_mut_any(&mut self) -> &mut dyn std::any::Any {
+        self.memory.as_mut_any()
+    }
+}
+
+// Every event starts with a tag byte. The low 2 bits are the kind of event:
+const TAG_ARM: u8 = 0;
+const TAG_THUMB: u8 = 1;
+const TAG_LOAD: u8 = 2;
+const TAG_STORE: u8 = 3;
+// For instructions, bit 2 is set if the address directly follows the previous instruction's
+// (otherwise a zigzag varint delta from that address follows) and bits 3-7 are the cycles, or
+// `CYCLES_ESCAPE` if a varint with the cycles follows. The opcode is written last as 4 or 2
+// little endian bytes.
+const TAG_SEQUENTIAL: u8 = 1 << 2;
+const CYCLES_SHIFT: u32 = 3;
+const CYCLES_ESCAPE: u8 = 0x1F;
+// For loads and stores, bits 2-3 are log2 of the size. A zigzag varint delta from the previous
+// load or store's address and a varint with the value follow.
+const SIZE_SHIFT: u32 = 2;
+
+/// Addresses are written relative to the last one of the same kind, which is what
+/// both [`TraceWriter`] and [`TraceReader`] keep track of here.
+#[derive(Default)]
+struct DeltaState {
+    next_instruction: u32,
+    last_access: u32,
+}
+
+/// Writes events in the compact format described above, after a header.
+pub struct TraceWriter<W: Write> {
+    inner: W,
+    state: DeltaState,
+    buffer: Vec<u8>,
+}
+
+impl<W: Write> TraceWriter<W> {
+    pub fn new(mut inner: W) -> io::Result<Self> {
+        inner.write_all(&TRACE_MAGIC)?;
+        inner.write_all(&TRACE_VERSION.to_le_bytes())?;
+        Ok(TraceWriter {
+            inner,
+            state: DeltaState::default(),
+            buffer: Vec::with_capacity(16),
+        })
+    }
+
+    pub fn write(&mut self, event: &TraceEvent) -> io::Result<()> {
+        self.buffer.clear();
+        match *event {
+            TraceEvent::Instruction {
+                address,
+                opcode,
+                thumb,
+                cycles,
+            } => {
+                let mut tag = if thumb { TAG_THUMB } else { TAG_ARM };
+                let sequential = address == self.state.next_instruction;
+                if sequential {
+                    tag |= TAG_SEQUENTIAL;
+                }
+                tag |= (cycles.min(CYCLES_ESCAPE as u32) as u8) << CYCLES_SHIFT;
+                self.buffer.push(tag);
+                if !sequential {
+                    let delta = address.wrapping_sub(self.state.next_instruction) as i32;
+                    write_varint(&mut self.buffer, zigzag(delta));
+                }
+                if cycles >= CYCLES_ESCAPE as u32 {
+                    write_varint(&mut self.buffer, cycles);
+                }
+                if thumb {
+                    self.buffer
+                        .extend_from_slice(&(opcode as u16).to_le_bytes());
+                    self.state.next_instruction = address.wrapping_add(2);
+                } else {
+                    self.buffer.extend_from_slice(&opcode.to_le_bytes());
+                    self.state.next_instruction = address.wrapping_add(4);
+                }
+            }
+            TraceEvent::Load {
+                address,
+                value,
+                size,
+            }
+            | TraceEvent::Store {
+                address,
+                value,
+                size,
+            } => {
+                let kind = if matches!(event, TraceEvent::Load { .. }) {
+                    TAG_LOAD
+                } else {
+                    TAG_STORE
+                };
+                self.buffer
+                    .push(kind | ((size.trailing_zeros() as u8) << SIZE_SHIFT));
+                let delta = address.wrapping_sub(self.state.last_access) as i32;
+                write_varint(&mut self.buffer, zigzag(delta));
+                write_varint(&mut self.buffer, value);
+                self.state.last_access = address;
+            }
+        }
+        self.inner.write_all(&self.buffer)
+    }
+
+    pub fn flush(&mut self) -> io::Result<()> {
+        self.inner.flush()
+    }
+
+    pub fn into_inner(self) -> W {
+        self.inner
+    }
+}
+
+/// Reads back events written by a [`TraceWriter`].
+pub struct TraceReader<R: Read> {
+    inner: R,
+    state: DeltaState,
+}
+
+impl<R: Read> TraceReader<R> {
+    /// Returns an error if `inner` doesn't start with a trace header.
+    pub fn new(mut inner: R) -> io::Result<Self> {
+        let mut header = [0; 12];
+        inner.read_exact(&mut header)?;
+        if header[..8] != TRACE_MAGIC {
+            return Err(io::Error::new(io::ErrorKind::InvalidData, "not a trace"));
+        }
+        let version = u32::from_le_bytes([header[8], header[9], header[10], header[11]]);
+        if version != TRACE_VERSION {
+            return Err(io::Error::new(
+                io::ErrorKind::InvalidData,
+                format!("unsupported trace version {version}"),
+            ));
+        }
+        Ok(TraceReader {
+            inner,
+            state: DeltaState::default(),
+        })
+    }
+
+    /// Returns `None` once the end of the trace is reached.
+    pub fn read(&mut self) -> io::Result<Option<TraceEvent>> {
+        let mut tag = [0];
+        if self.inner.read(&mut tag)? == 0 {
+            return Ok(None);
+        }
+        let tag = tag[0];
+
+        let event = match tag & 0x3 {
+            kind @ (TAG_ARM | TAG_THUMB) => {
+                let thumb = kind == TAG_THUMB;
+                let mut address = self.state.next_instruction;
+                if tag & TAG_SEQUENTIAL == 0 {
+                    address = address.wrapping_add(unzigzag(read_varint(&mut self.inner)?) as u32);
+                }
+                let mut cycles = (tag >> CYCLES_SHIFT) as u32;
+                if cycles == CYCLES_ESCAPE as u32 {
+                    cycles = read_varint(&mut self.inner)?;
+                }
+                let opcode = if thumb {
+                    let mut opcode = [0; 2];
+                    self.inner.read_exact(&mut opcode)?;
+                    self.state.next_instruction = address.wrapping_add(2);
+                    u16::from_le_bytes(opcode) as u32
+                } else {
+                    let mut opcode = [0; 4];
+                    self.inner.read_exact(&mut opcode)?;
+                    self.state.next_instruction = address.wrapping_add(4);
+                    u32::from_le_bytes(opcode)
+                };
+                TraceEvent::Instruction {
+                    address,
+                    opcode,
+                    thumb,
+                    cycles,
+                }
+            }
+            kind => {
+                let size = 1 << ((tag >> SIZE_SHIFT) & 0x3);
+                let delta = unzigzag(read_varint(&mut self.inner)?);
+                let address = self.state.last_access.wrapping_add(delta as u32);
+                let value = read_varint(&mut self.inner)?;
+                self.state.last_access = address;
+                if kind == TAG_LOAD {
+                    TraceEvent::Load {
+                        address,
+                        value,
+                        size,
+                    }
+                } else {
+                    TraceEvent::Store {
+                        address,
+                        value,
+                        size,
+                    }
+                }
+            }
+        };
+        Ok(Some(event))
+    }
+}
+
+impl<R: Read> Iterator for TraceReader<R> {
+    type Item = io::Result<TraceEvent>;
+
+    fn next(&mut self) -> Option<Self::Item> {
+        self.read().transpose()
+    }
+}
+
+fn zigzag(value: i32) -> u32 {
+    ((value << 1) ^ (value >> 31)) as u32
+}
+
+fn unzigzag(value: u32) -> i32 {
+    ((value >> 1) as i32) ^ -((value & 1) as i32)
+}
+
+fn write_varint(buffer: &mut Vec<u8>, mut value: u32) {
+    while value >= 0x80 {
+        buffer.push(value as u8 | 0x80);
+        value >>= 7;
+    }
+    buffer.push(value as u8);
+}
+
+fn read_varint<R: Read>(reader: &mut R) -> io::Result<u32> {
+    let mut value = 0u32;
+    for shift in (0..35).step_by(7) {
+        let mut byte = [0];
+        reader.read_exact(&mut byte)?;
+        value |= ((byte[0] & 0x7F) as u32) << shift;
+        if byte[0] & 0x80 == 0 {
+            return Ok(value);
+        }
+    }
+    Err(io::Error::new(
+        io::ErrorKind::InvalidData,
+        "varint is too long",
+    ))
+}
+
+#[cfg(test)]
+mod test {
+    use super::{trace_buffer, TraceEvent, TraceReader, TraceWriter};
+
+    fn instruction(address: u32, opcode: u32, thumb: bool, cycles: u32) -> TraceEvent {
+        TraceEvent::Instruction {
+            address,
+            opcode,
+            thumb,
+            cycles,
+        }
+    }
+
+    #[test]
+    fn test_format_round_trip() {
+        let events = [
+            instruction(0x08000000, 0xE3A00000, false, 3),
+            instruction(0x08000004, 0xE5901000, false, 40),
+            TraceEvent::Load {
+                address: 0x03007FFC,
+                value: 0xDEADBEEF,
+                size: 4,
+            },
+            TraceEvent::Store {
+                address: 0x03007FF0,
+                value: 0x12,
+                size: 1,
+            },
+            instruction(0x03000100, 0x4770, true, 1),
+            instruction(0x03000102, 0xE7FE, true, 3),
+            TraceEvent::Load {
+                address: 0x04000130,
+                value: 0x3FF,
+                size: 2,
+            },
+            instruction(0x00000000, 0xEA000000, false, 0),
+        ];
+
+        let mut writer = TraceWriter::new(Vec::new()).unwrap();
+        for event in &events {
+            writer.write(event).unwrap();
+        }
+        let bytes = writer.into_inner();
+
+        let read = TraceReader::new(&bytes[..])
+            .unwrap()
+            .collect::<Result<Vec<_>, _>>()
+            .unwrap();
+        assert_eq!(read, events);
+    }
+
+    #[test]
+    fn test_sequential_instructions_are_small() {
+        let mut writer = TraceWriter::new(Vec::new()).unwrap();
+        writer.write(&instruction(0, 0xE1A00000, false, 1)).unwrap();
+        let start = writer.into_inner().len();
+
+        let mut writer = TraceWriter::new(Vec::new()).unwrap();
+        writer.write(&instruction(0, 0xE1A00000, false, 1)).unwrap();
+        writer.write(&instruction(4, 0xE1A00000, false, 1)).unwrap();
+        // Just the tag and the opcode.
+        assert_eq!(writer.into_inner().len() - start, 5);
+    }
+
+    #[test]
+    fn test_buffer_is_drained_across_threads() {
+        let (mut producer, mut consumer) = trace_buffer(4);
+        let count = 1000;
+        let consumer = std::thread::spawn(move || {
+            let mut writer = TraceWriter::new(Vec::new()).unwrap();
+            consumer.drain_into(&mut writer).unwrap();
+            writer.into_inner()
+        });
+        for index in 0..count {
+            producer.push(instruction(index * 4, index, false, 1));
+        }
+        drop(producer);
+
+        let bytes = consumer.join().unwrap();
+        let read = TraceReader::new(&bytes[..])
+            .unwrap()
+            .collect::<Result<Vec<_>, _>>()
+            .unwrap();
+        assert_eq!(read.len(), count as usize);
+        for (index, event) in read.into_iter().enumerate() {
+            assert_eq!(event, instruction(index as u32 * 4, index as u32, false, 1));
+        }
+    }
+
+    #[test]
+    fn test_push_without_consumer_does_not_block() {
+        let (mut producer, consumer) = trace_buffer(2);
+        drop(consumer);
+        for index in 0..8 {
+            producer.push(instruction(index * 4, 0, false, 1));
+        }
+    }
+}
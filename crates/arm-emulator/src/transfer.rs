@@ -101,6 +101,7 @@ impl<const USER_MODE: bool> SingleDataTransfer for Str<USER_MODE> {
         //      A word store (STR) should generate a word aligned address. The word presented to
         //      the data bus is not affected if the address is not word aligned. That is, bit 31 of the
         //      register being stored always appears on data bus output 31.
+        cpu.invalidate_code(dst_addr & !0x3, 4);
         Cycles::one() + memory.store32(dst_addr & !0x3, value, cpu)
     }
 }
@@ -117,6 +118,7 @@ impl<const USER_MODE: bool> SingleDataTransfer for Strb<USER_MODE> {
             value = value.wrapping_add(4);
         }
 
+        cpu.invalidate_code(dst_addr, 1);
         Cycles::one() + memory.store8(dst_addr, value as u8, cpu)
     }
 }
@@ -145,6 +147,7 @@ impl SingleDataTransfer for Strh {
             value = value.wrapping_add(4);
         }
 
+        cpu.invalidate_code(addr & !0x1, 2);
         Cycles::one() + memory.store16(addr, value as u16, cpu)
     }
 }
@@ -378,6 +381,7 @@ impl BlockDataTransfer for Stm {
             value = value.wrapping_add(4);
         }
         let wait = memory.store32(destination_address, value, cpu);
+        cpu.invalidate_code(destination_address & !0x3, 4);
         Cycles::one() + wait
     }
 }
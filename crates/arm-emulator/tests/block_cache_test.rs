@@ -0,0 +1,174 @@
+use arm_emulator::{Cycles, InstructionSet};
+
+use crate::common::Executor;
+
+pub mod common;
+
+/// Runs `source` for `deadline` cycles and returns the number of cycles that elapsed along
+/// with the values of r0-r3 and the number of instructions that were executed. `source`
+/// has to end in a loop so that it never runs off the end.
+fn run(exec: &mut Executor, source: &str, cached: bool, deadline: u32) -> (Cycles, [u32; 4], u64) {
+    exec.cpu.set_block_cache_enabled(cached);
+    exec.push_no_exec(source);
+    exec.load();
+
+    let cycles = exec.cpu.run_until(Cycles::from(deadline), &mut exec.mem);
+    let registers = [0, 1, 2, 3].map(|r| exec.cpu.registers.read(r));
+    (cycles, registers, exec.cpu.instruction_count())
+}
+
+/// Checks that the block cache doesn't change anything. Returns the registers at the end and
+/// the number of opcode fetches that the block cache skipped.
+fn assert_same_with_and_without_cache(isa: InstructionSet, source: &str) -> ([u32; 4], u64) {
+    for deadline in [1, 17, 100, 999, 100_003] {
+        let mut cached = Executor::new(isa);
+        let mut uncached = Executor::new(isa);
+        let result = run(&mut cached, source, true, deadline);
+        assert_eq!(
+            result,
+            run(&mut uncached, source, false, deadline),
+            "deadline = {deadline}"
+        );
+        if deadline == 100_003 {
+            return (result.1, cached.mem.skipped_fetches);
+        }
+    }
+    unreachable!()
+}
+
+#[test]
+pub fn test_cached_arm_loop() {
+    let (registers, skipped) = assert_same_with_and_without_cache(
+        InstructionSet::Arm,
+        "
+        mov     r0, #0
+        mov     r1, #10
+    loop:
+        add     r0, r0, r1
+        eor     r2, r2, r0, lsl #3
+        add     r3, r2, r1
+        subs    r1, r1, #1
+        bne     loop
+    done:
+        b       done
+        ",
+    );
+    assert_eq!(registers[0], 55);
+    assert_ne!(skipped, 0);
+}
+
+#[test]
+pub fn test_cached_thumb_loop() {
+    let (registers, skipped) = assert_same_with_and_without_cache(
+        InstructionSet::Thumb,
+        "
+        mov     r0, #0
+        mov     r1, #10
+    loop:
+        add     r0, r0, r1
+        lsl     r2, r0, #3
+        eor     r3, r2
+        sub     r1, #1
+        bne     loop
+    done:
+        b       done
+        ",
+    );
+    assert_eq!(registers[0], 55);
+    assert_ne!(skipped, 0);
+}
+
+#[test]
+pub fn test_cached_loads_and_stores() {
+    let (_, skipped) = assert_same_with_and_without_cache(
+        InstructionSet::Arm,
+        "
+        mov     r0, #0
+        ldr     r2, =value
+    loop:
+        ldr     r1, [r2]
+        add     r0, r0, #3
+        add     r1, r1, r0
+        str     r1, [r2]
+        add     r3, r1, r0
+        b       loop
+
+        @ Keeps the stores off of the page with the code.
+        .space  1024
+    value:
+        .word   0
+        ",
+    );
+    assert_ne!(skipped, 0);
+}
+
+#[test]
+pub fn test_cached_self_modifying_code() {
+    let (registers, _) = assert_same_with_and_without_cache(
+        InstructionSet::Arm,
+        "
+        mov     r0, #0
+        mov     r1, #2
+        ldr     r2, =0xE2800010     @ add r0, r0, #16
+        adr     r3, patched
+    loop:
+    patched:
+        add     r0, r0, #1
+        str     r2, [r3]
+        subs    r1, r1, #1
+        bne     loop
+    done:
+        b       done
+        ",
+    );
+    assert_eq!(registers[0], 17);
+}
+
+/// The store changes an instruction that is already in the pipeline, so the old one still
+/// runs the first time around.
+#[test]
+pub fn test_cached_store_to_pipeline() {
+    let (registers, _) = assert_same_with_and_without_cache(
+        InstructionSet::Arm,
+        "
+        mov     r0, #0
+        mov     r1, #3
+        ldr     r2, =0xE2800010     @ add r0, r0, #16
+        adr     r3, patched
+    loop:
+        str     r2, [r3]
+    patched:
+        add     r0, r0, #1
+        subs    r1, r1, #1
+        bne     loop
+    done:
+        b       done
+        ",
+    );
+    assert_eq!(registers[0], 33);
+}
+
+#[test]
+pub fn test_cached_state_changes() {
+    assert_same_with_and_without_cache(
+        InstructionSet::Arm,
+        "
+        mov     r0, #0
+    arm_loop:
+        add     r0, r0, #1
+        adr     r1, thumb_code + 1
+        bx      r1
+    .thumb
+    thumb_code:
+        add     r0, #2
+        mov     r2, r0
+        adr     r1, arm_code
+        bx      r1
+    .align 2
+    .arm
+    arm_code:
+        add     r3, r2, r0
+        b       arm_loop
+        ",
+    );
+}
@@ -3,7 +3,10 @@ pub mod operands;
 use std::sync::Mutex;
 
 use arm_devkit::{LinkerScript, LinkerScriptWeakRef};
-use arm_emulator::{CpsrFlag, Cpu, CpuMode, InstructionSet, Memory, Waitstates};
+use arm_emulator::{
+    CodeTiming, CpsrFlag, Cpu, CpuException, CpuMode, Cycles, ExceptionHandlerResult,
+    InstructionSet, Memory, SkippedFetches, Waitstates,
+};
 
 #[macro_use]
 mod test_combinations;
@@ -11,6 +14,13 @@ mod test_combinations;
 #[derive(Default)]
 pub struct TestMemory {
     data: Vec<u8>,
+
+    /// Number of opcode fetches that the block cache skipped.
+    pub skipped_fetches: u64,
+
+    /// Makes fetches of the end markers return undefined instructions, so that running into
+    /// one raises an exception instead of having to be checked for before every instruction.
+    trap_end: bool,
 }
 
 impl TestMemory {
@@ -33,12 +43,37 @@ impl Memory for TestMemory {
         (self.data[address], Waitstates::zero())
     }
 
-    fn store8(&mut self, address: u32, value: u8, _cpu: &mut Cpu) -> Waitstates {
-        let address = address as usize % self.data.len();
-        self.data[address] = value;
+    fn store8(&mut self, address: u32, value: u8, cpu: &mut Cpu) -> Waitstates {
+        let unmirrored = address as usize % self.data.len();
+        self.data[unmirrored] = value;
+        if unmirrored != address as usize {
+            cpu.invalidate_code(unmirrored as u32, 1);
+        }
         Waitstates::zero()
     }
 
+    fn fetch32(&mut self, address: u32, cpu: &mut Cpu) -> (u32, Waitstates) {
+        match self.load32(address, cpu) {
+            (ARM_END_OPCODE, wait) if self.trap_end => (ARM_UNDEFINED_OPCODE, wait),
+            fetched => fetched,
+        }
+    }
+
+    fn fetch16(&mut self, address: u32, cpu: &mut Cpu) -> (u16, Waitstates) {
+        match self.load16(address, cpu) {
+            (THUMB_END_OPCODE, wait) if self.trap_end => (THUMB_UNDEFINED_OPCODE, wait),
+            fetched => fetched,
+        }
+    }
+
+    fn code_timing(&mut self, address: u32, _thumb: bool) -> Option<CodeTiming> {
+        ((address as usize) < self.data.len()).then(CodeTiming::default)
+    }
+
+    fn skipped_fetches(&mut self, fetches: SkippedFetches) {
+        self.skipped_fetches += fetches.count as u64;
+    }
+
     fn as_any(&self) -> &dyn std::any::Any {
         self
     }
@@ -56,6 +91,11 @@ const ARM_END_OPCODE: u32 = 0xF777F777;
 /// By itself this is an undefined instruction. (2 of them make a branch with link but w/e)
 const THUMB_END_OPCODE: u16 = 0xF777;
 
+/// Undefined instructions that the end markers are fetched as when [`TestMemory::trap_end`]
+/// is set.
+const ARM_UNDEFINED_OPCODE: u32 = 0xE7F000F0;
+const THUMB_UNDEFINED_OPCODE: u16 = 0xDE00;
+
 pub fn execute_arm(source: &str) -> (Cpu, TestMemory) {
     let mut exec = Executor::new(InstructionSet::Arm);
     exec.push(source);
@@ -107,7 +147,9 @@ impl Executor {
         self.execute();
     }
 
-    fn execute(&mut self) {
+    /// Assembles and loads the source that has been pushed so far and branches to the
+    /// start of it without executing anything.
+    pub fn load(&mut self) {
         let mut source = String::new();
         source.push_str(".text\n");
 
@@ -121,6 +163,12 @@ impl Executor {
         source.push_str("_start:\n");
         source.push_str(&self.source);
         source.push('\n');
+        if cfg!(feature = "jit") && self.base_isa == InstructionSet::Arm {
+            // The last two instructions of a block are never compiled, so this keeps the
+            // last instructions of the source from always being interpreted. Only ARM blocks
+            // are compiled.
+            source.push_str("mov r0, r0\nmov r0, r0\n");
+        }
         source.push_str(".hword 0xF777\n");
         source.push_str(".hword 0xF777\n");
         source.push_str(".text\n");
@@ -137,6 +185,10 @@ impl Executor {
         // where you're likely to have your code ignored by your antivirus (e.g. Windows Defender)
         // but not your temporary directory.
         arm_devkit::set_internal_tempfile_directory(env!("CARGO_TARGET_TMPDIR"));
+        arm_devkit::set_assembly_cache_directory(concat!(
+            env!("CARGO_TARGET_TMPDIR"),
+            "/assembly-cache"
+        ));
 
         self.mem.data = if self.base_isa == InstructionSet::Arm {
             arm_devkit::arm::assemble(&source, simple_linker_script()).unwrap()
@@ -148,7 +200,18 @@ impl Executor {
             .registers
             .put_flag(CpsrFlag::T, self.base_isa == InstructionSet::Thumb);
         self.cpu.branch(0, &mut self.mem);
+    }
+
+    fn execute(&mut self) {
+        self.load();
+        if cfg!(feature = "jit") {
+            self.execute_twice_cached();
+        } else {
+            self.step_to_end();
+        }
+    }
 
+    fn step_to_end(&mut self) {
         let start_time = std::time::Instant::now();
         let mut steps_since_time_chek = 0;
 
@@ -183,6 +246,58 @@ impl Executor {
     }
 }
 
+impl Executor {
+    /// Runs the loaded source through the block cache twice from the same state. The first
+    /// run records the blocks (and with the `jit` feature compiles them) and the second one
+    /// runs them from the cache, so they have to end the same way.
+    fn execute_twice_cached(&mut self) {
+        self.mem.trap_end = true;
+        self.cpu.clear_block_cache();
+        self.cpu.set_block_cache_enabled(true);
+        self.cpu.set_exception_handler(|cpu, memory, exception| {
+            let memory = memory.as_any().downcast_ref::<TestMemory>().unwrap();
+            let address = cpu.exception_address();
+            let end = if cpu.registers.get_flag(CpsrFlag::T) {
+                memory.view16(address) == THUMB_END_OPCODE
+            } else {
+                memory.view32(address) == ARM_END_OPCODE
+            };
+            if exception == CpuException::Undefined && end {
+                cpu.halt();
+                ExceptionHandlerResult::Handled(Cycles::zero())
+            } else {
+                ExceptionHandlerResult::Ignored
+            }
+        });
+
+        let start = (self.cpu.save_state(), self.mem.data.clone());
+        self.run_cached_to_end();
+        let first = (self.cpu.save_state(), self.mem.data.clone());
+
+        self.cpu.load_state(&start.0);
+        if self.mem.data != start.1 {
+            self.mem.data = start.1;
+            self.cpu.invalidate_code(0, self.mem.data.len() as u32);
+        }
+        self.run_cached_to_end();
+        assert!(
+            self.cpu.save_state() == first.0 && self.mem.data == first.1,
+            "running from the block cache changed the result"
+        );
+    }
+
+    fn run_cached_to_end(&mut self) {
+        let start_time = std::time::Instant::now();
+        while !self.cpu.halted() {
+            if start_time.elapsed() > std::time::Duration::from_secs(5) {
+                let next_pc = self.cpu.next_execution_address();
+                panic!("emulator timeout: 0x{next_pc:08X}");
+            }
+            self.cpu.run_until(Cycles::from(1 << 16), &mut self.mem);
+        }
+    }
+}
+
 fn simple_linker_script() -> LinkerScript {
     let mut locked = match SCRIPT.lock() {
         Ok(lock) => lock,
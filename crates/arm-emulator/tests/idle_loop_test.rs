@@ -0,0 +1,86 @@
+use arm_emulator::{Cycles, InstructionSet};
+
+use crate::common::Executor;
+
+pub mod common;
+
+/// Runs `source` for `deadline` cycles and returns the number of cycles that elapsed along
+/// with the values of r0-r3.
+fn run(isa: InstructionSet, source: &str, idle: bool, deadline: u32) -> (Cycles, [u32; 4]) {
+    let mut exec = Executor::new(isa);
+    exec.cpu.set_idle_loop_detection_enabled(idle);
+    exec.push_no_exec(source);
+    exec.load();
+
+    let cycles = exec.cpu.run_until(Cycles::from(deadline), &mut exec.mem);
+    let registers = [0, 1, 2, 3].map(|r| exec.cpu.registers.read(r));
+    (cycles, registers)
+}
+
+fn assert_same_with_and_without_detection(isa: InstructionSet, source: &str) {
+    for deadline in [1, 17, 100, 1000, 100_003] {
+        assert_eq!(
+            run(isa, source, true, deadline),
+            run(isa, source, false, deadline),
+            "deadline = {deadline}"
+        );
+    }
+}
+
+#[test]
+pub fn test_arm_idle_loop() {
+    assert_same_with_and_without_detection(
+        InstructionSet::Arm,
+        "
+        mov     r0, #0
+        mov     r2, #0x400
+    loop:
+        ldr     r1, [r2]
+        cmp     r1, #1
+        bne     loop
+        ",
+    );
+}
+
+#[test]
+pub fn test_thumb_idle_loop() {
+    assert_same_with_and_without_detection(
+        InstructionSet::Thumb,
+        "
+        mov     r2, #0x40
+    loop:
+        ldrh    r1, [r2]
+        cmp     r1, #1
+        bne     loop
+        ",
+    );
+}
+
+#[test]
+pub fn test_busy_loop_is_not_skipped() {
+    assert_same_with_and_without_detection(
+        InstructionSet::Arm,
+        "
+        mov     r0, #0
+    loop:
+        add     r0, r0, #1
+        b       loop
+        ",
+    );
+}
+
+#[test]
+pub fn test_loop_with_store_is_not_skipped() {
+    assert_same_with_and_without_detection(
+        InstructionSet::Arm,
+        "
+        mov     r0, #0
+        mov     r2, #0x400
+    loop:
+        ldr     r1, [r2]
+        add     r1, r1, #1
+        str     r1, [r2]
+        b       loop
+        ",
+    );
+}
@@ -0,0 +1,56 @@
+use arm_emulator::{Cycles, InstructionSet};
+
+use crate::common::Executor;
+
+pub mod common;
+
+/// Runs `source` for `deadline` cycles and returns the number of cycles that elapsed,
+/// the number of instructions executed and the values of r0-r3.
+fn run(source: &str, deadline: u32, step: bool) -> (Cycles, u64, [u32; 4]) {
+    let mut exec = Executor::new(InstructionSet::Arm);
+    exec.push_no_exec(source);
+    exec.load();
+
+    let deadline = Cycles::from(deadline);
+    let cycles = if step {
+        let mut cycles = Cycles::zero();
+        while cycles < deadline {
+            cycles += exec.cpu.step(&mut exec.mem);
+        }
+        cycles
+    } else {
+        exec.cpu.run_until(deadline, &mut exec.mem)
+    };
+    let registers = [0, 1, 2, 3].map(|r| exec.cpu.registers.read(r));
+    (cycles, exec.cpu.instruction_count(), registers)
+}
+
+#[test]
+pub fn test_run_until_matches_stepping_across_state_changes() {
+    let source = "
+        mov     r0, #0
+        mov     r1, #0
+    arm_loop:
+        add     r0, r0, #1
+        adr     r2, thumb_code + 1
+        bx      r2
+    .thumb
+    thumb_code:
+        add     r1, #1
+        mov     r3, r1
+        adr     r2, arm_code
+        bx      r2
+    .align 2
+    .arm
+    arm_code:
+        b       arm_loop
+    ";
+
+    for deadline in [1, 17, 100, 1000, 100_003] {
+        assert_eq!(
+            run(source, deadline, false),
+            run(source, deadline, true),
+            "deadline = {deadline}"
+        );
+    }
+}
@@ -0,0 +1,157 @@
+//! Measures whole frames of a ROM that keeps the CPU busy with generated instructions, with
+//! and without the block cache. The instructions are a mix of data processing, multiply and
+//! load/store instructions with operands from a fixed seed, like the ones in the
+//! `arm-emulator` dispatch benchmarks, and run straight from the gamepak.
+
+use criterion::{criterion_group, criterion_main, Criterion, Throughput};
+use gba::{Gba, NoopGbaAudioOutput, NoopGbaVideoOutput};
+use util::wyhash::WyHash;
+
+/// Number of generated instructions in a stream, not including the branch back to the start.
+const STREAM_LENGTH: u32 = 512;
+
+/// `mov r12, #0x03000000` and `mov r7, #0x03000000`: loads and stores go to IWRAM.
+const ARM_SET_DATA_ADDRESS: [u32; 2] = [0xE3A0C403, 0xE3A07403];
+
+/// `add r0, pc, #1` and `bx r0`, which switch to THUMB for the instruction after them.
+const ARM_SWITCH_TO_THUMB: [u32; 2] = [0xE28F0001, 0xE12FFF10];
+
+/// Generates ARM instructions that only write to r0-r11 and load and store relative to r12.
+fn arm_stream(seed: u64) -> Vec<u32> {
+    let mut rng = WyHash::new(seed);
+    let mut code = Vec::new();
+
+    for _ in 0..STREAM_LENGTH {
+        let r: u32 = rng.generate();
+        let rd = (r >> 12) % 12;
+        let rn = (r >> 16) % 13;
+        let rm = r % 13;
+        let cond = if r & 0x300000 == 0 {
+            (r >> 28) % 15
+        } else {
+            0xE
+        };
+
+        let instr = match (r >> 24) % 8 {
+            // Data processing with an immediate operand.
+            0..=2 => {
+                let opcode = (r >> 4) % 16;
+                let s = (opcode & 0xC == 0x8) as u32 | ((r >> 9) & 1);
+                (cond << 28)
+                    | (1 << 25)
+                    | (opcode << 21)
+                    | (s << 20)
+                    | (rn << 16)
+                    | (rd << 12)
+                    | (r & 0xFFF)
+            }
+            // Data processing with a register operand shifted by an immediate.
+            3..=5 => {
+                let opcode = (r >> 4) % 16;
+                let s = (opcode & 0xC == 0x8) as u32 | ((r >> 9) & 1);
+                let shift = (r >> 5) & 0x7F;
+                (cond << 28)
+                    | (opcode << 21)
+                    | (s << 20)
+                    | (rn << 16)
+                    | (rd << 12)
+                    | (shift << 5)
+                    | rm
+            }
+            // MUL
+            6 => {
+                let rs = (r >> 8) % 13;
+                (cond << 28) | (rd << 16) | (rs << 8) | 0x90 | rm
+            }
+            // LDR/STR/LDRB/STRB with an immediate offset from r12.
+            _ => {
+                let load = (r >> 20) & 1;
+                let byte = (r >> 22) & 1;
+                let offset = r & 0xFFC;
+                (cond << 28)
+                    | (0x58 << 20)
+                    | (byte << 22)
+                    | (load << 20)
+                    | (12 << 16)
+                    | (rd << 12)
+                    | offset
+            }
+        };
+        code.push(instr);
+    }
+    code
+}
+
+/// Generates THUMB instructions that only write to r0-r6 and load and store relative to r7.
+fn thumb_stream(seed: u64) -> Vec<u16> {
+    let mut rng = WyHash::new(seed);
+    let mut code = Vec::new();
+
+    for _ in 0..STREAM_LENGTH {
+        let r: u16 = rng.generate();
+        let rd = r % 7;
+        let rs = (r >> 3) & 0x7;
+
+        let instr = match (r >> 13) % 6 {
+            // Move shifted register.
+            0 => ((r >> 11) % 3) << 11 | ((r >> 6) & 0x1F) << 6 | rs << 3 | rd,
+            // Add/subtract.
+            1 => 0x1800 | ((r >> 9) & 0x3) << 9 | ((r >> 6) & 0x7) << 6 | rs << 3 | rd,
+            // Move/compare/add/subtract immediate.
+            2 => 0x2000 | ((r >> 11) & 0x3) << 11 | rd << 8 | (r & 0xFF),
+            // ALU operations.
+            3 | 4 => 0x4000 | ((r >> 6) & 0xF) << 6 | rs << 3 | rd,
+            // Load/store with an immediate offset from r7.
+            _ => 0x6000 | ((r >> 11) & 0x3) << 11 | ((r >> 6) & 0x1F) << 6 | 7 << 3 | rd,
+        };
+        code.push(instr);
+    }
+    code
+}
+
+/// A ROM that sets up the base registers and then runs the ARM stream in a loop.
+fn arm_rom() -> Vec<u8> {
+    let mut code = ARM_SET_DATA_ADDRESS.to_vec();
+    code.extend(arm_stream(0x41524D));
+    // b <start of the stream>
+    let offset = (-(STREAM_LENGTH as i32) - 2) as u32 & 0xFFFFFF;
+    code.push(0xEA000000 | offset);
+    code.iter().flat_map(|word| word.to_le_bytes()).collect()
+}
+
+/// A ROM that sets up the base registers, switches to THUMB and runs the THUMB stream in
+/// a loop.
+fn thumb_rom() -> Vec<u8> {
+    let mut rom: Vec<u8> = [ARM_SET_DATA_ADDRESS, ARM_SWITCH_TO_THUMB]
+        .iter()
+        .flatten()
+        .flat_map(|word| word.to_le_bytes())
+        .collect();
+    let mut code = thumb_stream(0x5448554D42);
+    // b <start of the stream>
+    let offset = (-(STREAM_LENGTH as i32) - 2) as u16 & 0x7FF;
+    code.push(0xE000 | offset);
+    rom.extend(code.iter().flat_map(|halfword| halfword.to_le_bytes()));
+    rom
+}
+
+fn bench_run_frame(c: &mut Criterion) {
+    let mut group = c.benchmark_group("run_frame");
+    group.throughput(Throughput::Elements(1));
+
+    for (name, rom) in [("arm", arm_rom()), ("thumb", thumb_rom())] {
+        for (suffix, block_cache) in [("", false), ("/block_cache", true)] {
+            let mut gba = Gba::new();
+            gba.cpu.set_block_cache_enabled(block_cache);
+            gba.set_gamepak(rom.clone());
+            gba.reset();
+            group.bench_function(format!("{name}{suffix}"), |b| {
+                b.iter(|| gba.run_frame(&mut NoopGbaVideoOutput, &mut NoopGbaAudioOutput))
+            });
+        }
+    }
+    group.finish();
+}
+
+criterion_group!(benches, bench_run_frame);
+criterion_main!(benches);
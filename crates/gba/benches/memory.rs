@@ -0,0 +1,113 @@
+//! Measures loads and stores through `GbaMemoryMappedHardware` for each memory region.
+
+use arm::emu::Memory as _;
+use criterion::{black_box, criterion_group, criterion_main, Criterion, Throughput};
+use gba::Gba;
+use util::wyhash::WyHash;
+
+/// Number of accesses for each iteration of a benchmark.
+const ACCESSES: usize = 1024;
+
+/// Name, start address, size of the range of addresses that are accessed and whether the
+/// region is written to by the store benchmarks. Only the background scroll registers are
+/// used for I/O so that the stores don't have any side effects.
+const REGIONS: &[(&str, u32, u32, bool)] = &[
+    ("bios", 0x00000000, 0x4000, false),
+    ("ewram", 0x02000000, 0x40000, true),
+    ("iwram", 0x03000000, 0x8000, true),
+    ("io", 0x04000010, 0x10, true),
+    ("palette", 0x05000000, 0x400, true),
+    ("vram", 0x06000000, 0x18000, true),
+    ("oam", 0x07000000, 0x400, true),
+    ("gamepak", 0x08000000, 0x10000, false),
+];
+
+fn setup() -> Gba {
+    let mut gba = Gba::new();
+    gba.set_gamepak(vec![0xA5; 0x10000]);
+    gba.reset();
+    gba
+}
+
+/// Addresses in the region aligned to `size` bytes.
+fn addresses(seed: u64, start: u32, len: u32, size: u32) -> Vec<u32> {
+    WyHash::new(seed)
+        .take(ACCESSES)
+        .map(|r| (start + r as u32 % len) & !(size - 1))
+        .collect()
+}
+
+fn bench_loads(c: &mut Criterion) {
+    let mut gba = setup();
+    let mut group = c.benchmark_group("memory/load");
+    group.throughput(Throughput::Elements(ACCESSES as u64));
+
+    for &(name, start, len, _) in REGIONS {
+        let addresses8 = addresses(1, start, len, 1);
+        group.bench_function(format!("{name}/8"), |b| {
+            b.iter(|| {
+                for &address in &addresses8 {
+                    black_box(gba.mapped.load8(address, &mut gba.cpu));
+                }
+            })
+        });
+
+        let addresses16 = addresses(2, start, len, 2);
+        group.bench_function(format!("{name}/16"), |b| {
+            b.iter(|| {
+                for &address in &addresses16 {
+                    black_box(gba.mapped.load16(address, &mut gba.cpu));
+                }
+            })
+        });
+
+        let addresses32 = addresses(4, start, len, 4);
+        group.bench_function(format!("{name}/32"), |b| {
+            b.iter(|| {
+                for &address in &addresses32 {
+                    black_box(gba.mapped.load32(address, &mut gba.cpu));
+                }
+            })
+        });
+    }
+    group.finish();
+}
+
+fn bench_stores(c: &mut Criterion) {
+    let mut gba = setup();
+    let mut group = c.benchmark_group("memory/store");
+    group.throughput(Throughput::Elements(ACCESSES as u64));
+
+    for &(name, start, len, _) in REGIONS.iter().filter(|region| region.3) {
+        let addresses8 = addresses(1, start, len, 1);
+        group.bench_function(format!("{name}/8"), |b| {
+            b.iter(|| {
+                for &address in &addresses8 {
+                    black_box(gba.mapped.store8(address, address as u8, &mut gba.cpu));
+                }
+            })
+        });
+
+        let addresses16 = addresses(2, start, len, 2);
+        group.bench_function(format!("{name}/16"), |b| {
+            b.iter(|| {
+                for &address in &addresses16 {
+                    black_box(gba.mapped.store16(address, address as u16, &mut gba.cpu));
+                }
+            })
+        });
+
+        let addresses32 = addresses(4, start, len, 4);
+        group.bench_function(format!("{name}/32"), |b| {
+            b.iter(|| {
+                for &address in &addresses32 {
+                    black_box(gba.mapped.store32(address, address, &mut gba.cpu));
+                }
+            })
+        });
+    }
+    group.finish();
+}
+
+criterion_group!(benches, bench_loads, bench_stores);
+criterion_main!(benches);
@@ -0,0 +1,48 @@
+//! Measures taking and restoring snapshots after a frame that only wrote to a few pages.
+
+use arm::emu::Memory as _;
+use criterion::{black_box, criterion_group, criterion_main, Criterion, Throughput};
+use gba::{
+    video::{ScreenBuffer, VISIBLE_PIXELS},
+    Gba, NoopGbaAudioOutput,
+};
+
+fn setup() -> Gba {
+    let mut gba = Gba::new();
+    gba.set_noop_gamepak();
+    gba.reset();
+    let mut frame: Box<ScreenBuffer> = Box::new([0; VISIBLE_PIXELS]);
+    gba.run_frame_into(&mut frame, &mut NoopGbaAudioOutput);
+    gba
+}
+
+fn bench_savestate(c: &mut Criterion) {
+    let mut group = c.benchmark_group("savestate");
+    group.throughput(Throughput::Elements(1));
+
+    let mut gba = setup();
+    gba.snapshot();
+    group.bench_function("snapshot", |b| {
+        b.iter(|| {
+            // Dirty the same two pages that a game's stack and variables would.
+            gba.mapped.store32(0x03007F00, 1, &mut gba.cpu);
+            gba.mapped.store32(0x02000000, 1, &mut gba.cpu);
+            black_box(gba.snapshot())
+        })
+    });
+
+    let snapshot = gba.snapshot();
+    group.bench_function("restore", |b| {
+        b.iter(|| {
+            gba.mapped.store32(0x03007F00, 2, &mut gba.cpu);
+            gba.mapped.store32(0x02000000, 2, &mut gba.cpu);
+            gba.restore(&snapshot);
+        })
+    });
+
+    group.bench_function("to_bytes", |b| b.iter(|| black_box(snapshot.to_bytes())));
+    group.finish();
+}
+
+criterion_group!(benches, bench_savestate);
+criterion_main!(benches);
@@ -0,0 +1,77 @@
+//! Measures scheduling and firing events with as many events pending as the GBA has
+//! (H-Draw/H-Blank plus timers, DMA, ...).
+
+use arm::emu::Cycles;
+use criterion::{black_box, criterion_group, criterion_main, BenchmarkId, Criterion, Throughput};
+use gba::bench::{GbaEvent, GbaScheduler};
+use util::wyhash::WyHash;
+
+/// Number of events that are fired for each iteration of a benchmark.
+const EVENTS: u64 = 1024;
+
+/// Fills a scheduler with `pending` events and returns the delays that events are
+/// rescheduled with after they fire.
+fn setup(pending: usize) -> (GbaScheduler, Vec<Cycles>) {
+    let mut scheduler = GbaScheduler::default();
+    let delays: Vec<Cycles> = WyHash::new(pending as u64)
+        .take(pending)
+        .map(|r| Cycles::from(64 + r as u32 % 1232))
+        .collect();
+    for (index, &delay) in delays.iter().enumerate() {
+        let event = if index % 2 == 0 {
+            GbaEvent::HDraw
+        } else {
+            GbaEvent::HBlank
+        };
+        scheduler.schedule(event, delay);
+    }
+    (scheduler, delays)
+}
+
+/// Runs the scheduler like `Gba::run_frame` does: time always advances to the next event and
+/// every event reschedules itself when it fires, so the number of pending events doesn't change.
+fn bench_schedule_tick(c: &mut Criterion) {
+    let mut group = c.benchmark_group("scheduler/schedule_tick");
+    group.throughput(Throughput::Elements(EVENTS));
+
+    for pending in [2, 4, 8, 16] {
+        let (mut scheduler, delays) = setup(pending);
+        let mut next_delay = 0;
+        group.bench_with_input(BenchmarkId::from_parameter(pending), &pending, |b, _| {
+            b.iter(|| {
+                for _ in 0..EVENTS {
+                    let mut cycles = scheduler.next_event_in().unwrap();
+                    while let Some(event) = scheduler.tick(&mut cycles) {
+                        scheduler.schedule(black_box(event), delays[next_delay]);
+                        next_delay = (next_delay + 1) % delays.len();
+                    }
+                }
+            })
+        });
+    }
+    group.finish();
+}
+
+/// Ticks that don't reach an event, which is what happens when the CPU stops before the next
+/// event because of e.g. an interrupt.
+fn bench_tick_no_event(c: &mut Criterion) {
+    let mut group = c.benchmark_group("scheduler/tick_no_event");
+    group.throughput(Throughput::Elements(EVENTS));
+
+    let mut scheduler = GbaScheduler::default();
+    for _ in 0..8 {
+        scheduler.schedule_at(GbaEvent::HDraw, u64::MAX);
+    }
+    group.bench_function("8", |b| {
+        b.iter(|| {
+            for _ in 0..EVENTS {
+                let mut cycles = Cycles::one();
+                black_box(scheduler.tick(&mut cycles));
+            }
+        })
+    });
+    group.finish();
+}
+
+criterion_group!(benches, bench_schedule_tick, bench_tick_no_event);
+criterion_main!(benches);
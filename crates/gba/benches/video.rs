@@ -0,0 +1,185 @@
+//! Measures rendering and blending single scanlines, and whole frames.
+
+use arm::emu::Memory as _;
+use criterion::{black_box, criterion_group, criterion_main, Criterion, Throughput};
+use gba::{
+    bench,
+    video::{self, VISIBLE_LINE_COUNT, VISIBLE_LINE_WIDTH},
+    Gba, NoopGbaAudioOutput,
+};
+use util::wyhash::WyHash;
+
+/// A GBA in mode 3 with BG2 enabled and random pixels in the frame buffer.
+fn setup_mode3() -> Gba {
+    let mut gba = Gba::new();
+    gba.set_noop_gamepak();
+    gba.reset();
+
+    gba.mapped.store16(0x04000000, 0x0403, &mut gba.cpu);
+    let pixels = WyHash::new(3).take(VISIBLE_LINE_WIDTH * VISIBLE_LINE_COUNT);
+    for (index, pixel) in pixels.enumerate() {
+        let address = 0x06000000 + index as u32 * 2;
+        gba.mapped.store16(address, pixel as u16, &mut gba.cpu);
+    }
+    gba
+}
+
+/// A GBA in mode 0 with all four backgrounds enabled, scrolled and filled with random tiles.
+/// BG0 and BG1 use 16 color tiles and BG2 and BG3 use 256 color tiles.
+fn setup_mode0() -> Gba {
+    let mut gba = Gba::new();
+    gba.set_noop_gamepak();
+    gba.reset();
+
+    let data = WyHash::new(0).take(0x10000 / 2);
+    for (index, value) in data.enumerate() {
+        let address = 0x06000000 + index as u32 * 2;
+        gba.mapped.store16(address, value as u16, &mut gba.cpu);
+    }
+    for bg in 0..4 {
+        let screen_block = 28 + bg;
+        let palette_256 = if bg >= 2 { 0x80 } else { 0 };
+        let bgcnt = bg | palette_256 | (screen_block << 8);
+        gba.mapped
+            .store16(0x04000008 + bg * 2, bgcnt as u16, &mut gba.cpu);
+        gba.mapped
+            .store16(0x04000010 + bg * 4, (bg * 37) as u16, &mut gba.cpu);
+        gba.mapped
+            .store16(0x04000012 + bg * 4, (bg * 11) as u16, &mut gba.cpu);
+    }
+    gba.mapped.store16(0x04000000, 0x0F00, &mut gba.cpu);
+    gba
+}
+
+fn bench_mode0(c: &mut Criterion) {
+    let mut gba = setup_mode0();
+    let mut group = c.benchmark_group("video/mode0");
+    group.throughput(Throughput::Elements(VISIBLE_LINE_COUNT as u64));
+
+    group.bench_function("render", |b| {
+        b.iter(|| {
+            for line in 0..VISIBLE_LINE_COUNT as u16 {
+                black_box(bench::render_line(&mut gba.mapped, line));
+            }
+        })
+    });
+
+    group.bench_function("render_blend", |b| {
+        let mut output = [0; VISIBLE_LINE_WIDTH];
+        b.iter(|| {
+            for line in 0..VISIBLE_LINE_COUNT as u16 {
+                bench::render_line(&mut gba.mapped, line);
+                bench::blend_line(&mut gba.mapped, &mut output);
+                black_box(&output);
+            }
+        })
+    });
+    group.finish();
+}
+
+fn bench_mode3(c: &mut Criterion) {
+    let mut gba = setup_mode3();
+    let mut group = c.benchmark_group("video/mode3");
+    group.throughput(Throughput::Elements(VISIBLE_LINE_COUNT as u64));
+
+    group.bench_function("render", |b| {
+        b.iter(|| {
+            for line in 0..VISIBLE_LINE_COUNT as u16 {
+                black_box(bench::render_line(&mut gba.mapped, line));
+            }
+        })
+    });
+
+    group.bench_function("render_blend", |b| {
+        let mut output = [0; VISIBLE_LINE_WIDTH];
+        b.iter(|| {
+            for line in 0..VISIBLE_LINE_COUNT as u16 {
+                bench::render_line(&mut gba.mapped, line);
+                bench::blend_line(&mut gba.mapped, &mut output);
+                black_box(&output);
+            }
+        })
+    });
+    group.finish();
+}
+
+fn bench_blend(c: &mut Criterion) {
+    let mut gba = setup_mode3();
+    let mut group = c.benchmark_group("video/blend");
+    group.throughput(Throughput::Elements(1));
+
+    bench::render_line(&mut gba.mapped, 80);
+    group.bench_function("mode3", |b| {
+        let mut output = [0; VISIBLE_LINE_WIDTH];
+        b.iter(|| {
+            bench::blend_line(&mut gba.mapped, &mut output);
+            black_box(&output);
+        })
+    });
+    group.finish();
+}
+
+/// Whole frames, including running the CPU.
+fn bench_frame(c: &mut Criterion) {
+    let mut gba = setup_mode3();
+    let mut group = c.benchmark_group("video/frame");
+    group.throughput(Throughput::Elements(1));
+
+    let mut frame = Box::new([0; VISIBLE_LINE_WIDTH * VISIBLE_LINE_COUNT]);
+    group.bench_function("static", |b| {
+        b.iter(|| {
+            gba.run_frame_into(&mut frame, &mut NoopGbaAudioOutput);
+            black_box(&frame);
+        })
+    });
+
+    // The palette changes before every frame so that every line has to be rendered again.
+    for (name, parallel) in [("mode0", false), ("mode0/parallel", true)] {
+        let mut gba = setup_mode0();
+        gba.set_parallel_rendering(parallel);
+        let mut color = 0u16;
+        group.bench_function(name, |b| {
+            b.iter(|| {
+                color = color.wrapping_add(1);
+                gba.mapped.store16(0x05000002, color, &mut gba.cpu);
+                gba.run_frame_into(&mut frame, &mut NoopGbaAudioOutput);
+                black_box(&frame);
+            })
+        });
+    }
+    group.finish();
+}
+
+fn bench_convert(c: &mut Criterion) {
+    let mut gba = setup_mode3();
+    let mut frame = Box::new([0; VISIBLE_LINE_WIDTH * VISIBLE_LINE_COUNT]);
+    gba.run_frame_into(&mut frame, &mut NoopGbaAudioOutput);
+
+    let mut group = c.benchmark_group("video/convert");
+    group.throughput(Throughput::Elements(1));
+    group.bench_function("rgb565", |b| {
+        let mut output = vec![0u16; frame.len()];
+        b.iter(|| {
+            video::convert_to_rgb565(&frame[..], &mut output);
+            black_box(&output);
+        })
+    });
+    group.bench_function("rgba8888", |b| {
+        let mut output = vec![0u32; frame.len()];
+        b.iter(|| {
+            video::convert_to_rgba8888(&frame[..], &mut output);
+            black_box(&output);
+        })
+    });
+    group.finish();
+}
+
+criterion_group!(
+    benches,
+    bench_mode0,
+    bench_mode3,
+    bench_blend,
+    bench_frame,
+    bench_convert
+);
+criterion_main!(benches);
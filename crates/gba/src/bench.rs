@@ -0,0 +1,24 @@
+//! Internals that are only public so that the benchmarks in `benches/` can measure them on
+//! their own. Nothing in here is part of the crate's API.
+
+pub use crate::events::{GbaEvent, GbaScheduler};
+
+use crate::{
+    hardware::video::{line::BlendContext, HBlankContext, LineBuffer},
+    GbaMemoryMappedHardware,
+};
+
+/// Renders the layers of `line` with the current video mode without blending them.
+pub fn render_line(mapped: &mut GbaMemoryMappedHardware, line: u16) -> bool {
+    mapped.video.render_layers(line, &mapped.vram)
+}
+
+/// Blends the layers of the last line that was rendered with [`render_line`] into `output`.
+pub fn blend_line(mapped: &mut GbaMemoryMappedHardware, output: &mut LineBuffer) {
+    let context = HBlankContext {
+        palette: &mapped.palram,
+        vram: &mapped.vram,
+    };
+    let context = BlendContext::with_hblank(&mapped.video.registers, context);
+    mapped.video.renderer.line.blend(output, context);
+}
@@ -0,0 +1,112 @@
+//! Cheap counters that are always kept while the GBA runs, for finding out whether a ROM
+//! spends its time in the CPU, waiting on memory or rendering.
+//! See [`Gba::counters`](crate::Gba::counters).
+
+use std::time::Duration;
+
+use arm::emu::{CpuCounters, Waitstates};
+
+/// Memory regions are the top byte of an address, anything above the last one is counted
+/// in the last region.
+pub const MEMORY_REGION_COUNT: usize = 16;
+
+#[derive(Clone, Copy, Default, Debug, PartialEq, Eq)]
+pub struct GbaCounters {
+    pub cpu: CpuCounters,
+    pub memory: MemoryCounters,
+    /// Scheduler events that have been fired.
+    pub events: u64,
+    /// Frames run by [`Gba::run_frame`](crate::Gba::run_frame) and friends.
+    pub frames: u64,
+    /// Host time spent running those frames.
+    pub frame_time: Duration,
+}
+
+impl GbaCounters {
+    /// The counts since `earlier`, which must have been taken from the same GBA.
+    pub fn since(&self, earlier: &GbaCounters) -> GbaCounters {
+        GbaCounters {
+            cpu: self.cpu.since(&earlier.cpu),
+            memory: self.memory.since(&earlier.memory),
+            events: self.events - earlier.events,
+            frames: self.frames - earlier.frames,
+            frame_time: self.frame_time.saturating_sub(earlier.frame_time),
+        }
+    }
+
+    /// Average host time per frame, or zero if no frames were run.
+    pub fn time_per_frame(&self) -> Duration {
+        if self.frames == 0 {
+            Duration::ZERO
+        } else {
+            self.frame_time / self.frames as u32
+        }
+    }
+}
+
+/// Loads, stores and instruction fetches made by the CPU and DMA, by memory region (see the
+/// `REGION_*` constants in [`crate::memory`]).
+#[derive(Clone, Copy, Default, Debug, PartialEq, Eq)]
+pub struct MemoryCounters {
+    pub accesses: [u64; MEMORY_REGION_COUNT],
+    pub waitstates: [u64; MEMORY_REGION_COUNT],
+}
+
+impl MemoryCounters {
+    #[inline(always)]
+    pub(crate) fn record(&mut self, address: u32, wait: Waitstates) {
+        self.record_many(address, 1, wait);
+    }
+
+    #[inline(always)]
+    pub(crate) fn record_many(&mut self, address: u32, accesses: u32, wait: Waitstates) {
+        let region = ((address >> 24) as usize).min(MEMORY_REGION_COUNT - 1);
+        self.accesses[region] += accesses as u64;
+        self.waitstates[region] += u32::from(wait) as u64;
+    }
+
+    pub fn total_accesses(&self) -> u64 {
+        self.accesses.iter().sum()
+    }
+
+    pub fn total_waitstates(&self) -> u64 {
+        self.waitstates.iter().sum()
+    }
+
+    pub fn since(&self, earlier: &MemoryCounters) -> MemoryCounters {
+        MemoryCounters {
+            accesses: std::array::from_fn(|region| {
+                self.accesses[region] - earlier.accesses[region]
+            }),
+            waitstates: std::array::from_fn(|region| {
+                self.waitstates[region] - earlier.waitstates[region]
+            }),
+        }
+    }
+}
+
+/// Short names for the memory regions, indexed the same way as [`MemoryCounters`].
+pub const MEMORY_REGION_NAMES: [&str; MEMORY_REGION_COUNT] = [
+    "BIOS", "Unused", "EWRAM", "IWRAM", "I/O", "Palette", "VRAM", "OAM", "ROM0", "ROM0 Hi", "ROM1",
+    "ROM1 Hi", "ROM2", "ROM2 Hi", "SRAM", "Unused",
+];
+
+#[cfg(test)]
+mod test {
+    use arm::emu::Waitstates;
+
+    use super::MemoryCounters;
+
+    #[test]
+    fn test_addresses_past_the_last_region_are_counted_in_it() {
+        let mut counters = MemoryCounters::default();
+        counters.record(0x0800_0000, Waitstates::from(4));
+        counters.record(0xFFFF_FFFF, Waitstates::zero());
+        counters.record_many(0x0300_0000, 8, Waitstates::zero());
+        assert_eq!(counters.accesses[0x8], 1);
+        assert_eq!(counters.waitstates[0x8], 4);
+        assert_eq!(counters.accesses[0xF], 1);
+        assert_eq!(counters.accesses[0x3], 8);
+        assert_eq!(counters.total_accesses(), 10);
+    }
+}
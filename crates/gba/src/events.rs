@@ -1,26 +1,6 @@
-use std::{cell::RefCell, rc::Rc};
+use std::{cmp::Reverse, collections::BinaryHeap};
 
 use arm::emu::Cycles;
-use arrayvec::ArrayVec;
-
-#[derive(Default, Clone)]
-pub(crate) struct SharedGbaScheduler {
-    inner: Rc<RefCell<GbaScheduler>>,
-}
-
-impl SharedGbaScheduler {
-    pub fn schedule(&mut self, event: GbaEvent, cycles: Cycles) {
-        self.inner.borrow_mut().schedule(event, cycles)
-    }
-
-    pub fn tick(&mut self, cycles: &mut Cycles) -> Option<GbaEvent> {
-        self.inner.borrow_mut().tick(cycles)
-    }
-
-    pub fn clear(&mut self) {
-        self.inner.borrow_mut().clear();
-    }
-}
 
 #[derive(Debug, Clone, Copy, PartialEq, Eq)]
 pub enum GbaEvent {
@@ -35,74 +15,170 @@ pub enum GbaEvent {
 
 #[derive(Debug, Clone, Copy, PartialEq, Eq)]
 struct Entry {
-    cycles: Cycles,
+    /// The cycle that this event should be fired on.
+    timestamp: u64,
+
+    /// Events that are scheduled for the same cycle are fired in the order
+    /// that they were scheduled in.
+    sequence: u64,
+
     event: GbaEvent,
 }
 
-#[derive(Default)]
+impl Ord for Entry {
+    fn cmp(&self, other: &Self) -> std::cmp::Ordering {
+        (self.timestamp, self.sequence).cmp(&(other.timestamp, other.sequence))
+    }
+}
+
+impl PartialOrd for Entry {
+    fn partial_cmp(&self, other: &Self) -> Option<std::cmp::Ordering> {
+        Some(self.cmp(other))
+    }
+}
+
+/// Schedules events on a global cycle counter that starts at 0 when the scheduler is
+/// created or cleared and only ever increases.
+#[derive(Clone)]
 pub struct GbaScheduler {
-    entries: ArrayVec<Entry, 64>,
+    now: u64,
+    sequence: u64,
+    entries: BinaryHeap<Reverse<Entry>>,
 }
 
 impl GbaScheduler {
+    /// Schedules `event` to be fired `cycles` cycles after the current time. While an event
+    /// is being handled the current time is the cycle that the event was scheduled for, so
+    /// events that reschedule themselves don't drift when they are handled late.
     pub fn schedule(&mut self, event: GbaEvent, cycles: Cycles) {
-        let mut new_entry = Entry { cycles, event };
-        if self.entries.is_empty() {
-            self.entries.push(new_entry);
-            return;
-        }
+        self.schedule_at(event, self.now + u64::from(u32::from(cycles)));
+    }
 
-        let mut slot = self.entries.len();
+    /// Schedules `event` to be fired on the cycle `timestamp`.
+    pub fn schedule_at(&mut self, event: GbaEvent, timestamp: u64) {
+        let sequence = self.sequence;
+        self.sequence += 1;
+        self.entries.push(Reverse(Entry {
+            timestamp,
+            sequence,
+            event,
+        }));
+    }
 
-        for (idx, entry) in self.entries.iter_mut().enumerate().rev() {
-            if entry.cycles <= new_entry.cycles {
-                new_entry.cycles -= entry.cycles;
-                slot = idx;
-            } else {
-                entry.cycles -= new_entry.cycles;
-                break;
+    /// Advances the current time by up to `cycles` cycles and returns the first event that was
+    /// reached. When an event is returned, time only advances to that event and `cycles` is left
+    /// with the number of cycles that were not consumed, which is also how late the event is.
+    /// Keep calling this until it returns `None`, at which point `cycles` is zero.
+    pub fn tick(&mut self, cycles: &mut Cycles) -> Option<GbaEvent> {
+        let target = self.now + u64::from(u32::from(*cycles));
+
+        if let Some(Reverse(entry)) = self.entries.peek() {
+            if entry.timestamp <= target {
+                let entry = *entry;
+                self.entries.pop();
+
+                // Events can't be fired before the cycle they were scheduled on, so an event
+                // scheduled in the past is fired immediately and doesn't move time backwards.
+                self.now = self.now.max(entry.timestamp);
+                *cycles = Cycles::from((target - self.now) as u32);
+                return Some(entry.event);
             }
         }
 
-        self.entries.insert(slot, new_entry);
+        self.now = target;
+        *cycles = Cycles::zero();
+        None
     }
 
-    pub fn tick(&mut self, cycles: &mut Cycles) -> Option<GbaEvent> {
-        if let Some(entry) = self.entries.last_mut() {
-            if entry.cycles <= *cycles {
-                *cycles -= entry.cycles;
-                return self.entries.pop().map(|entry| entry.event);
-            } else {
-                entry.cycles -= *cycles;
-            }
+    /// Every scheduled event and the cycle that it will be fired on, in the order that they
+    /// will be fired in.
+    pub fn scheduled(&self) -> Vec<(GbaEvent, u64)> {
+        let mut entries: Vec<Entry> = self.entries.iter().map(|Reverse(entry)| *entry).collect();
+        entries.sort_unstable();
+        entries
+            .into_iter()
+            .map(|entry| (entry.event, entry.timestamp))
+            .collect()
+    }
+
+    /// A scheduler at cycle `now` with `events` scheduled in the order returned by
+    /// [`GbaScheduler::scheduled`].
+    pub fn with_scheduled(now: u64, events: &[(GbaEvent, u64)]) -> Self {
+        let mut scheduler = GbaScheduler {
+            now,
+            ..GbaScheduler::default()
+        };
+        for &(event, timestamp) in events {
+            scheduler.schedule_at(event, timestamp);
         }
-        None
+        scheduler
     }
 
     pub fn clear(&mut self) {
+        self.now = 0;
+        self.sequence = 0;
         self.entries.clear();
     }
+
+    /// Returns the current value of the global cycle counter.
+    #[inline]
+    pub fn now(&self) -> u64 {
+        self.now
+    }
+
+    /// Returns the cycle that the next event will be fired on, or [`u64::MAX`] if there
+    /// are no events scheduled.
+    #[inline]
+    pub fn next_event_at(&self) -> u64 {
+        self.entries
+            .peek()
+            .map(|Reverse(entry)| entry.timestamp)
+            .unwrap_or(u64::MAX)
+    }
+
+    /// Returns the number of cycles until the next event will be fired.
+    pub fn next_event_in(&self) -> Option<Cycles> {
+        if self.entries.is_empty() {
+            return None;
+        }
+        let cycles = self.next_event_at().saturating_sub(self.now);
+        Some(Cycles::from(cycles.min(u64::from(u32::MAX)) as u32))
+    }
+}
+
+impl Default for GbaScheduler {
+    fn default() -> Self {
+        GbaScheduler {
+            now: 0,
+            sequence: 0,
+            entries: BinaryHeap::with_capacity(64),
+        }
+    }
 }
 
 #[cfg(test)]
 mod test {
     use arm::emu::Cycles;
 
-    use crate::events::Entry;
-
     use super::{GbaEvent, GbaScheduler};
 
+    /// Fires every scheduled event and returns each one along with the time that it fired on.
+    fn drain(scheduler: &mut GbaScheduler) -> Vec<(GbaEvent, u64)> {
+        let mut events = Vec::new();
+        while let Some(mut cycles) = scheduler.next_event_in() {
+            while let Some(event) = scheduler.tick(&mut cycles) {
+                events.push((event, scheduler.now()));
+            }
+        }
+        events
+    }
+
     #[test]
     fn test_scheduling_empty() {
         let mut scheduler = GbaScheduler::default();
         scheduler.schedule(GbaEvent::HDraw, Cycles::from(12));
-        assert_eq!(
-            scheduler.entries.last(),
-            Some(&Entry {
-                event: GbaEvent::HDraw,
-                cycles: Cycles::from(12)
-            })
-        );
+        assert_eq!(scheduler.next_event_at(), 12);
+        assert_eq!(drain(&mut scheduler), vec![(GbaEvent::HDraw, 12)]);
     }
 
     #[test]
@@ -110,21 +186,9 @@ mod test {
         let mut scheduler = GbaScheduler::default();
         scheduler.schedule(GbaEvent::HDraw, Cycles::from(12));
         scheduler.schedule(GbaEvent::HBlank, Cycles::from(16));
-
         assert_eq!(
-            scheduler.entries.get(1),
-            Some(&Entry {
-                event: GbaEvent::HDraw,
-                cycles: Cycles::from(12)
-            })
-        );
-
-        assert_eq!(
-            scheduler.entries.get(0),
-            Some(&Entry {
-                event: GbaEvent::HBlank,
-                cycles: Cycles::from(4)
-            })
+            drain(&mut scheduler),
+            vec![(GbaEvent::HDraw, 12), (GbaEvent::HBlank, 16)]
         );
     }
 
@@ -133,21 +197,9 @@ mod test {
         let mut scheduler = GbaScheduler::default();
         scheduler.schedule(GbaEvent::HBlank, Cycles::from(16));
         scheduler.schedule(GbaEvent::HDraw, Cycles::from(12));
-
         assert_eq!(
-            scheduler.entries.get(1),
-            Some(&Entry {
-                event: GbaEvent::HDraw,
-                cycles: Cycles::from(12)
-            })
-        );
-
-        assert_eq!(
-            scheduler.entries.get(0),
-            Some(&Entry {
-                event: GbaEvent::HBlank,
-                cycles: Cycles::from(4)
-            })
+            drain(&mut scheduler),
+            vec![(GbaEvent::HDraw, 12), (GbaEvent::HBlank, 16)]
         );
     }
 
@@ -157,29 +209,29 @@ mod test {
         scheduler.schedule(GbaEvent::HBlank, Cycles::from(16));
         scheduler.schedule(GbaEvent::HDraw, Cycles::from(12));
         scheduler.schedule(GbaEvent::Test, Cycles::from(14));
-
-        assert_eq!(
-            scheduler.entries.get(2),
-            Some(&Entry {
-                event: GbaEvent::HDraw,
-                cycles: Cycles::from(12)
-            })
-        );
-
         assert_eq!(
-            scheduler.entries.get(1),
-            Some(&Entry {
-                event: GbaEvent::Test,
-                cycles: Cycles::from(2)
-            })
+            drain(&mut scheduler),
+            vec![
+                (GbaEvent::HDraw, 12),
+                (GbaEvent::Test, 14),
+                (GbaEvent::HBlank, 16)
+            ]
         );
+    }
 
+    #[test]
+    fn test_scheduling_same_cycle() {
+        let mut scheduler = GbaScheduler::default();
+        scheduler.schedule(GbaEvent::HBlank, Cycles::from(12));
+        scheduler.schedule(GbaEvent::HDraw, Cycles::from(12));
+        scheduler.schedule(GbaEvent::Test, Cycles::from(12));
         assert_eq!(
-            scheduler.entries.get(0),
-            Some(&Entry {
-                event: GbaEvent::HBlank,
-                cycles: Cycles::from(2)
-            })
+            drain(&mut scheduler),
+            vec![
+                (GbaEvent::HBlank, 12),
+                (GbaEvent::HDraw, 12),
+                (GbaEvent::Test, 12)
+            ]
         );
     }
 
@@ -192,6 +244,7 @@ mod test {
 
         let mut cycles = Cycles::from(1);
         assert_eq!(scheduler.tick(&mut cycles), None);
+        assert_eq!(scheduler.now(), 1);
 
         let mut cycles = Cycles::from(11);
         assert_eq!(scheduler.tick(&mut cycles), Some(GbaEvent::HDraw));
@@ -202,5 +255,59 @@ mod test {
         assert_eq!(cycles, Cycles::from(2));
         assert_eq!(scheduler.tick(&mut cycles), Some(GbaEvent::HBlank));
         assert_eq!(cycles, Cycles::zero());
+        assert_eq!(scheduler.now(), 16);
+    }
+
+    #[test]
+    fn test_late_events_do_not_drift() {
+        let mut scheduler = GbaScheduler::default();
+        scheduler.schedule(GbaEvent::HDraw, Cycles::from(10));
+
+        let mut cycles = Cycles::from(13);
+        assert_eq!(scheduler.tick(&mut cycles), Some(GbaEvent::HDraw));
+        assert_eq!(cycles, Cycles::from(3));
+        scheduler.schedule(GbaEvent::HBlank, Cycles::from(10));
+        assert_eq!(scheduler.tick(&mut cycles), None);
+        assert_eq!(scheduler.now(), 13);
+        assert_eq!(scheduler.next_event_at(), 20);
+    }
+
+    #[test]
+    fn test_with_scheduled() {
+        let mut scheduler = GbaScheduler::default();
+        scheduler.schedule(GbaEvent::HBlank, Cycles::from(12));
+        scheduler.schedule(GbaEvent::HDraw, Cycles::from(12));
+        scheduler.schedule(GbaEvent::Test, Cycles::from(4));
+        let mut cycles = Cycles::from(2);
+        scheduler.tick(&mut cycles);
+
+        let scheduled = scheduler.scheduled();
+        assert_eq!(
+            scheduled,
+            vec![
+                (GbaEvent::Test, 4),
+                (GbaEvent::HBlank, 12),
+                (GbaEvent::HDraw, 12)
+            ]
+        );
+        let mut restored = GbaScheduler::with_scheduled(scheduler.now(), &scheduled);
+        assert_eq!(restored.now(), 2);
+        assert_eq!(drain(&mut restored), drain(&mut scheduler));
+    }
+
+    #[test]
+    fn test_next_event_in() {
+        let mut scheduler = GbaScheduler::default();
+        assert_eq!(scheduler.next_event_in(), None);
+        assert_eq!(scheduler.next_event_at(), u64::MAX);
+
+        scheduler.schedule(GbaEvent::HBlank, Cycles::from(16));
+        scheduler.schedule(GbaEvent::HDraw, Cycles::from(12));
+        assert_eq!(scheduler.next_event_in(), Some(Cycles::from(12)));
+
+        let mut cycles = Cycles::from(5);
+        assert_eq!(scheduler.tick(&mut cycles), None);
+        assert_eq!(scheduler.next_event_in(), Some(Cycles::from(7)));
+        assert_eq!(scheduler.next_event_at(), 12);
     }
 }
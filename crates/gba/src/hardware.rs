@@ -1,74 +1,201 @@
+pub mod dma;
+pub mod gamepak;
 pub mod palette;
 pub mod system_control;
 pub mod video;
 
 use crate::{
-    events::SharedGbaScheduler,
-    memory::{BIOS_SIZE, EWRAM_SIZE, IWRAM_SIZE, OAM_SIZE, VRAM_SIZE},
+    counters::MemoryCounters,
+    events::GbaScheduler,
+    memory::{
+        page_table::{
+            Page, PageTable, PAGE_SIZE, TIMING_EWRAM, TIMING_GAMEPAK0, TIMING_GAMEPAK1,
+            TIMING_GAMEPAK2, TIMING_NONE, TIMING_VRAM,
+        },
+        vram_offset, BIOS_SIZE, EWRAM_SIZE, IWRAM_SIZE, OAM_SIZE, VRAM_SIZE,
+    },
+    savestate::pages::DirtyPages,
 };
 
 use self::{
+    dma::GbaDma,
+    gamepak::Gamepak,
     palette::Palette,
     system_control::{RegInternalMemoryControl, SystemControl},
     video::GbaVideo,
 };
 
 pub struct GbaMemoryMappedHardware {
-    pub bios: Box<[u8; BIOS_SIZE]>,
-    pub ewram: Box<[u8; EWRAM_SIZE]>,
-    pub iwram: Box<[u8; IWRAM_SIZE]>,
+    // NOTE: The page table points into the boxed memory regions below, so they
+    //       must never be replaced without calling `map_pages` again.
+    pub(crate) bios: Box<[u8; BIOS_SIZE]>,
+    pub(crate) ewram: Box<[u8; EWRAM_SIZE]>,
+    pub(crate) iwram: Box<[u8; IWRAM_SIZE]>,
 
     pub video: Box<GbaVideo>,
     pub system_control: SystemControl,
+    pub(crate) dma: GbaDma,
 
     pub palram: Box<Palette>,
-    pub vram: Box<[u8; VRAM_SIZE]>,
-    pub oam: Box<[u8; OAM_SIZE]>,
+    pub(crate) vram: Box<[u8; VRAM_SIZE]>,
+    pub(crate) oam: Box<[u8; OAM_SIZE]>,
 
     pub(crate) gamepak_mask: usize,
-    pub(crate) gamepak: Vec<u8>,
+    pub(crate) gamepak: Gamepak,
+
+    /// Direct access to memory for regions that don't require any special handling.
+    pub(crate) page_table: PageTable,
+    /// Pages of memory that were written to since the last snapshot.
+    pub(crate) dirty: DirtyPages,
+    /// Accesses by region. These aren't reset or saved with the rest of the hardware.
+    pub(crate) counters: MemoryCounters,
 
     /// The last value ready from memory.
     pub(crate) last_read_value: u32,
     /// The last value read from BIOS.
     pub(crate) last_bios_value: u32,
+
+    /// BIOS math functions are computed natively instead of running the BIOS's code.
+    pub(crate) hle_math_enabled: bool,
+    /// BIOS memory copy and decompression functions work directly on the memory's backing
+    /// arrays instead of running the BIOS's code.
+    pub(crate) hle_memory_enabled: bool,
+    /// Halt, IntrWait and VBlankIntrWait halt the CPU directly instead of running the BIOS's
+    /// code.
+    pub(crate) hle_wait_enabled: bool,
 }
 
 impl GbaMemoryMappedHardware {
-    pub(crate) fn new(scheduler: SharedGbaScheduler) -> Self {
-        Self {
+    pub(crate) fn new() -> Self {
+        let mut hardware = Self {
             bios: Box::new([0; BIOS_SIZE]),
             ewram: Box::new([0; EWRAM_SIZE]),
             iwram: Box::new([0; IWRAM_SIZE]),
 
-            video: Box::new(GbaVideo::new(scheduler)),
+            video: Box::new(GbaVideo::new()),
             system_control: SystemControl::default(),
+            dma: GbaDma::default(),
 
             palram: Box::default(),
             vram: Box::new([0; VRAM_SIZE]),
             oam: Box::new([0; OAM_SIZE]),
 
             gamepak_mask: 0,
-            gamepak: vec![0; 4],
+            gamepak: Gamepak::from(vec![0; 4]),
+
+            page_table: PageTable::default(),
+            dirty: DirtyPages::default(),
+            counters: MemoryCounters::default(),
 
             last_read_value: 0,
             last_bios_value: 0,
-        }
+
+            hle_math_enabled: true,
+            hle_memory_enabled: true,
+            hle_wait_enabled: true,
+        };
+        hardware.map_pages();
+        hardware
     }
 
     /// Called after a hard reset of the GBA.
-    pub(crate) fn reset(&mut self) {
+    pub(crate) fn reset(&mut self, scheduler: &mut GbaScheduler) {
         self.system_control
             .write_internal_memory_control(RegInternalMemoryControl::DEFAULT);
-        self.video.reset();
+        self.system_control.intr_wait = None;
+        self.dma = GbaDma::default();
+        self.video.reset(scheduler);
+    }
+
+    pub fn set_gamepak(&mut self, gamepak: Gamepak) {
+        self.gamepak_mask = gamepak.len() - 1;
+        self.gamepak = gamepak;
+        self.map_pages();
+    }
+
+    pub fn gamepak(&self) -> &Gamepak {
+        &self.gamepak
     }
 
-    pub fn set_gamepak(&mut self, mut new_gamepak: Vec<u8>) {
-        assert!(!new_gamepak.is_empty());
-        let gamepak_size = new_gamepak.len().next_power_of_two();
-        new_gamepak.resize(gamepak_size, 0);
-        self.gamepak = new_gamepak;
-        self.gamepak_mask = gamepak_size - 1;
+    /// Rebuilds the page table. This must be called whenever the memory that it points to moves.
+    ///
+    /// BIOS, I/O registers, palette RAM and SRAM are never mapped and always go through the
+    /// slower path in the memory map because they need special handling for every access.
+    /// VRAM and OAM are only mapped for reads, writes to them go through the memory map or
+    /// [`GbaMemoryMappedHardware::write_run`] so that the video hardware can tell which lines
+    /// changed.
+    fn map_pages(&mut self) {
+        let ram = Page::READ | Page::WRITE | Page::WRITE8;
+        let video = Page::READ;
+
+        self.page_table.unmap_all();
+
+        // SAFETY: every region is a power of two in size (VRAM is mapped in PAGE_SIZE chunks
+        //         that are all inside of it) and they are all owned by `self`. They are only
+        //         ever moved or freed by replacing them which requires calling this again.
+        //         The gamepak might be shared with other GBAs but it's only mapped for reads.
+        unsafe {
+            let ewram = self.ewram.as_mut_ptr();
+            self.page_table.map(
+                0x02000000..=0x02FFFFFF,
+                ewram,
+                EWRAM_SIZE,
+                ram,
+                TIMING_EWRAM,
+                |a| a as usize % EWRAM_SIZE,
+            );
+
+            let iwram = self.iwram.as_mut_ptr();
+            self.page_table.map(
+                0x03000000..=0x03FFFFFF,
+                iwram,
+                IWRAM_SIZE,
+                ram,
+                TIMING_NONE,
+                |a| a as usize % IWRAM_SIZE,
+            );
+
+            let vram = self.vram.as_mut_ptr();
+            self.page_table.map(
+                0x06000000..=0x06FFFFFF,
+                vram,
+                PAGE_SIZE,
+                video,
+                TIMING_VRAM,
+                vram_offset,
+            );
+
+            let oam = self.oam.as_mut_ptr();
+            self.page_table.map(
+                0x07000000..=0x07FFFFFF,
+                oam,
+                OAM_SIZE,
+                video,
+                TIMING_NONE,
+                |_| 0,
+            );
+
+            // The default gamepak is smaller than a word so it can't be mapped.
+            if self.gamepak_mask >= 3 {
+                let size = self.gamepak_mask + 1;
+                let gamepak = self.gamepak.as_ptr() as *mut u8;
+                let gamepak_offset = |a: u32| a as usize & self.gamepak_mask;
+                for (start, timing) in [
+                    (0x08000000, TIMING_GAMEPAK0),
+                    (0x0A000000, TIMING_GAMEPAK1),
+                    (0x0C000000, TIMING_GAMEPAK2),
+                ] {
+                    self.page_table.map(
+                        start..=(start + 0x01FFFFFF),
+                        gamepak,
+                        size,
+                        Page::READ,
+                        timing,
+                        gamepak_offset,
+                    );
+                }
+            }
+        }
     }
 }
 
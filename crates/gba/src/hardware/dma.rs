@@ -0,0 +1,405 @@
+//! DMA channels 0-3.
+//!
+//! Transfers that increment through memory in the page table are copied a run at a time,
+//! where a run is as many units as are contiguous in both the source and the destination,
+//! and the cycles of a run are worked out from the page timings without making any of its
+//! accesses. VRAM and OAM are copied the same way even though they aren't writable in the
+//! page table, and the video hardware is told about the parts that changed afterwards.
+//! Transfers to or from anything else (I/O registers, palette RAM, SRAM, ...) and transfers
+//! that decrement go through the memory map one unit at a time.
+
+use arm::emu::{AccessType, Cpu, Cycles, Waitstates};
+use pyrite_derive::IoRegister;
+use util::bits::BitOps;
+
+use crate::{
+    hardware::GbaMemoryMappedHardware,
+    hle::memory::{load, load_waitstates, repeat, store, store_waitstates},
+    memory::{self, IoRegister, RunSource},
+};
+
+pub const DMA_CHANNEL_COUNT: usize = 4;
+
+/// Cycles that every transfer takes before its first access.
+const DMA_START_CYCLES: u32 = 2;
+
+#[derive(Default, Clone)]
+pub struct GbaDma {
+    pub(crate) channels: [DmaChannel; DMA_CHANNEL_COUNT],
+    /// Cycles of the immediate transfers that were started by the last write to an I/O
+    /// register. The CPU is stopped while they run so they're added to the write's waitstates.
+    stall: Waitstates,
+}
+
+impl GbaDma {
+    pub(crate) fn take_stall(&mut self) -> Waitstates {
+        std::mem::take(&mut self.stall)
+    }
+}
+
+#[derive(Default, Clone, Copy)]
+pub struct DmaChannel {
+    /// DMAxSAD, DMAxDAD and DMAxCNT_L as they were written. They're only used when the
+    /// channel is enabled, and the count and destination when a repeating transfer restarts.
+    pub(crate) source: u32,
+    pub(crate) destination: u32,
+    pub(crate) count: u16,
+    pub(crate) control: RegDmaControl,
+
+    /// Where the next unit will be transferred from and to, and the number of units left.
+    pub(crate) internal_source: u32,
+    pub(crate) internal_destination: u32,
+    pub(crate) internal_count: u32,
+}
+
+impl DmaChannel {
+    pub(crate) fn write_source(&mut self, high: bool, value: u16) {
+        self.source = write_half(self.source, high, value);
+    }
+
+    pub(crate) fn write_destination(&mut self, high: bool, value: u16) {
+        self.destination = write_half(self.destination, high, value);
+    }
+
+    /// Loads the internal registers from the ones that were written.
+    fn latch(&mut self, channel: usize) {
+        let size = self.control.unit_size();
+        self.internal_source = self.source & source_mask(channel) & !(size - 1);
+        self.internal_destination = self.destination & destination_mask(channel) & !(size - 1);
+        self.reload_count(channel);
+    }
+
+    /// A count of 0 transfers as many units as the count can hold.
+    fn reload_count(&mut self, channel: usize) {
+        let max = if channel == 3 { 0x10000 } else { 0x4000 };
+        let count = self.count as u32 & (max - 1);
+        self.internal_count = if count == 0 { max } else { count };
+    }
+}
+
+impl GbaMemoryMappedHardware {
+    /// Writes DMAxCNT_H. Enabling a channel that was disabled loads its internal registers
+    /// and runs it right away if it starts immediately.
+    pub(crate) fn write_dma_control(&mut self, channel: usize, value: u16, cpu: &mut Cpu) {
+        let dma = &mut self.dma.channels[channel];
+        let was_enabled = dma.control.enabled();
+        // Bits 0-4 are unused and only DMA3 can be started by the gamepak.
+        let mask = if channel == 3 { 0xFFE0 } else { 0xF7E0 };
+        dma.control.write(value & mask);
+        if was_enabled || !dma.control.enabled() {
+            return;
+        }
+
+        dma.latch(channel);
+        match dma.control.timing() {
+            DmaTiming::Immediate => {
+                let cycles = self.run_dma(channel, cpu);
+                self.dma.stall += Waitstates::from(u32::from(cycles));
+            }
+            DmaTiming::Special => {
+                tracing::debug!(channel, "special DMA timing is not implemented");
+            }
+            DmaTiming::VBlank | DmaTiming::HBlank => {}
+        }
+    }
+
+    /// Runs every enabled channel that starts at `timing`, DMA0 first because it has the
+    /// highest priority. Returns the number of cycles that the CPU is stopped for.
+    pub(crate) fn trigger_dma(&mut self, timing: DmaTiming, cpu: &mut Cpu) -> Cycles {
+        let mut cycles = Cycles::zero();
+        for channel in 0..DMA_CHANNEL_COUNT {
+            let control = self.dma.channels[channel].control;
+            if control.enabled() && control.timing() == timing {
+                cycles += self.run_dma(channel, cpu);
+            }
+        }
+        cycles
+    }
+
+    /// Transfers every unit that's left on a channel and returns the number of cycles that
+    /// took. A channel that repeats is reloaded for its next transfer, any other channel is
+    /// disabled.
+    fn run_dma(&mut self, channel: usize, cpu: &mut Cpu) -> Cycles {
+        #[cfg(feature = "puffin")]
+        puffin::profile_function!();
+
+        let dma = self.dma.channels[channel];
+        let control = dma.control;
+        let size = control.unit_size();
+        let mut source = dma.internal_source;
+        let mut destination = dma.internal_destination;
+
+        // The gamepak can only be read from in order, so sources in it always increment.
+        let source_control = if (0x08000000..0x0E000000).contains(&source) {
+            DmaAddressControl::Increment
+        } else {
+            control.source_control()
+        };
+        let source_step = source_control.step(size);
+        let destination_step = control.destination_control().step(size);
+
+        let mut cycles = Cycles::new(DMA_START_CYCLES);
+        let mut access = AccessType::NonSequential;
+        let mut remaining = dma.internal_count;
+        while remaining > 0 {
+            let run = self.dma_run(
+                source,
+                destination,
+                size,
+                source_step,
+                destination_step,
+                remaining,
+                access,
+            );
+            let (units, waitstates) = run.unwrap_or_else(|| {
+                let (value, load_wait) = load(cpu, self, source, size, access);
+                (1, load_wait + store(cpu, self, destination, size, value))
+            });
+
+            let len = units * size;
+            let first = if destination_step < 0 {
+                destination.wrapping_sub(len - size)
+            } else {
+                destination
+            };
+            memory::invalidate_code(cpu, first, len);
+
+            // Every unit is a load and a store.
+            cycles += Cycles::new(2 * units) + waitstates;
+            source = source.wrapping_add_signed(source_step * units as i32);
+            destination = destination.wrapping_add_signed(destination_step * units as i32);
+            remaining -= units;
+            access = AccessType::Sequential;
+        }
+
+        let dma = &mut self.dma.channels[channel];
+        dma.internal_source = source & source_mask(channel);
+        dma.internal_destination = destination & destination_mask(channel);
+        dma.internal_count = 0;
+        if control.repeat() && control.timing() != DmaTiming::Immediate {
+            dma.reload_count(channel);
+            if control.destination_control() == DmaAddressControl::IncrementReload {
+                dma.internal_destination =
+                    dma.destination & destination_mask(channel) & !(size - 1);
+            }
+        } else {
+            dma.control.set_enabled(false);
+        }
+
+        if control.irq() {
+            self.system_control.request_interrupts(1 << (8 + channel));
+        }
+        cycles
+    }
+
+    /// Copies as many units as are contiguous in both the source and the destination
+    /// directly between the memory behind them. Returns the number of units that were copied
+    /// and their waitstates, or `None` if the next unit has to go through the memory map.
+    #[allow(clippy::too_many_arguments)]
+    fn dma_run(
+        &mut self,
+        source: u32,
+        destination: u32,
+        size: u32,
+        source_step: i32,
+        destination_step: i32,
+        remaining: u32,
+        access: AccessType,
+    ) -> Option<(u32, Waitstates)> {
+        let fill = source_step == 0;
+        if destination_step != size as i32 || !(fill || source_step == size as i32) {
+            return None;
+        }
+
+        let src_page = self.page_table.get(source);
+        let dst_page = self.page_table.get(destination);
+        if !src_page.readable() || !memory::run_writable(&dst_page, destination, size) {
+            return None;
+        }
+
+        let mut units = remaining.min(dst_page.contiguous_len(destination) as u32 / size);
+        if !fill {
+            units = units.min(src_page.contiguous_len(source) as u32 / size);
+        }
+        let len = (units * size) as usize;
+        let dst = dst_page.host(destination);
+
+        let run_source = if fill {
+            // SAFETY: the page is readable and the source is aligned to the size of a unit.
+            let unit = unsafe {
+                match size {
+                    2 => src_page.read16(source) as u32,
+                    _ => src_page.read32(source),
+                }
+            };
+            RunSource::fill(unit, size)
+        } else {
+            let src = src_page.host(source);
+            // Copying forward over the source repeats the units between them, which a
+            // single copy wouldn't do.
+            // SAFETY: `len` bytes are contiguous in the source's page.
+            if dst > src && dst < unsafe { src.add(len) } {
+                return None;
+            }
+            RunSource::Copy(src.cast_const())
+        };
+
+        // SAFETY: `len` bytes starting at `destination` are contiguous in its page, and the
+        //         same goes for the source if it's copied. The source is only ever read
+        //         ahead of where the destination is written to.
+        unsafe { self.write_run(&dst_page, destination, len, run_source) };
+
+        let timing = src_page.timing();
+        let load_first = load_waitstates(self, timing, size, access);
+        let load_rest = load_waitstates(self, timing, size, AccessType::Sequential);
+        let store = store_waitstates(self, dst_page.timing(), size);
+        let load = load_first + repeat(load_rest, units - 1);
+        let store = repeat(store, units);
+        self.counters.record_many(source, units, load);
+        self.counters.record_many(destination, units, store);
+        Some((units, load + store))
+    }
+}
+
+fn write_half(word: u32, high: bool, value: u16) -> u32 {
+    if high {
+        word.put_bit_range(16..32, value as u32)
+    } else {
+        word.put_bit_range(0..16, value as u32)
+    }
+}
+
+/// DMA0 can only read from internal memory.
+fn source_mask(channel: usize) -> u32 {
+    if channel == 0 {
+        0x07FFFFFF
+    } else {
+        0x0FFFFFFF
+    }
+}
+
+/// Only DMA3 can write to the gamepak.
+fn destination_mask(channel: usize) -> u32 {
+    if channel == 3 {
+        0x0FFFFFFF
+    } else {
+        0x07FFFFFF
+    }
+}
+
+/// 40000BAh - DMA0CNT_H - DMA 0 Control (R/W)
+/// 40000C6h - DMA1CNT_H - DMA 1 Control (R/W)
+/// 40000D2h - DMA2CNT_H - DMA 2 Control (R/W)
+/// 40000DEh - DMA3CNT_H - DMA 3 Control (R/W)
+///
+/// ```ignore
+///   Bit   Expl.
+///   0-4   Not used
+///   5-6   Dest Addr Control  (0=Increment,1=Decrement,2=Fixed,3=Increment/Reload)
+///   7-8   Source Adr Control (0=Increment,1=Decrement,2=Fixed,3=Prohibited)
+///   9     DMA Repeat                   (0=Off, 1=On) (Must be zero if Bit 11 set)
+///   10    DMA Transfer Type            (0=16bit, 1=32bit)
+///   11    Game Pak DRQ  - DMA3 only -  (0=Normal, 1=DRQ <from> Game Pak, DMA3)
+///   12-13 DMA Start Timing  (0=Immediately, 1=VBlank, 2=HBlank, 3=Special)
+///   14    IRQ upon end of Word Count   (0=Disable, 1=Enable)
+///   15    DMA Enable                   (0=Off, 1=On)
+/// ```
+///
+/// The Special timing is the sound FIFO for DMA1 and DMA2 and video capture for DMA3.
+/// The prohibited source control is treated as increment.
+#[derive(IoRegister, Copy, Clone)]
+#[field(destination_control: DmaAddressControl = 5..=6)]
+#[field(source_control: DmaAddressControl = 7..=8)]
+#[field(repeat: bool = 9)]
+#[field(transfer32: bool = 10)]
+#[field(gamepak_drq: bool = 11)]
+#[field(timing: DmaTiming = 12..=13)]
+#[field(irq: bool = 14)]
+#[field(enabled: bool = 15)]
+pub struct RegDmaControl {
+    value: u16,
+}
+
+impl RegDmaControl {
+    /// The number of bytes in each unit that's transferred.
+    fn unit_size(self) -> u32 {
+        if self.transfer32() {
+            4
+        } else {
+            2
+        }
+    }
+}
+
+#[derive(Copy, Clone, PartialEq, Eq, Debug)]
+pub enum DmaAddressControl {
+    Increment,
+    Decrement,
+    Fixed,
+    IncrementReload,
+}
+
+impl DmaAddressControl {
+    /// How much the address changes by after each unit.
+    fn step(self, size: u32) -> i32 {
+        match self {
+            DmaAddressControl::Increment | DmaAddressControl::IncrementReload => size as i32,
+            DmaAddressControl::Decrement => -(size as i32),
+            DmaAddressControl::Fixed => 0,
+        }
+    }
+}
+
+impl From<u16> for DmaAddressControl {
+    fn from(value: u16) -> Self {
+        match value {
+            0 => DmaAddressControl::Increment,
+            1 => DmaAddressControl::Decrement,
+            2 => DmaAddressControl::Fixed,
+            3 => DmaAddressControl::IncrementReload,
+            _ => unreachable!(),
+        }
+    }
+}
+
+impl From<DmaAddressControl> for u16 {
+    fn from(value: DmaAddressControl) -> Self {
+        match value {
+            DmaAddressControl::Increment => 0,
+            DmaAddressControl::Decrement => 1,
+            DmaAddressControl::Fixed => 2,
+            DmaAddressControl::IncrementReload => 3,
+        }
+    }
+}
+
+#[derive(Copy, Clone, PartialEq, Eq, Debug)]
+pub enum DmaTiming {
+    Immediate,
+    VBlank,
+    HBlank,
+    Special,
+}
+
+impl From<u16> for DmaTiming {
+    fn from(value: u16) -> Self {
+        match value {
+            0 => DmaTiming::Immediate,
+            1 => DmaTiming::VBlank,
+            2 => DmaTiming::HBlank,
+            3 => DmaTiming::Special,
+            _ => unreachable!(),
+        }
+    }
+}
+
+impl From<DmaTiming> for u16 {
+    fn from(value: DmaTiming) -> Self {
+        match value {
+            DmaTiming::Immediate => 0,
+            DmaTiming::VBlank => 1,
+            DmaTiming::HBlank => 2,
+            DmaTiming::Special => 3,
+        }
+    }
+}
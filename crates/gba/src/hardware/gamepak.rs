@@ -0,0 +1,228 @@
+//! The ROM inside of a gamepak.
+//!
+//! ROMs are never written to, so one copy of a ROM can be shared by every [`crate::Gba`] that
+//! runs it. [`Gamepak::map_file`] goes further and maps the ROM file straight into memory so
+//! that it isn't read until it's used and its pages can be shared with every other process
+//! that has the same file mapped. That's only sound while the file doesn't change, so it's
+//! `unsafe`.
+
+use std::{fmt, io, ops::Deref, path::Path, sync::Arc};
+
+/// A ROM padded with zeroes up to the next power of two in size, so that it can be mirrored
+/// with a mask. Cloning one is cheap and shares the ROM.
+#[derive(Clone)]
+pub struct Gamepak {
+    rom: Arc<Rom>,
+}
+
+impl Gamepak {
+    /// Maps the ROM file at `path` into memory read-only. Nothing is read until the GBA
+    /// accesses it.
+    ///
+    /// On platforms without `mmap` this reads the whole file instead.
+    ///
+    /// # Safety
+    ///
+    /// The file must not be modified or truncated while the returned [`Gamepak`] or any of its
+    /// clones are alive. The mapping is private, but pages that haven't been read yet still
+    /// come from the file, so a change to it would change the ROM underneath the GBA and
+    /// truncating it would make reads past the new end fault.
+    pub unsafe fn map_file(path: impl AsRef<Path>) -> io::Result<Self> {
+        let file = std::fs::File::open(path)?;
+        let len = file.metadata()?.len();
+        if len == 0 {
+            return Err(io::Error::new(io::ErrorKind::InvalidData, "empty ROM file"));
+        }
+        let len = usize::try_from(len)
+            .map_err(|_| io::Error::new(io::ErrorKind::InvalidData, "ROM file is too large"))?;
+        Rom::map(&file, len).map(Self::from_rom)
+    }
+
+    fn from_rom(rom: Rom) -> Self {
+        Self { rom: Arc::new(rom) }
+    }
+
+    /// Size of the ROM after padding. This is always a power of two.
+    pub fn len(&self) -> usize {
+        self.rom.as_slice().len()
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.len() == 0
+    }
+
+    /// True if this was mapped from a file instead of being copied onto the heap.
+    pub fn is_mapped(&self) -> bool {
+        !matches!(&*self.rom, Rom::Heap(_))
+    }
+
+    /// True if `other` shares the same ROM as `self`.
+    pub fn ptr_eq(&self, other: &Gamepak) -> bool {
+        Arc::ptr_eq(&self.rom, &other.rom)
+    }
+}
+
+impl From<Vec<u8>> for Gamepak {
+    /// # Panics
+    ///
+    /// Panics if `rom` is empty.
+    fn from(mut rom: Vec<u8>) -> Self {
+        assert!(!rom.is_empty());
+        rom.resize(rom.len().next_power_of_two(), 0);
+        Self::from_rom(Rom::Heap(rom.into_boxed_slice()))
+    }
+}
+
+impl From<&[u8]> for Gamepak {
+    fn from(rom: &[u8]) -> Self {
+        Self::from(rom.to_vec())
+    }
+}
+
+impl Deref for Gamepak {
+    type Target = [u8];
+
+    fn deref(&self) -> &[u8] {
+        self.rom.as_slice()
+    }
+}
+
+impl fmt::Debug for Gamepak {
+    fn fmt(&self, f: &mut fmt::Formatter<'_>) -> fmt::Result {
+        f.debug_struct("Gamepak")
+            .field("len", &self.len())
+            .field("mapped", &self.is_mapped())
+            .finish()
+    }
+}
+
+enum Rom {
+    Heap(Box<[u8]>),
+    #[cfg(unix)]
+    Mapped(mmap::Mapping),
+}
+
+impl Rom {
+    #[cfg(unix)]
+    fn map(file: &std::fs::File, len: usize) -> io::Result<Self> {
+        mmap::Mapping::new(file, len).map(Rom::Mapped)
+    }
+
+    #[cfg(not(unix))]
+    fn map(mut file: &std::fs::File, len: usize) -> io::Result<Self> {
+        use io::Read as _;
+
+        let mut rom = Vec::with_capacity(len.next_power_of_two());
+        file.read_to_end(&mut rom)?;
+        rom.resize(len.next_power_of_two(), 0);
+        Ok(Rom::Heap(rom.into_boxed_slice()))
+    }
+
+    fn as_slice(&self) -> &[u8] {
+        match self {
+            Rom::Heap(rom) => rom,
+            #[cfg(unix)]
+            Rom::Mapped(mapping) => mapping.as_slice(),
+        }
+    }
+}
+
+#[cfg(unix)]
+mod mmap {
+    use std::{io, os::unix::io::AsRawFd as _, ptr::NonNull};
+
+    /// A read-only private mapping of a file that's padded with zeroes up to the next power
+    /// of two in size.
+    pub(super) struct Mapping {
+        ptr: NonNull<u8>,
+        len: usize,
+    }
+
+    impl Mapping {
+        pub(super) fn new(file: &std::fs::File, file_len: usize) -> io::Result<Self> {
+            let len = file_len.next_power_of_two();
+
+            // SAFETY: the whole padded size is reserved as zeroed anonymous memory first and
+            //         then the file is mapped over the start of it, so that every byte past
+            //         the end of the file reads as zero instead of faulting. Both mappings
+            //         are read-only and are only unmapped when this is dropped.
+            unsafe {
+                let ptr = libc::mmap(
+                    std::ptr::null_mut(),
+                    len,
+                    libc::PROT_READ,
+                    libc::MAP_PRIVATE | libc::MAP_ANONYMOUS,
+                    -1,
+                    0,
+                );
+                if ptr == libc::MAP_FAILED {
+                    return Err(io::Error::last_os_error());
+                }
+                let mapping = Mapping {
+                    ptr: NonNull::new_unchecked(ptr as *mut u8),
+                    len,
+                };
+
+                let file_ptr = libc::mmap(
+                    ptr,
+                    file_len,
+                    libc::PROT_READ,
+                    libc::MAP_PRIVATE | libc::MAP_FIXED,
+                    file.as_raw_fd(),
+                    0,
+                );
+                if file_ptr == libc::MAP_FAILED {
+                    return Err(io::Error::last_os_error());
+                }
+                Ok(mapping)
+            }
+        }
+
+        pub(super) fn as_slice(&self) -> &[u8] {
+            // SAFETY: the mapping is `len` bytes and readable for as long as `self` lives.
+            unsafe { std::slice::from_raw_parts(self.ptr.as_ptr(), self.len) }
+        }
+    }
+
+    impl Drop for Mapping {
+        fn drop(&mut self) {
+            // SAFETY: this is the whole region that was mapped in `Mapping::new`.
+            unsafe { libc::munmap(self.ptr.as_ptr() as *mut libc::c_void, self.len) };
+        }
+    }
+
+    // SAFETY: the mapping is never written to.
+    unsafe impl Send for Mapping {}
+    unsafe impl Sync for Mapping {}
+}
+
+#[cfg(test)]
+mod test {
+    use super::Gamepak;
+
+    #[test]
+    fn test_padding() {
+        let gamepak = Gamepak::from(vec![1, 2, 3]);
+        assert_eq!(&gamepak[..], &[1, 2, 3, 0]);
+        assert!(!gamepak.is_mapped());
+    }
+
+    #[test]
+    fn test_map_file() {
+        let path = std::env::temp_dir().join(format!("pyrite-gamepak-{}.gba", std::process::id()));
+        let rom: Vec<u8> = (0..5000u32).map(|n| n as u8).collect();
+        std::fs::write(&path, &rom).unwrap();
+        // SAFETY: nothing else knows about the file, and removing it doesn't change its
+        //         contents while it's still mapped.
+        let gamepak = unsafe { Gamepak::map_file(&path) };
+        std::fs::remove_file(&path).unwrap();
+
+        let gamepak = gamepak.unwrap();
+        assert_eq!(gamepak.len(), 8192);
+        assert_eq!(&gamepak[..rom.len()], &rom[..]);
+        assert!(gamepak[rom.len()..].iter().all(|&b| b == 0));
+
+        let shared = gamepak.clone();
+        assert!(shared.ptr_eq(&gamepak));
+    }
+}
@@ -1,26 +1,39 @@
 use crate::memory::{PAL_MASK, PAL_SIZE};
-use byteorder::{ByteOrder, LittleEndian};
 
+pub const COLOR_COUNT: usize = PAL_SIZE / 2;
+
+/// Palette RAM is kept as native 16-bit colors instead of bytes because it's read one color at
+/// a time for every pixel while rendering, and only occasionally read or written by the CPU.
+#[derive(Clone, PartialEq, Eq)]
 pub struct Palette {
-    pub(crate) data: [u8; PAL_SIZE],
+    colors: [u16; COLOR_COUNT],
 }
 
 impl Default for Palette {
     fn default() -> Self {
         Palette {
-            data: [0; PAL_SIZE],
+            colors: [0; COLOR_COUNT],
         }
     }
 }
 
 impl Palette {
+    pub(crate) fn colors(&self) -> &[u16; COLOR_COUNT] {
+        &self.colors
+    }
+
+    pub(crate) fn colors_mut(&mut self) -> &mut [u16; COLOR_COUNT] {
+        &mut self.colors
+    }
+
+    #[inline]
     pub fn get_bg256(&self, entry: u8) -> u16 {
-        self.view16((entry as u32) * 2)
+        self.colors[entry as usize]
     }
 
+    #[inline]
     pub fn get_obj256(&self, entry: u8) -> u16 {
-        let addr = (entry as u32) * 2 + 0x200;
-        self.view16(addr)
+        self.colors[0x100 + entry as usize]
     }
 
     pub fn get_bg16(&self, palette: u8, entry: u8) -> u16 {
@@ -32,42 +45,54 @@ impl Palette {
     }
 
     pub fn load32(&self, address: u32) -> u32 {
-        LittleEndian::read_u32(&self.data[(address & PAL_MASK) as usize..])
+        let index = color_index(address & !0x3);
+        self.colors[index] as u32 | ((self.colors[index + 1] as u32) << 16)
     }
 
     pub fn load16(&self, address: u32) -> u16 {
-        LittleEndian::read_u16(&self.data[(address & PAL_MASK) as usize..])
+        self.colors[color_index(address)]
     }
 
     pub fn load8(&self, address: u32) -> u8 {
-        self.data[(address & PAL_MASK) as usize]
+        (self.colors[color_index(address)] >> ((address & 0x1) * 8)) as u8
     }
 
-    pub fn store32(&mut self, address: u32, value: u32) {
-        LittleEndian::write_u32(&mut self.data[(address & PAL_MASK) as usize..], value);
+    /// Returns true if the palette changed.
+    pub fn store32(&mut self, address: u32, value: u32) -> bool {
+        let index = color_index(address & !0x3);
+        let changed = self.load32(address) != value;
+        self.colors[index] = value as u16;
+        self.colors[index + 1] = (value >> 16) as u16;
+        changed
     }
 
-    pub fn store16(&mut self, address: u32, value: u16) {
-        LittleEndian::write_u16(&mut self.data[(address & PAL_MASK) as usize..], value);
+    /// Returns true if the palette changed.
+    pub fn store16(&mut self, address: u32, value: u16) -> bool {
+        let color = &mut self.colors[color_index(address)];
+        std::mem::replace(color, value) != value
     }
 
-    pub fn store8(&mut self, address: u32, value: u8) {
+    /// Returns true if the palette changed.
+    pub fn store8(&mut self, address: u32, value: u8) -> bool {
         // 8bit writes to PAL write the 8bit value to both the lower and upper byte of
         // the addressed halfword.
-        let address = ((address & !0x1) & PAL_MASK) as usize;
-        self.data[address] = value;
-        self.data[address + 1] = value;
+        self.store16(address & !0x1, (value as u16) * 0x0101)
     }
 
     pub fn view32(&self, address: u32) -> u32 {
-        LittleEndian::read_u32(&self.data[(address & PAL_MASK) as usize..])
+        self.load32(address)
     }
 
     pub fn view16(&self, address: u32) -> u16 {
-        LittleEndian::read_u16(&self.data[(address & PAL_MASK) as usize..])
+        self.load16(address)
     }
 
     pub fn view8(&self, address: u32) -> u8 {
-        self.data[(address & PAL_MASK) as usize]
+        self.load8(address)
     }
 }
+
+#[inline]
+fn color_index(address: u32) -> usize {
+    (address & PAL_MASK) as usize / 2
+}
@@ -1,14 +1,74 @@
 use arm::emu::Waitstates;
 use pyrite_derive::IoRegister;
 
+use crate::memory::page_table::PageTimings;
+
 #[derive(Default)]
 pub struct SystemControl {
     pub waitcnt: RegWaitcnt,
     pub internal_memory_control: RegInternalMemoryControl,
     pub waitstates: SystemWaitstates,
+
+    pub interrupt_enable: RegInterrupts,
+    pub interrupt_request: RegInterrupts,
+    pub interrupt_master_enable: RegIme,
+    pub postflg: u8,
+
+    /// Interrupts that a halted CPU is waiting for because of an `IntrWait` or
+    /// `VBlankIntrWait` BIOS call. If this is `None` the CPU is woken up by any
+    /// enabled interrupt instead.
+    pub(crate) intr_wait: Option<u16>,
 }
 
 impl SystemControl {
+    /// Sets bits in `IF` for interrupts that have been requested by hardware.
+    pub fn request_interrupts(&mut self, interrupts: u16) {
+        let value = u16::from(self.interrupt_request) | interrupts;
+        self.interrupt_request = RegInterrupts::new(value);
+    }
+
+    /// Writing 1 to a bit in `IF` acknowledges the interrupt and clears it.
+    pub fn write_interrupt_request(&mut self, value: u16) {
+        let value = u16::from(self.interrupt_request) & !value;
+        self.interrupt_request = RegInterrupts::new(value);
+    }
+
+    /// Waits for any of `interrupts` to be requested like the BIOS `IntrWait` function.
+    /// Returns true if the CPU should be halted until one of them is. If `discard` is
+    /// true, interrupts that have already been requested are ignored.
+    ///
+    /// The BIOS normally waits for flags that the game's interrupt handler sets in RAM
+    /// after it acknowledges an interrupt. Interrupts are acknowledged in `IF`
+    /// directly here instead.
+    pub(crate) fn begin_intr_wait(&mut self, discard: bool, interrupts: u16) -> bool {
+        self.interrupt_master_enable.set_enabled(true);
+        if discard {
+            self.write_interrupt_request(interrupts);
+        }
+
+        if u16::from(self.interrupt_request) & interrupts != 0 {
+            self.write_interrupt_request(interrupts);
+            return false;
+        }
+
+        self.intr_wait = Some(interrupts);
+        true
+    }
+
+    /// Returns true if a halted CPU should be woken up by one of the interrupts in `IF`.
+    pub(crate) fn poll_wake_up(&mut self) -> bool {
+        let requested = u16::from(self.interrupt_request);
+        match self.intr_wait {
+            Some(interrupts) if requested & interrupts != 0 => {
+                self.write_interrupt_request(interrupts);
+                self.intr_wait = None;
+                true
+            }
+            Some(_) => false,
+            None => requested & u16::from(self.interrupt_enable) != 0,
+        }
+    }
+
     pub fn write_waitcnt(&mut self, waitcnt: RegWaitcnt) {
         self.waitcnt = waitcnt;
         self.update_waitstates();
@@ -82,10 +142,71 @@ impl SystemControl {
             _ => unreachable!(),
         };
 
+        self.waitstates.pages = PageTimings::new(&self.waitstates);
+
         tracing::debug!(waitstates = debug(&self.waitstates), "waitstates updated");
     }
 }
 
+/// 4000200h - IE - Interrupt Enable Register (R/W)
+/// 4000202h - IF - Interrupt Request Flags / IRQ Acknowledge (R/W, see below)
+///
+/// ```ignore
+///   Bit   Expl.
+///   0     LCD V-Blank                    (0=Disable)
+///   1     LCD H-Blank                    (etc.)
+///   2     LCD V-Counter Match            (etc.)
+///   3     Timer 0 Overflow               (etc.)
+///   4     Timer 1 Overflow               (etc.)
+///   5     Timer 2 Overflow               (etc.)
+///   6     Timer 3 Overflow               (etc.)
+///   7     Serial Communication           (etc.)
+///   8     DMA 0                          (etc.)
+///   9     DMA 1                          (etc.)
+///   10    DMA 2                          (etc.)
+///   11    DMA 3                          (etc.)
+///   12    Keypad                         (etc.)
+///   13    Game Pak (external IRQ source) (etc.)
+///   14-15 Not used
+/// ```
+///
+/// Interrupts must be enabled in IE, and IME must be set for them to be executed.
+/// IF is set by hardware when an interrupt is requested and each bit is cleared
+/// (acknowledged) by writing a 1 to it.
+#[derive(IoRegister, Copy, Clone)]
+#[repr(C)]
+#[field(vblank: bool = 0)]
+#[field(hblank: bool = 1)]
+#[field(vcounter_match: bool = 2)]
+#[field(timer: u16 = 3..=6)]
+#[field(serial: bool = 7)]
+#[field(dma: u16 = 8..=11)]
+#[field(keypad: bool = 12)]
+#[field(gamepak: bool = 13)]
+pub struct RegInterrupts {
+    value: u16,
+}
+
+impl RegInterrupts {
+    pub const VBLANK: u16 = 1 << 0;
+    pub const HBLANK: u16 = 1 << 1;
+    pub const VCOUNTER_MATCH: u16 = 1 << 2;
+}
+
+/// 4000208h - IME - Interrupt Master Enable Register (R/W)
+///
+/// ```ignore
+///   Bit   Expl.
+///   0     Disable all interrupts         (0=Disable All, 1=See IE register)
+///   1-31  Not used
+/// ```
+#[derive(IoRegister, Copy, Clone)]
+#[repr(C)]
+#[field(enabled: bool = 0)]
+pub struct RegIme {
+    value: u16,
+}
+
 #[derive(Debug, Default)]
 pub struct SystemWaitstates {
     pub sram: Waitstates,
@@ -94,6 +215,9 @@ pub struct SystemWaitstates {
         /* second access */ Waitstates,
     ); 3],
     pub ewram: Waitstates,
+
+    /// Waitstates for accesses that go through the page table.
+    pub(crate) pages: PageTimings,
 }
 
 /// 4000204h - WAITCNT - Waitstate Control (R/W)
@@ -1,21 +1,33 @@
+mod affine;
+mod compositor;
+mod convert;
 pub mod line;
 mod mode3;
 pub mod registers;
+mod text;
+mod tiles;
+mod worker;
 
 use arm::emu::Cycles;
 
 use crate::{
-    events::{GbaEvent, SharedGbaScheduler},
+    events::{GbaEvent, GbaScheduler},
     memory::VRAM_SIZE,
     GbaVideoOutput,
 };
 
 use self::{
     line::{BlendContext, GbaLine},
-    registers::{BgMode, GbaVideoRegisters},
+    registers::{BgMode, DisplayFrame, GbaVideoRegisters},
+    tiles::TileCache,
+    worker::RenderWorker,
 };
 
-use super::palette::Palette;
+use super::{palette::Palette, system_control::RegInterrupts};
+
+pub use self::convert::{
+    convert_to_rgb565, convert_to_rgba8888, to_rgb565, to_rgba8888, PixelFormat, RgbaLineBuffer,
+};
 
 pub const VISIBLE_LINE_WIDTH: usize = 240;
 pub const VISIBLE_LINE_COUNT: usize = 160;
@@ -23,65 +35,264 @@ pub const LINE_COUNT: usize = 228;
 pub const VISIBLE_PIXELS: usize = VISIBLE_LINE_WIDTH * VISIBLE_LINE_COUNT;
 pub const HDRAW_CYCLES: Cycles = Cycles::new(960);
 pub const HBLANK_CYCLES: Cycles = Cycles::new(272);
+/// Cycles in a whole frame, H-Draw and H-Blank for every line.
+pub const FRAME_CYCLES: u64 = LINE_COUNT as u64 * (960 + 272);
 
 pub type LineBuffer = [u16; VISIBLE_LINE_WIDTH];
 pub type ScreenBuffer = [u16; VISIBLE_PIXELS];
 
 pub struct GbaVideo {
-    pub(crate) line: GbaLine,
-    scheduler: SharedGbaScheduler,
+    pub(crate) renderer: LineRenderer,
     pub(crate) registers: GbaVideoRegisters,
     pub(crate) frame: u64,
+    cache: LineCache,
+    /// The internal reference points of BG2 and BG3 for the current line.
+    reference_points: [ReferencePoint; 2],
+    /// Renders lines on another thread if parallel rendering is enabled.
+    worker: Option<RenderWorker>,
+    /// Lines aren't rendered or sent anywhere while this is false, but everything else about
+    /// the video hardware, including its timing and interrupts, stays the same.
+    rendering: bool,
 }
 
 impl GbaVideo {
-    pub(crate) fn new(scheduler: SharedGbaScheduler) -> GbaVideo {
+    pub(crate) fn new() -> GbaVideo {
         GbaVideo {
-            line: GbaLine::default(),
-            scheduler,
+            renderer: LineRenderer::default(),
             registers: GbaVideoRegisters::default(),
             frame: 0,
+            cache: LineCache::default(),
+            reference_points: [ReferencePoint::default(); 2],
+            worker: None,
+            rendering: true,
         }
     }
 
-    fn render_line(&mut self, line: u16, video: &mut dyn GbaVideoOutput, context: HBlankContext) {
-        let mut unhandled_mode = false;
-
-        let render_context = RenderContext::new(line, &self.registers, context.vram);
-        match self.registers.dispcnt.bg_mode() {
-            BgMode::Mode0 => unhandled_mode = true,
-            BgMode::Mode1 => unhandled_mode = true,
-            BgMode::Mode3 => mode3::render(&mut self.line, render_context),
-            BgMode::Mode2 => unhandled_mode = true,
-            BgMode::Mode4 => unhandled_mode = true,
-            BgMode::Mode5 => unhandled_mode = true,
-            BgMode::Invalid6 => unhandled_mode = true,
-            BgMode::Invalid7 => unhandled_mode = true,
+    fn render_line(&mut self, line: u16, target: &mut VideoTarget, context: HBlankContext) {
+        if self.rendering {
+            self.draw_line(line, target, context);
+        } else {
+            // The line has to be rendered again the next time that it's shown.
+            self.cache.valid[line as usize] = false;
         }
 
-        let mut buffer = [0u16; VISIBLE_LINE_WIDTH];
-        if unhandled_mode {
-            buffer.fill(rgb5(0x1F, 0, 0x1F));
-        } else {
-            let context = BlendContext::with_hblank(&self.registers, context);
-            self.line.blend(&mut buffer, context);
+        for (point, affine) in self.reference_points.iter_mut().zip(&self.registers.affine) {
+            point.x = point.x.wrapping_add(affine.pb.parameter() as i32);
+            point.y = point.y.wrapping_add(affine.pd.parameter() as i32);
         }
-        video.gba_line_ready(line as usize, &buffer);
 
         if line == (VISIBLE_LINE_COUNT - 1) as u16 {
             self.frame += 1;
         }
     }
 
-    pub(crate) fn reset(&mut self) {
+    /// Lines are only rendered again if something that they depend on changed since the last
+    /// time that they were rendered, otherwise the last thing that was rendered is reused.
+    fn draw_line(&mut self, line: u16, target: &mut VideoTarget, context: HBlankContext) {
+        let index = line as usize;
+        let valid = std::mem::replace(&mut self.cache.valid[index], true);
+        // The reference points of the affine backgrounds can be different for the same line
+        // without any of the registers changing if they were written to in the middle of the
+        // last frame.
+        let same_reference_points = std::mem::replace(
+            &mut self.cache.reference_points[index],
+            self.reference_points,
+        ) == self.reference_points;
+        let redraw = !(valid && same_reference_points);
+
+        if let Some(worker) = &mut self.worker {
+            worker.render_line(
+                line,
+                redraw,
+                &self.registers,
+                self.reference_points,
+                context,
+            );
+            if line == (VISIBLE_LINE_COUNT - 1) as u16 {
+                worker.finish_frame(target);
+            }
+        } else {
+            let cached = self.cache.line_mut(index);
+            if redraw {
+                self.renderer.draw(
+                    line,
+                    &self.registers,
+                    self.reference_points,
+                    context,
+                    cached,
+                );
+            }
+
+            match target {
+                VideoTarget::Frame(frame) => {
+                    let start = index * VISIBLE_LINE_WIDTH;
+                    frame[start..(start + VISIBLE_LINE_WIDTH)].copy_from_slice(cached);
+                }
+                VideoTarget::Lines(video) => send_line(*video, index, cached),
+            }
+        }
+    }
+
+    /// Renders the layers of `line` into [`LineRenderer::line`] without blending them.
+    /// Returns false if the current video mode isn't implemented.
+    #[cfg(feature = "bench")]
+    pub(crate) fn render_layers(&mut self, line: u16, vram: &[u8; VRAM_SIZE]) -> bool {
+        let renderer = &mut self.renderer;
+        renderer.tiles.update(vram);
+        let render_context = RenderContext::new(
+            line,
+            &self.registers,
+            vram,
+            &renderer.tiles,
+            self.reference_points,
+        );
+        render_layers(&mut renderer.line, render_context)
+    }
+
+    /// Starts or stops rendering lines on another thread. The other thread keeps its own copy
+    /// of VRAM and the palette, starting with `vram` and `palette`, which is kept up to date by
+    /// sending it everything that changed along with every line.
+    pub(crate) fn set_parallel_rendering(
+        &mut self,
+        enabled: bool,
+        vram: &[u8; VRAM_SIZE],
+        palette: &Palette,
+    ) {
+        if enabled == self.worker.is_some() {
+            return;
+        }
+        self.worker = enabled.then(|| RenderWorker::new(vram, palette));
+        // The lines that were already rendered are on the other side.
+        self.invalidate_lines();
+    }
+
+    pub(crate) fn parallel_rendering(&self) -> bool {
+        self.worker.is_some()
+    }
+
+    pub(crate) fn set_rendering(&mut self, enabled: bool) {
+        self.rendering = enabled;
+    }
+
+    pub(crate) fn rendering(&self) -> bool {
+        self.rendering
+    }
+
+    /// Every line has to be rendered again after the palette changes.
+    pub(crate) fn palette_changed(&mut self) {
+        self.invalidate_lines();
+        if let Some(worker) = &mut self.worker {
+            worker.palette_changed();
+        }
+    }
+
+    /// Updates the internal reference point of an affine background after 16 bits of BG2X,
+    /// BG2Y, BG3X or BG3Y at `address` were written.
+    pub(crate) fn write_reference_point(&mut self, address: u32, value: u16) {
+        // BG3's registers are 16 bytes after BG2's, Y is 4 bytes after X and the upper half of
+        // each is 2 bytes after the lower half.
+        let bg = ((address >> 4) & 1) as usize;
+        let affine = &mut self.registers.affine[bg];
+        let point = &mut self.reference_points[bg];
+        let high = address & 2 != 0;
+        if address & 4 == 0 {
+            affine.x.write_half(high, value);
+            point.x = affine.x.signed();
+        } else {
+            affine.y.write_half(high, value);
+            point.y = affine.y.signed();
+        }
+    }
+
+    /// The internal reference points are reloaded from the registers at the start of every
+    /// frame.
+    fn reload_reference_points(&mut self) {
+        for (point, affine) in self.reference_points.iter_mut().zip(&self.registers.affine) {
+            point.x = affine.x.signed();
+            point.y = affine.y.signed();
+        }
+    }
+
+    /// Every line has to be rendered again, for changes to anything that isn't tied to
+    /// specific lines like the palette, OAM and the video registers.
+    pub(crate) fn invalidate_lines(&mut self) {
+        self.cache.valid.fill(false);
+    }
+
+    /// Called after the VRAM at `offset` was changed. Only the lines that show it have to be
+    /// rendered again in the bitmap modes. Tiles can end up on any line so every line has to
+    /// be rendered again in the tile modes.
+    pub(crate) fn vram_changed(&mut self, offset: usize) {
+        self.renderer.tiles.vram_changed(offset);
+        if let Some(worker) = &mut self.worker {
+            worker.vram_changed(offset);
+        }
+
+        const BITMAP_OBJ_TILES: usize = 0x14000;
+        const BITMAP_FRAME_SIZE: usize = 0xA000;
+
+        let dispcnt = self.registers.dispcnt;
+        let frame = match dispcnt.display_frame_select() {
+            DisplayFrame::Mode0 => 0,
+            DisplayFrame::Mode1 => BITMAP_FRAME_SIZE,
+        };
+        let bitmap_line = match dispcnt.bg_mode() {
+            BgMode::Mode3 if offset < BITMAP_OBJ_TILES => Some(offset / (VISIBLE_LINE_WIDTH * 2)),
+            BgMode::Mode4 if offset < BITMAP_OBJ_TILES => {
+                // The frame that isn't displayed can be drawn to without changing anything.
+                let Some(offset) = offset.checked_sub(frame) else {
+                    return;
+                };
+                Some(offset / VISIBLE_LINE_WIDTH)
+            }
+            BgMode::Mode5 if offset < BITMAP_OBJ_TILES => {
+                let Some(offset) = offset.checked_sub(frame) else {
+                    return;
+                };
+                Some(offset / (MODE5_LINE_WIDTH * 2))
+            }
+            // OBJ tiles and tile mode backgrounds.
+            _ => None,
+        };
+
+        match bitmap_line {
+            Some(line) if line < VISIBLE_LINE_COUNT => self.cache.valid[line] = false,
+            // Past the end of the displayed frame.
+            Some(_) => {}
+            None => self.invalidate_lines(),
+        }
+    }
+
+    pub(crate) fn save_state(&self) -> VideoState {
+        VideoState {
+            registers: self.registers.clone(),
+            frame: self.frame,
+            reference_points: self.reference_points,
+        }
+    }
+
+    /// Restores a state returned by [`GbaVideo::save_state`]. VRAM and the palette aren't
+    /// part of it, [`GbaVideo::vram_changed`] and [`GbaVideo::palette_changed`] still have
+    /// to be called for them.
+    pub(crate) fn load_state(&mut self, state: &VideoState) {
+        self.registers.clone_from(&state.registers);
+        self.frame = state.frame;
+        self.reference_points = state.reference_points;
+        self.invalidate_lines();
+    }
+
+    pub(crate) fn reset(&mut self, scheduler: &mut GbaScheduler) {
+        self.invalidate_lines();
+        self.reload_reference_points();
         self.registers
             .vcount
             .set_current_scanline(LINE_COUNT as u16 - 1);
-        self.begin_hdraw();
+        self.begin_hdraw(scheduler);
     }
 
-    pub(crate) fn begin_hdraw(&mut self) {
-        self.scheduler.schedule(GbaEvent::HBlank, HDRAW_CYCLES);
+    /// Returns the interrupts that were requested by the start of the new line.
+    pub(crate) fn begin_hdraw(&mut self, scheduler: &mut GbaScheduler) -> u16 {
+        scheduler.schedule(GbaEvent::HBlank, HDRAW_CYCLES);
 
         let mut current_scanline = self.registers.vcount.current_scanline();
         if current_scanline >= (LINE_COUNT - 1) as u16 {
@@ -90,14 +301,51 @@ impl GbaVideo {
             current_scanline += 1;
         }
         self.registers.vcount.set_current_scanline(current_scanline);
+        if current_scanline == VISIBLE_LINE_COUNT as u16 {
+            self.reload_reference_points();
+        }
+
+        let mut interrupts = 0;
+        let dispstat = &mut self.registers.dispstat;
+        dispstat.set_hblank_flag(false);
+
+        // The V-Blank flag is set in lines 160..226 but not 227.
+        let vblank =
+            (VISIBLE_LINE_COUNT as u16..(LINE_COUNT - 1) as u16).contains(&current_scanline);
+        if vblank && !dispstat.vblank_flag() && dispstat.vblank_irq_enable() {
+            interrupts |= RegInterrupts::VBLANK;
+        }
+        dispstat.set_vblank_flag(vblank);
+
+        let v_counter_match = current_scanline == dispstat.v_count_setting();
+        if v_counter_match && dispstat.v_counter_irq_enable() {
+            interrupts |= RegInterrupts::VCOUNTER_MATCH;
+        }
+        dispstat.set_v_counter_flag(v_counter_match);
+
+        interrupts
     }
 
-    pub(crate) fn begin_hblank(&mut self, video: &mut dyn GbaVideoOutput, context: HBlankContext) {
-        self.scheduler.schedule(GbaEvent::HDraw, HBLANK_CYCLES);
+    /// Returns the interrupts that were requested by the start of H-Blank.
+    pub(crate) fn begin_hblank(
+        &mut self,
+        scheduler: &mut GbaScheduler,
+        target: &mut VideoTarget,
+        context: HBlankContext,
+    ) -> u16 {
+        scheduler.schedule(GbaEvent::HDraw, HBLANK_CYCLES);
 
         let current_scanline = self.registers.vcount.current_scanline();
         if current_scanline < VISIBLE_LINE_COUNT as _ {
-            self.render_line(current_scanline, video, context);
+            self.render_line(current_scanline, target, context);
+        }
+
+        let dispstat = &mut self.registers.dispstat;
+        dispstat.set_hblank_flag(true);
+        if dispstat.hblank_irq_enable() {
+            RegInterrupts::HBLANK
+        } else {
+            0
         }
     }
 
@@ -107,25 +355,166 @@ impl GbaVideo {
     }
 }
 
+const MODE5_LINE_WIDTH: usize = 160;
+
+/// Everything about [`GbaVideo`] that's saved in a savestate. Lines that were already
+/// rendered aren't, they're rendered again after the state is loaded.
+#[derive(Clone)]
+pub(crate) struct VideoState {
+    pub(crate) registers: GbaVideoRegisters,
+    pub(crate) frame: u64,
+    pub(crate) reference_points: [ReferencePoint; 2],
+}
+
+/// Renders the layers of a line and blends them.
+#[derive(Default)]
+pub(crate) struct LineRenderer {
+    pub(crate) line: GbaLine,
+    tiles: TileCache,
+}
+
+impl LineRenderer {
+    fn draw(
+        &mut self,
+        line: u16,
+        registers: &GbaVideoRegisters,
+        reference_points: [ReferencePoint; 2],
+        context: HBlankContext,
+        output: &mut LineBuffer,
+    ) {
+        // Only text backgrounds use the decoded tiles.
+        if matches!(registers.dispcnt.bg_mode(), BgMode::Mode0 | BgMode::Mode1) {
+            self.tiles.update(context.vram);
+        }
+        let render_context =
+            RenderContext::new(line, registers, context.vram, &self.tiles, reference_points);
+
+        if render_layers(&mut self.line, render_context) {
+            let context = BlendContext::with_hblank(registers, context);
+            self.line.blend(output, context);
+        } else {
+            output.fill(rgb5(0x1F, 0, 0x1F));
+        }
+    }
+}
+
+/// Renders the layers of a line without blending them. Returns false if the current video mode
+/// isn't implemented.
+fn render_layers(gba_line: &mut GbaLine, context: RenderContext) -> bool {
+    let dispcnt = context.registers.dispcnt;
+    let (text, affine) = match dispcnt.bg_mode() {
+        BgMode::Mode0 => (0..4, 0..0),
+        BgMode::Mode1 => (0..2, 2..3),
+        BgMode::Mode2 => (0..0, 2..4),
+        BgMode::Mode3 => {
+            mode3::render(gba_line, context);
+            return true;
+        }
+        BgMode::Mode4 => return false,
+        BgMode::Mode5 => return false,
+        BgMode::Invalid6 => return false,
+        BgMode::Invalid7 => return false,
+    };
+
+    for bg in text.filter(|&bg| line::background_enabled(dispcnt, bg)) {
+        text::render(gba_line, bg, context);
+    }
+    for bg in affine.filter(|&bg| line::background_enabled(dispcnt, bg)) {
+        affine::render(gba_line, bg, context);
+    }
+    true
+}
+
+/// The last thing rendered for every visible line.
+struct LineCache {
+    lines: Box<ScreenBuffer>,
+    /// False for lines where something that they depend on changed since they were rendered.
+    valid: [bool; VISIBLE_LINE_COUNT],
+    /// The reference points that every line was rendered with.
+    reference_points: [[ReferencePoint; 2]; VISIBLE_LINE_COUNT],
+}
+
+impl LineCache {
+    fn line_mut(&mut self, line: usize) -> &mut LineBuffer {
+        let start = line * VISIBLE_LINE_WIDTH;
+        (&mut self.lines[start..(start + VISIBLE_LINE_WIDTH)])
+            .try_into()
+            .expect("cached line is not a line")
+    }
+}
+
+impl Default for LineCache {
+    fn default() -> Self {
+        Self {
+            lines: Box::new([0; VISIBLE_PIXELS]),
+            valid: [false; VISIBLE_LINE_COUNT],
+            reference_points: [[ReferencePoint::default(); 2]; VISIBLE_LINE_COUNT],
+        }
+    }
+}
+
+/// Sends a line to `output` in the format that it asked for.
+fn send_line(output: &mut dyn GbaVideoOutput, line: usize, data: &LineBuffer) {
+    match output.pixel_format() {
+        PixelFormat::Rgb555 => output.gba_line_ready(line, data),
+        PixelFormat::Rgb565 => {
+            let mut converted = [0; VISIBLE_LINE_WIDTH];
+            convert_to_rgb565(data, &mut converted);
+            output.gba_line_ready(line, &converted);
+        }
+        PixelFormat::Rgba8888 => {
+            let mut converted = [0; VISIBLE_LINE_WIDTH];
+            convert_to_rgba8888(data, &mut converted);
+            output.gba_rgba_line_ready(line, &converted);
+        }
+    }
+}
+
+/// Where [`GbaVideo`] sends the lines that it renders.
+pub(crate) enum VideoTarget<'a> {
+    /// Lines are rendered straight into their row of the frame buffer.
+    Frame(&'a mut ScreenBuffer),
+    /// Lines are rendered into a temporary buffer and passed to the output one at a time.
+    Lines(&'a mut dyn GbaVideoOutput),
+}
+
 #[derive(Copy, Clone)]
 pub struct HBlankContext<'a> {
     pub palette: &'a Palette,
     pub vram: &'a [u8; VRAM_SIZE],
 }
 
+/// Where an affine background's pixel at the start of a line is in the background, with 8
+/// fractional bits.
+#[derive(Default, Copy, Clone, PartialEq, Eq)]
+pub(crate) struct ReferencePoint {
+    pub(crate) x: i32,
+    pub(crate) y: i32,
+}
+
 #[derive(Copy, Clone)]
 struct RenderContext<'a> {
     pub vram: &'a [u8; VRAM_SIZE],
     pub line: u16,
     pub registers: &'a GbaVideoRegisters,
+    pub tiles: &'a TileCache,
+    pub reference_points: [ReferencePoint; 2],
 }
 
 impl<'a> RenderContext<'a> {
-    pub fn new(line: u16, registers: &'a GbaVideoRegisters, vram: &'a [u8; VRAM_SIZE]) -> Self {
+    pub fn new(
+        line: u16,
+        registers: &'a GbaVideoRegisters,
+        vram: &'a [u8; VRAM_SIZE],
+        tiles: &'a TileCache,
+        reference_points: [ReferencePoint; 2],
+    ) -> Self {
         Self {
             line,
             vram,
             registers,
+            tiles,
+            reference_points,
         }
     }
 }
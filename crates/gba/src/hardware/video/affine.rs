@@ -0,0 +1,53 @@
+use super::{
+    line::{BgPixel8Bpp, GbaLine, Layer, LayerAttrs},
+    tiles::BG_VRAM_SIZE,
+    RenderContext,
+};
+
+/// Renders rotation/scaling background `bg` (BG2 in mode 1, BG2 and BG3 in mode 2) into its
+/// layer. These always use 256 color tiles and one byte map entries.
+pub(super) fn render(line: &mut GbaLine, bg: usize, context: RenderContext) {
+    #[cfg(feature = "puffin")]
+    puffin::profile_function!();
+
+    let layer = Layer::background(bg);
+    let bgcnt = context.registers.bgcnt[bg];
+    line.set_layer_attrs(layer, LayerAttrs::default());
+
+    let affine = context.registers.affine[bg - 2];
+    let reference = context.reference_points[bg - 2];
+    let (dx, dy) = (affine.pa.parameter() as i32, affine.pc.parameter() as i32);
+    let size = 128 << bgcnt.screen_size();
+    let wraparound = bgcnt.display_area_overflow();
+    let char_base = bgcnt.character_base_block() as usize * 0x4000;
+    let screen_base = bgcnt.screen_base_block() as usize * 0x800;
+
+    let (mut x, mut y) = (reference.x, reference.y);
+    for pixel in line.layer_mut(layer).iter_mut() {
+        let (mut tx, mut ty) = (x >> 8, y >> 8);
+        x = x.wrapping_add(dx);
+        y = y.wrapping_add(dy);
+
+        if wraparound {
+            tx &= size - 1;
+            ty &= size - 1;
+        } else if !(0..size).contains(&tx) || !(0..size).contains(&ty) {
+            *pixel = BgPixel8Bpp::new(0).into();
+            continue;
+        }
+        let (tx, ty) = (tx as usize, ty as usize);
+
+        let entry_offset = screen_base + (ty / 8) * (size as usize / 8) + tx / 8;
+        let tile = read(context.vram, entry_offset) as usize;
+        let offset = char_base + tile * 64 + (ty % 8) * 8 + tx % 8;
+        *pixel = BgPixel8Bpp::new(read(context.vram, offset)).into();
+    }
+}
+
+fn read(vram: &[u8], offset: usize) -> u8 {
+    if offset < BG_VRAM_SIZE {
+        vram[offset]
+    } else {
+        0
+    }
+}
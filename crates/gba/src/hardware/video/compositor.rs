@@ -0,0 +1,358 @@
+//! Combines the layers of a line into the final colors.
+//!
+//! Everything in here works on whole lines stored as structure-of-arrays (one array for the
+//! colors of a layer, one for their priorities, ...) and avoids branching on pixel values so
+//! that the loops are vectorized: with SSE2 on x86_64 and NEON on AArch64 by default, and with
+//! AVX2 when the CPU running the emulator supports it. Looking colors up in the palette isn't
+//! part of this since it can't be vectorized, the layers are resolved to colors beforehand.
+
+use super::{LineBuffer, VISIBLE_LINE_WIDTH};
+
+/// Rank of a pixel that is transparent or hidden by a window.
+pub const TRANSPARENT: u8 = 0xFF;
+
+/// Rank of the backdrop, which is behind every layer.
+const BACKDROP_RANK: u8 = 0xFE;
+
+/// Layer IDs, these are also the bits used for each layer by BLDCNT and the window registers.
+pub const LAYER_OBJ: u8 = 4;
+pub const LAYER_BACKDROP: u8 = 5;
+
+/// The bit in a window mask that enables color special effects.
+pub const WINDOW_EFFECTS: u8 = 0x20;
+
+const EFFECT_ALPHA: u8 = 1;
+const EFFECT_BRIGHTEN: u8 = 2;
+const EFFECT_DARKEN: u8 = 3;
+
+/// The layers of a line that were resolved to colors.
+pub struct ResolvedLayers {
+    /// The color of every pixel of each layer, indexed by layer ID.
+    pub colors: [[u16; VISIBLE_LINE_WIDTH]; 5],
+    /// Decides which layer is in front where it's lower. Each layer's pixels are ranked by
+    /// priority and then by layer, with [`TRANSPARENT`] for pixels that aren't drawn.
+    pub ranks: [[u8; VISIBLE_LINE_WIDTH]; 5],
+    /// Nonzero where the OBJ layer's pixel is semi-transparent.
+    pub obj_semi_transparent: [u8; VISIBLE_LINE_WIDTH],
+    /// The layers that are visible at each pixel and [`WINDOW_EFFECTS`], from the windows.
+    pub window: [u8; VISIBLE_LINE_WIDTH],
+    /// Bit N is set if the layer with ID N is enabled and was resolved.
+    pub enabled: u8,
+}
+
+impl Default for ResolvedLayers {
+    fn default() -> Self {
+        Self {
+            colors: [[0; VISIBLE_LINE_WIDTH]; 5],
+            ranks: [[TRANSPARENT; VISIBLE_LINE_WIDTH]; 5],
+            obj_semi_transparent: [0; VISIBLE_LINE_WIDTH],
+            window: [0; VISIBLE_LINE_WIDTH],
+            enabled: 0,
+        }
+    }
+}
+
+/// Color special effects from BLDCNT, BLDALPHA and BLDY.
+#[derive(Clone, Copy, Default)]
+pub struct Effects {
+    pub backdrop: u16,
+    pub effect: u8,
+    pub first_target: u8,
+    pub second_target: u8,
+    pub eva: u16,
+    pub evb: u16,
+    pub evy: u16,
+}
+
+/// Picks the top two pixels of each column and blends them into `output`.
+pub fn compose(layers: &ResolvedLayers, effects: &Effects, output: &mut LineBuffer) {
+    #[cfg(target_arch = "x86_64")]
+    if std::arch::is_x86_feature_detected!("avx2") {
+        // SAFETY: the CPU supports AVX2.
+        unsafe { compose_avx2(layers, effects, output) };
+        return;
+    }
+
+    compose_baseline(layers, effects, output);
+}
+
+#[cfg(target_arch = "x86_64")]
+#[target_feature(enable = "avx2")]
+unsafe fn compose_avx2(layers: &ResolvedLayers, effects: &Effects, output: &mut LineBuffer) {
+    compose_lanes(layers, effects, output);
+}
+
+fn compose_baseline(layers: &ResolvedLayers, effects: &Effects, output: &mut LineBuffer) {
+    compose_lanes(layers, effects, output);
+}
+
+/// Always inlined so that it is compiled with the target features of whichever of
+/// [`compose_avx2`] or [`compose_baseline`] it's called from.
+#[inline(always)]
+fn compose_lanes(layers: &ResolvedLayers, effects: &Effects, output: &mut LineBuffer) {
+    let mut stack = PixelStack::new(effects.backdrop);
+    for layer in 0..5u8 {
+        if layers.enabled & (1 << layer) == 0 {
+            continue;
+        }
+
+        let semi_transparent = if layer == LAYER_OBJ {
+            &layers.obj_semi_transparent
+        } else {
+            &[0; VISIBLE_LINE_WIDTH]
+        };
+        stack.insert(
+            layer,
+            &layers.colors[layer as usize],
+            &layers.ranks[layer as usize],
+            semi_transparent,
+            &layers.window,
+        );
+    }
+    stack.blend(effects, &layers.window, output);
+}
+
+/// The top two pixels of each column.
+struct PixelStack {
+    top_color: [u16; VISIBLE_LINE_WIDTH],
+    top_rank: [u8; VISIBLE_LINE_WIDTH],
+    /// `1 << layer` instead of the layer ID so that checking BLDCNT's targets doesn't need a
+    /// variable shift, which can't be vectorized for bytes.
+    top_layer_bit: [u8; VISIBLE_LINE_WIDTH],
+    top_semi_transparent: [u8; VISIBLE_LINE_WIDTH],
+    bottom_color: [u16; VISIBLE_LINE_WIDTH],
+    bottom_rank: [u8; VISIBLE_LINE_WIDTH],
+    /// Zero when the only thing below the top pixel is the backdrop.
+    bottom_layer_bit: [u8; VISIBLE_LINE_WIDTH],
+}
+
+impl PixelStack {
+    #[inline(always)]
+    fn new(backdrop: u16) -> Self {
+        Self {
+            top_color: [backdrop; VISIBLE_LINE_WIDTH],
+            top_rank: [BACKDROP_RANK; VISIBLE_LINE_WIDTH],
+            top_layer_bit: [1 << LAYER_BACKDROP; VISIBLE_LINE_WIDTH],
+            top_semi_transparent: [0; VISIBLE_LINE_WIDTH],
+            bottom_color: [backdrop; VISIBLE_LINE_WIDTH],
+            bottom_rank: [BACKDROP_RANK; VISIBLE_LINE_WIDTH],
+            bottom_layer_bit: [0; VISIBLE_LINE_WIDTH],
+        }
+    }
+
+    #[inline(always)]
+    fn insert(
+        &mut self,
+        layer: u8,
+        colors: &[u16; VISIBLE_LINE_WIDTH],
+        ranks: &[u8; VISIBLE_LINE_WIDTH],
+        semi_transparent: &[u8; VISIBLE_LINE_WIDTH],
+        window: &[u8; VISIBLE_LINE_WIDTH],
+    ) {
+        let layer_bit = 1 << layer;
+        for x in 0..VISIBLE_LINE_WIDTH {
+            let rank = ranks[x] | mask8(window[x] & layer_bit == 0);
+            let above_top8 = mask8(rank < self.top_rank[x]);
+            let above_bottom8 = mask8(rank < self.bottom_rank[x]);
+            let above_top16 = mask16(rank < self.top_rank[x]);
+            let above_bottom16 = mask16(rank < self.bottom_rank[x]);
+
+            // The old top pixel moves down if the new one is above it.
+            self.bottom_color[x] = select16(
+                above_top16,
+                self.top_color[x],
+                select16(above_bottom16, colors[x], self.bottom_color[x]),
+            );
+            self.bottom_rank[x] = select8(
+                above_top8,
+                self.top_rank[x],
+                select8(above_bottom8, rank, self.bottom_rank[x]),
+            );
+            self.bottom_layer_bit[x] = select8(
+                above_top8,
+                self.top_layer_bit[x],
+                select8(above_bottom8, layer_bit, self.bottom_layer_bit[x]),
+            );
+
+            self.top_color[x] = select16(above_top16, colors[x], self.top_color[x]);
+            self.top_rank[x] = select8(above_top8, rank, self.top_rank[x]);
+            self.top_layer_bit[x] = select8(above_top8, layer_bit, self.top_layer_bit[x]);
+            self.top_semi_transparent[x] = select8(
+                above_top8,
+                semi_transparent[x],
+                self.top_semi_transparent[x],
+            );
+        }
+    }
+
+    #[inline(always)]
+    fn blend(&self, effects: &Effects, window: &[u8; VISIBLE_LINE_WIDTH], output: &mut LineBuffer) {
+        let eva = effects.eva.min(16);
+        let evb = effects.evb.min(16);
+        let evy = effects.evy.min(16);
+        let alpha_effect = effects.effect == EFFECT_ALPHA;
+        let brighten_effect = effects.effect == EFFECT_BRIGHTEN;
+        let darken_effect = effects.effect == EFFECT_DARKEN;
+
+        for x in 0..VISIBLE_LINE_WIDTH {
+            let effects_enabled = window[x] & WINDOW_EFFECTS != 0;
+            let first = effects.first_target & self.top_layer_bit[x] != 0;
+            let second = effects.second_target & self.bottom_layer_bit[x] != 0;
+            let semi_transparent = self.top_semi_transparent[x] != 0;
+
+            // Semi-transparent OBJs are always alpha blended with a second target below them.
+            let alpha = effects_enabled & second & (semi_transparent | (first & alpha_effect));
+            let brightness = effects_enabled & first & !alpha;
+            let alpha = mask16(alpha);
+            let brighten = mask16(brightness & brighten_effect);
+            let darken = mask16(brightness & darken_effect);
+            let unchanged = !(alpha | brighten | darken);
+
+            let top = self.top_color[x];
+            let bottom = self.bottom_color[x];
+            let mut color = 0;
+            for shift in [0, 5, 10] {
+                let a = (top >> shift) & 0x1F;
+                let b = (bottom >> shift) & 0x1F;
+                let blended = ((a * eva + b * evb) >> 4).min(31);
+                let brightened = a + (((31 - a) * evy) >> 4);
+                let darkened = a - ((a * evy) >> 4);
+                let channel = (blended & alpha)
+                    | (brightened & brighten)
+                    | (darkened & darken)
+                    | (a & unchanged);
+                color |= channel << shift;
+            }
+            output[x] = color;
+        }
+    }
+}
+
+// Selecting with masks instead of `if` keeps LLVM from turning the selects into branches,
+// which would stop the loops from being vectorized.
+
+#[inline(always)]
+fn mask8(condition: bool) -> u8 {
+    (condition as u8).wrapping_neg()
+}
+
+#[inline(always)]
+fn mask16(condition: bool) -> u16 {
+    (condition as u16).wrapping_neg()
+}
+
+#[inline(always)]
+fn select8(mask: u8, a: u8, b: u8) -> u8 {
+    (a & mask) | (b & !mask)
+}
+
+#[inline(always)]
+fn select16(mask: u16, a: u16, b: u16) -> u16 {
+    (a & mask) | (b & !mask)
+}
+
+#[cfg(test)]
+mod test {
+    use super::*;
+    use crate::video::rgb5;
+
+    fn single_layer(layer: u8, color: u16, rank: u8) -> ResolvedLayers {
+        let mut layers = ResolvedLayers {
+            enabled: 1 << layer,
+            window: [0x3F; VISIBLE_LINE_WIDTH],
+            ..ResolvedLayers::default()
+        };
+        layers.colors[layer as usize] = [color; VISIBLE_LINE_WIDTH];
+        layers.ranks[layer as usize] = [rank; VISIBLE_LINE_WIDTH];
+        layers
+    }
+
+    #[test]
+    fn test_backdrop_only() {
+        let layers = ResolvedLayers::default();
+        let effects = Effects {
+            backdrop: rgb5(1, 2, 3),
+            ..Effects::default()
+        };
+        let mut output = [0; VISIBLE_LINE_WIDTH];
+        compose(&layers, &effects, &mut output);
+        assert!(output.iter().all(|&pixel| pixel == rgb5(1, 2, 3)));
+    }
+
+    #[test]
+    fn test_priority() {
+        let mut layers = single_layer(0, rgb5(31, 0, 0), 0x11);
+        layers.enabled |= 1 << 1;
+        layers.colors[1] = [rgb5(0, 31, 0); VISIBLE_LINE_WIDTH];
+        // BG1 is in front of BG0 on the left half of the line.
+        for x in 0..VISIBLE_LINE_WIDTH {
+            layers.ranks[1][x] = if x < 120 { 0x02 } else { 0x1A };
+        }
+        // BG1 is hidden by the window at one pixel and BG0 is transparent at another.
+        layers.window[110] = 0x3F & !0x2;
+        layers.ranks[0][200] = TRANSPARENT;
+
+        let mut output = [0; VISIBLE_LINE_WIDTH];
+        compose(&layers, &Effects::default(), &mut output);
+        assert_eq!(output[0], rgb5(0, 31, 0));
+        assert_eq!(output[110], rgb5(31, 0, 0));
+        assert_eq!(output[199], rgb5(31, 0, 0));
+        assert_eq!(output[200], rgb5(0, 31, 0));
+    }
+
+    #[test]
+    fn test_alpha_blend() {
+        let mut layers = single_layer(0, rgb5(31, 0, 16), 0x01);
+        layers.window[0] &= !WINDOW_EFFECTS;
+        let effects = Effects {
+            backdrop: rgb5(0, 31, 16),
+            effect: EFFECT_ALPHA,
+            first_target: 1 << 0,
+            second_target: 1 << LAYER_BACKDROP,
+            eva: 8,
+            evb: 8,
+            ..Effects::default()
+        };
+        let mut output = [0; VISIBLE_LINE_WIDTH];
+        compose(&layers, &effects, &mut output);
+        assert_eq!(output[0], rgb5(31, 0, 16));
+        assert_eq!(output[1], rgb5(15, 15, 16));
+    }
+
+    #[test]
+    fn test_semi_transparent_obj() {
+        let mut layers = single_layer(LAYER_OBJ, rgb5(16, 16, 16), 0x00);
+        layers.obj_semi_transparent[1] = 1;
+        let effects = Effects {
+            backdrop: rgb5(16, 0, 0),
+            effect: EFFECT_DARKEN,
+            first_target: 1 << LAYER_OBJ,
+            second_target: 1 << LAYER_BACKDROP,
+            eva: 16,
+            evb: 16,
+            evy: 16,
+        };
+        let mut output = [0; VISIBLE_LINE_WIDTH];
+        compose(&layers, &effects, &mut output);
+        assert_eq!(output[0], 0);
+        assert_eq!(output[1], rgb5(31, 16, 16));
+    }
+
+    #[test]
+    fn test_brightness() {
+        let layers = single_layer(2, rgb5(0, 16, 31), 0x03);
+        let mut effects = Effects {
+            effect: EFFECT_BRIGHTEN,
+            first_target: 1 << 2,
+            evy: 8,
+            ..Effects::default()
+        };
+        let mut output = [0; VISIBLE_LINE_WIDTH];
+        compose(&layers, &effects, &mut output);
+        assert_eq!(output[0], rgb5(15, 23, 31));
+
+        effects.effect = EFFECT_DARKEN;
+        compose(&layers, &effects, &mut output);
+        assert_eq!(output[0], rgb5(0, 8, 16));
+    }
+}
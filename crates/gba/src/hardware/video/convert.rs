@@ -0,0 +1,104 @@
+//! Conversion from the GBA's 15-bit colors to the formats that frames are usually displayed or
+//! encoded in.
+
+use super::VISIBLE_LINE_WIDTH;
+
+/// The formats that rendered pixels can be sent to a [`crate::GbaVideoOutput`] in.
+#[derive(Copy, Clone, PartialEq, Eq, Debug, Default)]
+pub enum PixelFormat {
+    /// The GBA's own format: 5 bits each of red, green and blue starting from the lowest bit.
+    #[default]
+    Rgb555,
+    /// 5 bits of blue, 6 bits of green and 5 bits of red starting from the lowest bit.
+    Rgb565,
+    /// 8 bits each of red, green, blue and alpha in that order in memory.
+    Rgba8888,
+}
+
+pub type RgbaLineBuffer = [u32; VISIBLE_LINE_WIDTH];
+
+/// Every RGB555 color converted to RGBA8888. The top bit of a color isn't used and is ignored.
+static RGBA8888: [u32; 0x8000] = rgba8888_table();
+
+const fn rgba8888_table() -> [u32; 0x8000] {
+    let mut table = [0; 0x8000];
+    let mut color = 0;
+    while color < table.len() {
+        let [r, g, b] = expand_rgb555(color as u16);
+        table[color] = u32::from_le_bytes([r, g, b, 0xFF]);
+        color += 1;
+    }
+    table
+}
+
+/// Widens each 5-bit channel to 8 bits so that 0x1F becomes 0xFF.
+const fn expand_rgb555(color: u16) -> [u8; 3] {
+    let r = (color & 0x1F) as u8;
+    let g = ((color >> 5) & 0x1F) as u8;
+    let b = ((color >> 10) & 0x1F) as u8;
+    [
+        (r << 3) | (r >> 2),
+        (g << 3) | (g >> 2),
+        (b << 3) | (b >> 2),
+    ]
+}
+
+#[inline]
+pub fn to_rgba8888(color: u16) -> u32 {
+    RGBA8888[(color & 0x7FFF) as usize]
+}
+
+#[inline]
+pub const fn to_rgb565(color: u16) -> u16 {
+    let r = color & 0x1F;
+    let g = (color >> 5) & 0x1F;
+    let b = (color >> 10) & 0x1F;
+    (r << 11) | (((g << 1) | (g >> 4)) << 5) | b
+}
+
+/// Converts every RGB555 color in `colors` to RGBA8888. Both slices must be the same length.
+pub fn convert_to_rgba8888(colors: &[u16], output: &mut [u32]) {
+    assert_eq!(colors.len(), output.len());
+    for (output, &color) in output.iter_mut().zip(colors) {
+        *output = to_rgba8888(color);
+    }
+}
+
+/// Converts every RGB555 color in `colors` to RGB565. Both slices must be the same length.
+pub fn convert_to_rgb565(colors: &[u16], output: &mut [u16]) {
+    assert_eq!(colors.len(), output.len());
+    for (output, &color) in output.iter_mut().zip(colors) {
+        *output = to_rgb565(color);
+    }
+}
+
+#[cfg(test)]
+mod test {
+    use crate::video::rgb5;
+
+    use super::{to_rgb565, to_rgba8888};
+
+    #[test]
+    fn test_rgba8888() {
+        assert_eq!(to_rgba8888(0), 0xFF000000);
+        assert_eq!(to_rgba8888(0x7FFF), 0xFFFFFFFF);
+        assert_eq!(to_rgba8888(0xFFFF), 0xFFFFFFFF);
+        assert_eq!(
+            to_rgba8888(rgb5(0x1F, 0, 0)).to_le_bytes(),
+            [0xFF, 0, 0, 0xFF]
+        );
+        assert_eq!(
+            to_rgba8888(rgb5(0x10, 0x01, 0x08)).to_le_bytes(),
+            [0x84, 0x08, 0x42, 0xFF]
+        );
+    }
+
+    #[test]
+    fn test_rgb565() {
+        assert_eq!(to_rgb565(0), 0);
+        assert_eq!(to_rgb565(0x7FFF), 0xFFFF);
+        assert_eq!(to_rgb565(rgb5(0x1F, 0, 0)), 0xF800);
+        assert_eq!(to_rgb565(rgb5(0, 0x1F, 0)), 0x07E0);
+        assert_eq!(to_rgb565(rgb5(0, 0, 0x1F)), 0x001F);
+    }
+}
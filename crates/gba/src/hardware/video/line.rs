@@ -2,13 +2,16 @@ use util::bits::BitOps;
 
 use crate::{hardware::palette::Palette, memory::VRAM_SIZE};
 
-use super::{registers::GbaVideoRegisters, HBlankContext, VISIBLE_LINE_WIDTH};
+use super::{
+    compositor::{self, Effects, ResolvedLayers, LAYER_OBJ, TRANSPARENT},
+    registers::{BgMode, GbaVideoRegisters, RegDispcnt},
+    HBlankContext, LineBuffer, VISIBLE_LINE_COUNT, VISIBLE_LINE_WIDTH,
+};
 
 #[derive(Default)]
 pub struct GbaLine {
     layers: [LayerLine; 5],
     objwin: LineBits,
-    layer_attrs: [LayerAttrs; 5],
 }
 
 impl GbaLine {
@@ -16,17 +19,129 @@ impl GbaLine {
         self.layers[layer as usize].pixels[x] = pixel.into();
     }
 
-    pub fn blend(&mut self, output: &mut [u16; VISIBLE_LINE_WIDTH], context: BlendContext) {
+    pub(crate) fn layer_mut(&mut self, layer: Layer) -> &mut [Pixel; VISIBLE_LINE_WIDTH] {
+        &mut self.layers[layer as usize].pixels
+    }
+
+    pub(crate) fn set_layer_attrs(&mut self, layer: Layer, attrs: LayerAttrs) {
+        self.layers[layer as usize].attrs = attrs;
+    }
+
+    /// Resolves the pixels of every enabled layer to colors and combines them using the
+    /// priorities, windows and color special effects from the registers.
+    pub fn blend(&mut self, output: &mut LineBuffer, context: BlendContext) {
         #[cfg(feature = "puffin")]
         puffin::profile_function!();
 
-        for (x, output) in output.iter_mut().enumerate() {
-            let pixel = self.layers[2].pixels[x];
-            *output = pixel.value;
+        let registers = context.registers;
+        let dispcnt = registers.dispcnt;
+        if dispcnt.forced_blank() {
+            output.fill(0x7FFF);
+            return;
+        }
+
+        let mut layers = ResolvedLayers::default();
+        self.window_mask(registers, &mut layers.window);
+        for bg in 0..4 {
+            if !background_enabled(dispcnt, bg) {
+                continue;
+            }
+            // Lower priorities are in front and BG0 is in front of BG3 when they're the same.
+            let rank = ((registers.bgcnt[bg].priority() as u8) << 3) | (bg as u8 + 1);
+            self.layers[bg].resolve_bg(
+                rank,
+                context.palette,
+                &mut layers.colors[bg],
+                &mut layers.ranks[bg],
+            );
+            layers.enabled |= 1 << bg;
+        }
+        if dispcnt.screen_display_obj() {
+            let obj = LAYER_OBJ as usize;
+            self.layers[obj].resolve_obj(
+                context.palette,
+                &mut layers.colors[obj],
+                &mut layers.ranks[obj],
+                &mut layers.obj_semi_transparent,
+            );
+            layers.enabled |= 1 << LAYER_OBJ;
+        }
+
+        let effects = Effects {
+            backdrop: context.palette.get_bg256(0) & 0x7FFF,
+            effect: registers.bldcnt.effect(),
+            first_target: registers.bldcnt.first_target(),
+            second_target: registers.bldcnt.second_target(),
+            eva: registers.bldalpha.eva(),
+            evb: registers.bldalpha.evb(),
+            evy: registers.bldy.evy(),
+        };
+        compositor::compose(&layers, &effects, output);
+    }
+
+    /// Sets the bits of the layers that are visible at each pixel of the current line and
+    /// whether color special effects are enabled there.
+    fn window_mask(&self, registers: &GbaVideoRegisters, window: &mut [u8; VISIBLE_LINE_WIDTH]) {
+        let dispcnt = registers.dispcnt;
+        if !(dispcnt.window0_display() || dispcnt.window1_display() || dispcnt.obj_window_display())
+        {
+            window.fill(0x3F);
+            return;
+        }
+
+        window.fill(registers.winout.outside());
+        if dispcnt.obj_window_display() {
+            let inside = registers.winout.obj_window();
+            for (x, mask) in window.iter_mut().enumerate() {
+                if self.objwin.get(x) {
+                    *mask = inside;
+                }
+            }
+        }
+
+        // Window 0 has priority over window 1 so it's applied last.
+        let line = registers.vcount.current_scanline();
+        let windows = [
+            (
+                dispcnt.window1_display(),
+                registers.win1h,
+                registers.win1v,
+                registers.winin.window1(),
+            ),
+            (
+                dispcnt.window0_display(),
+                registers.win0h,
+                registers.win0v,
+                registers.winin.window0(),
+            ),
+        ];
+        for (enabled, horizontal, vertical, inside) in windows {
+            if enabled && vertical.range(VISIBLE_LINE_COUNT as u16).contains(&line) {
+                let range = horizontal.range(VISIBLE_LINE_WIDTH as u16);
+                window[range.start as usize..range.end as usize].fill(inside);
+            }
         }
     }
 }
 
+/// Returns true if background `bg` is enabled and exists in the current video mode.
+pub(super) fn background_enabled(dispcnt: RegDispcnt, bg: usize) -> bool {
+    let in_mode = match dispcnt.bg_mode() {
+        BgMode::Mode0 => true,
+        BgMode::Mode1 => bg <= 2,
+        BgMode::Mode2 => bg >= 2,
+        BgMode::Mode3 | BgMode::Mode4 | BgMode::Mode5 => bg == 2,
+        BgMode::Invalid6 | BgMode::Invalid7 => false,
+    };
+    let displayed = match bg {
+        0 => dispcnt.screen_display_bg0(),
+        1 => dispcnt.screen_display_bg1(),
+        2 => dispcnt.screen_display_bg2(),
+        _ => dispcnt.screen_display_bg3(),
+    };
+    in_mode && displayed
+}
+
 #[derive(Clone, Copy)]
 pub struct BlendContext<'a> {
     pub registers: &'a GbaVideoRegisters,
@@ -52,6 +167,7 @@ impl<'a> BlendContext<'a> {
     }
 }
 
+#[derive(Copy, Clone)]
 pub enum Layer {
     Bg0 = 0,
     Bg1 = 1,
@@ -60,11 +176,77 @@ pub enum Layer {
     Obj = 4,
 }
 
+impl Layer {
+    pub fn background(bg: usize) -> Self {
+        match bg {
+            0 => Layer::Bg0,
+            1 => Layer::Bg1,
+            2 => Layer::Bg2,
+            _ => Layer::Bg3,
+        }
+    }
+}
+
 struct LayerLine {
     attrs: LayerAttrs,
     pixels: [Pixel; VISIBLE_LINE_WIDTH],
 }
 
+impl LayerLine {
+    fn resolve_bg(
+        &self,
+        rank: u8,
+        palette: &Palette,
+        colors: &mut [u16; VISIBLE_LINE_WIDTH],
+        ranks: &mut [u8; VISIBLE_LINE_WIDTH],
+    ) {
+        if self.attrs.is_bitmap() {
+            for (color, pixel) in colors.iter_mut().zip(&self.pixels) {
+                *color = pixel.value & 0x7FFF;
+            }
+            ranks.fill(rank);
+            return;
+        }
+
+        // Entry 0 of every palette is transparent.
+        let entry_mask = if self.attrs.is_4bpp() { 0xF } else { 0xFF };
+        for ((color, rank_out), pixel) in colors.iter_mut().zip(ranks.iter_mut()).zip(&self.pixels)
+        {
+            let pixel = pixel.value;
+            *color = palette.get_bg256(pixel as u8) & 0x7FFF;
+            *rank_out = if pixel & entry_mask != 0 {
+                rank
+            } else {
+                TRANSPARENT
+            };
+        }
+    }
+
+    fn resolve_obj(
+        &self,
+        palette: &Palette,
+        colors: &mut [u16; VISIBLE_LINE_WIDTH],
+        ranks: &mut [u8; VISIBLE_LINE_WIDTH],
+        semi_transparent: &mut [u8; VISIBLE_LINE_WIDTH],
+    ) {
+        for x in 0..VISIBLE_LINE_WIDTH {
+            let pixel = self.pixels[x].value;
+            let attrs = PixelAttrs { value: pixel as u8 };
+            let entry = (pixel >> 8) as u8;
+            let entry_mask = if attrs.is_4bpp() { 0xF } else { 0xFF };
+
+            colors[x] = palette.get_obj256(entry) & 0x7FFF;
+            // OBJs are in front of backgrounds with the same priority.
+            ranks[x] = if entry & entry_mask != 0 {
+                (attrs.priority() as u8) << 3
+            } else {
+                TRANSPARENT
+            };
+            semi_transparent[x] = attrs.is_semi_transparent() as u8;
+        }
+    }
+}
+
 impl Default for LayerLine {
     fn default() -> Self {
         Self {
@@ -140,6 +322,12 @@ impl BgPixel8Bpp {
     }
 }
 
+impl From<BgPixel8Bpp> for Pixel {
+    fn from(value: BgPixel8Bpp) -> Self {
+        Self { value: value.0 }
+    }
+}
+
 impl From<Pixel> for BgPixel8Bpp {
     fn from(pixel: Pixel) -> Self {
         Self(pixel.value)
@@ -155,6 +343,12 @@ impl BgPixel4Bpp {
     }
 }
 
+impl From<BgPixel4Bpp> for Pixel {
+    fn from(value: BgPixel4Bpp) -> Self {
+        Self { value: value.0 }
+    }
+}
+
 impl From<Pixel> for BgPixel4Bpp {
     fn from(pixel: Pixel) -> Self {
         Self(pixel.value)
@@ -265,14 +459,7 @@ struct LineBits {
 }
 
 impl LineBits {
-    const fn ones() -> Self {
-        LineBits { inner: [0xFF; 30] }
-    }
-
-    const fn zeroes() -> Self {
-        LineBits { inner: [0x00; 30] }
-    }
-
+    #[allow(dead_code)]
     fn put(&mut self, index: usize, value: bool) {
         if index < 240 {
             self.inner[index / 8] |= (value as u8) << (index % 8);
@@ -287,40 +474,3 @@ impl LineBits {
         }
     }
 }
-
-#[derive(Copy, Clone)]
-struct WindowMask {
-    visible: LineBits,
-    effects: LineBits,
-}
-
-impl WindowMask {
-    fn new_all_enabled() -> Self {
-        WindowMask {
-            visible: LineBits::ones(),
-            effects: LineBits::ones(),
-        }
-    }
-
-    fn new_all_disabled() -> Self {
-        WindowMask {
-            visible: LineBits::zeroes(),
-            effects: LineBits::zeroes(),
-        }
-    }
-
-    fn set_visible(&mut self, x: usize, visible: bool, effects: bool) {
-        if x < 240 {
-            self.visible.put(x, visible);
-            self.effects.put(x, effects);
-        }
-    }
-
-    fn visible(&self, x: usize) -> bool {
-        self.visible.get(x)
-    }
-
-    fn effects(&self, x: usize) -> bool {
-        self.effects.get(x)
-    }
-}
@@ -3,7 +3,7 @@ use byteorder::{ByteOrder, LittleEndian};
 use crate::memory::VRAM_SIZE;
 
 use super::{
-    line::{GbaLine, Layer, Pixel},
+    line::{GbaLine, Layer, LayerAttrs, Pixel},
     RenderContext, VISIBLE_LINE_WIDTH,
 };
 
@@ -12,6 +12,10 @@ pub(super) fn render(line: &mut GbaLine, context: RenderContext) {
     puffin::profile_function!();
 
     assert!(context.line < 160);
+    let mut attrs = LayerAttrs::default();
+    attrs.set_bitmap();
+    line.set_layer_attrs(Layer::Bg2, attrs);
+
     let frame_buffer = Mode3FrameBuffer::new(context.vram);
     for x in 0..VISIBLE_LINE_WIDTH {
         line.put(Layer::Bg2, x, frame_buffer.get_pixel(context.line, x));
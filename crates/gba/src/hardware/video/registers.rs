@@ -1,11 +1,27 @@
+use std::ops::Range;
+
 use pyrite_derive::IoRegister;
 
-#[derive(Default)]
+#[derive(Default, Clone)]
 pub struct GbaVideoRegisters {
     pub(crate) dispcnt: RegDispcnt,
     pub(crate) green_swap: RegGreenSwap,
     pub(crate) dispstat: RegDispstat,
     pub(crate) vcount: RegVcount,
+    pub(crate) bgcnt: [RegBgcnt; 4],
+    pub(crate) bghofs: [RegBgOffset; 4],
+    pub(crate) bgvofs: [RegBgOffset; 4],
+    /// Rotation and scaling for BG2 and BG3.
+    pub(crate) affine: [BgAffineRegisters; 2],
+    pub(crate) win0h: RegWindowDimension,
+    pub(crate) win1h: RegWindowDimension,
+    pub(crate) win0v: RegWindowDimension,
+    pub(crate) win1v: RegWindowDimension,
+    pub(crate) winin: RegWinin,
+    pub(crate) winout: RegWinout,
+    pub(crate) bldcnt: RegBldcnt,
+    pub(crate) bldalpha: RegBldalpha,
+    pub(crate) bldy: RegBldy,
 }
 
 /// 4000000h - DISPCNT - LCD Control (Read/Write)
@@ -61,8 +77,8 @@ pub struct RegDispcnt {
 #[field(hblank_flag: readonly<bool> = 1)]
 #[field(v_counter_flag: readonly<bool> = 2)]
 #[field(vblank_irq_enable: bool = 3)]
-#[field(hblank_irq_enable: bool = 3)]
-#[field(v_counter_irq_enable: bool = 3)]
+#[field(hblank_irq_enable: bool = 4)]
+#[field(v_counter_irq_enable: bool = 5)]
 #[field(v_count_setting: u16 = 8..=15)]
 pub struct RegDispstat {
     value: u16,
@@ -99,6 +115,233 @@ pub struct RegGreenSwap {
     value: u16,
 }
 
+/// 4000008h - BG0CNT - BG0 Control (R/W) (BG Modes 0,1 only)
+/// 400000Ah - BG1CNT - BG1 Control (R/W) (BG Modes 0,1 only)
+/// 400000Ch - BG2CNT - BG2 Control (R/W) (BG Modes 0,1,2 only)
+/// 400000Eh - BG3CNT - BG3 Control (R/W) (BG Modes 0,2 only)
+///   Bit   Expl.
+///   0-1   BG Priority           (0-3, 0=Highest)
+///   2-3   Character Base Block  (0-3, in units of 16 KBytes) (=BG Tile Data)
+///   4-5   Not used (must be zero) (except in NDS mode: MSBs of char base)
+///   6     Mosaic                (0=Disable, 1=Enable)
+///   7     Colors/Palettes       (0=16/16, 1=256/1)
+///   8-12  Screen Base Block     (0-31, in units of 2 KBytes) (=BG Map Data)
+///   13    BG0/BG1: Not used (except in NDS mode: Ext Palette Slot for BG0/BG1)
+///   13    BG2/BG3: Display Area Overflow (0=Transparent, 1=Wraparound)
+///   14-15 Screen Size (0-3)
+#[derive(IoRegister, Copy, Clone)]
+#[field(priority: u16 = 0..=1)]
+#[field(character_base_block: u16 = 2..=3)]
+#[field(mosaic: bool = 6)]
+#[field(palette_256: bool = 7)]
+#[field(screen_base_block: u16 = 8..=12)]
+#[field(display_area_overflow: bool = 13)]
+#[field(screen_size: u16 = 14..=15)]
+pub struct RegBgcnt {
+    value: u16,
+}
+
+/// 4000010h - BG0HOFS - BG0 X-Offset (W)
+/// 4000012h - BG0VOFS - BG0 Y-Offset (W)
+/// 4000014h - BG1HOFS - BG1 X-Offset (W)
+/// 4000016h - BG1VOFS - BG1 Y-Offset (W)
+/// 4000018h - BG2HOFS - BG2 X-Offset (W)
+/// 400001Ah - BG2VOFS - BG2 Y-Offset (W)
+/// 400001Ch - BG3HOFS - BG3 X-Offset (W)
+/// 400001Eh - BG3VOFS - BG3 Y-Offset (W)
+///   Bit   Expl.
+///   0-8   Offset (0-511)
+///   9-15  Not used
+/// Specifies the coordinate of the upperleft first visible dot of BG0-3 background layer,
+/// ie. used to scroll the BG0-3 area. Only used in text mode.
+#[derive(IoRegister, Copy, Clone)]
+#[field(offset: writeonly<u16> = 0..=8)]
+pub struct RegBgOffset {
+    value: u16,
+}
+
+/// The rotation/scaling parameters and the reference point of BG2 or BG3.
+#[derive(Default, Copy, Clone)]
+pub struct BgAffineRegisters {
+    pub(crate) pa: RegBgAffineParameter,
+    pub(crate) pb: RegBgAffineParameter,
+    pub(crate) pc: RegBgAffineParameter,
+    pub(crate) pd: RegBgAffineParameter,
+    pub(crate) x: RegBgReferencePoint,
+    pub(crate) y: RegBgReferencePoint,
+}
+
+/// 4000020h - BG2PA - BG2 Rotation/Scaling Parameter A (alias dx) (W)
+/// 4000022h - BG2PB - BG2 Rotation/Scaling Parameter B (alias dmx) (W)
+/// 4000024h - BG2PC - BG2 Rotation/Scaling Parameter C (alias dy) (W)
+/// 4000026h - BG2PD - BG2 Rotation/Scaling Parameter D (alias dmy) (W)
+/// 4000030h - BG3PA - BG3 Rotation/Scaling Parameter A (alias dx) (W)
+/// 4000032h - BG3PB - BG3 Rotation/Scaling Parameter B (alias dmx) (W)
+/// 4000034h - BG3PC - BG3 Rotation/Scaling Parameter C (alias dy) (W)
+/// 4000036h - BG3PD - BG3 Rotation/Scaling Parameter D (alias dmy) (W)
+///   Bit   Expl.
+///   0-7   Fractional portion (8 bits)
+///   8-14  Integer portion    (7 bits)
+///   15    Sign               (1 bit)
+#[derive(IoRegister, Copy, Clone)]
+#[field(parameter: writeonly<i16> = 0..=15)]
+pub struct RegBgAffineParameter {
+    value: u16,
+}
+
+/// 4000028h - BG2X_L - BG2 Reference Point X-Coordinate, lower 16 bit (W)
+/// 400002Ah - BG2X_H - BG2 Reference Point X-Coordinate, upper 12 bit (W)
+/// 400002Ch - BG2Y_L - BG2 Reference Point Y-Coordinate, lower 16 bit (W)
+/// 400002Eh - BG2Y_H - BG2 Reference Point Y-Coordinate, upper 12 bit (W)
+/// 4000038h - BG3X_L - BG3 Reference Point X-Coordinate, lower 16 bit (W)
+/// 400003Ah - BG3X_H - BG3 Reference Point X-Coordinate, upper 12 bit (W)
+/// 400003Ch - BG3Y_L - BG3 Reference Point Y-Coordinate, lower 16 bit (W)
+/// 400003Eh - BG3Y_H - BG3 Reference Point Y-Coordinate, upper 12 bit (W)
+///   Bit   Expl.
+///   0-7   Fractional portion (8 bits)
+///   8-26  Integer portion    (19 bits)
+///   27    Sign               (1 bit)
+///   28-31 Not used
+/// Writing to these registers also sets the internal reference point that is used for the
+/// current frame, which is otherwise only reloaded at the start of V-Blank.
+#[derive(IoRegister, Copy, Clone)]
+#[field(point: writeonly<u32> = 0..=27)]
+pub struct RegBgReferencePoint {
+    value: u32,
+}
+
+impl RegBgReferencePoint {
+    /// The reference point with 8 fractional bits.
+    pub fn signed(self) -> i32 {
+        ((self.point() << 4) as i32) >> 4
+    }
+
+    /// Writes the lower (`high` = false) or upper 16 bits of the register.
+    pub fn write_half(&mut self, high: bool, value: u16) {
+        let mut point = self.point();
+        if high {
+            point = (point & 0xFFFF) | ((value as u32 & 0xFFF) << 16);
+        } else {
+            point = (point & !0xFFFF) | value as u32;
+        }
+        self.set_point(point);
+    }
+}
+
+/// 4000040h - WIN0H - Window 0 Horizontal Dimensions (W)
+/// 4000042h - WIN1H - Window 1 Horizontal Dimensions (W)
+/// 4000044h - WIN0V - Window 0 Vertical Dimensions (W)
+/// 4000046h - WIN1V - Window 1 Vertical Dimensions (W)
+///   Bit   Expl.
+///   0-7   X2/Y2, Rightmost/Bottom-most coordinate of window, plus 1
+///   8-15  X1/Y1, Leftmost/Top-most coordinate of window
+/// Garbage values of X2>240 or X1>X2 are interpreted as X2=240.
+/// Garbage values of Y2>160 or Y1>Y2 are interpreted as Y2=160.
+#[derive(IoRegister, Copy, Clone)]
+#[field(end: writeonly<u16> = 0..=7)]
+#[field(start: writeonly<u16> = 8..=15)]
+pub struct RegWindowDimension {
+    value: u16,
+}
+
+impl RegWindowDimension {
+    /// The coordinates covered by the window where `limit` is the width or height of the
+    /// screen.
+    pub fn range(self, limit: u16) -> Range<u16> {
+        let start = self.start();
+        let mut end = self.end();
+        if end > limit || start > end {
+            end = limit;
+        }
+        start.min(limit)..end
+    }
+}
+
+/// 4000048h - WININ - Control of Inside of Window(s) (R/W)
+///   Bit   Expl.
+///   0-3   Window 0 BG0-BG3 Enable Bits     (0=No Display, 1=Display)
+///   4     Window 0 OBJ Enable Bit          (0=No Display, 1=Display)
+///   5     Window 0 Color Special Effect    (0=Disable, 1=Enable)
+///   6-7   Not used
+///   8-11  Window 1 BG0-BG3 Enable Bits     (0=No Display, 1=Display)
+///   12    Window 1 OBJ Enable Bit          (0=No Display, 1=Display)
+///   13    Window 1 Color Special Effect    (0=Disable, 1=Enable)
+///   14-15 Not used
+#[derive(IoRegister, Copy, Clone)]
+#[field(window0: u8 = 0..=5)]
+#[field(window1: u8 = 8..=13)]
+pub struct RegWinin {
+    value: u16,
+}
+
+/// 400004Ah - WINOUT - Control of Outside of Windows & Inside of OBJ Window (R/W)
+///   Bit   Expl.
+///   0-3   Outside BG0-BG3 Enable Bits      (0=No Display, 1=Display)
+///   4     Outside OBJ Enable Bit           (0=No Display, 1=Display)
+///   5     Outside Color Special Effect     (0=Disable, 1=Enable)
+///   6-7   Not used
+///   8-11  OBJ Window BG0-BG3 Enable Bits   (0=No Display, 1=Display)
+///   12    OBJ Window OBJ Enable Bit        (0=No Display, 1=Display)
+///   13    OBJ Window Color Special Effect  (0=Disable, 1=Enable)
+///   14-15 Not used
+#[derive(IoRegister, Copy, Clone)]
+#[field(outside: u8 = 0..=5)]
+#[field(obj_window: u8 = 8..=13)]
+pub struct RegWinout {
+    value: u16,
+}
+
+/// 4000050h - BLDCNT - Color Special Effects Selection (R/W)
+///   Bit   Expl.
+///   0     BG0 1st Target Pixel (Background 0)
+///   1     BG1 1st Target Pixel (Background 1)
+///   2     BG2 1st Target Pixel (Background 2)
+///   3     BG3 1st Target Pixel (Background 3)
+///   4     OBJ 1st Target Pixel (Top-most OBJ pixel)
+///   5     BD  1st Target Pixel (Backdrop)
+///   6-7   Color Special Effect (0-3, see below)
+///          0 = None                (Special effects disabled)
+///          1 = Alpha Blending      (1st+2nd Target mixed)
+///          2 = Brightness Increase (1st Target becomes whiter)
+///          3 = Brightness Decrease (1st Target becomes blacker)
+///   8     BG0 2nd Target Pixel (Background 0)
+///   9     BG1 2nd Target Pixel (Background 1)
+///   10    BG2 2nd Target Pixel (Background 2)
+///   11    BG3 2nd Target Pixel (Background 3)
+///   12    OBJ 2nd Target Pixel (Top-most OBJ pixel)
+///   13    BD  2nd Target Pixel (Backdrop)
+///   14-15 Not used
+#[derive(IoRegister, Copy, Clone)]
+#[field(first_target: u8 = 0..=5)]
+#[field(effect: u8 = 6..=7)]
+#[field(second_target: u8 = 8..=13)]
+pub struct RegBldcnt {
+    value: u16,
+}
+
+/// 4000052h - BLDALPHA - Alpha Blending Coefficients (R/W)
+///   Bit   Expl.
+///   0-4   EVA Coefficient (1st Target) (0..16 = 0/16..16/16, 17..31=16/16)
+///   5-7   Not used
+///   8-12  EVB Coefficient (2nd Target) (0..16 = 0/16..16/16, 17..31=16/16)
+///   13-15 Not used
+#[derive(IoRegister, Copy, Clone)]
+#[field(eva: u16 = 0..=4)]
+#[field(evb: u16 = 8..=12)]
+pub struct RegBldalpha {
+    value: u16,
+}
+
+/// 4000054h - BLDY - Brightness (Fade-In/Out) Coefficient (W)
+///   Bit   Expl.
+///   0-4   EVY Coefficient (Brightness) (0..16 = 0/16..16/16, 17..31=16/16)
+///   5-31  Not used
+#[derive(IoRegister, Copy, Clone)]
+#[field(evy: writeonly<u16> = 0..=4)]
+pub struct RegBldy {
+    value: u16,
+}
+
 #[derive(Copy, Clone, PartialEq, Eq)]
 pub enum BgMode {
     Mode0,
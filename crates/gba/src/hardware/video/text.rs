@@ -0,0 +1,104 @@
+use util::bits::BitOps;
+
+use super::{
+    line::{BgPixel4Bpp, BgPixel8Bpp, GbaLine, Layer, LayerAttrs, Pixel},
+    tiles::{TileRow, BG_VRAM_SIZE},
+    RenderContext, VISIBLE_LINE_WIDTH,
+};
+
+/// Renders text background `bg` (modes 0 and 1) into its layer.
+///
+/// The line is drawn one tile at a time starting with the tile under its first pixel so that
+/// the map entry for every 8 pixels is only looked up once.
+pub(super) fn render(line: &mut GbaLine, bg: usize, context: RenderContext) {
+    #[cfg(feature = "puffin")]
+    puffin::profile_function!();
+
+    let layer = Layer::background(bg);
+    let bgcnt = context.registers.bgcnt[bg];
+    let palette_256 = bgcnt.palette_256();
+    let mut attrs = LayerAttrs::default();
+    if palette_256 {
+        attrs.set_8bpp();
+    } else {
+        attrs.set_4bpp();
+    }
+    line.set_layer_attrs(layer, attrs);
+
+    let (width, height) = match bgcnt.screen_size() {
+        0 => (256, 256),
+        1 => (512, 256),
+        2 => (256, 512),
+        _ => (512, 512),
+    };
+    let x = context.registers.bghofs[bg].offset() as usize;
+    let y = (context.line as usize + context.registers.bgvofs[bg].offset() as usize) % height;
+    let char_base = bgcnt.character_base_block() as usize * 0x4000;
+    let screen_base = bgcnt.screen_base_block() as usize * 0x800;
+
+    // Maps bigger than 256x256 are made of 32x32 tile screen blocks with the one on the right
+    // directly after the one on the left.
+    let map_row = screen_base + (y / 256) * (width / 256) * 0x800 + ((y % 256) / 8) * 64;
+    let tile_row = y % 8;
+
+    let mut span = [Pixel::default(); VISIBLE_LINE_WIDTH + 8];
+    for (column, pixels) in span.chunks_exact_mut(8).enumerate() {
+        let map_x = (x / 8 + column) % (width / 8);
+        let entry_offset = map_row + (map_x / 32) * 0x800 + (map_x % 32) * 2;
+        let entry = map_entry(context.vram, entry_offset);
+
+        let tile = entry.get_bit_range(0..=9) as usize;
+        let row = if entry.get_bit(11) {
+            7 - tile_row
+        } else {
+            tile_row
+        };
+        let hflip = entry.get_bit(10);
+
+        if palette_256 {
+            let offset = char_base + tile * 64 + row * 8;
+            let data = if offset < BG_VRAM_SIZE {
+                context.vram[offset..(offset + 8)].try_into().unwrap()
+            } else {
+                [0; 8]
+            };
+            put_row(pixels, &data, hflip, |entry| BgPixel8Bpp::new(entry).into());
+        } else {
+            let offset = char_base + tile * 32;
+            let palette = entry.get_bit_range(12..=15) as u8;
+            let data = if offset < BG_VRAM_SIZE {
+                *context.tiles.row_4bpp(offset, row)
+            } else {
+                [0; 8]
+            };
+            put_row(pixels, &data, hflip, |entry| {
+                BgPixel4Bpp::new(palette, entry).into()
+            });
+        }
+    }
+
+    let start = x % 8;
+    line.layer_mut(layer)
+        .copy_from_slice(&span[start..(start + VISIBLE_LINE_WIDTH)]);
+}
+
+fn map_entry(vram: &[u8], offset: usize) -> u16 {
+    if offset < BG_VRAM_SIZE {
+        u16::from_le_bytes([vram[offset], vram[offset + 1]])
+    } else {
+        0
+    }
+}
+
+#[inline(always)]
+fn put_row(pixels: &mut [Pixel], row: &TileRow, hflip: bool, pixel: impl Fn(u8) -> Pixel) {
+    if hflip {
+        for (dest, &entry) in pixels.iter_mut().zip(row.iter().rev()) {
+            *dest = pixel(entry);
+        }
+    } else {
+        for (dest, &entry) in pixels.iter_mut().zip(row) {
+            *dest = pixel(entry);
+        }
+    }
+}
@@ -0,0 +1,132 @@
+use crate::memory::VRAM_SIZE;
+
+/// Size of the part of VRAM that holds tiles and maps for backgrounds in the tile modes.
+pub(super) const BG_VRAM_SIZE: usize = 0x10000;
+
+pub(super) const TILE_SIZE_4BPP: usize = 32;
+pub(super) const TILE_COUNT: usize = VRAM_SIZE / TILE_SIZE_4BPP;
+
+/// One row of a tile with one palette entry per pixel.
+pub(super) type TileRow = [u8; 8];
+
+/// Every 4bpp tile in VRAM decoded into one palette entry per byte so that drawing a row of a
+/// tile is a copy instead of splitting every byte into two pixels. Tiles are decoded again the
+/// next time that they're needed after VRAM containing them was written to.
+///
+/// 8bpp tiles already have one palette entry per byte so they're read straight from VRAM.
+pub(crate) struct TileCache {
+    tiles: Box<[[TileRow; 8]; TILE_COUNT]>,
+    /// Tiles that were written to since they were last decoded.
+    dirty: DirtyTiles,
+}
+
+impl TileCache {
+    /// Called after the VRAM at `offset` was changed.
+    pub(crate) fn vram_changed(&mut self, offset: usize) {
+        self.dirty.mark(offset);
+    }
+
+    /// Decodes every tile that changed since it was last decoded.
+    pub(crate) fn update(&mut self, vram: &[u8; VRAM_SIZE]) {
+        for tile in self.dirty.drain() {
+            let data = &vram[(tile * TILE_SIZE_4BPP)..((tile + 1) * TILE_SIZE_4BPP)];
+            for (row, data) in self.tiles[tile].iter_mut().zip(data.chunks_exact(4)) {
+                for (pixels, &byte) in row.chunks_exact_mut(2).zip(data) {
+                    pixels[0] = byte & 0xF;
+                    pixels[1] = byte >> 4;
+                }
+            }
+        }
+    }
+
+    /// Row `row` of the 4bpp tile at `offset` in VRAM.
+    #[inline]
+    pub(super) fn row_4bpp(&self, offset: usize, row: usize) -> &TileRow {
+        &self.tiles[offset / TILE_SIZE_4BPP][row]
+    }
+}
+
+impl Default for TileCache {
+    fn default() -> Self {
+        // VRAM starts out as zeroes so every tile is already decoded.
+        Self {
+            tiles: Box::new([[[0; 8]; 8]; TILE_COUNT]),
+            dirty: DirtyTiles::default(),
+        }
+    }
+}
+
+/// The tile sized pieces of VRAM that were written to since they were last looked at, each
+/// only once no matter how often they were written to.
+pub(super) struct DirtyTiles {
+    tiles: Vec<u16>,
+    /// True for every tile in `tiles`.
+    pending: Box<[bool; TILE_COUNT]>,
+}
+
+impl DirtyTiles {
+    /// Called after the VRAM at `offset` was changed.
+    #[inline]
+    pub(super) fn mark(&mut self, offset: usize) {
+        let tile = offset / TILE_SIZE_4BPP;
+        if !std::mem::replace(&mut self.pending[tile], true) {
+            self.tiles.push(tile as u16);
+        }
+    }
+
+    /// Takes every tile that was marked since the last time.
+    pub(super) fn drain(&mut self) -> impl Iterator<Item = usize> + '_ {
+        let pending = &mut self.pending;
+        self.tiles.drain(..).map(move |tile| {
+            pending[tile as usize] = false;
+            tile as usize
+        })
+    }
+}
+
+impl Default for DirtyTiles {
+    fn default() -> Self {
+        Self {
+            tiles: Vec::with_capacity(TILE_COUNT),
+            pending: Box::new([false; TILE_COUNT]),
+        }
+    }
+}
+
+#[cfg(test)]
+mod test {
+    use crate::memory::VRAM_SIZE;
+
+    use super::TileCache;
+
+    #[test]
+    fn test_decode_4bpp() {
+        let mut vram = Box::new([0u8; VRAM_SIZE]);
+        let mut tiles = TileCache::default();
+
+        vram[0x40..0x44].copy_from_slice(&[0x21, 0x43, 0x65, 0x87]);
+        vram[0x5C] = 0xFE;
+        tiles.vram_changed(0x40);
+        tiles.vram_changed(0x5C);
+        tiles.update(&vram);
+        assert_eq!(tiles.row_4bpp(0x40, 0), &[1, 2, 3, 4, 5, 6, 7, 8]);
+        assert_eq!(tiles.row_4bpp(0x40, 7), &[0xE, 0xF, 0, 0, 0, 0, 0, 0]);
+    }
+
+    #[test]
+    fn test_only_changed_tiles_are_decoded() {
+        let mut vram = Box::new([0u8; VRAM_SIZE]);
+        let mut tiles = TileCache::default();
+
+        vram[0x20] = 0x11;
+        vram[0x40] = 0x22;
+        tiles.vram_changed(0x20);
+        tiles.update(&vram);
+        assert_eq!(tiles.row_4bpp(0x20, 0)[..2], [1, 1]);
+        assert_eq!(tiles.row_4bpp(0x40, 0)[..2], [0, 0]);
+
+        tiles.vram_changed(0x40);
+        tiles.update(&vram);
+        assert_eq!(tiles.row_4bpp(0x40, 0)[..2], [2, 2]);
+    }
+}
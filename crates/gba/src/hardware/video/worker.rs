@@ -0,0 +1,220 @@
+//! Renders lines on another thread so that the CPU can keep running while they're rendered.
+//!
+//! The other thread has its own copy of VRAM and the palette. Every line is sent along with a
+//! copy of the video registers and of the pieces of VRAM and palette RAM that changed since
+//! the last line, so the copy looks exactly like the real thing did at that line's H-Blank no
+//! matter what the CPU does to it afterwards. The finished frame is only needed once its last
+//! line was rendered, which is the only time that the CPU has to wait for the other thread.
+
+use std::{
+    sync::mpsc::{self, Receiver, Sender},
+    thread::JoinHandle,
+};
+
+use crate::{hardware::palette::Palette, memory::VRAM_SIZE};
+
+use super::{
+    registers::GbaVideoRegisters,
+    send_line,
+    tiles::{DirtyTiles, TILE_SIZE_4BPP},
+    HBlankContext, LineRenderer, ReferencePoint, ScreenBuffer, VideoTarget, VISIBLE_LINE_COUNT,
+    VISIBLE_LINE_WIDTH, VISIBLE_PIXELS,
+};
+
+type VramPiece = [u8; TILE_SIZE_4BPP];
+
+enum Job {
+    Line(Box<LineJob>),
+    /// Copy every line into the frame and send it back.
+    Frame(Box<ScreenBuffer>),
+}
+
+struct LineJob {
+    line: u16,
+    /// False if the line can be reused from the last frame.
+    redraw: bool,
+    registers: GbaVideoRegisters,
+    reference_points: [ReferencePoint; 2],
+    /// Pieces of VRAM that changed since the last line and their offsets.
+    vram: Vec<(usize, VramPiece)>,
+    /// The whole palette if it changed since the last line.
+    palette: Option<Box<Palette>>,
+}
+
+pub(crate) struct RenderWorker {
+    jobs: Option<Sender<Job>>,
+    frames: Receiver<Box<ScreenBuffer>>,
+    thread: Option<JoinHandle<()>>,
+    /// The frame that is sent to the other thread to be filled in, when it isn't there.
+    frame: Option<Box<ScreenBuffer>>,
+
+    vram_dirty: DirtyTiles,
+    palette_dirty: bool,
+}
+
+impl RenderWorker {
+    pub(crate) fn new(vram: &[u8; VRAM_SIZE], palette: &Palette) -> Self {
+        let (jobs, job_receiver) = mpsc::channel();
+        let (frame_sender, frames) = mpsc::channel();
+
+        let mut state = WorkerState {
+            renderer: LineRenderer::default(),
+            vram: Box::new(*vram),
+            palette: Box::new(palette.clone()),
+            lines: Box::new([0; VISIBLE_PIXELS]),
+        };
+        // The renderer's tiles were decoded from empty VRAM.
+        for offset in (0..VRAM_SIZE).step_by(TILE_SIZE_4BPP) {
+            state.renderer.tiles.vram_changed(offset);
+        }
+
+        let thread = std::thread::Builder::new()
+            .name("gba-video".into())
+            .spawn(move || state.run(job_receiver, frame_sender))
+            .expect("failed to spawn video thread");
+
+        Self {
+            jobs: Some(jobs),
+            frames,
+            thread: Some(thread),
+            frame: Some(Box::new([0; VISIBLE_PIXELS])),
+            vram_dirty: DirtyTiles::default(),
+            palette_dirty: false,
+        }
+    }
+
+    pub(crate) fn vram_changed(&mut self, offset: usize) {
+        self.vram_dirty.mark(offset);
+    }
+
+    pub(crate) fn palette_changed(&mut self) {
+        self.palette_dirty = true;
+    }
+
+    /// Sends a line to the other thread with everything that changed since the last one.
+    pub(crate) fn render_line(
+        &mut self,
+        line: u16,
+        redraw: bool,
+        registers: &GbaVideoRegisters,
+        reference_points: [ReferencePoint; 2],
+        context: HBlankContext,
+    ) {
+        let vram: Vec<_> = self
+            .vram_dirty
+            .drain()
+            .map(|tile| {
+                let offset = tile * TILE_SIZE_4BPP;
+                let piece = context.vram[offset..(offset + TILE_SIZE_4BPP)]
+                    .try_into()
+                    .unwrap();
+                (offset, piece)
+            })
+            .collect();
+        let palette =
+            std::mem::take(&mut self.palette_dirty).then(|| Box::new(context.palette.clone()));
+        // There's nothing for the other thread to do.
+        if !redraw && vram.is_empty() && palette.is_none() {
+            return;
+        }
+
+        self.send(Job::Line(Box::new(LineJob {
+            line,
+            redraw,
+            registers: registers.clone(),
+            reference_points,
+            vram,
+            palette,
+        })));
+    }
+
+    /// Waits for every line that was sent so far to be rendered and sends them to `target`.
+    pub(crate) fn finish_frame(&mut self, target: &mut VideoTarget) {
+        let frame = self.frame.take().expect("frame is already being rendered");
+        self.send(Job::Frame(frame));
+        let frame = self.frames.recv().expect("video thread stopped");
+
+        match target {
+            VideoTarget::Frame(target) => target.copy_from_slice(&frame[..]),
+            VideoTarget::Lines(video) => {
+                for (index, line) in frame.chunks_exact(VISIBLE_LINE_WIDTH).enumerate() {
+                    send_line(*video, index, line.try_into().unwrap());
+                }
+            }
+        }
+        self.frame = Some(frame);
+    }
+
+    fn send(&self, job: Job) {
+        self.jobs
+            .as_ref()
+            .unwrap()
+            .send(job)
+            .expect("video thread stopped");
+    }
+}
+
+impl Drop for RenderWorker {
+    fn drop(&mut self) {
+        // The other thread stops once there are no more jobs.
+        self.jobs = None;
+        if let Some(thread) = self.thread.take() {
+            let _ = thread.join();
+        }
+    }
+}
+
+/// Everything that lives on the other thread.
+struct WorkerState {
+    renderer: LineRenderer,
+    vram: Box<[u8; VRAM_SIZE]>,
+    palette: Box<Palette>,
+    /// The last thing rendered for every visible line.
+    lines: Box<ScreenBuffer>,
+}
+
+impl WorkerState {
+    fn run(mut self, jobs: Receiver<Job>, frames: Sender<Box<ScreenBuffer>>) {
+        while let Ok(job) = jobs.recv() {
+            match job {
+                Job::Line(job) => self.render_line(*job),
+                Job::Frame(mut frame) => {
+                    frame.copy_from_slice(&self.lines[..]);
+                    if frames.send(frame).is_err() {
+                        break;
+                    }
+                }
+            }
+        }
+    }
+
+    fn render_line(&mut self, job: LineJob) {
+        for (offset, piece) in job.vram {
+            self.vram[offset..(offset + TILE_SIZE_4BPP)].copy_from_slice(&piece);
+            self.renderer.tiles.vram_changed(offset);
+        }
+        if let Some(palette) = job.palette {
+            self.palette = palette;
+        }
+
+        if !job.redraw {
+            return;
+        }
+        assert!((job.line as usize) < VISIBLE_LINE_COUNT);
+        let start = job.line as usize * VISIBLE_LINE_WIDTH;
+        let output = (&mut self.lines[start..(start + VISIBLE_LINE_WIDTH)])
+            .try_into()
+            .unwrap();
+        let context = HBlankContext {
+            palette: &self.palette,
+            vram: &self.vram,
+        };
+        self.renderer.draw(
+            job.line,
+            &job.registers,
+            job.reference_points,
+            context,
+            output,
+        );
+    }
+}
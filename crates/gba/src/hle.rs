@@ -0,0 +1,142 @@
+//! High level emulation of BIOS functions. These are called instead of the code in the BIOS
+//! when a game uses a software interrupt.
+
+pub mod math;
+pub mod memory;
+
+use arm::emu::{CpsrFlag, Cpu, CpuException, Cycles, ExceptionHandlerResult, Memory};
+
+use crate::{hardware::system_control::RegInterrupts, GbaMemoryMappedHardware};
+
+pub const SWI_HALT: u32 = 0x02;
+pub const SWI_INTR_WAIT: u32 = 0x04;
+pub const SWI_VBLANK_INTR_WAIT: u32 = 0x05;
+pub const SWI_DIV: u32 = 0x06;
+pub const SWI_DIV_ARM: u32 = 0x07;
+pub const SWI_SQRT: u32 = 0x08;
+pub const SWI_ARCTAN: u32 = 0x09;
+pub const SWI_ARCTAN2: u32 = 0x0A;
+pub const SWI_CPU_SET: u32 = 0x0B;
+pub const SWI_CPU_FAST_SET: u32 = 0x0C;
+pub const SWI_LZ77_UNCOMP_WRITE8: u32 = 0x11;
+pub const SWI_LZ77_UNCOMP_WRITE16: u32 = 0x12;
+pub const SWI_RL_UNCOMP_WRITE8: u32 = 0x14;
+pub const SWI_RL_UNCOMP_WRITE16: u32 = 0x15;
+
+/// The number of cycles that the SWI instruction takes (2S + 1N). Time spent in the BIOS
+/// isn't counted for functions that halt the CPU because it would just be spent waiting.
+const SWI_CYCLES: Cycles = Cycles::new(3);
+
+/// The number of cycles that the custom BIOS's SWI handler spends getting from the exception
+/// vector to the function and back to the game, not counting the branch to the function.
+const DISPATCH_CYCLES: Cycles = Cycles::new(40);
+
+pub(crate) fn exception_handler(
+    cpu: &mut Cpu,
+    memory: &mut dyn Memory,
+    exception: CpuException,
+) -> ExceptionHandlerResult {
+    if exception != CpuException::Swi {
+        return ExceptionHandlerResult::Ignored;
+    }
+
+    let Some(mapped) = memory
+        .as_mut_any()
+        .downcast_mut::<GbaMemoryMappedHardware>()
+    else {
+        return ExceptionHandlerResult::Ignored;
+    };
+
+    let Some(comment) = swi_comment(cpu, mapped) else {
+        return ExceptionHandlerResult::Ignored;
+    };
+    if mapped.hle_math_enabled {
+        let registers = &mut cpu.registers;
+        let cycles = match comment {
+            SWI_DIV => Some(math::div(registers)),
+            SWI_DIV_ARM => Some(math::div_arm(registers)),
+            SWI_SQRT => Some(math::sqrt(registers)),
+            SWI_ARCTAN => Some(math::arctan(registers)),
+            SWI_ARCTAN2 => Some(math::arctan2(registers)),
+            _ => None,
+        };
+
+        if let Some(cycles) = cycles {
+            return ExceptionHandlerResult::Handled(SWI_CYCLES + DISPATCH_CYCLES + cycles);
+        }
+    }
+
+    if mapped.hle_memory_enabled {
+        let cycles = match comment {
+            SWI_CPU_SET => Some(memory::cpu_set(cpu, mapped)),
+            SWI_CPU_FAST_SET => Some(memory::cpu_fast_set(cpu, mapped)),
+            SWI_LZ77_UNCOMP_WRITE8 => Some(memory::lz77_uncomp_write8(cpu, mapped)),
+            SWI_LZ77_UNCOMP_WRITE16 => Some(memory::lz77_uncomp_write16(cpu, mapped)),
+            SWI_RL_UNCOMP_WRITE8 => Some(memory::rl_uncomp_write8(cpu, mapped)),
+            SWI_RL_UNCOMP_WRITE16 => Some(memory::rl_uncomp_write16(cpu, mapped)),
+            _ => None,
+        };
+
+        if let Some(cycles) = cycles {
+            return ExceptionHandlerResult::Handled(SWI_CYCLES + DISPATCH_CYCLES + cycles);
+        }
+    }
+
+    if !mapped.hle_wait_enabled {
+        return ExceptionHandlerResult::Ignored;
+    }
+
+    match comment {
+        SWI_HALT => {
+            mapped.system_control.intr_wait = None;
+            cpu.halt();
+        }
+
+        SWI_INTR_WAIT => {
+            let discard = cpu.registers.read(0) != 0;
+            let interrupts = cpu.registers.read(1) as u16;
+            if mapped.system_control.begin_intr_wait(discard, interrupts) {
+                cpu.halt();
+            }
+        }
+
+        SWI_VBLANK_INTR_WAIT => {
+            // VBlankIntrWait is just IntrWait with these arguments and
+            // they are left in the registers afterwards.
+            cpu.registers.write(0, 1);
+            cpu.registers.write(1, RegInterrupts::VBLANK as u32);
+            if mapped
+                .system_control
+                .begin_intr_wait(true, RegInterrupts::VBLANK)
+            {
+                cpu.halt();
+            }
+        }
+
+        _ => return ExceptionHandlerResult::Ignored,
+    }
+
+    ExceptionHandlerResult::Handled(SWI_CYCLES)
+}
+
+/// Reads the comment field of the SWI instruction that caused the current exception, or
+/// returns `None` if it isn't in memory that can be read directly. This doesn't go through
+/// `load16`/`load32` so that it doesn't count as an access or change the open bus value.
+/// The function number is in the upper 8 bits of the comment in ARM mode.
+fn swi_comment(cpu: &Cpu, mapped: &GbaMemoryMappedHardware) -> Option<u32> {
+    let address = cpu.exception_address();
+    let page = mapped.page_table.get(address);
+    if !page.readable() {
+        return None;
+    }
+
+    if cpu.registers.get_flag(CpsrFlag::T) {
+        // SAFETY: the page is readable and the address is halfword aligned.
+        let opcode = unsafe { page.read16(address & !0x1) };
+        Some(opcode as u32 & 0xFF)
+    } else {
+        // SAFETY: the page is readable and the address is word aligned.
+        let opcode = unsafe { page.read32(address & !0x3) };
+        Some((opcode >> 16) & 0xFF)
+    }
+}
@@ -0,0 +1,185 @@
+//! High level emulation of the BIOS math functions (SWI 06h..0Ah).
+//!
+//! Each function reads its arguments from and writes its results to the same registers as the
+//! custom BIOS's implementation in `gba-programs/custom-bios/source/math.s`, including the
+//! registers that the BIOS function destroys. The returned cycle count is the number of cycles
+//! that the BIOS function takes from the branch that calls it until it has returned, with
+//! BIOS timing (no waitstates). These are the same as what the emulator counts for running
+//! the BIOS function, so enabling HLE doesn't change the timing of a game.
+
+use arm::emu::{Cycles, Registers};
+
+/// Div is a fixed 32 iterations of shifting and subtracting.
+const DIV_CYCLES: u32 = 314;
+
+/// DivArm swaps its arguments and branches to Div.
+const DIV_ARM_CYCLES: u32 = DIV_CYCLES + 6;
+
+/// Sqrt is a fixed 16 iterations of finding a bit of the root.
+const SQRT_CYCLES: u32 = 151;
+
+/// ArcTan without the internal cycles of its multiplies.
+const ARCTAN_CYCLES: u32 = 40;
+
+/// ArcTan2 returns early when `x` or `y` is 0 and otherwise calls Div and ArcTan.
+const ARCTAN2_Y_ZERO_CYCLES: u32 = 11;
+const ARCTAN2_X_ZERO_CYCLES: u32 = 15;
+const ARCTAN2_CYCLES: u32 = 39;
+
+/// Coefficients of the polynomial that ArcTan uses.
+const ARCTAN_COEFFICIENTS: [i32; 7] = [0x0390, 0x091C, 0x0FB6, 0x16AA, 0x2081, 0x3651, 0xA2F9];
+
+/// SWI 06h - Div
+///
+/// r0 = number, r1 = denominator. Returns r0 = number / denominator, r1 = number % denominator
+/// and r3 = abs(number / denominator).
+pub fn div(registers: &mut Registers) -> Cycles {
+    let number = registers.read(0) as i32;
+    let denominator = registers.read(1) as i32;
+    write_div_results(registers, number, denominator);
+    Cycles::new(DIV_CYCLES)
+}
+
+/// SWI 07h - DivArm
+///
+/// Same as [`div`] but with the number in r1 and the denominator in r0.
+pub fn div_arm(registers: &mut Registers) -> Cycles {
+    let number = registers.read(1) as i32;
+    let denominator = registers.read(0) as i32;
+    write_div_results(registers, number, denominator);
+    Cycles::new(DIV_ARM_CYCLES)
+}
+
+/// SWI 08h - Sqrt
+///
+/// r0 = unsigned 32-bit number. Returns r0 = the square root rounded down.
+pub fn sqrt(registers: &mut Registers) -> Cycles {
+    let mut value = registers.read(0);
+    let mut root = 0u32;
+    let mut trial = 0u32;
+    let mut bit = 1u32 << 30;
+
+    while bit != 0 {
+        trial = root + bit;
+        if value >= trial {
+            value -= trial;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+
+    registers.write(0, root);
+    registers.write(1, root);
+    registers.write(3, trial);
+    Cycles::new(SQRT_CYCLES)
+}
+
+/// SWI 09h - ArcTan
+///
+/// r0 = tan(θ) as a signed 1.14 fixed point number. Returns r0 = θ in the range -0x4000..=0x4000
+/// (-π/2..=π/2).
+pub fn arctan(registers: &mut Registers) -> Cycles {
+    let tan = registers.read(0) as i32;
+    let (theta, cycles) = write_arctan_results(registers, tan);
+    registers.write(0, theta as u32);
+    Cycles::new(cycles)
+}
+
+/// SWI 0Ah - ArcTan2
+///
+/// r0 = x, r1 = y, both signed 1.14 fixed point numbers. Returns r0 = θ in the range 0..=0xFFFF
+/// (0..2π).
+pub fn arctan2(registers: &mut Registers) -> Cycles {
+    let x = registers.read(0) as i32;
+    let y = registers.read(1) as i32;
+
+    if y == 0 {
+        registers.write(0, if x >= 0 { 0x0000 } else { 0x8000 });
+        return Cycles::new(ARCTAN2_Y_ZERO_CYCLES);
+    }
+
+    if x == 0 {
+        registers.write(0, if y >= 0 { 0x4000 } else { 0xC000 });
+        return Cycles::new(ARCTAN2_X_ZERO_CYCLES);
+    }
+
+    let theta;
+    let cycles;
+    if x.unsigned_abs() >= y.unsigned_abs() {
+        write_div_results(registers, y.wrapping_shl(14), x);
+        let (arctan, arctan_cycles) = write_arctan_results(registers, registers.read(0) as i32);
+        theta = if x < 0 { arctan + 0x8000 } else { arctan };
+        cycles = arctan_cycles;
+    } else {
+        write_div_results(registers, x.wrapping_shl(14), y);
+        let (arctan, arctan_cycles) = write_arctan_results(registers, registers.read(0) as i32);
+        theta = if y >= 0 {
+            0x4000 - arctan
+        } else {
+            0xC000 - arctan
+        };
+        cycles = arctan_cycles;
+    }
+
+    registers.write(0, theta as u32 & 0xFFFF);
+    Cycles::new(ARCTAN2_CYCLES + DIV_CYCLES + cycles)
+}
+
+fn write_div_results(registers: &mut Registers, number: i32, denominator: i32) {
+    let n = number.unsigned_abs();
+    let d = denominator.unsigned_abs();
+
+    // This is what the BIOS's division loop ends up with when dividing by zero.
+    let (quotient, remainder) = if d != 0 {
+        (n / d, n % d)
+    } else {
+        (u32::MAX, n)
+    };
+
+    let signed_quotient = if (number ^ denominator) < 0 {
+        quotient.wrapping_neg()
+    } else {
+        quotient
+    };
+    let signed_remainder = if number < 0 {
+        remainder.wrapping_neg()
+    } else {
+        remainder
+    };
+
+    registers.write(0, signed_quotient);
+    registers.write(1, signed_remainder);
+    registers.write(3, quotient);
+}
+
+/// Writes the registers that ArcTan destroys and returns θ and the cycles that ArcTan took.
+fn write_arctan_results(registers: &mut Registers, tan: i32) -> (i32, u32) {
+    let mut cycles = ARCTAN_CYCLES + 2 * multiply_cycles(tan);
+
+    let a = (tan.wrapping_mul(tan) >> 14).wrapping_neg();
+    let mut b = 0xA9;
+    for coefficient in ARCTAN_COEFFICIENTS {
+        cycles += multiply_cycles(b);
+        b = (a.wrapping_mul(b) >> 14).wrapping_add(coefficient);
+    }
+
+    registers.write(1, a as u32);
+    registers.write(3, b as u32);
+    (tan.wrapping_mul(b) >> 16, cycles)
+}
+
+/// Internal cycles of a multiply with `rhs` as the multiplier operand.
+fn multiply_cycles(rhs: i32) -> u32 {
+    let xor = (rhs ^ (rhs >> 31)) as u32;
+    if (xor & 0xFFFFFF00) == 0 {
+        1
+    } else if (xor & 0xFFFF0000) == 0 {
+        2
+    } else if (xor & 0xFF000000) == 0 {
+        3
+    } else {
+        4
+    }
+}
@@ -0,0 +1,601 @@
+//! High level emulation of the BIOS memory copy and decompression functions (SWI 0Bh, 0Ch,
+//! 11h, 12h, 14h and 15h).
+//!
+//! These work directly on the memory behind the page table where they can, so a copy is a
+//! `memcpy` and a fill is a `fill` on the backing arrays. VRAM and OAM are written the same
+//! way that DMA writes them, comparing a chunk at a time so that the video hardware only
+//! renders the lines that changed again. Memory that isn't in the page table (palette RAM,
+//! I/O registers, ...) and 8-bit writes to VRAM still go through the memory map one unit at
+//! a time.
+//!
+//! Like [`super::math`], each function leaves the same values in registers as the custom
+//! BIOS's implementation in `gba-programs/custom-bios/source/memory.s` and returns the number
+//! of cycles that it takes from the branch that calls it until it has returned. The cycles
+//! include the waitstates of every load and store that the BIOS function would have made,
+//! but code is assumed to run with BIOS timing and the stack is assumed to be in IWRAM.
+
+use arm::emu::{AccessType, Cpu, Cycles, Memory, Waitstates};
+
+use crate::{
+    memory::{self, RunSource},
+    GbaMemoryMappedHardware,
+};
+
+const CPUSET_FILL: u32 = 1 << 24;
+const CPUSET_32BIT: u32 = 1 << 26;
+const CPUSET_COUNT_MASK: u32 = 0x1FFFFF;
+
+/// Cycles for returning early because the source is in the BIOS or the count is 0.
+const CPUSET_REJECT_CYCLES: u32 = 12;
+const CPUSET_EMPTY_CYCLES: u32 = 15;
+/// Cycles outside of the loop and the cycles of each iteration of the loop (without the
+/// branch back to the start of the loop for the last iteration).
+const CPUSET_COPY16_CYCLES: (u32, u32) = (22, 9);
+const CPUSET_FILL16_CYCLES: (u32, u32) = (27, 6);
+const CPUSET_COPY32_CYCLES: (u32, u32) = (24, 9);
+const CPUSET_FILL32_CYCLES: (u32, u32) = (26, 6);
+
+const CPUFASTSET_REJECT_CYCLES: u32 = 26;
+const CPUFASTSET_EMPTY_CYCLES: u32 = 29;
+const CPUFASTSET_COPY_CYCLES: (u32, u32) = (36, 22);
+const CPUFASTSET_FILL_CYCLES: (u32, u32) = (45, 13);
+
+/// Cycles for returning because the source is in the BIOS, or because the decompressed size
+/// is 0 (not counting the waitstates for reading the header).
+const UNCOMP_REJECT_CYCLES: u32 = 22;
+const UNCOMP_EMPTY_CYCLES: u32 = 27;
+/// Cycles before the first flag byte is read and after the last byte is written.
+const UNCOMP_START_CYCLES: u32 = 15;
+const UNCOMP_END_CYCLES: u32 = 10;
+
+/// SWI 0Bh - CpuSet
+///
+/// r0 = source, r1 = destination, r2 = count (bits 0-20), fill (bit 24) and 32-bit (bit 26).
+pub fn cpu_set(cpu: &mut Cpu, mapped: &mut GbaMemoryMappedHardware) -> Cycles {
+    let source = cpu.registers.read(0);
+    let destination = cpu.registers.read(1);
+    let control = cpu.registers.read(2);
+    let count = control & CPUSET_COUNT_MASK;
+    let fill = (control & CPUSET_FILL) != 0;
+
+    let cycles = if source & 0x0E000000 == 0 {
+        Cycles::new(CPUSET_REJECT_CYCLES)
+    } else if count == 0 {
+        Cycles::new(CPUSET_EMPTY_CYCLES)
+    } else {
+        let (size, (base, iteration)) = match (control & CPUSET_32BIT != 0, fill) {
+            (false, false) => (2, CPUSET_COPY16_CYCLES),
+            (false, true) => (2, CPUSET_FILL16_CYCLES),
+            (true, false) => (4, CPUSET_COPY32_CYCLES),
+            (true, true) => (4, CPUSET_FILL32_CYCLES),
+        };
+        let source = source & !(size - 1);
+        let destination = destination & !(size - 1);
+        let transfer = Transfer {
+            source,
+            destination,
+            size,
+            count,
+            fill,
+            burst: 1,
+        };
+        let waitstates = transfer.run(cpu, mapped);
+
+        let len = count * size;
+        let source_end = if fill {
+            source
+        } else {
+            source.wrapping_add(len)
+        };
+        cpu.registers.write(0, source_end);
+        cpu.registers.write(1, destination.wrapping_add(len));
+        Cycles::new(base + iteration * count - 2) + waitstates
+    };
+
+    cpu.registers.write(2, 0);
+    cpu.registers.write(3, 0);
+    cycles
+}
+
+/// SWI 0Ch - CpuFastSet
+///
+/// r0 = source, r1 = destination, r2 = word count (bits 0-20, rounded up to a multiple of 8)
+/// and fill (bit 24).
+pub fn cpu_fast_set(cpu: &mut Cpu, mapped: &mut GbaMemoryMappedHardware) -> Cycles {
+    let source = cpu.registers.read(0);
+    let destination = cpu.registers.read(1);
+    let control = cpu.registers.read(2);
+    let count = control & CPUSET_COUNT_MASK;
+    let fill = (control & CPUSET_FILL) != 0;
+
+    let cycles = if source & 0x0E000000 == 0 {
+        Cycles::new(CPUFASTSET_REJECT_CYCLES)
+    } else if count == 0 {
+        Cycles::new(CPUFASTSET_EMPTY_CYCLES)
+    } else {
+        let blocks = count.div_ceil(8);
+        let source = source & !0x3;
+        let destination = destination & !0x3;
+        let transfer = Transfer {
+            source,
+            destination,
+            size: 4,
+            count: blocks * 8,
+            fill,
+            burst: 8,
+        };
+        let waitstates = transfer.run(cpu, mapped);
+
+        let (base, iteration) = if fill {
+            CPUFASTSET_FILL_CYCLES
+        } else {
+            CPUFASTSET_COPY_CYCLES
+        };
+        let len = blocks * 32;
+        let source_end = if fill {
+            source
+        } else {
+            source.wrapping_add(len)
+        };
+        cpu.registers.write(0, source_end);
+        cpu.registers.write(1, destination.wrapping_add(len));
+        Cycles::new(base + iteration * blocks - 2) + waitstates
+    };
+
+    cpu.registers.write(2, 0);
+    cpu.registers.write(3, 0);
+    cycles
+}
+
+/// SWI 11h - LZ77UnCompReadNormalWrite8bit
+///
+/// r0 = source, r1 = destination.
+pub fn lz77_uncomp_write8(cpu: &mut Cpu, mapped: &mut GbaMemoryMappedHardware) -> Cycles {
+    uncomp(cpu, mapped, lz77, false)
+}
+
+/// SWI 12h - LZ77UnCompReadNormalWrite16bit
+///
+/// r0 = source, r1 = destination. Same as [`lz77_uncomp_write8`] but the decompressed data is
+/// written 16 bits at a time so it can be used with VRAM.
+pub fn lz77_uncomp_write16(cpu: &mut Cpu, mapped: &mut GbaMemoryMappedHardware) -> Cycles {
+    uncomp(cpu, mapped, lz77, true)
+}
+
+/// SWI 14h - RLUnCompReadNormalWrite8bit
+///
+/// r0 = source, r1 = destination.
+pub fn rl_uncomp_write8(cpu: &mut Cpu, mapped: &mut GbaMemoryMappedHardware) -> Cycles {
+    uncomp(cpu, mapped, rl, false)
+}
+
+/// SWI 15h - RLUnCompReadNormalWrite16bit
+///
+/// r0 = source, r1 = destination. Same as [`rl_uncomp_write8`] but the decompressed data is
+/// written 16 bits at a time so it can be used with VRAM.
+pub fn rl_uncomp_write16(cpu: &mut Cpu, mapped: &mut GbaMemoryMappedHardware) -> Cycles {
+    uncomp(cpu, mapped, rl, true)
+}
+
+/// A copy or fill of `count` units of `size` bytes.
+struct Transfer {
+    source: u32,
+    destination: u32,
+    size: u32,
+    count: u32,
+    fill: bool,
+    /// Loads are made in bursts of this many units (like LDM) where only the first access
+    /// is non-sequential.
+    burst: u32,
+}
+
+impl Transfer {
+    /// Runs the transfer and returns the waitstates of all of its loads and stores.
+    fn run(&self, cpu: &mut Cpu, mapped: &mut GbaMemoryMappedHardware) -> Waitstates {
+        let size = self.size;
+        let mut waitstates = Waitstates::zero();
+
+        // The source is only read once for fills.
+        let mut fill_value = 0;
+        if self.fill {
+            let (value, wait) = load(cpu, mapped, self.source, size, AccessType::NonSequential);
+            fill_value = value;
+            waitstates += wait;
+        }
+
+        let mut done = 0;
+        while done < self.count {
+            let source = self.source.wrapping_add(done * size);
+            let destination = self.destination.wrapping_add(done * size);
+            let remaining = self.count - done;
+
+            let dst_page = mapped.page_table.get(destination);
+            let src_page = mapped.page_table.get(source);
+            let direct = memory::run_writable(&dst_page, destination, size)
+                && (self.fill || src_page.readable());
+
+            let units = if direct {
+                let mut units = remaining.min(dst_page.contiguous_len(destination) as u32 / size);
+                let run_source = if self.fill {
+                    RunSource::fill(fill_value, size)
+                } else {
+                    units = units.min(src_page.contiguous_len(source) as u32 / size);
+                    // Copying forward over the source repeats the units between them, so
+                    // runs stop before the first unit that they would have written to.
+                    // Both are aligned to the size of a unit, so this is at least one unit.
+                    let src = src_page.host(source);
+                    let distance = (dst_page.host(destination) as usize).wrapping_sub(src as usize);
+                    if distance != 0 && distance < (units * size) as usize {
+                        units = (distance / size as usize) as u32;
+                    }
+
+                    let (n, s) = self.burst_accesses(done, units);
+                    let timing = src_page.timing();
+                    let load_n = load_waitstates(mapped, timing, size, AccessType::NonSequential);
+                    let load_s = load_waitstates(mapped, timing, size, AccessType::Sequential);
+                    let load = repeat(load_n, n) + repeat(load_s, s);
+                    mapped.counters.record_many(source, units, load);
+                    waitstates += load;
+                    RunSource::Copy(src.cast_const())
+                };
+                let len = (units * size) as usize;
+
+                // SAFETY: `len` bytes are contiguous in both pages, and if the source is
+                //         before the destination then the run doesn't reach it.
+                unsafe { mapped.write_run(&dst_page, destination, len, run_source) };
+
+                let store = repeat(store_waitstates(mapped, dst_page.timing(), size), units);
+                mapped.counters.record_many(destination, units, store);
+                waitstates += store;
+                units
+            } else {
+                let value = if self.fill {
+                    fill_value
+                } else {
+                    let access = if done % self.burst == 0 {
+                        AccessType::NonSequential
+                    } else {
+                        AccessType::Sequential
+                    };
+                    let (value, wait) = load(cpu, mapped, source, size, access);
+                    waitstates += wait;
+                    value
+                };
+                waitstates += store(cpu, mapped, destination, size, value);
+                1
+            };
+
+            memory::invalidate_code(cpu, destination, units * size);
+            done += units;
+        }
+
+        waitstates
+    }
+
+    /// The number of non-sequential and sequential loads for units `first..first + units`.
+    fn burst_accesses(&self, first: u32, units: u32) -> (u32, u32) {
+        let bursts_before = |unit: u32| unit.div_ceil(self.burst);
+        let n = bursts_before(first + units) - bursts_before(first);
+        (n, units - n)
+    }
+}
+
+pub(crate) fn repeat(waitstates: Waitstates, count: u32) -> Waitstates {
+    Waitstates::from(u32::from(waitstates) * count)
+}
+
+pub(crate) fn load_waitstates(
+    mapped: &GbaMemoryMappedHardware,
+    timing: u8,
+    size: u32,
+    access: AccessType,
+) -> Waitstates {
+    let timings = &mapped.system_control.waitstates.pages;
+    match size {
+        1 => timings.load8(timing, access),
+        2 => timings.load16(timing, access),
+        _ => timings.load32(timing, access),
+    }
+}
+
+pub(crate) fn store_waitstates(
+    mapped: &GbaMemoryMappedHardware,
+    timing: u8,
+    size: u32,
+) -> Waitstates {
+    let timings = &mapped.system_control.waitstates.pages;
+    match size {
+        1 => timings.store8(timing),
+        2 => timings.store16(timing),
+        _ => timings.store32(timing),
+    }
+}
+
+pub(crate) fn load(
+    cpu: &mut Cpu,
+    mapped: &mut GbaMemoryMappedHardware,
+    address: u32,
+    size: u32,
+    access: AccessType,
+) -> (u32, Waitstates) {
+    let page = mapped.page_table.get(address);
+    if page.readable() {
+        let wait = load_waitstates(mapped, page.timing(), size, access);
+        // SAFETY: the page is readable and the address is aligned.
+        let value = unsafe {
+            match size {
+                1 => page.read8(address) as u32,
+                2 => page.read16(address) as u32,
+                _ => page.read32(address),
+            }
+        };
+        mapped.counters.record(address, wait);
+        return (value, wait);
+    }
+
+    match size {
+        1 => {
+            let (value, wait) = mapped.load8(address, cpu);
+            (value as u32, wait)
+        }
+        2 => {
+            let (value, wait) = mapped.load16(address, cpu);
+            (value as u32, wait)
+        }
+        _ => mapped.load32(address, cpu),
+    }
+}
+
+pub(crate) fn store(
+    cpu: &mut Cpu,
+    mapped: &mut GbaMemoryMappedHardware,
+    address: u32,
+    size: u32,
+    value: u32,
+) -> Waitstates {
+    match size {
+        1 => mapped.store8(address, value as u8, cpu),
+        2 => mapped.store16(address, value as u16, cpu),
+        _ => mapped.store32(address, value, cpu),
+    }
+}
+
+/// Reads the compressed data one byte at a time like the BIOS does and keeps track of the
+/// waitstates and cycles that the BIOS function would have taken.
+struct Uncomp<'a> {
+    cpu: &'a mut Cpu,
+    mapped: &'a mut GbaMemoryMappedHardware,
+    source: u32,
+    destination: u32,
+    output: Vec<u8>,
+    size: usize,
+    write16: bool,
+    cycles: u32,
+    waitstates: Waitstates,
+}
+
+impl Uncomp<'_> {
+    fn read8(&mut self) -> u8 {
+        let (value, wait) = load(
+            self.cpu,
+            self.mapped,
+            self.source,
+            1,
+            AccessType::NonSequential,
+        );
+        self.source = self.source.wrapping_add(1);
+        self.waitstates += wait;
+        value as u8
+    }
+
+    /// Reads a byte that was already decompressed `distance` bytes before the next one.
+    fn read_back(&mut self, distance: usize) -> u8 {
+        let position = self.output.len();
+        let address = self
+            .destination
+            .wrapping_add(position as u32)
+            .wrapping_sub(distance as u32);
+
+        let page = self.mapped.page_table.get(address);
+        let (value, wait) = if distance <= position {
+            let wait = if page.readable() {
+                let wait =
+                    load_waitstates(self.mapped, page.timing(), 1, AccessType::NonSequential);
+                self.mapped.counters.record(address, wait);
+                wait
+            } else {
+                Waitstates::zero()
+            };
+            (self.output[position - distance], wait)
+        } else {
+            // This is from before the start of the destination.
+            let (value, wait) = load(self.cpu, self.mapped, address, 1, AccessType::NonSequential);
+            (value as u8, wait)
+        };
+        self.waitstates += wait;
+        value
+    }
+
+    /// Writes the next decompressed byte and returns true if that was the last one.
+    fn emit(&mut self, value: u8) -> bool {
+        let position = self.output.len();
+        self.cycles += match (self.write16, position % 2 == 1) {
+            (false, _) => 2,
+            (true, true) => 6,
+            (true, false) => 5,
+        };
+        self.output.push(value);
+        self.output.len() == self.size
+    }
+
+    /// Writes the decompressed data to the destination and returns the waitstates of the
+    /// stores that the BIOS function would have made.
+    fn flush(&mut self) -> Waitstates {
+        let size = if self.write16 { 2 } else { 1 };
+        let len = self.output.len() as u32 & !(size - 1);
+        let mut waitstates = Waitstates::zero();
+
+        let mut done = 0;
+        while done < len {
+            let destination = self.destination.wrapping_add(done);
+            let page = self.mapped.page_table.get(destination);
+            let direct = memory::run_writable(&page, destination, size);
+
+            let written = if direct {
+                let bytes = (len - done).min(page.contiguous_len(destination) as u32);
+                let output = self.output[done as usize..].as_ptr();
+                // SAFETY: `bytes` bytes are contiguous in the page and the output is a
+                //         separate buffer.
+                unsafe {
+                    self.mapped.write_run(
+                        &page,
+                        destination,
+                        bytes as usize,
+                        RunSource::Copy(output),
+                    )
+                };
+
+                let store = repeat(
+                    store_waitstates(self.mapped, page.timing(), size),
+                    bytes / size,
+                );
+                self.mapped
+                    .counters
+                    .record_many(destination, bytes / size, store);
+                waitstates += store;
+                bytes
+            } else {
+                let index = done as usize;
+                let value = if size == 2 {
+                    u16::from_le_bytes([self.output[index], self.output[index + 1]]) as u32
+                } else {
+                    self.output[index] as u32
+                };
+                waitstates += store(self.cpu, self.mapped, destination, size, value);
+                size
+            };
+
+            memory::invalidate_code(self.cpu, destination, written);
+            done += written;
+        }
+
+        waitstates
+    }
+}
+
+fn uncomp(
+    cpu: &mut Cpu,
+    mapped: &mut GbaMemoryMappedHardware,
+    decompress: fn(&mut Uncomp),
+    write16: bool,
+) -> Cycles {
+    let source = cpu.registers.read(0);
+    let destination = cpu.registers.read(1);
+
+    if source & 0x0E000000 == 0 {
+        cpu.registers.write(2, 0);
+        cpu.registers.write(3, 0);
+        return Cycles::new(UNCOMP_REJECT_CYCLES);
+    }
+
+    let (header, header_wait) = load(cpu, mapped, source, 4, AccessType::NonSequential);
+    let size = (header >> 8) as usize;
+    let mut uncomp = Uncomp {
+        cpu,
+        mapped,
+        source: source.wrapping_add(4),
+        destination,
+        output: Vec::with_capacity(size),
+        size,
+        write16,
+        cycles: UNCOMP_START_CYCLES + UNCOMP_END_CYCLES,
+        waitstates: header_wait,
+    };
+
+    if size == 0 {
+        uncomp.cycles = UNCOMP_EMPTY_CYCLES;
+    } else {
+        decompress(&mut uncomp);
+        let waitstates = uncomp.flush();
+        uncomp.waitstates += waitstates;
+    }
+
+    let cycles = Cycles::new(uncomp.cycles) + uncomp.waitstates;
+    let source = uncomp.source;
+    cpu.registers.write(0, source);
+    cpu.registers
+        .write(1, destination.wrapping_add(size as u32));
+    cpu.registers.write(2, 0);
+    cpu.registers.write(3, 0);
+    cycles
+}
+
+fn lz77(uncomp: &mut Uncomp) {
+    loop {
+        let flags = uncomp.read8();
+        uncomp.cycles += 4;
+
+        for block in 0..8 {
+            if (flags << block) & 0x80 == 0 {
+                let value = uncomp.read8();
+                uncomp.cycles += 6;
+                if uncomp.emit(value) {
+                    uncomp.cycles += 3;
+                    return;
+                }
+                uncomp.cycles += 4;
+            } else {
+                let lo = uncomp.read8();
+                let hi = uncomp.read8();
+                uncomp.cycles += 16;
+                let length = (lo >> 4) as usize + 3;
+                let distance = (((lo as usize) & 0xF) << 8 | hi as usize) + 1;
+
+                for index in 0..length {
+                    let value = uncomp.read_back(distance);
+                    uncomp.cycles += 4;
+                    if uncomp.emit(value) {
+                        uncomp.cycles += 3;
+                        return;
+                    }
+                    uncomp.cycles += if index + 1 < length { 5 } else { 3 };
+                }
+            }
+
+            uncomp.cycles += if block < 7 { 5 } else { 6 };
+        }
+    }
+}
+
+fn rl(uncomp: &mut Uncomp) {
+    loop {
+        let flag = uncomp.read8();
+        uncomp.cycles += 5;
+
+        if flag & 0x80 == 0 {
+            let length = (flag & 0x7F) as usize + 1;
+            uncomp.cycles += 2;
+            for index in 0..length {
+                let value = uncomp.read8();
+                uncomp.cycles += 4;
+                if uncomp.emit(value) {
+                    uncomp.cycles += 3;
+                    return;
+                }
+                uncomp.cycles += if index + 1 < length { 5 } else { 6 };
+            }
+        } else {
+            let length = (flag & 0x7F) as usize + 3;
+            let value = uncomp.read8();
+            uncomp.cycles += 7;
+            for index in 0..length {
+                uncomp.cycles += 1;
+                if uncomp.emit(value) {
+                    uncomp.cycles += 3;
+                    return;
+                }
+                uncomp.cycles += if index + 1 < length { 5 } else { 6 };
+            }
+        }
+    }
+}
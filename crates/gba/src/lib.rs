@@ -1,77 +1,337 @@
+#[cfg(feature = "bench")]
+#[doc(hidden)]
+pub mod bench;
+pub mod counters;
 mod events;
 mod hardware;
+pub mod hle;
 pub mod memory;
+pub mod pool;
+pub mod savestate;
+
+use std::time::{Duration, Instant};
 
 use arm::emu::{Cpu, CpuMode, Cycles, InstructionSet};
-use events::{GbaEvent, SharedGbaScheduler};
-pub use hardware::{video, GbaMemoryMappedHardware};
-use hardware::{video::HBlankContext, CUSTOM_BIOS};
+use counters::GbaCounters;
+use events::{GbaEvent, GbaScheduler};
+use hardware::{
+    dma::DmaTiming,
+    video::{HBlankContext, ScreenBuffer, VideoTarget, VISIBLE_LINE_COUNT},
+    CUSTOM_BIOS,
+};
+pub use hardware::{gamepak::Gamepak, video, GbaMemoryMappedHardware};
 
 pub const NOP_ROM: [u8; 4] = [0xFE, 0xFF, 0xFF, 0xEA];
 
 pub struct Gba {
     pub cpu: Cpu,
     pub mapped: GbaMemoryMappedHardware,
-    scheduler: SharedGbaScheduler,
+    scheduler: GbaScheduler,
+
+    /// Counted for [`Gba::counters`], the CPU and the memory count the rest themselves.
+    events_fired: u64,
+    frames_run: u64,
+    frame_time: Duration,
 }
 
 impl Gba {
     pub fn new() -> Self {
-        let scheduler = SharedGbaScheduler::default();
-
-        let mut mmh = GbaMemoryMappedHardware::new(scheduler.clone());
+        let mut mmh = GbaMemoryMappedHardware::new();
         assert!(CUSTOM_BIOS.len() <= memory::BIOS_SIZE);
         mmh.bios[..CUSTOM_BIOS.len()].copy_from_slice(CUSTOM_BIOS);
 
-        let cpu = Cpu::new(InstructionSet::Arm, CpuMode::System, &mut mmh);
+        let mut cpu = Cpu::new(InstructionSet::Arm, CpuMode::System, &mut mmh);
+        cpu.set_exception_handler(hle::exception_handler);
+        cpu.set_idle_loop_detection_enabled(true);
         Self {
             cpu,
             mapped: mmh,
-            scheduler,
+            scheduler: GbaScheduler::default(),
+            events_fired: 0,
+            frames_run: 0,
+            frame_time: Duration::ZERO,
         }
     }
 
     /// Hard reset.
     pub fn reset(&mut self) {
+        self.cpu.resume();
         self.cpu.branch(0, &mut self.mapped);
         self.scheduler.clear();
-        self.mapped.reset();
+        self.mapped.reset(&mut self.scheduler);
     }
 
+    /// Executes a single instruction and sends every line that finishes rendering because
+    /// of it to `video_out`.
     pub fn step(&mut self, video_out: &mut dyn GbaVideoOutput, audio_out: &mut dyn GbaAudioOutput) {
+        self.step_to(&mut VideoTarget::Lines(video_out), audio_out);
+    }
+
+    /// Executes a single instruction and renders every line that finishes because of it
+    /// straight into its row of `frame`. Returns true if the last visible line of the frame
+    /// was rendered.
+    pub fn step_into(
+        &mut self,
+        frame: &mut ScreenBuffer,
+        audio_out: &mut dyn GbaAudioOutput,
+    ) -> bool {
+        let frame_count = self.frame_count();
+        self.step_to(&mut VideoTarget::Frame(frame), audio_out);
+        self.frame_count() != frame_count
+    }
+
+    fn step_to(&mut self, video: &mut VideoTarget, audio_out: &mut dyn GbaAudioOutput) {
         let _unused = audio_out;
 
-        let mut cycles = self.cpu.step(&mut self.mapped);
+        self.wake_up_if_interrupted();
+        let cycles = if self.cpu.halted() {
+            self.scheduler.next_event_in().unwrap_or(Cycles::one())
+        } else {
+            self.cpu.step(&mut self.mapped)
+        };
+        self.process_events(cycles, video);
+    }
+
+    /// Runs the GBA until the last visible line of the current frame has been sent to `video_out`.
+    ///
+    /// Unlike [`Gba::step`], this runs the CPU in batches of instructions that end at the
+    /// next scheduled event instead of checking the scheduler after every instruction.
+    /// While the CPU is halted or stuck in an idle loop, time skips straight to the next event.
+    ///
+    /// Every line goes through a call to [`GbaVideoOutput::gba_line_ready`], which is useful
+    /// for looking at raster effects. [`Gba::run_frame_into`] is faster when only the finished
+    /// frame is needed.
+    pub fn run_frame(
+        &mut self,
+        video_out: &mut dyn GbaVideoOutput,
+        audio_out: &mut dyn GbaAudioOutput,
+    ) {
+        self.run_frame_to(&mut VideoTarget::Lines(video_out), audio_out);
+    }
+
+    /// Runs the GBA until the last visible line of the current frame has been rendered,
+    /// rendering each line straight into its row of `frame`. `frame` is only complete once
+    /// this returns, lines that weren't reached yet keep whatever was in them before.
+    pub fn run_frame_into(&mut self, frame: &mut ScreenBuffer, audio_out: &mut dyn GbaAudioOutput) {
+        self.run_frame_to(&mut VideoTarget::Frame(frame), audio_out);
+    }
+
+    /// Runs the current frame without rendering it, runs `ahead` more frames and renders the
+    /// last of them into `frame`, then goes back to the end of the current frame. `frame`
+    /// shows what the screen will look like `ahead` frames from now if the input stays the
+    /// same, which hides that many frames of a game's input lag.
+    ///
+    /// Only the frame that's shown is rendered, the others only keep the video hardware's
+    /// timing. With `ahead` set to 0 this is the same as [`Gba::run_frame_into`].
+    pub fn run_frame_ahead(
+        &mut self,
+        ahead: u32,
+        frame: &mut ScreenBuffer,
+        audio_out: &mut dyn GbaAudioOutput,
+    ) {
+        #[cfg(feature = "puffin")]
+        puffin::profile_function!();
+
+        if ahead == 0 {
+            self.run_frame_into(frame, audio_out);
+            return;
+        }
+
+        let rendering = self.rendering_enabled();
+        self.set_rendering_enabled(false);
+        self.run_frame_into(frame, audio_out);
+        let snapshot = self.snapshot();
+
+        // The frames that are run ahead are thrown away, so nothing that they output is kept.
+        for _ in 1..ahead {
+            self.run_frame_into(frame, &mut NoopGbaAudioOutput);
+        }
+        self.set_rendering_enabled(rendering);
+        self.run_frame_into(frame, &mut NoopGbaAudioOutput);
+
+        self.restore(&snapshot);
+    }
+
+    fn run_frame_to(&mut self, video: &mut VideoTarget, audio_out: &mut dyn GbaAudioOutput) {
+        let _unused = audio_out;
+
+        let start = Instant::now();
+        let frame = self.frame_count();
+        while self.frame_count() == frame {
+            self.wake_up_if_interrupted();
+            let deadline = self.scheduler.next_event_in().unwrap_or(Cycles::one());
+            let cycles = if self.cpu.halted() {
+                deadline
+            } else {
+                self.cpu.run_until(deadline, &mut self.mapped)
+            };
+            self.process_events(cycles, video);
+        }
+        self.frames_run += 1;
+        self.frame_time += start.elapsed();
+    }
+
+    fn process_events(&mut self, mut cycles: Cycles, video: &mut VideoTarget) {
         while let Some(event) = self.scheduler.tick(&mut cycles) {
-            self.handle_event(event, cycles, video_out);
+            self.events_fired += 1;
+            // The CPU is stopped while any DMA transfers that were started by the event run.
+            cycles += self.handle_event(event, cycles, video);
         }
     }
 
-    fn handle_event(&mut self, event: GbaEvent, _late: Cycles, video_out: &mut dyn GbaVideoOutput) {
+    fn wake_up_if_interrupted(&mut self) {
+        if self.cpu.halted() && self.mapped.system_control.poll_wake_up() {
+            self.cpu.resume();
+        }
+    }
+
+    /// Returns the number of cycles that DMA transfers started by the event took.
+    fn handle_event(&mut self, event: GbaEvent, _late: Cycles, video: &mut VideoTarget) -> Cycles {
         match event {
-            GbaEvent::HDraw => self.mapped.video.begin_hdraw(),
+            GbaEvent::HDraw => {
+                let interrupts = self.mapped.video.begin_hdraw(&mut self.scheduler);
+                self.mapped.system_control.request_interrupts(interrupts);
+                if self.mapped.video.registers.vcount.current_scanline()
+                    == VISIBLE_LINE_COUNT as u16
+                {
+                    self.mapped.trigger_dma(DmaTiming::VBlank, &mut self.cpu)
+                } else {
+                    Cycles::zero()
+                }
+            }
             GbaEvent::HBlank => {
                 let context = HBlankContext {
                     palette: &self.mapped.palram,
                     vram: &self.mapped.vram,
                 };
-                self.mapped.video.begin_hblank(video_out, context);
+                let interrupts =
+                    self.mapped
+                        .video
+                        .begin_hblank(&mut self.scheduler, video, context);
+                self.mapped.system_control.request_interrupts(interrupts);
+                // H-Blank transfers don't happen during V-Blank.
+                if self.mapped.video.registers.vcount.current_scanline() < VISIBLE_LINE_COUNT as u16
+                {
+                    self.mapped.trigger_dma(DmaTiming::HBlank, &mut self.cpu)
+                } else {
+                    Cycles::zero()
+                }
             }
             GbaEvent::Test => unreachable!(),
         }
     }
 
-    pub fn set_gamepak(&mut self, gamepak: Vec<u8>) {
-        self.mapped.set_gamepak(gamepak);
+    /// Inserts a gamepak. This accepts a ROM as a `Vec<u8>`, which is padded and moved into
+    /// a new [`Gamepak`], or an existing [`Gamepak`] which is shared without copying it.
+    pub fn set_gamepak(&mut self, gamepak: impl Into<Gamepak>) {
+        self.mapped.set_gamepak(gamepak.into());
+        // The gamepak is never written to, so nothing else would invalidate its blocks.
+        self.cpu.clear_block_cache();
     }
 
     pub fn set_noop_gamepak(&mut self) {
-        self.mapped.set_gamepak(NOP_ROM.to_vec());
+        self.mapped.set_gamepak(Gamepak::from(&NOP_ROM[..]));
+        self.cpu.clear_block_cache();
+    }
+
+    /// Replaces the custom BIOS with `bios`. Anything after the end of `bios` is zeroed.
+    ///
+    /// # Panics
+    ///
+    /// Panics if `bios` is larger than [`memory::BIOS_SIZE`].
+    pub fn set_bios(&mut self, bios: &[u8]) {
+        assert!(bios.len() <= memory::BIOS_SIZE);
+        self.mapped.bios[..bios.len()].copy_from_slice(bios);
+        self.mapped.bios[bios.len()..].fill(0);
+        self.cpu.clear_block_cache();
+    }
+
+    /// Enables or disables high level emulation of the BIOS math functions (Div, DivArm, Sqrt,
+    /// ArcTan and ArcTan2). When enabled these are computed natively instead of running the
+    /// BIOS's code, but they still take the same number of cycles and leave the same values
+    /// in registers. This is enabled by default because the built in custom BIOS hasn't been
+    /// rebuilt with its own versions of them yet.
+    pub fn set_hle_math_enabled(&mut self, enabled: bool) {
+        self.mapped.hle_math_enabled = enabled;
+    }
+
+    pub fn hle_math_enabled(&self) -> bool {
+        self.mapped.hle_math_enabled
+    }
+
+    /// Enables or disables high level emulation of the BIOS memory functions (CpuSet,
+    /// CpuFastSet and the LZ77 and run-length decompression functions). When enabled these
+    /// copy directly between the memory's backing arrays instead of running the BIOS's code.
+    /// They still take the same number of cycles and leave the same values in registers.
+    /// This is enabled by default because the built in custom BIOS hasn't been rebuilt with
+    /// its own versions of them yet.
+    pub fn set_hle_memory_enabled(&mut self, enabled: bool) {
+        self.mapped.hle_memory_enabled = enabled;
+    }
+
+    pub fn hle_memory_enabled(&self) -> bool {
+        self.mapped.hle_memory_enabled
+    }
+
+    /// Enables or disables high level emulation of the BIOS functions that wait for
+    /// interrupts (Halt, IntrWait and VBlankIntrWait). This is enabled by default because the
+    /// built in custom BIOS doesn't implement them and interrupts aren't delivered to the CPU
+    /// yet. Disable it to run the code of a BIOS set with [`Gba::set_bios`] instead.
+    pub fn set_hle_wait_enabled(&mut self, enabled: bool) {
+        self.mapped.hle_wait_enabled = enabled;
+    }
+
+    pub fn hle_wait_enabled(&self) -> bool {
+        self.mapped.hle_wait_enabled
+    }
+
+    /// Enables or disables rendering lines on another thread. When enabled the CPU keeps
+    /// running while lines are rendered and only waits for the other thread at the end of
+    /// every frame. This produces the same frames, but [`Gba::run_frame`] and [`Gba::step`]
+    /// only send lines to the video output once the whole frame is done.
+    pub fn set_parallel_rendering(&mut self, enabled: bool) {
+        let mapped = &mut self.mapped;
+        mapped
+            .video
+            .set_parallel_rendering(enabled, &mapped.vram, &mapped.palram);
+    }
+
+    pub fn parallel_rendering(&self) -> bool {
+        self.mapped.video.parallel_rendering()
+    }
+
+    /// Enables or disables rendering. While disabled, lines aren't rendered or sent to the
+    /// video output but the video hardware's registers, timing and interrupts are the same
+    /// as they would be otherwise. This is for running frames that won't be shown.
+    pub fn set_rendering_enabled(&mut self, enabled: bool) {
+        self.mapped.video.set_rendering(enabled);
+    }
+
+    pub fn rendering_enabled(&self) -> bool {
+        self.mapped.video.rendering()
     }
 
     pub fn frame_count(&self) -> u64 {
         self.mapped.video.frame
     }
+
+    /// Returns the number of cycles that have been emulated since the GBA was last reset.
+    pub fn cycles(&self) -> u64 {
+        self.scheduler.now()
+    }
+
+    /// Returns counts of what the GBA has done since it was created. Resetting the GBA or
+    /// restoring a snapshot doesn't change these, and frames that are run ahead are counted
+    /// too. Use [`GbaCounters::since`] to get the counts for a stretch of time.
+    pub fn counters(&self) -> GbaCounters {
+        GbaCounters {
+            cpu: *self.cpu.counters(),
+            memory: self.mapped.counters,
+            events: self.events_fired,
+            frames: self.frames_run,
+            frame_time: self.frame_time,
+        }
+    }
 }
 
 impl Default for Gba {
@@ -80,14 +340,34 @@ impl Default for Gba {
     }
 }
 
-// SAFETY: don't let the scheduler escape the GBA
-unsafe impl Send for Gba {}
+// SAFETY: the only part of the GBA that isn't `Sync` is the channel that receives frames from
+//         the render worker, which is only ever used through `&mut self`.
 unsafe impl Sync for Gba {}
 
+/// A GBA is moved between threads by [`pool::GbaPool`], so it has to stay `Send` without
+/// any help.
+const _: fn() = || {
+    fn assert_send<T: Send>() {}
+    assert_send::<Gba>();
+};
+
 pub struct NoopGbaAudioOutput;
 
 pub trait GbaVideoOutput {
+    /// Called with every line once it's rendered, in RGB555 or RGB565 depending on
+    /// [`GbaVideoOutput::pixel_format`].
     fn gba_line_ready(&mut self, line: usize, data: &video::LineBuffer);
+
+    /// The format that lines are converted to before they're sent to this output.
+    fn pixel_format(&self) -> video::PixelFormat {
+        video::PixelFormat::Rgb555
+    }
+
+    /// Called instead of [`GbaVideoOutput::gba_line_ready`] with every line once it's rendered
+    /// if [`GbaVideoOutput::pixel_format`] is [`video::PixelFormat::Rgba8888`].
+    fn gba_rgba_line_ready(&mut self, line: usize, data: &video::RgbaLineBuffer) {
+        let _ = (line, data);
+    }
 }
 
 pub struct NoopGbaVideoOutput;
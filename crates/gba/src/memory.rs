@@ -1,14 +1,102 @@
 mod io_registers;
+pub(crate) mod page_table;
 
 #[cfg(feature = "arm-disassembler")]
 use arm::disasm::MemoryView;
-use arm::emu::{AccessType, Cpu, Memory, Waitstates};
+use arm::emu::{AccessType, CodeTiming, Cpu, Memory, SkippedFetches, Waitstates};
 use byteorder::{ByteOrder, LittleEndian};
 use util::bits::BitOps;
 
 use crate::hardware::GbaMemoryMappedHardware;
 
+use self::page_table::Page;
+
 impl GbaMemoryMappedHardware {
+    /// Called after the CPU wrote `len` bytes to `address` in EWRAM or IWRAM.
+    #[inline(always)]
+    fn ram_written(&mut self, address: u32, len: u32, cpu: &mut Cpu) {
+        self.dirty.ram_written(address);
+
+        // The CPU only invalidates code at the address that it wrote to.
+        let unmirrored = unmirrored_ram_address(address);
+        if unmirrored != address {
+            cpu.invalidate_code(unmirrored, len);
+        }
+    }
+
+    // VRAM and OAM are never mapped for writes so that the video hardware knows which
+    // lines have to be rendered again.
+
+    fn vram_store32(&mut self, offset: usize, value: u32) {
+        if LittleEndian::read_u32(&self.vram[offset..]) != value {
+            LittleEndian::write_u32(&mut self.vram[offset..], value);
+            self.dirty.vram.mark(offset);
+            self.video.vram_changed(offset);
+        }
+    }
+
+    fn vram_store16(&mut self, offset: usize, value: u16) {
+        if LittleEndian::read_u16(&self.vram[offset..]) != value {
+            LittleEndian::write_u16(&mut self.vram[offset..], value);
+            self.dirty.vram.mark(offset);
+            self.video.vram_changed(offset);
+        }
+    }
+
+    fn oam_store32(&mut self, offset: usize, value: u32) {
+        if LittleEndian::read_u32(&self.oam[offset..]) != value {
+            LittleEndian::write_u32(&mut self.oam[offset..], value);
+            self.video.invalidate_lines();
+        }
+    }
+
+    fn oam_store16(&mut self, offset: usize, value: u16) {
+        if LittleEndian::read_u16(&self.oam[offset..]) != value {
+            LittleEndian::write_u16(&mut self.oam[offset..], value);
+            self.video.invalidate_lines();
+        }
+    }
+
+    /// Writes a run of `len` bytes to `destination` straight into `page`, which has to be a
+    /// page that [`run_writable`] allows. This is how DMA and the HLE BIOS functions write
+    /// whole runs of units without going through the memory map. Writes to VRAM and OAM are
+    /// compared with what's already there a chunk at a time, so the video hardware is told
+    /// about the same changes as it would be by the stores in the memory map.
+    ///
+    /// # Safety
+    /// `len` bytes starting at `destination` have to be contiguous in `page`, and the source
+    /// can't start after the destination if they overlap (see [`RunSource::write`]).
+    pub(crate) unsafe fn write_run(
+        &mut self,
+        page: &Page,
+        destination: u32,
+        len: usize,
+        source: RunSource,
+    ) {
+        let dst = page.host(destination);
+        match destination >> 24 {
+            REGION_VRAM => {
+                let offset = vram_offset(destination);
+                write_changed(dst, offset, len, source, |offset| {
+                    self.dirty.vram.mark(offset);
+                    self.video.vram_changed(offset);
+                });
+            }
+            REGION_OAM => {
+                let mut changed = false;
+                let offset = (destination & OAM_MASK) as usize;
+                write_changed(dst, offset, len, source, |_| changed = true);
+                if changed {
+                    self.video.invalidate_lines();
+                }
+            }
+            _ => {
+                source.write(dst, len);
+                self.dirty.ram_range_written(destination, len as u32);
+            }
+        }
+    }
+
     fn gamepak_load32<const AREA: usize>(
         &mut self,
         address: u32,
@@ -100,6 +188,18 @@ impl GbaMemoryMappedHardware {
 impl Memory for GbaMemoryMappedHardware {
     fn load32(&mut self, address: u32, cpu: &mut Cpu) -> (u32, arm::emu::Waitstates) {
         let address = address & !0x3;
+
+        let page = self.page_table.get(address);
+        if page.readable() {
+            // SAFETY: the page is readable and the address is word aligned.
+            let value = unsafe { page.read32(address) };
+            self.last_read_value = value;
+            let timings = &self.system_control.waitstates.pages;
+            let wait = timings.load32(page.timing(), cpu.access_type());
+            self.counters.record(address, wait);
+            return (value, wait);
+        }
+
         let mut wait = Waitstates::zero();
         let value = match address >> 24 {
             REGION_BIOS if address < 0x4000 => {
@@ -149,11 +249,23 @@ impl Memory for GbaMemoryMappedHardware {
             }
         };
         self.last_read_value = value;
+        self.counters.record(address, wait);
         (value, wait)
     }
 
     fn load16(&mut self, address: u32, cpu: &mut Cpu) -> (u16, arm::emu::Waitstates) {
         let address = address & !0x1;
+
+        let page = self.page_table.get(address);
+        if page.readable() {
+            // SAFETY: the page is readable and the address is halfword aligned.
+            let value = unsafe { page.read16(address) };
+            let timings = &self.system_control.waitstates.pages;
+            let wait = timings.load16(page.timing(), cpu.access_type());
+            self.counters.record(address, wait);
+            return (value, wait);
+        }
+
         let mut wait = Waitstates::zero();
         let value = match address >> 24 {
             REGION_BIOS if address < 0x4000 => {
@@ -195,10 +307,22 @@ impl Memory for GbaMemoryMappedHardware {
                 self.last_read_value as u16
             }
         };
+        self.counters.record(address, wait);
         (value, wait)
     }
 
     fn load8(&mut self, address: u32, cpu: &mut Cpu) -> (u8, arm::emu::Waitstates) {
+        let page = self.page_table.get(address);
+        if page.readable() {
+            // SAFETY: the page is readable.
+            let value = unsafe { page.read8(address) };
+            self.last_read_value = value as u32;
+            let timings = &self.system_control.waitstates.pages;
+            let wait = timings.load8(page.timing(), cpu.access_type());
+            self.counters.record(address, wait);
+            return (value, wait);
+        }
+
         let mut wait = Waitstates::zero();
         let value = match address >> 24 {
             0x0 if address < 0x4000 => {
@@ -237,34 +361,117 @@ impl Memory for GbaMemoryMappedHardware {
             }
         };
         self.last_read_value = value as u32;
+        self.counters.record(address, wait);
         (value, wait)
     }
 
+    fn fetch32(&mut self, address: u32, cpu: &mut Cpu) -> (u32, Waitstates) {
+        let address = address & !0x3;
+
+        let page = self.page_table.get_code(address);
+        if page.readable() {
+            // SAFETY: the page is readable and the address is word aligned.
+            let value = unsafe { page.read32(address) };
+            self.last_read_value = value;
+            let timings = &self.system_control.waitstates.pages;
+            let wait = timings.load32(page.timing(), cpu.access_type());
+            self.counters.record(address, wait);
+            return (value, wait);
+        }
+
+        self.load32(address, cpu)
+    }
+
+    fn fetch16(&mut self, address: u32, cpu: &mut Cpu) -> (u16, Waitstates) {
+        let address = address & !0x1;
+
+        let page = self.page_table.get_code(address);
+        if page.readable() {
+            // SAFETY: the page is readable and the address is halfword aligned.
+            let value = unsafe { page.read16(address) };
+            let timings = &self.system_control.waitstates.pages;
+            let wait = timings.load16(page.timing(), cpu.access_type());
+            self.counters.record(address, wait);
+            return (value, wait);
+        }
+
+        self.load16(address, cpu)
+    }
+
+    fn code_timing(&mut self, address: u32, thumb: bool) -> Option<CodeTiming> {
+        // Writes to the first copy of EWRAM and IWRAM don't invalidate code in their mirrors.
+        if unmirrored_ram_address(address) != address {
+            return None;
+        }
+
+        let page = self.page_table.get_code(address);
+        if !page.readable() {
+            return None;
+        }
+        let timings = &self.system_control.waitstates.pages;
+        let wait = |access| {
+            if thumb {
+                timings.load16(page.timing(), access)
+            } else {
+                timings.load32(page.timing(), access)
+            }
+        };
+        Some(CodeTiming {
+            sequential: wait(AccessType::Sequential),
+            nonsequential: wait(AccessType::NonSequential),
+        })
+    }
+
+    fn skipped_fetches(&mut self, fetches: SkippedFetches) {
+        // Same as what fetch32 and fetch16 would have done.
+        if !fetches.thumb {
+            self.last_read_value = fetches.opcode;
+        }
+        self.counters
+            .record_many(fetches.address, fetches.count, fetches.wait);
+    }
+
     fn store32(&mut self, address: u32, value: u32, cpu: &mut Cpu) -> arm::emu::Waitstates {
         let address = address & !0x3;
+
+        let page = self.page_table.get(address);
+        if page.writable() {
+            // SAFETY: the page is writable and the address is word aligned.
+            unsafe { page.write32(address, value) };
+            self.ram_written(address, 4, cpu);
+            let wait = self.system_control.waitstates.pages.store32(page.timing());
+            self.counters.record(address, wait);
+            return wait;
+        }
+
         let mut wait = Waitstates::zero();
         match address >> 24 {
             // FIXME implement enable/disable from SystemControl
             REGION_EWRAM => {
                 wait += self.system_control.waitstates.ewram + self.system_control.waitstates.ewram;
                 LittleEndian::write_u32(&mut self.ewram[(address & EWRAM_MASK) as usize..], value);
+                self.ram_written(address, 4, cpu);
             }
             // FIXME implement enable/disable from SystemControl
             REGION_IWRAM => {
                 LittleEndian::write_u32(&mut self.iwram[(address & IWRAM_MASK) as usize..], value);
+                self.ram_written(address, 4, cpu);
+            }
+            REGION_IOREGS => {
+                self.ioreg_store32(address, value, cpu);
+                wait += self.dma.take_stall();
             }
-            REGION_IOREGS => self.ioreg_store32(address, value),
             REGION_PAL => {
                 wait = Waitstates::one();
-                self.palram.store32(address, value);
+                if self.palram.store32(address, value) {
+                    self.video.palette_changed();
+                }
             }
             REGION_VRAM => {
                 wait = Waitstates::one();
-                LittleEndian::write_u32(&mut self.vram[vram_offset(address)..], value);
-            }
-            REGION_OAM => {
-                LittleEndian::write_u32(&mut self.oam[(address & OAM_MASK) as usize..], value)
+                self.vram_store32(vram_offset(address), value);
             }
+            REGION_OAM => self.oam_store32((address & OAM_MASK) as usize, value),
             REGION_GAMEPAK0_LO | REGION_GAMEPAK0_HI => {
                 self.gamepak_store32::<0>(address, value, cpu.access_type(), &mut wait);
             }
@@ -283,28 +490,47 @@ impl Memory for GbaMemoryMappedHardware {
                 tracing::debug!("32-bit write to unused memory: [0x{address:08X}] = 0x{value:08X}");
             }
         }
+        self.counters.record(address, wait);
         wait
     }
 
     fn store16(&mut self, address: u32, value: u16, cpu: &mut Cpu) -> arm::emu::Waitstates {
         let address = address & !0x1;
+
+        let page = self.page_table.get(address);
+        if page.writable() {
+            // SAFETY: the page is writable and the address is halfword aligned.
+            unsafe { page.write16(address, value) };
+            self.ram_written(address, 2, cpu);
+            let wait = self.system_control.waitstates.pages.store16(page.timing());
+            self.counters.record(address, wait);
+            return wait;
+        }
+
         let mut wait = Waitstates::zero();
         match address >> 24 {
             // FIXME implement enable/disable from SystemControl
             REGION_EWRAM => {
                 wait += self.system_control.waitstates.ewram;
                 LittleEndian::write_u16(&mut self.ewram[(address & EWRAM_MASK) as usize..], value);
+                self.ram_written(address, 2, cpu);
             }
             // FIXME implement enable/disable from SystemControl
             REGION_IWRAM => {
                 LittleEndian::write_u16(&mut self.iwram[(address & IWRAM_MASK) as usize..], value);
+                self.ram_written(address, 2, cpu);
             }
-            REGION_IOREGS => self.ioreg_store16(address, value),
-            REGION_PAL => self.palram.store16(address, value),
-            REGION_VRAM => LittleEndian::write_u16(&mut self.vram[vram_offset(address)..], value),
-            REGION_OAM => {
-                LittleEndian::write_u16(&mut self.oam[(address & OAM_MASK) as usize..], value)
+            REGION_IOREGS => {
+                self.ioreg_store16(address, value, cpu);
+                wait += self.dma.take_stall();
             }
+            REGION_PAL => {
+                if self.palram.store16(address, value) {
+                    self.video.palette_changed();
+                }
+            }
+            REGION_VRAM => self.vram_store16(vram_offset(address), value),
+            REGION_OAM => self.oam_store16((address & OAM_MASK) as usize, value),
             REGION_GAMEPAK0_LO | REGION_GAMEPAK0_HI => {
                 self.gamepak_store16::<0>(address, value, cpu.access_type(), &mut wait);
             }
@@ -323,19 +549,34 @@ impl Memory for GbaMemoryMappedHardware {
                 tracing::debug!("16-bit write to unused memory: [0x{address:08X}] = 0x{value:04X}");
             }
         }
+        self.counters.record(address, wait);
         wait
     }
 
     fn store8(&mut self, address: u32, value: u8, cpu: &mut Cpu) -> arm::emu::Waitstates {
+        let page = self.page_table.get(address);
+        if page.writable8() {
+            // SAFETY: the page is writable with 8-bit stores.
+            unsafe { page.write8(address, value) };
+            self.ram_written(address, 1, cpu);
+            let wait = self.system_control.waitstates.pages.store8(page.timing());
+            self.counters.record(address, wait);
+            return wait;
+        }
+
         let mut wait = Waitstates::zero();
         match address >> 24 {
             // FIXME implement enable/disable from SystemControl
             REGION_EWRAM => {
                 wait += self.system_control.waitstates.ewram;
-                self.ewram[(address & EWRAM_MASK) as usize] = value
+                self.ewram[(address & EWRAM_MASK) as usize] = value;
+                self.ram_written(address, 1, cpu);
             }
             // FIXME implement enable/disable from SystemControl
-            REGION_IWRAM => self.iwram[(address & IWRAM_MASK) as usize] = value,
+            REGION_IWRAM => {
+                self.iwram[(address & IWRAM_MASK) as usize] = value;
+                self.ram_written(address, 1, cpu);
+            }
 
             // Writing 8bit Data to Video Memory
             //      Video Memory (BG, OBJ, OAM, Palette) can be written to in 16bit and 32bit units only.
@@ -347,10 +588,17 @@ impl Memory for GbaMemoryMappedHardware {
             //      Writes to OBJ (6010000h-6017FFFh) (or 6014000h-6017FFFh in Bitmap mode) and to OAM (7000000h-70003FFh) are ignored,
             //      the memory content remains unchanged.
             // FIXME at the moment I just always mirror the byte for VRAM.
-            REGION_IOREGS => self.ioreg_store8(address, value),
-            REGION_PAL => self.palram.store8(address, value),
-            REGION_VRAM => LittleEndian::write_u16(
-                &mut self.vram[vram_offset(address & !0x1)..],
+            REGION_IOREGS => {
+                self.ioreg_store8(address, value, cpu);
+                wait += self.dma.take_stall();
+            }
+            REGION_PAL => {
+                if self.palram.store8(address, value) {
+                    self.video.palette_changed();
+                }
+            }
+            REGION_VRAM => self.vram_store16(
+                vram_offset(address & !0x1),
                 (value as u16).wrapping_mul(0x0101),
             ),
             REGION_OAM => { /* IGNORED */ }
@@ -370,6 +618,7 @@ impl Memory for GbaMemoryMappedHardware {
                 tracing::debug!("8-bit write to unused memory: [0x{address:08X}] = 0x{value:02X}");
             }
         }
+        self.counters.record(address, wait);
         wait
     }
 
@@ -447,9 +696,131 @@ impl MemoryView for GbaMemoryMappedHardware {
     }
 }
 
+/// Returns the address of the first copy of `address` if it is in a mirror of EWRAM or IWRAM,
+/// which are repeated across their whole regions. Other addresses are returned as they are.
+#[inline(always)]
+pub(crate) const fn unmirrored_ram_address(address: u32) -> u32 {
+    match address >> 24 {
+        REGION_EWRAM => (REGION_EWRAM << 24) | (address & EWRAM_MASK),
+        REGION_IWRAM => (REGION_IWRAM << 24) | (address & IWRAM_MASK),
+        _ => address,
+    }
+}
+
+/// Writes to VRAM and OAM are compared with what's already there in chunks of this many
+/// bytes. Rows of pixels in every bitmap mode and tiles both start at a multiple of it, so a
+/// chunk that changed only ever changes a single line or tile.
+pub(crate) const COMPARE_CHUNK: usize = 16;
+
+/// True if units of `size` bytes can be written to `address` in `page` with
+/// [`GbaMemoryMappedHardware::write_run`]. VRAM and OAM are only mapped for reads so that
+/// writes to them don't go unnoticed, but runs of halfwords and words can still be written to
+/// them that way. Their 8-bit writes are special and always go through the memory map.
+pub(crate) fn run_writable(page: &Page, address: u32, size: u32) -> bool {
+    match address >> 24 {
+        REGION_VRAM | REGION_OAM => page.readable() && size >= 2,
+        _ => page.writable() && (size >= 2 || page.writable8()),
+    }
+}
+
+/// Where the units of a run come from.
+#[derive(Clone, Copy)]
+pub(crate) enum RunSource {
+    /// The source increments along with the destination.
+    Copy(*const u8),
+    /// The source is fixed so the same unit is written over and over. It's repeated across
+    /// the whole chunk.
+    Fill([u8; COMPARE_CHUNK]),
+}
+
+impl RunSource {
+    /// A fill with `unit`, which is `size` bytes.
+    pub(crate) fn fill(unit: u32, size: u32) -> Self {
+        let word = match size {
+            1 => (unit & 0xFF) * 0x01010101,
+            2 => (unit & 0xFFFF) * 0x00010001,
+            _ => unit,
+        };
+        let mut pattern = [0; COMPARE_CHUNK];
+        for bytes in pattern.chunks_exact_mut(4) {
+            bytes.copy_from_slice(&word.to_le_bytes());
+        }
+        RunSource::Fill(pattern)
+    }
+
+    /// Reads `buffer.len()` bytes starting `offset` bytes into the run, which has to be a
+    /// multiple of the unit size.
+    ///
+    /// # Safety
+    /// The bytes have to be inside of the run.
+    unsafe fn read(&self, offset: usize, buffer: &mut [u8]) {
+        match self {
+            RunSource::Copy(src) => {
+                std::ptr::copy_nonoverlapping(src.add(offset), buffer.as_mut_ptr(), buffer.len())
+            }
+            RunSource::Fill(pattern) => buffer.copy_from_slice(&pattern[..buffer.len()]),
+        }
+    }
+
+    /// Writes the whole run to `dst`.
+    ///
+    /// # Safety
+    /// `dst` has to be valid for `len` bytes, and the source can't start after it if they
+    /// overlap.
+    unsafe fn write(&self, dst: *mut u8, len: usize) {
+        match self {
+            RunSource::Copy(src) => std::ptr::copy(*src, dst, len),
+            RunSource::Fill(pattern) => {
+                let dst = std::slice::from_raw_parts_mut(dst, len);
+                for chunk in dst.chunks_mut(COMPARE_CHUNK) {
+                    chunk.copy_from_slice(&pattern[..chunk.len()]);
+                }
+            }
+        }
+    }
+}
+
+/// Writes the run to `dst` one chunk at a time and calls `changed` with the offset of every
+/// chunk whose bytes were different. `offset` is the offset of `dst` in the memory that it's
+/// in and chunks are aligned to [`COMPARE_CHUNK`] bytes in that memory.
+///
+/// # Safety
+/// Same as [`RunSource::write`].
+unsafe fn write_changed(
+    dst: *mut u8,
+    offset: usize,
+    len: usize,
+    source: RunSource,
+    mut changed: impl FnMut(usize),
+) {
+    let mut done = 0;
+    while done < len {
+        let chunk_len = (COMPARE_CHUNK - (offset + done) % COMPARE_CHUNK).min(len - done);
+        let mut chunk = [0; COMPARE_CHUNK];
+        let chunk = &mut chunk[..chunk_len];
+        source.read(done, chunk);
+        if std::slice::from_raw_parts(dst.add(done), chunk_len) != chunk {
+            std::ptr::copy_nonoverlapping(chunk.as_ptr(), dst.add(done), chunk_len);
+            changed(offset + done);
+        }
+        done += chunk_len;
+    }
+}
+
+/// Lets the CPU know that `len` bytes of code starting at `address` might have changed.
+/// Code is only cached from the first copy of EWRAM and IWRAM, so for a mirror that is
+/// invalidated as well.
+pub(crate) fn invalidate_code(cpu: &mut Cpu, address: u32, len: u32) {
+    cpu.invalidate_code(address, len);
+    let unmirrored = unmirrored_ram_address(address);
+    if unmirrored != address {
+        cpu.invalidate_code(unmirrored, len);
+    }
+}
+
 /// Converts an address in the range [0x06000000, 0x06FFFFFF] into an offset in VRAM accounting
 /// for VRAM mirroring.
-const fn vram_offset(address: u32) -> usize {
+pub(crate) const fn vram_offset(address: u32) -> usize {
     // Even though VRAM is sized 96K (64K+32K), it is repeated in steps of 128K (64K+32K+32K,
     // the two 32K blocks itself being mirrors of each other).
     let vram128 = address % (128 * 1024); // offset in a 128KB block
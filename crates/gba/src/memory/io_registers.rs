@@ -1,7 +1,8 @@
+use arm::emu::Cpu;
 use pyrite_derive::IoRegister;
 use util::display::hex;
 
-use crate::GbaMemoryMappedHardware;
+use crate::{video::registers::GbaVideoRegisters, GbaMemoryMappedHardware};
 
 use super::IoRegister;
 
@@ -12,6 +13,31 @@ impl GbaMemoryMappedHardware {
             self::GREENSWAP => self.video.registers.green_swap.read(),
             self::DISPSTAT => self.video.registers.dispstat.read(),
             self::VCOUNT => self.video.registers.vcount.read(),
+            self::BG0CNT => self.video.registers.bgcnt[0].read(),
+            self::BG1CNT => self.video.registers.bgcnt[1].read(),
+            self::BG2CNT => self.video.registers.bgcnt[2].read(),
+            self::BG3CNT => self.video.registers.bgcnt[3].read(),
+            self::WIN0H => self.video.registers.win0h.read(),
+            self::WIN1H => self.video.registers.win1h.read(),
+            self::WIN0V => self.video.registers.win0v.read(),
+            self::WIN1V => self.video.registers.win1v.read(),
+            self::WININ => self.video.registers.winin.read(),
+            self::WINOUT => self.video.registers.winout.read(),
+            self::BLDCNT => self.video.registers.bldcnt.read(),
+            self::BLDALPHA => self.video.registers.bldalpha.read(),
+            self::BLDY => self.video.registers.bldy.read(),
+            self::DMA0CNT_H => self.dma.channels[0].control.read(),
+            self::DMA1CNT_H => self.dma.channels[1].control.read(),
+            self::DMA2CNT_H => self.dma.channels[2].control.read(),
+            self::DMA3CNT_H => self.dma.channels[3].control.read(),
+            // The addresses and counts of the DMA channels are write only.
+            self::DMA0SAD..=self::DMA3CNT_L => 0,
+            self::IE => self.system_control.interrupt_enable.read(),
+            self::IF => self.system_control.interrupt_request.read(),
+            self::IME => self.system_control.interrupt_master_enable.read(),
+            self::IME_HI => 0,
+            // HALTCNT is write only.
+            self::POSTFLG => self.system_control.postflg as u16,
             _ => {
                 tracing::debug!(address = hex(address), "unimplemented read from IO");
                 0
@@ -19,12 +45,79 @@ impl GbaMemoryMappedHardware {
         }
     }
 
-    pub(super) fn ioreg_store16(&mut self, address: u32, value: u16) {
+    pub(super) fn ioreg_store16(&mut self, address: u32, value: u16, cpu: &mut Cpu) {
         match address {
-            self::DISPCNT => self.video.registers.dispcnt.write(value),
-            self::GREENSWAP => self.video.registers.green_swap.write(value),
+            self::DISPCNT => self.write_display(|r| &mut r.dispcnt, value),
+            self::GREENSWAP => self.write_display(|r| &mut r.green_swap, value),
             self::DISPSTAT => self.video.registers.dispstat.write(value),
             self::VCOUNT => self.video.registers.vcount.write(value),
+            self::BG0CNT => self.write_display(|r| &mut r.bgcnt[0], value),
+            self::BG1CNT => self.write_display(|r| &mut r.bgcnt[1], value),
+            self::BG2CNT => self.write_display(|r| &mut r.bgcnt[2], value),
+            self::BG3CNT => self.write_display(|r| &mut r.bgcnt[3], value),
+            self::BG0HOFS => self.write_display(|r| &mut r.bghofs[0], value),
+            self::BG0VOFS => self.write_display(|r| &mut r.bgvofs[0], value),
+            self::BG1HOFS => self.write_display(|r| &mut r.bghofs[1], value),
+            self::BG1VOFS => self.write_display(|r| &mut r.bgvofs[1], value),
+            self::BG2HOFS => self.write_display(|r| &mut r.bghofs[2], value),
+            self::BG2VOFS => self.write_display(|r| &mut r.bgvofs[2], value),
+            self::BG3HOFS => self.write_display(|r| &mut r.bghofs[3], value),
+            self::BG3VOFS => self.write_display(|r| &mut r.bgvofs[3], value),
+            self::BG2PA => self.write_display(|r| &mut r.affine[0].pa, value),
+            self::BG2PB => self.write_display(|r| &mut r.affine[0].pb, value),
+            self::BG2PC => self.write_display(|r| &mut r.affine[0].pc, value),
+            self::BG2PD => self.write_display(|r| &mut r.affine[0].pd, value),
+            self::BG3PA => self.write_display(|r| &mut r.affine[1].pa, value),
+            self::BG3PB => self.write_display(|r| &mut r.affine[1].pb, value),
+            self::BG3PC => self.write_display(|r| &mut r.affine[1].pc, value),
+            self::BG3PD => self.write_display(|r| &mut r.affine[1].pd, value),
+            self::BG2X | self::BG2X_H | self::BG2Y | self::BG2Y_H => {
+                self.video.write_reference_point(address, value)
+            }
+            self::BG3X | self::BG3X_H | self::BG3Y | self::BG3Y_H => {
+                self.video.write_reference_point(address, value)
+            }
+            self::WIN0H => self.write_display(|r| &mut r.win0h, value),
+            self::WIN1H => self.write_display(|r| &mut r.win1h, value),
+            self::WIN0V => self.write_display(|r| &mut r.win0v, value),
+            self::WIN1V => self.write_display(|r| &mut r.win1v, value),
+            self::WININ => self.write_display(|r| &mut r.winin, value),
+            self::WINOUT => self.write_display(|r| &mut r.winout, value),
+            self::BLDCNT => self.write_display(|r| &mut r.bldcnt, value),
+            self::BLDALPHA => self.write_display(|r| &mut r.bldalpha, value),
+            self::BLDY => self.write_display(|r| &mut r.bldy, value),
+            self::DMA0SAD => self.dma.channels[0].write_source(false, value),
+            self::DMA0SAD_H => self.dma.channels[0].write_source(true, value),
+            self::DMA0DAD => self.dma.channels[0].write_destination(false, value),
+            self::DMA0DAD_H => self.dma.channels[0].write_destination(true, value),
+            self::DMA0CNT_L => self.dma.channels[0].count = value,
+            self::DMA0CNT_H => self.write_dma_control(0, value, cpu),
+            self::DMA1SAD => self.dma.channels[1].write_source(false, value),
+            self::DMA1SAD_H => self.dma.channels[1].write_source(true, value),
+            self::DMA1DAD => self.dma.channels[1].write_destination(false, value),
+            self::DMA1DAD_H => self.dma.channels[1].write_destination(true, value),
+            self::DMA1CNT_L => self.dma.channels[1].count = value,
+            self::DMA1CNT_H => self.write_dma_control(1, value, cpu),
+            self::DMA2SAD => self.dma.channels[2].write_source(false, value),
+            self::DMA2SAD_H => self.dma.channels[2].write_source(true, value),
+            self::DMA2DAD => self.dma.channels[2].write_destination(false, value),
+            self::DMA2DAD_H => self.dma.channels[2].write_destination(true, value),
+            self::DMA2CNT_L => self.dma.channels[2].count = value,
+            self::DMA2CNT_H => self.write_dma_control(2, value, cpu),
+            self::DMA3SAD => self.dma.channels[3].write_source(false, value),
+            self::DMA3SAD_H => self.dma.channels[3].write_source(true, value),
+            self::DMA3DAD => self.dma.channels[3].write_destination(false, value),
+            self::DMA3DAD_H => self.dma.channels[3].write_destination(true, value),
+            self::DMA3CNT_L => self.dma.channels[3].count = value,
+            self::DMA3CNT_H => self.write_dma_control(3, value, cpu),
+            self::IE => self.system_control.interrupt_enable.write(value),
+            self::IF => self.system_control.write_interrupt_request(value),
+            self::IME => self.system_control.interrupt_master_enable.write(value),
+            self::IME_HI => {}
+            self::POSTFLG => {
+                self.system_control.postflg = value as u8;
+                self.write_haltcnt((value >> 8) as u8, cpu);
+            }
             _ => {
                 tracing::debug!(
                     address = hex(address),
@@ -41,24 +134,70 @@ impl GbaMemoryMappedHardware {
         lo | (hi << 16)
     }
 
-    pub(super) fn ioreg_store32(&mut self, address: u32, value: u32) {
-        self.ioreg_store16(address, value as u16);
-        self.ioreg_store16(address.wrapping_add(2), (value >> 16) as u16);
+    pub(super) fn ioreg_store32(&mut self, address: u32, value: u32, cpu: &mut Cpu) {
+        self.ioreg_store16(address, value as u16, cpu);
+        self.ioreg_store16(address.wrapping_add(2), (value >> 16) as u16, cpu);
     }
 
     pub(super) fn ioreg_load8(&mut self, address: u32) -> u8 {
         (self.ioreg_load16(address & !0x1) >> ((address & 1) * 8)) as u8
     }
 
-    pub(super) fn ioreg_store8(&mut self, address: u32, value: u8) {
-        let old = self.ioreg_load16(address & !0x1);
-        if (value & 1) == 0 {
+    pub(super) fn ioreg_store8(&mut self, address: u32, value: u8, cpu: &mut Cpu) {
+        match address {
+            self::POSTFLG => {
+                self.system_control.postflg = value;
+                return;
+            }
+            self::HALTCNT => {
+                self.write_haltcnt(value, cpu);
+                return;
+            }
+            _ => {}
+        }
+
+        let old = match address & !0x1 {
+            // Writing the old value back to IF would acknowledge every interrupt
+            // in the other half of the register.
+            self::IF => 0,
+            aligned => self.ioreg_load16(aligned),
+        };
+
+        if (address & 1) == 0 {
             // write low
-            self.ioreg_store16(address & !0x1, (old & 0xFF00) | (value as u16))
+            self.ioreg_store16(address & !0x1, (old & 0xFF00) | (value as u16), cpu)
         } else {
             // write high
-            self.ioreg_store16(address & !0x1, (old & 0x00FF) | ((value as u16) << 8))
+            self.ioreg_store16(address & !0x1, (old & 0x00FF) | ((value as u16) << 8), cpu)
+        }
+    }
+
+    /// Writes a video register that changes what is displayed. Every line has to be rendered
+    /// again if its value changed.
+    fn write_display<R>(
+        &mut self,
+        register: impl FnOnce(&mut GbaVideoRegisters) -> &mut R,
+        value: u16,
+    ) where
+        R: IoRegister<u16> + Into<u16>,
+    {
+        let register = register(&mut self.video.registers);
+        let old: u16 = (*register).into();
+        register.write(value);
+        if (*register).into() != old {
+            self.video.invalidate_lines();
+        }
+    }
+
+    /// 4000301h - HALTCNT - Undocumented - Low Power Mode Control (W)
+    /// Bit 7 selects between Halt (0) and Stop (1). Stop mode is treated as Halt since
+    /// nothing that would wake the GBA up from it is emulated yet.
+    fn write_haltcnt(&mut self, value: u8, cpu: &mut Cpu) {
+        if (value & 0x80) != 0 {
+            tracing::debug!("stop mode is not implemented, halting instead");
         }
+        self.system_control.intr_wait = None;
+        cpu.halt();
     }
 }
 
@@ -79,45 +218,45 @@ pub const DISPCNT: u32 = 0x04000000;
 pub const GREENSWAP: u32 = 0x04000002;
 pub const DISPSTAT: u32 = 0x04000004;
 pub const VCOUNT: u32 = 0x04000006;
-// pub const BG0CNT: u32 = 0x04000008;
-// pub const BG1CNT: u32 = 0x0400000A;
-// pub const BG2CNT: u32 = 0x0400000C;
-// pub const BG3CNT: u32 = 0x0400000E;
-// pub const BG0HOFS: u32 = 0x04000010;
-// pub const BG0VOFS: u32 = 0x04000012;
-// pub const BG1HOFS: u32 = 0x04000014;
-// pub const BG1VOFS: u32 = 0x04000016;
-// pub const BG2HOFS: u32 = 0x04000018;
-// pub const BG2VOFS: u32 = 0x0400001A;
-// pub const BG3HOFS: u32 = 0x0400001C;
-// pub const BG3VOFS: u32 = 0x0400001E;
-// pub const BG2PA: u32 = 0x04000020;
-// pub const BG2PB: u32 = 0x04000022;
-// pub const BG2PC: u32 = 0x04000024;
-// pub const BG2PD: u32 = 0x04000026;
-// pub const BG2X: u32 = 0x04000028;
-// pub const BG2X_H: u32 = 0x0400002A;
-// pub const BG2Y: u32 = 0x0400002C;
-// pub const BG2Y_H: u32 = 0x0400002E;
-// pub const BG3PA: u32 = 0x04000030;
-// pub const BG3PB: u32 = 0x04000032;
-// pub const BG3PC: u32 = 0x04000034;
-// pub const BG3PD: u32 = 0x04000036;
-// pub const BG3X: u32 = 0x04000038;
-// pub const BG3X_H: u32 = 0x0400003A;
-// pub const BG3Y: u32 = 0x0400003C;
-// pub const BG3Y_H: u32 = 0x0400003E;
-// pub const WIN0H: u32 = 0x04000040;
-// pub const WIN1H: u32 = 0x04000042;
-// pub const WIN0V: u32 = 0x04000044;
-// pub const WIN1V: u32 = 0x04000046;
-// pub const WININ: u32 = 0x04000048;
-// pub const WINOUT: u32 = 0x0400004A;
+pub const BG0CNT: u32 = 0x04000008;
+pub const BG1CNT: u32 = 0x0400000A;
+pub const BG2CNT: u32 = 0x0400000C;
+pub const BG3CNT: u32 = 0x0400000E;
+pub const BG0HOFS: u32 = 0x04000010;
+pub const BG0VOFS: u32 = 0x04000012;
+pub const BG1HOFS: u32 = 0x04000014;
+pub const BG1VOFS: u32 = 0x04000016;
+pub const BG2HOFS: u32 = 0x04000018;
+pub const BG2VOFS: u32 = 0x0400001A;
+pub const BG3HOFS: u32 = 0x0400001C;
+pub const BG3VOFS: u32 = 0x0400001E;
+pub const BG2PA: u32 = 0x04000020;
+pub const BG2PB: u32 = 0x04000022;
+pub const BG2PC: u32 = 0x04000024;
+pub const BG2PD: u32 = 0x04000026;
+pub const BG2X: u32 = 0x04000028;
+pub const BG2X_H: u32 = 0x0400002A;
+pub const BG2Y: u32 = 0x0400002C;
+pub const BG2Y_H: u32 = 0x0400002E;
+pub const BG3PA: u32 = 0x04000030;
+pub const BG3PB: u32 = 0x04000032;
+pub const BG3PC: u32 = 0x04000034;
+pub const BG3PD: u32 = 0x04000036;
+pub const BG3X: u32 = 0x04000038;
+pub const BG3X_H: u32 = 0x0400003A;
+pub const BG3Y: u32 = 0x0400003C;
+pub const BG3Y_H: u32 = 0x0400003E;
+pub const WIN0H: u32 = 0x04000040;
+pub const WIN1H: u32 = 0x04000042;
+pub const WIN0V: u32 = 0x04000044;
+pub const WIN1V: u32 = 0x04000046;
+pub const WININ: u32 = 0x04000048;
+pub const WINOUT: u32 = 0x0400004A;
 // pub const MOSAIC: u32 = 0x0400004C;
 // pub const MOSAIC_HI: u32 = 0x0400004E;
-// pub const BLDCNT: u32 = 0x04000050;
-// pub const BLDALPHA: u32 = 0x04000052;
-// pub const BLDY: u32 = 0x04000054;
+pub const BLDCNT: u32 = 0x04000050;
+pub const BLDALPHA: u32 = 0x04000052;
+pub const BLDY: u32 = 0x04000054;
 // pub const BLDY_H: u32 = 0x04000056;
 
 // // Sound Registers
@@ -187,31 +326,31 @@ pub const VCOUNT: u32 = 0x04000006;
 // pub const NR51: u32 = 0x04000081;
 // pub const NR52: u32 = 0x04000084;
 
-// // DMA Transfer Channels
-// pub const DMA0SAD: u32 = 0x040000B0;
-// pub const DMA0SAD_H: u32 = 0x040000B2;
-// pub const DMA0DAD: u32 = 0x040000B4;
-// pub const DMA0DAD_H: u32 = 0x040000B6;
-// pub const DMA0CNT_L: u32 = 0x040000B8;
-// pub const DMA0CNT_H: u32 = 0x040000BA;
-// pub const DMA1SAD: u32 = 0x040000BC;
-// pub const DMA1SAD_H: u32 = 0x040000BE;
-// pub const DMA1DAD: u32 = 0x040000C0;
-// pub const DMA1DAD_H: u32 = 0x040000C2;
-// pub const DMA1CNT_L: u32 = 0x040000C4;
-// pub const DMA1CNT_H: u32 = 0x040000C6;
-// pub const DMA2SAD: u32 = 0x040000C8;
-// pub const DMA2SAD_H: u32 = 0x040000CA;
-// pub const DMA2DAD: u32 = 0x040000CC;
-// pub const DMA2DAD_H: u32 = 0x040000CE;
-// pub const DMA2CNT_L: u32 = 0x040000D0;
-// pub const DMA2CNT_H: u32 = 0x040000D2;
-// pub const DMA3SAD: u32 = 0x040000D4;
-// pub const DMA3SAD_H: u32 = 0x040000D6;
-// pub const DMA3DAD: u32 = 0x040000D8;
-// pub const DMA3DAD_H: u32 = 0x040000DA;
-// pub const DMA3CNT_L: u32 = 0x040000DC;
-// pub const DMA3CNT_H: u32 = 0x040000DE;
+// DMA Transfer Channels
+pub const DMA0SAD: u32 = 0x040000B0;
+pub const DMA0SAD_H: u32 = 0x040000B2;
+pub const DMA0DAD: u32 = 0x040000B4;
+pub const DMA0DAD_H: u32 = 0x040000B6;
+pub const DMA0CNT_L: u32 = 0x040000B8;
+pub const DMA0CNT_H: u32 = 0x040000BA;
+pub const DMA1SAD: u32 = 0x040000BC;
+pub const DMA1SAD_H: u32 = 0x040000BE;
+pub const DMA1DAD: u32 = 0x040000C0;
+pub const DMA1DAD_H: u32 = 0x040000C2;
+pub const DMA1CNT_L: u32 = 0x040000C4;
+pub const DMA1CNT_H: u32 = 0x040000C6;
+pub const DMA2SAD: u32 = 0x040000C8;
+pub const DMA2SAD_H: u32 = 0x040000CA;
+pub const DMA2DAD: u32 = 0x040000CC;
+pub const DMA2DAD_H: u32 = 0x040000CE;
+pub const DMA2CNT_L: u32 = 0x040000D0;
+pub const DMA2CNT_H: u32 = 0x040000D2;
+pub const DMA3SAD: u32 = 0x040000D4;
+pub const DMA3SAD_H: u32 = 0x040000D6;
+pub const DMA3DAD: u32 = 0x040000D8;
+pub const DMA3DAD_H: u32 = 0x040000DA;
+pub const DMA3CNT_L: u32 = 0x040000DC;
+pub const DMA3CNT_H: u32 = 0x040000DE;
 
 // // Timer Registers
 // pub const TM0CNT_L: u32 = 0x04000100;
@@ -248,14 +387,14 @@ pub const VCOUNT: u32 = 0x04000006;
 // pub const JOYSTAT: u32 = 0x04000158;
 
 // // Interrupt, Waitstate, and Power-Down Control
-// pub const IE: u32 = 0x04000200;
-// pub const IF: u32 = 0x04000202;
+pub const IE: u32 = 0x04000200;
+pub const IF: u32 = 0x04000202;
 // pub const IF_HI: u32 = 0x04000203;
 // pub const WAITCNT: u32 = 0x04000204;
-// pub const IME: u32 = 0x04000208;
-// pub const IME_HI: u32 = 0x0400020A;
-// pub const POSTFLG: u32 = 0x04000300;
-// pub const HALTCNT: u32 = 0x04000301;
+pub const IME: u32 = 0x04000208;
+pub const IME_HI: u32 = 0x0400020A;
+pub const POSTFLG: u32 = 0x04000300;
+pub const HALTCNT: u32 = 0x04000301;
 // pub const BUG410: u32 = 0x04000410;
 // pub const IMC: u32 = 0x04000800;
 // pub const IMC_H: u32 = 0x04000802;
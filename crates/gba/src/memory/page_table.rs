@@ -0,0 +1,381 @@
+use std::ops::RangeInclusive;
+
+use arm::emu::{AccessType, Waitstates};
+
+use crate::hardware::system_control::SystemWaitstates;
+
+pub const PAGE_SHIFT: u32 = 14;
+pub const PAGE_SIZE: usize = 1 << PAGE_SHIFT;
+
+/// Only the lower 28 bits of the address bus have anything mapped to them so the page table
+/// doesn't contain any pages for addresses above 0x0FFFFFFF.
+const PAGE_COUNT: usize = 0x10000000 >> PAGE_SHIFT;
+
+pub const TIMING_NONE: u8 = 0;
+pub const TIMING_EWRAM: u8 = 1;
+pub const TIMING_VRAM: u8 = 2;
+pub const TIMING_GAMEPAK0: u8 = 3;
+pub const TIMING_GAMEPAK1: u8 = 4;
+pub const TIMING_GAMEPAK2: u8 = 5;
+const TIMING_COUNT: usize = 6;
+
+/// A page of memory that can be accessed directly without going through the memory map.
+///
+/// Pages point at the memory that they map, so whatever owns that memory must not move
+/// or free it without rebuilding the page table.
+#[derive(Clone, Copy)]
+pub struct Page {
+    ptr: *mut u8,
+    mask: u32,
+    flags: u8,
+    timing: u8,
+}
+
+impl Page {
+    pub const READ: u8 = 0x1;
+    pub const WRITE: u8 = 0x2;
+    /// 8-bit writes are handled separately because they have special behavior
+    /// in most of video memory.
+    pub const WRITE8: u8 = 0x4;
+
+    const UNMAPPED: Page = Page {
+        ptr: std::ptr::null_mut(),
+        mask: 0,
+        flags: 0,
+        timing: TIMING_NONE,
+    };
+
+    #[inline(always)]
+    pub fn readable(&self) -> bool {
+        (self.flags & Self::READ) != 0
+    }
+
+    #[inline(always)]
+    pub fn writable(&self) -> bool {
+        (self.flags & Self::WRITE) != 0
+    }
+
+    #[inline(always)]
+    pub fn writable8(&self) -> bool {
+        (self.flags & Self::WRITE8) != 0
+    }
+
+    #[inline(always)]
+    pub fn timing(&self) -> u8 {
+        self.timing
+    }
+
+    /// Returns a pointer to the byte that `address` is mapped to. The bytes after it up to
+    /// [`Page::contiguous_len`] are mapped to the addresses after `address`.
+    #[inline(always)]
+    pub fn host(&self, address: u32) -> *mut u8 {
+        // SAFETY: pages are only mapped with a mask that keeps the offset inside of the memory
+        //         that the page points to.
+        unsafe { self.ptr.add((address & self.mask) as usize) }
+    }
+
+    /// The number of bytes starting at `address` that are next to each other in the memory
+    /// that the page points to. This is never more than [`PAGE_SIZE`].
+    #[inline(always)]
+    pub fn contiguous_len(&self, address: u32) -> usize {
+        (self.mask - (address & self.mask)) as usize + 1
+    }
+
+    /// # Safety
+    /// The page must be readable and `address` must be word aligned.
+    #[inline(always)]
+    pub unsafe fn read32(&self, address: u32) -> u32 {
+        u32::from_le_bytes(self.host(address).cast::<[u8; 4]>().read_unaligned())
+    }
+
+    /// # Safety
+    /// The page must be readable and `address` must be halfword aligned.
+    #[inline(always)]
+    pub unsafe fn read16(&self, address: u32) -> u16 {
+        u16::from_le_bytes(self.host(address).cast::<[u8; 2]>().read_unaligned())
+    }
+
+    /// # Safety
+    /// The page must be readable.
+    #[inline(always)]
+    pub unsafe fn read8(&self, address: u32) -> u8 {
+        self.host(address).read()
+    }
+
+    /// # Safety
+    /// The page must be writable and `address` must be word aligned.
+    #[inline(always)]
+    pub unsafe fn write32(&self, address: u32, value: u32) {
+        self.host(address)
+            .cast::<[u8; 4]>()
+            .write_unaligned(value.to_le_bytes())
+    }
+
+    /// # Safety
+    /// The page must be writable and `address` must be halfword aligned.
+    #[inline(always)]
+    pub unsafe fn write16(&self, address: u32, value: u16) {
+        self.host(address)
+            .cast::<[u8; 2]>()
+            .write_unaligned(value.to_le_bytes())
+    }
+
+    /// # Safety
+    /// The page must be writable with 8-bit stores.
+    #[inline(always)]
+    pub unsafe fn write8(&self, address: u32, value: u8) {
+        self.host(address).write(value)
+    }
+}
+
+pub struct PageTable {
+    pages: Box<[Page]>,
+
+    /// The page that instructions were last fetched from and its index. Code usually stays
+    /// in the same page for a while so this saves a lookup for most fetches.
+    code_page: Page,
+    code_page_index: u32,
+}
+
+impl PageTable {
+    #[inline(always)]
+    pub fn get(&self, address: u32) -> Page {
+        self.pages
+            .get((address >> PAGE_SHIFT) as usize)
+            .copied()
+            .unwrap_or(Page::UNMAPPED)
+    }
+
+    /// Same as [`PageTable::get`] but meant to be used for instruction fetches.
+    #[inline(always)]
+    pub fn get_code(&mut self, address: u32) -> Page {
+        let index = address >> PAGE_SHIFT;
+        if index != self.code_page_index {
+            self.code_page = self.get(address);
+            self.code_page_index = index;
+        }
+        self.code_page
+    }
+
+    pub fn unmap_all(&mut self) {
+        self.pages.fill(Page::UNMAPPED);
+        self.code_page = Page::UNMAPPED;
+        self.code_page_index = u32::MAX;
+    }
+
+    /// Maps every page in `addresses` to memory starting at `base`. `offset` returns the offset
+    /// into that memory for the first address in a page.
+    ///
+    /// # Safety
+    /// For every page, `base + offset(page_address)` must point to at least
+    /// [`PAGE_SIZE`] bytes, or `size` bytes if `size` is smaller than [`PAGE_SIZE`],
+    /// that remain valid until the page is unmapped. `size` must be a power of two and at least 4.
+    pub unsafe fn map<F>(
+        &mut self,
+        addresses: RangeInclusive<u32>,
+        base: *mut u8,
+        size: usize,
+        flags: u8,
+        timing: u8,
+        offset: F,
+    ) where
+        F: Fn(u32) -> usize,
+    {
+        debug_assert!(size.is_power_of_two() && size >= 4);
+
+        let first = addresses.start() >> PAGE_SHIFT;
+        let last = addresses.end() >> PAGE_SHIFT;
+        for index in first..=last {
+            let page_address = index << PAGE_SHIFT;
+            self.pages[index as usize] = Page {
+                ptr: base.add(offset(page_address)),
+                mask: (size.min(PAGE_SIZE) - 1) as u32,
+                flags,
+                timing,
+            };
+        }
+    }
+}
+
+// SAFETY: pages only point into memory that's owned by whatever owns the page table, which
+//         moves between threads along with it.
+unsafe impl Send for PageTable {}
+unsafe impl Sync for PageTable {}
+
+impl Default for PageTable {
+    fn default() -> Self {
+        PageTable {
+            pages: vec![Page::UNMAPPED; PAGE_COUNT].into_boxed_slice(),
+            code_page: Page::UNMAPPED,
+            code_page_index: u32::MAX,
+        }
+    }
+}
+
+/// Waitstates for each kind of access to a page with a given timing.
+#[derive(Default, Debug, Clone, Copy)]
+pub struct AccessTimings {
+    /// Indexed by the size of the access (8, 16, 32) and then by [`access_index`].
+    load: [[Waitstates; 2]; 3],
+    store: [Waitstates; 3],
+}
+
+#[derive(Default, Debug)]
+pub struct PageTimings {
+    timings: [AccessTimings; TIMING_COUNT],
+}
+
+impl PageTimings {
+    pub fn new(waitstates: &SystemWaitstates) -> Self {
+        let mut timings = [AccessTimings::default(); TIMING_COUNT];
+
+        let ewram = waitstates.ewram;
+        timings[TIMING_EWRAM as usize] = AccessTimings {
+            load: [[ewram + ewram; 2], [ewram; 2], [ewram + ewram; 2]],
+            store: [ewram, ewram, ewram + ewram],
+        };
+
+        timings[TIMING_VRAM as usize] = AccessTimings {
+            load: [
+                [Waitstates::zero(); 2],
+                [Waitstates::zero(); 2],
+                [Waitstates::one(); 2],
+            ],
+            store: [Waitstates::zero(), Waitstates::zero(), Waitstates::one()],
+        };
+
+        for (area, (first, second)) in waitstates.gamepak.iter().copied().enumerate() {
+            timings[TIMING_GAMEPAK0 as usize + area] = AccessTimings {
+                load: [
+                    [second, first],
+                    [second, first],
+                    [second + second, first + second],
+                ],
+                store: [Waitstates::zero(); 3],
+            };
+        }
+
+        PageTimings { timings }
+    }
+
+    #[inline(always)]
+    pub fn load8(&self, timing: u8, access_type: AccessType) -> Waitstates {
+        self.timings[timing as usize].load[0][access_index(access_type)]
+    }
+
+    #[inline(always)]
+    pub fn load16(&self, timing: u8, access_type: AccessType) -> Waitstates {
+        self.timings[timing as usize].load[1][access_index(access_type)]
+    }
+
+    #[inline(always)]
+    pub fn load32(&self, timing: u8, access_type: AccessType) -> Waitstates {
+        self.timings[timing as usize].load[2][access_index(access_type)]
+    }
+
+    #[inline(always)]
+    pub fn store8(&self, timing: u8) -> Waitstates {
+        self.timings[timing as usize].store[0]
+    }
+
+    #[inline(always)]
+    pub fn store16(&self, timing: u8) -> Waitstates {
+        self.timings[timing as usize].store[1]
+    }
+
+    #[inline(always)]
+    pub fn store32(&self, timing: u8) -> Waitstates {
+        self.timings[timing as usize].store[2]
+    }
+}
+
+#[inline(always)]
+fn access_index(access_type: AccessType) -> usize {
+    match access_type {
+        AccessType::Sequential => 0,
+        AccessType::NonSequential => 1,
+    }
+}
+
+#[cfg(test)]
+mod test {
+    use arm::emu::{AccessType, Waitstates};
+
+    use crate::hardware::system_control::SystemWaitstates;
+
+    use super::{Page, PageTable, PageTimings, PAGE_SIZE, TIMING_GAMEPAK1, TIMING_NONE};
+
+    #[test]
+    fn test_addresses_above_bus_are_unmapped() {
+        let mut memory = [0u8; 16];
+        let mut table = PageTable::default();
+        let last_page = 0x0FFFC000..=0x0FFFFFFF;
+        unsafe {
+            table.map(
+                last_page,
+                memory.as_mut_ptr(),
+                16,
+                Page::READ,
+                TIMING_NONE,
+                |_| 0,
+            );
+        }
+        assert!(table.get(0x0FFFFFF0).readable());
+        assert!(!table.get(0x1FFFFFF0).readable());
+        assert!(!table.get(0xFFFFFFFF).readable());
+    }
+
+    #[test]
+    fn test_code_page_is_unmapped_with_table() {
+        let mut memory = [0u8; PAGE_SIZE];
+        let mut table = PageTable::default();
+        unsafe {
+            table.map(
+                0x03000000..=0x03003FFF,
+                memory.as_mut_ptr(),
+                PAGE_SIZE,
+                Page::READ,
+                TIMING_NONE,
+                |_| 0,
+            );
+        }
+        assert!(table.get_code(0x03000000).readable());
+        table.unmap_all();
+        assert!(!table.get_code(0x03000000).readable());
+    }
+
+    #[test]
+    fn test_contiguous_len() {
+        let mut memory = [0u8; 32];
+        let mut table = PageTable::default();
+        unsafe {
+            table.map(
+                0x03000000..=0x03003FFF,
+                memory.as_mut_ptr(),
+                32,
+                Page::READ,
+                TIMING_NONE,
+                |_| 0,
+            );
+        }
+        let page = table.get(0x03000000);
+        assert_eq!(page.contiguous_len(0x03000000), 32);
+        assert_eq!(page.contiguous_len(0x0300001F), 1);
+        assert_eq!(page.contiguous_len(0x03000024), 28);
+        assert_eq!(page.host(0x03000024), page.host(0x03000004));
+    }
+
+    #[test]
+    fn test_gamepak_timings() {
+        let mut waitstates = SystemWaitstates::default();
+        waitstates.gamepak[1] = (Waitstates::from(4), Waitstates::from(1));
+        let timings = PageTimings::new(&waitstates);
+
+        let n = AccessType::NonSequential;
+        let s = AccessType::Sequential;
+        assert_eq!(timings.load16(TIMING_GAMEPAK1, n), Waitstates::from(4));
+        assert_eq!(timings.load16(TIMING_GAMEPAK1, s), Waitstates::from(1));
+        assert_eq!(timings.load32(TIMING_GAMEPAK1, n), Waitstates::from(5));
+        assert_eq!(timings.load32(TIMING_GAMEPAK1, s), Waitstates::from(2));
+    }
+}
@@ -0,0 +1,271 @@
+//! Runs many GBAs on a fixed number of threads.
+//!
+//! Each thread has a queue of GBAs and runs them a frame at a time, putting each one back at
+//! the end of its queue until it stops. Threads that run out of GBAs take them from the back
+//! of another thread's queue, so GBAs that run slower than the others don't hold up a thread
+//! while the rest of them sit idle.
+
+use std::{
+    collections::VecDeque,
+    sync::{
+        atomic::{AtomicUsize, Ordering},
+        Mutex,
+    },
+};
+
+use crate::{
+    video::{ScreenBuffer, VISIBLE_PIXELS},
+    Gba, NoopGbaAudioOutput,
+};
+
+/// When a GBA in a [`GbaPool`] should stop running.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum StopCondition {
+    /// Stop once this many frames were finished since the GBA was reset.
+    FrameCount(u64),
+    /// Stop right before the instruction at this address is executed. GBAs with this
+    /// condition are run one instruction at a time, which is a lot slower.
+    ProgramCounter(u32),
+    /// Stop at the end of a frame if the word at `address` is `value`. Only memory that can be
+    /// read directly (EWRAM, IWRAM, VRAM, OAM and the gamepak) ever matches.
+    Memory32 { address: u32, value: u32 },
+}
+
+struct PoolEntry {
+    gba: Gba,
+    conditions: Vec<StopCondition>,
+    /// The condition that stopped the GBA.
+    stopped_by: Option<StopCondition>,
+    /// The last frame that was rendered.
+    frame: Box<ScreenBuffer>,
+}
+
+impl PoolEntry {
+    /// Runs the GBA until the end of the frame or until it stops. Returns true if it stopped.
+    fn run_frame(&mut self) -> bool {
+        let pc_conditions = self
+            .conditions
+            .iter()
+            .any(|condition| matches!(condition, StopCondition::ProgramCounter(_)));
+
+        if pc_conditions {
+            loop {
+                let pc = StopCondition::ProgramCounter(self.gba.cpu.next_execution_address());
+                if self.conditions.contains(&pc) {
+                    self.stopped_by = Some(pc);
+                    return true;
+                }
+                if self.gba.step_into(&mut self.frame, &mut NoopGbaAudioOutput) {
+                    break;
+                }
+            }
+        } else {
+            self.gba
+                .run_frame_into(&mut self.frame, &mut NoopGbaAudioOutput);
+        }
+        self.check_end_of_frame()
+    }
+
+    fn check_end_of_frame(&mut self) -> bool {
+        let gba = &self.gba;
+        self.stopped_by = self
+            .conditions
+            .iter()
+            .copied()
+            .find(|&condition| match condition {
+                StopCondition::FrameCount(frames) => gba.frame_count() >= frames,
+                StopCondition::ProgramCounter(_) => false,
+                StopCondition::Memory32 { address, value } => {
+                    let address = address & !0x3;
+                    let page = gba.mapped.page_table.get(address);
+                    // SAFETY: the page is readable and the address is word aligned.
+                    page.readable() && unsafe { page.read32(address) } == value
+                }
+            });
+        self.stopped_by.is_some()
+    }
+}
+
+/// Owns a number of GBAs and runs all of them at once on a fixed number of threads.
+pub struct GbaPool {
+    entries: Vec<PoolEntry>,
+    threads: usize,
+}
+
+impl GbaPool {
+    /// A pool that runs its GBAs on `threads` threads, or one for each CPU if it's 0.
+    pub fn new(threads: usize) -> Self {
+        let threads = if threads == 0 {
+            std::thread::available_parallelism().map_or(1, |threads| threads.get())
+        } else {
+            threads
+        };
+        GbaPool {
+            entries: Vec::new(),
+            threads,
+        }
+    }
+
+    /// Adds a GBA that runs until any of `conditions` are met and returns its index. A GBA
+    /// without any conditions that can be met never stops, so [`GbaPool::run`] never returns.
+    pub fn add(&mut self, gba: Gba, conditions: Vec<StopCondition>) -> usize {
+        self.entries.push(PoolEntry {
+            gba,
+            conditions,
+            stopped_by: None,
+            frame: Box::new([0; VISIBLE_PIXELS]),
+        });
+        self.entries.len() - 1
+    }
+
+    pub fn len(&self) -> usize {
+        self.entries.len()
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.entries.is_empty()
+    }
+
+    pub fn threads(&self) -> usize {
+        self.threads
+    }
+
+    pub fn gba(&self, index: usize) -> &Gba {
+        &self.entries[index].gba
+    }
+
+    pub fn gba_mut(&mut self, index: usize) -> &mut Gba {
+        &mut self.entries[index].gba
+    }
+
+    /// The last frame that the GBA at `index` finished. Frames that it was in the middle of
+    /// when it stopped are only partially drawn.
+    pub fn frame(&self, index: usize) -> &ScreenBuffer {
+        &self.entries[index].frame
+    }
+
+    /// The condition that stopped the GBA at `index`, or `None` if it hasn't stopped.
+    pub fn stopped_by(&self, index: usize) -> Option<StopCondition> {
+        self.entries[index].stopped_by
+    }
+
+    /// Replaces the conditions of the GBA at `index`, which lets it run again if it stopped.
+    pub fn set_conditions(&mut self, index: usize, conditions: Vec<StopCondition>) {
+        let entry = &mut self.entries[index];
+        entry.conditions = conditions;
+        entry.stopped_by = None;
+    }
+
+    /// Removes every GBA from the pool, in the order that they were added.
+    pub fn into_gbas(self) -> Vec<Gba> {
+        self.entries.into_iter().map(|entry| entry.gba).collect()
+    }
+
+    /// Runs every GBA until it stops.
+    pub fn run(&mut self) {
+        #[cfg(feature = "puffin")]
+        puffin::profile_function!();
+
+        let threads = self.threads.min(self.entries.len()).max(1);
+        let queues: Vec<Mutex<VecDeque<&mut PoolEntry>>> =
+            (0..threads).map(|_| Mutex::default()).collect();
+        let mut running = 0;
+        for entry in &mut self.entries {
+            if entry.stopped_by.is_none() && !entry.check_end_of_frame() {
+                queues[running % threads].lock().unwrap().push_back(entry);
+                running += 1;
+            }
+        }
+        let running = AtomicUsize::new(running);
+
+        std::thread::scope(|scope| {
+            for thread in 0..threads {
+                let (queues, running) = (&queues, &running);
+                scope.spawn(move || run_queue(thread, queues, running));
+            }
+        });
+    }
+}
+
+fn run_queue(thread: usize, queues: &[Mutex<VecDeque<&mut PoolEntry>>], running: &AtomicUsize) {
+    while running.load(Ordering::Acquire) > 0 {
+        let own = queues[thread].lock().unwrap().pop_front();
+        let next = own.or_else(|| {
+            // Steal from the back of the other queues, which is where the GBAs that were most
+            // recently run are.
+            (1..queues.len())
+                .map(|offset| &queues[(thread + offset) % queues.len()])
+                .find_map(|queue| queue.lock().unwrap().pop_back())
+        });
+
+        // Every GBA that's still running is being run by another thread.
+        let Some(entry) = next else {
+            std::thread::yield_now();
+            continue;
+        };
+
+        if entry.run_frame() {
+            running.fetch_sub(1, Ordering::AcqRel);
+        } else {
+            queues[thread].lock().unwrap().push_back(entry);
+        }
+    }
+}
+
+#[cfg(test)]
+mod test {
+    use super::{GbaPool, StopCondition};
+    use crate::Gba;
+
+    fn noop_gba() -> Gba {
+        let mut gba = Gba::new();
+        gba.set_noop_gamepak();
+        gba.reset();
+        gba
+    }
+
+    #[test]
+    fn test_frame_count() {
+        let mut pool = GbaPool::new(3);
+        for frames in 1..=8 {
+            pool.add(noop_gba(), vec![StopCondition::FrameCount(frames)]);
+        }
+        pool.run();
+
+        for index in 0..pool.len() {
+            let frames = index as u64 + 1;
+            assert_eq!(pool.gba(index).frame_count(), frames);
+            assert_eq!(
+                pool.stopped_by(index),
+                Some(StopCondition::FrameCount(frames))
+            );
+        }
+
+        // Stopped GBAs aren't run again until their conditions change.
+        pool.run();
+        assert_eq!(pool.gba(0).frame_count(), 1);
+        pool.set_conditions(0, vec![StopCondition::FrameCount(3)]);
+        pool.run();
+        assert_eq!(pool.gba(0).frame_count(), 3);
+        assert_eq!(pool.gba(7).frame_count(), 8);
+    }
+
+    #[test]
+    fn test_program_counter() {
+        let mut pool = GbaPool::new(2);
+        // The custom BIOS jumps to the gamepak, which is a branch to itself.
+        pool.add(
+            noop_gba(),
+            vec![
+                StopCondition::ProgramCounter(0x08000000),
+                StopCondition::FrameCount(60),
+            ],
+        );
+        pool.run();
+        assert_eq!(
+            pool.stopped_by(0),
+            Some(StopCondition::ProgramCounter(0x08000000))
+        );
+        assert_eq!(pool.gba(0).cpu.next_execution_address(), 0x08000000);
+    }
+}
@@ -0,0 +1,491 @@
+//! Savestates and in-memory snapshots of everything about a [`Gba`] that changes while it
+//! runs.
+//!
+//! [`Gba::snapshot`] is meant to be called often. EWRAM, IWRAM and VRAM are kept in pages
+//! that are shared with the last snapshot unless they were written to since then (see
+//! [`pages`]), so taking a snapshot only copies the pages that changed along with a few
+//! kilobytes of registers, OAM and palette RAM. [`Snapshot::to_bytes`] turns a snapshot into
+//! a versioned binary savestate that can be loaded by [`Snapshot::from_bytes`].
+//! [`RewindBuffer`] keeps a history of snapshots as compressed deltas between savestates.
+//!
+//! The BIOS, the gamepak and settings like HLE and parallel rendering aren't part of a
+//! snapshot. They have to be the same when it's restored for the GBA to continue the same
+//! way that it would have from where it was taken.
+
+mod format;
+pub(crate) mod pages;
+mod rewind;
+
+use std::{fmt, sync::Arc};
+
+use arm::emu::{CpuMode, CpuState, Registers};
+
+use crate::{
+    events::{GbaEvent, GbaScheduler},
+    hardware::{
+        dma::GbaDma,
+        palette::Palette,
+        system_control::{RegIme, RegInternalMemoryControl, RegInterrupts, RegWaitcnt},
+        video::{
+            registers::{BgAffineRegisters, GbaVideoRegisters},
+            ReferencePoint, VideoState,
+        },
+    },
+    memory::{EWRAM_SIZE, IWRAM_SIZE, OAM_SIZE, VRAM_SIZE},
+    Gba,
+};
+
+use self::{
+    format::{StateReader, StateWriter},
+    pages::{PagedRegion, SNAPSHOT_PAGE_SIZE},
+};
+
+pub use self::rewind::RewindBuffer;
+
+/// The first bytes of every savestate.
+pub const SAVESTATE_MAGIC: [u8; 8] = *b"PYRITESS";
+/// The version of the savestate format. Savestates with any other version can't be loaded.
+pub const SAVESTATE_VERSION: u32 = 2;
+
+/// The state of a [`Gba`] at some point in time. Cloning a snapshot is cheap because its
+/// memory is shared.
+#[derive(Clone)]
+pub struct Snapshot {
+    cpu: CpuState,
+    scheduler: GbaScheduler,
+    ewram: PagedRegion,
+    iwram: PagedRegion,
+    vram: PagedRegion,
+    oam: Arc<[u8; OAM_SIZE]>,
+    palette: Arc<Palette>,
+    video: VideoState,
+    system_control: SystemControlState,
+    dma: GbaDma,
+    last_read_value: u32,
+    last_bios_value: u32,
+}
+
+#[derive(Clone)]
+struct SystemControlState {
+    waitcnt: RegWaitcnt,
+    internal_memory_control: RegInternalMemoryControl,
+    interrupt_enable: RegInterrupts,
+    interrupt_request: RegInterrupts,
+    interrupt_master_enable: RegIme,
+    postflg: u8,
+    intr_wait: Option<u16>,
+}
+
+impl Gba {
+    /// Takes a snapshot of the GBA's current state. Only the memory that changed since the
+    /// last snapshot that was taken or restored is copied.
+    pub fn snapshot(&mut self) -> Snapshot {
+        #[cfg(feature = "puffin")]
+        puffin::profile_function!();
+
+        let mapped = &mut self.mapped;
+        let system_control = &mapped.system_control;
+        Snapshot {
+            cpu: self.cpu.save_state(),
+            scheduler: self.scheduler.clone(),
+            ewram: mapped.dirty.ewram.snapshot(&mapped.ewram[..]),
+            iwram: mapped.dirty.iwram.snapshot(&mapped.iwram[..]),
+            vram: mapped.dirty.vram.snapshot(&mapped.vram[..]),
+            oam: Arc::new(*mapped.oam),
+            palette: Arc::new((*mapped.palram).clone()),
+            video: mapped.video.save_state(),
+            system_control: SystemControlState {
+                waitcnt: system_control.waitcnt,
+                internal_memory_control: system_control.internal_memory_control,
+                interrupt_enable: system_control.interrupt_enable,
+                interrupt_request: system_control.interrupt_request,
+                interrupt_master_enable: system_control.interrupt_master_enable,
+                postflg: system_control.postflg,
+                intr_wait: system_control.intr_wait,
+            },
+            dma: mapped.dma.clone(),
+            last_read_value: mapped.last_read_value,
+            last_bios_value: mapped.last_bios_value,
+        }
+    }
+
+    /// Puts the GBA back into the state that it was in when `snapshot` was taken. Only the
+    /// memory that's different from the snapshot is copied.
+    pub fn restore(&mut self, snapshot: &Snapshot) {
+        #[cfg(feature = "puffin")]
+        puffin::profile_function!();
+
+        let mapped = &mut self.mapped;
+        let video = &mut mapped.video;
+
+        let mut code_changed = false;
+        mapped
+            .dirty
+            .ewram
+            .restore(&mut mapped.ewram[..], &snapshot.ewram, |_| {
+                code_changed = true
+            });
+        mapped
+            .dirty
+            .iwram
+            .restore(&mut mapped.iwram[..], &snapshot.iwram, |_| {
+                code_changed = true
+            });
+        // The video state has to be loaded first so that changes to VRAM invalidate the lines
+        // that the restored video registers display it on.
+        video.load_state(&snapshot.video);
+        mapped
+            .dirty
+            .vram
+            .restore(&mut mapped.vram[..], &snapshot.vram, |offset| {
+                code_changed = true;
+                for offset in (offset..(offset + SNAPSHOT_PAGE_SIZE)).step_by(32) {
+                    video.vram_changed(offset);
+                }
+            });
+        if *mapped.oam != *snapshot.oam {
+            *mapped.oam = *snapshot.oam;
+            video.invalidate_lines();
+        }
+        if *mapped.palram != *snapshot.palette {
+            (*mapped.palram).clone_from(&snapshot.palette);
+            video.palette_changed();
+        }
+
+        let state = &snapshot.system_control;
+        let system_control = &mut mapped.system_control;
+        system_control.write_waitcnt(state.waitcnt);
+        system_control.write_internal_memory_control(state.internal_memory_control);
+        system_control.interrupt_enable = state.interrupt_enable;
+        system_control.interrupt_request = state.interrupt_request;
+        system_control.interrupt_master_enable = state.interrupt_master_enable;
+        system_control.postflg = state.postflg;
+        system_control.intr_wait = state.intr_wait;
+        mapped.dma.clone_from(&snapshot.dma);
+        mapped.last_read_value = snapshot.last_read_value;
+        mapped.last_bios_value = snapshot.last_bios_value;
+
+        self.scheduler.clone_from(&snapshot.scheduler);
+        self.cpu.load_state(&snapshot.cpu);
+        // Cached instructions are keyed by address and don't know about mirrors, so it's
+        // simpler to throw all of them away than to find every address that changed.
+        if code_changed {
+            self.cpu.clear_block_cache();
+        }
+    }
+
+    /// Takes a snapshot and encodes it as a savestate.
+    pub fn save_state(&mut self) -> Vec<u8> {
+        self.snapshot().to_bytes()
+    }
+
+    /// Loads a savestate that was returned by [`Gba::save_state`] or [`Snapshot::to_bytes`].
+    /// The GBA isn't changed if the savestate can't be decoded.
+    pub fn load_state(&mut self, savestate: &[u8]) -> Result<(), SavestateError> {
+        let snapshot = Snapshot::from_bytes(savestate)?;
+        self.restore(&snapshot);
+        Ok(())
+    }
+}
+
+impl Snapshot {
+    /// The number of frames that were finished when the snapshot was taken.
+    pub fn frame_count(&self) -> u64 {
+        self.video.frame
+    }
+
+    /// The number of cycles that had elapsed when the snapshot was taken.
+    pub fn cycles(&self) -> u64 {
+        self.scheduler.now()
+    }
+
+    /// Encodes the snapshot as a savestate. Pages of memory that are all zeroes are left out.
+    pub fn to_bytes(&self) -> Vec<u8> {
+        self.encode(true)
+    }
+
+    /// Same as [`Snapshot::to_bytes`] but every page of memory is kept, so memory is always at
+    /// the same offset in the savestate. This is what deltas between savestates are made from.
+    pub(crate) fn to_bytes_with_zero_pages(&self) -> Vec<u8> {
+        self.encode(false)
+    }
+
+    fn encode(&self, skip_zero_pages: bool) -> Vec<u8> {
+        let mut w = StateWriter::default();
+        w.bytes(&SAVESTATE_MAGIC);
+        w.u32(SAVESTATE_VERSION);
+
+        for word in self.cpu.registers.to_words() {
+            w.u32(word);
+        }
+        w.u32(self.cpu.fetched);
+        w.u32(self.cpu.decoded);
+        w.bool(self.cpu.sequential);
+        w.bool(self.cpu.halted);
+        w.u64(self.cpu.instruction_count);
+
+        w.u64(self.scheduler.now());
+        let events = self.scheduler.scheduled();
+        w.u32(events.len() as u32);
+        for (event, timestamp) in events {
+            w.u8(event as u8);
+            w.u64(timestamp);
+        }
+
+        for region in [&self.ewram, &self.iwram, &self.vram] {
+            for page in region.pages() {
+                let zero = skip_zero_pages && page.iter().all(|&byte| byte == 0);
+                w.bool(!zero);
+                if !zero {
+                    w.bytes(page);
+                }
+            }
+        }
+        w.bytes(&self.oam[..]);
+        for &color in self.palette.colors() {
+            w.u16(color);
+        }
+
+        write_video_registers(&mut w, &self.video.registers);
+        w.u64(self.video.frame);
+        for point in self.video.reference_points {
+            w.i32(point.x);
+            w.i32(point.y);
+        }
+
+        let state = &self.system_control;
+        w.u32(state.waitcnt);
+        w.u32(state.internal_memory_control);
+        w.u16(state.interrupt_enable);
+        w.u16(state.interrupt_request);
+        w.u16(state.interrupt_master_enable);
+        w.u8(state.postflg);
+        w.bool(state.intr_wait.is_some());
+        w.u16(state.intr_wait.unwrap_or(0));
+
+        for channel in &self.dma.channels {
+            w.u32(channel.source);
+            w.u32(channel.destination);
+            w.u16(channel.count);
+            w.u16(channel.control);
+            w.u32(channel.internal_source);
+            w.u32(channel.internal_destination);
+            w.u32(channel.internal_count);
+        }
+
+        w.u32(self.last_read_value);
+        w.u32(self.last_bios_value);
+        w.bytes
+    }
+
+    /// Decodes a savestate that was returned by [`Snapshot::to_bytes`].
+    pub fn from_bytes(savestate: &[u8]) -> Result<Snapshot, SavestateError> {
+        let mut r = StateReader::new(savestate);
+        if r.array::<8>().ok() != Some(SAVESTATE_MAGIC) {
+            return Err(SavestateError::NotASavestate);
+        }
+        let version: u32 = r.u32()?;
+        if version != SAVESTATE_VERSION {
+            return Err(SavestateError::UnsupportedVersion(version));
+        }
+
+        let mut words = [0; Registers::WORD_COUNT];
+        for word in &mut words {
+            *word = r.u32()?;
+        }
+        // Switching out of a mode that isn't one of the CPU's modes panics, so those are
+        // rejected here instead. The SPSRs of modes that were never entered are still zero.
+        CpuMode::from_bits_checked(words[36] & 0x1F)
+            .map_err(|_| SavestateError::Invalid("cpsr mode"))?;
+        for &spsr in words[31..36].iter().chain(&words[37..]) {
+            if spsr != 0 && CpuMode::from_bits_checked(spsr & 0x1F).is_err() {
+                return Err(SavestateError::Invalid("spsr mode"));
+            }
+        }
+        let cpu = CpuState {
+            registers: Registers::from_words(&words),
+            fetched: r.u32()?,
+            decoded: r.u32()?,
+            sequential: r.bool()?,
+            halted: r.bool()?,
+            instruction_count: r.u64()?,
+        };
+
+        let now = r.u64()?;
+        let event_count: u32 = r.u32()?;
+        let mut events = Vec::new();
+        for _ in 0..event_count {
+            let event = match r.u8()? {
+                0 => GbaEvent::HDraw,
+                1 => GbaEvent::HBlank,
+                _ => return Err(SavestateError::Invalid("event")),
+            };
+            events.push((event, r.u64()?));
+        }
+        let scheduler = GbaScheduler::with_scheduled(now, &events);
+
+        let mut read_region = |size: usize| -> Result<PagedRegion, SavestateError> {
+            let mut memory = vec![0; size];
+            for page in memory.chunks_exact_mut(SNAPSHOT_PAGE_SIZE) {
+                if r.bool()? {
+                    page.copy_from_slice(r.bytes(SNAPSHOT_PAGE_SIZE)?);
+                }
+            }
+            Ok(PagedRegion::from_bytes(&memory))
+        };
+        let ewram = read_region(EWRAM_SIZE)?;
+        let iwram = read_region(IWRAM_SIZE)?;
+        let vram = read_region(VRAM_SIZE)?;
+        let oam = Arc::new(r.array::<OAM_SIZE>()?);
+        let mut palette = Palette::default();
+        for color in palette.colors_mut() {
+            *color = r.u16()?;
+        }
+
+        let mut video = VideoState {
+            registers: read_video_registers(&mut r)?,
+            frame: r.u64()?,
+            reference_points: [ReferencePoint::default(); 2],
+        };
+        for point in &mut video.reference_points {
+            point.x = r.i32()?;
+            point.y = r.i32()?;
+        }
+
+        let system_control = SystemControlState {
+            waitcnt: r.u32()?,
+            internal_memory_control: r.u32()?,
+            interrupt_enable: r.u16()?,
+            interrupt_request: r.u16()?,
+            interrupt_master_enable: r.u16()?,
+            postflg: r.u8()?,
+            intr_wait: {
+                let waiting = r.bool()?;
+                let interrupts: u16 = r.u16()?;
+                waiting.then_some(interrupts)
+            },
+        };
+
+        let mut dma = GbaDma::default();
+        for channel in &mut dma.channels {
+            channel.source = r.u32()?;
+            channel.destination = r.u32()?;
+            channel.count = r.u16()?;
+            channel.control = r.u16()?;
+            channel.internal_source = r.u32()?;
+            channel.internal_destination = r.u32()?;
+            channel.internal_count = r.u32()?;
+        }
+
+        let snapshot = Snapshot {
+            cpu,
+            scheduler,
+            ewram,
+            iwram,
+            vram,
+            oam,
+            palette: Arc::new(palette),
+            video,
+            system_control,
+            dma,
+            last_read_value: r.u32()?,
+            last_bios_value: r.u32()?,
+        };
+        if !r.is_empty() {
+            return Err(SavestateError::Invalid("trailing bytes"));
+        }
+        Ok(snapshot)
+    }
+}
+
+fn write_video_registers(w: &mut StateWriter, registers: &GbaVideoRegisters) {
+    w.u16(registers.dispcnt);
+    w.u16(registers.green_swap);
+    w.u16(registers.dispstat);
+    w.u16(registers.vcount);
+    for bg in 0..4 {
+        w.u16(registers.bgcnt[bg]);
+        w.u16(registers.bghofs[bg]);
+        w.u16(registers.bgvofs[bg]);
+    }
+    for affine in &registers.affine {
+        w.u16(affine.pa);
+        w.u16(affine.pb);
+        w.u16(affine.pc);
+        w.u16(affine.pd);
+        w.u32(affine.x);
+        w.u32(affine.y);
+    }
+    w.u16(registers.win0h);
+    w.u16(registers.win1h);
+    w.u16(registers.win0v);
+    w.u16(registers.win1v);
+    w.u16(registers.winin);
+    w.u16(registers.winout);
+    w.u16(registers.bldcnt);
+    w.u16(registers.bldalpha);
+    w.u16(registers.bldy);
+}
+
+fn read_video_registers(r: &mut StateReader) -> Result<GbaVideoRegisters, SavestateError> {
+    let mut registers = GbaVideoRegisters {
+        dispcnt: r.u16()?,
+        green_swap: r.u16()?,
+        dispstat: r.u16()?,
+        vcount: r.u16()?,
+        ..GbaVideoRegisters::default()
+    };
+    for bg in 0..4 {
+        registers.bgcnt[bg] = r.u16()?;
+        registers.bghofs[bg] = r.u16()?;
+        registers.bgvofs[bg] = r.u16()?;
+    }
+    for affine in &mut registers.affine {
+        *affine = BgAffineRegisters {
+            pa: r.u16()?,
+            pb: r.u16()?,
+            pc: r.u16()?,
+            pd: r.u16()?,
+            x: r.u32()?,
+            y: r.u32()?,
+        };
+    }
+    registers.win0h = r.u16()?;
+    registers.win1h = r.u16()?;
+    registers.win0v = r.u16()?;
+    registers.win1v = r.u16()?;
+    registers.winin = r.u16()?;
+    registers.winout = r.u16()?;
+    registers.bldcnt = r.u16()?;
+    registers.bldalpha = r.u16()?;
+    registers.bldy = r.u16()?;
+    Ok(registers)
+}
+
+#[derive(Debug, Clone, PartialEq, Eq)]
+pub enum SavestateError {
+    /// The data doesn't start with [`SAVESTATE_MAGIC`].
+    NotASavestate,
+    /// The savestate was made with a different version of the format.
+    UnsupportedVersion(u32),
+    /// The savestate ended in the middle of a value.
+    Truncated,
+    /// The savestate contains a value that can't be loaded.
+    Invalid(&'static str),
+}
+
+impl fmt::Display for SavestateError {
+    fn fmt(&self, f: &mut fmt::Formatter<'_>) -> fmt::Result {
+        match self {
+            SavestateError::NotASavestate => write!(f, "not a savestate"),
+            SavestateError::UnsupportedVersion(version) => write!(
+                f,
+                "savestate version {version} is not supported (expected {SAVESTATE_VERSION})"
+            ),
+            SavestateError::Truncated => write!(f, "savestate is truncated"),
+            SavestateError::Invalid(what) => write!(f, "savestate contains an invalid {what}"),
+        }
+    }
+}
+
+impl std::error::Error for SavestateError {}
@@ -0,0 +1,93 @@
+//! Little-endian encoding of the values in a savestate.
+
+use super::SavestateError;
+
+#[derive(Default)]
+pub(crate) struct StateWriter {
+    pub(crate) bytes: Vec<u8>,
+}
+
+impl StateWriter {
+    pub(crate) fn bytes(&mut self, bytes: &[u8]) {
+        self.bytes.extend_from_slice(bytes);
+    }
+
+    pub(crate) fn u8(&mut self, value: u8) {
+        self.bytes.push(value);
+    }
+
+    pub(crate) fn bool(&mut self, value: bool) {
+        self.u8(value as u8);
+    }
+
+    pub(crate) fn u16(&mut self, value: impl Into<u16>) {
+        self.bytes(&value.into().to_le_bytes());
+    }
+
+    pub(crate) fn u32(&mut self, value: impl Into<u32>) {
+        self.bytes(&value.into().to_le_bytes());
+    }
+
+    pub(crate) fn i32(&mut self, value: i32) {
+        self.bytes(&value.to_le_bytes());
+    }
+
+    pub(crate) fn u64(&mut self, value: u64) {
+        self.bytes(&value.to_le_bytes());
+    }
+}
+
+pub(crate) struct StateReader<'a> {
+    bytes: &'a [u8],
+}
+
+impl<'a> StateReader<'a> {
+    pub(crate) fn new(bytes: &'a [u8]) -> Self {
+        Self { bytes }
+    }
+
+    pub(crate) fn is_empty(&self) -> bool {
+        self.bytes.is_empty()
+    }
+
+    pub(crate) fn bytes(&mut self, len: usize) -> Result<&'a [u8], SavestateError> {
+        if self.bytes.len() < len {
+            return Err(SavestateError::Truncated);
+        }
+        let (bytes, rest) = self.bytes.split_at(len);
+        self.bytes = rest;
+        Ok(bytes)
+    }
+
+    pub(crate) fn array<const N: usize>(&mut self) -> Result<[u8; N], SavestateError> {
+        Ok(self.bytes(N)?.try_into().unwrap())
+    }
+
+    pub(crate) fn u8(&mut self) -> Result<u8, SavestateError> {
+        Ok(self.array::<1>()?[0])
+    }
+
+    pub(crate) fn bool(&mut self) -> Result<bool, SavestateError> {
+        match self.u8()? {
+            0 => Ok(false),
+            1 => Ok(true),
+            _ => Err(SavestateError::Invalid("bool")),
+        }
+    }
+
+    pub(crate) fn u16<T: From<u16>>(&mut self) -> Result<T, SavestateError> {
+        Ok(u16::from_le_bytes(self.array()?).into())
+    }
+
+    pub(crate) fn u32<T: From<u32>>(&mut self) -> Result<T, SavestateError> {
+        Ok(u32::from_le_bytes(self.array()?).into())
+    }
+
+    pub(crate) fn i32(&mut self) -> Result<i32, SavestateError> {
+        Ok(i32::from_le_bytes(self.array()?))
+    }
+
+    pub(crate) fn u64(&mut self) -> Result<u64, SavestateError> {
+        Ok(u64::from_le_bytes(self.array()?))
+    }
+}
@@ -0,0 +1,206 @@
+//! Copy-on-write snapshots of the larger memory regions.
+//!
+//! Each region is split into pages that are shared between every snapshot that they didn't
+//! change between. Only the pages that were written to since the last snapshot are copied
+//! when a new one is taken, and restoring a snapshot only copies the pages that are different
+//! from what's in memory, which can be told apart without looking at their contents.
+
+use std::sync::Arc;
+
+use crate::memory::{EWRAM_MASK, EWRAM_SIZE, IWRAM_MASK, IWRAM_SIZE, VRAM_SIZE};
+
+pub const SNAPSHOT_PAGE_SHIFT: u32 = 12;
+pub const SNAPSHOT_PAGE_SIZE: usize = 1 << SNAPSHOT_PAGE_SHIFT;
+
+pub(crate) type SnapshotPage = Arc<[u8; SNAPSHOT_PAGE_SIZE]>;
+
+/// The contents of a memory region when a snapshot was taken.
+#[derive(Clone)]
+pub(crate) struct PagedRegion {
+    pages: Box<[SnapshotPage]>,
+}
+
+impl PagedRegion {
+    pub(crate) fn from_bytes(bytes: &[u8]) -> Self {
+        let pages = bytes
+            .chunks_exact(SNAPSHOT_PAGE_SIZE)
+            .map(|page| Arc::new(page.try_into().unwrap()))
+            .collect();
+        Self { pages }
+    }
+
+    pub(crate) fn pages(&self) -> impl Iterator<Item = &[u8; SNAPSHOT_PAGE_SIZE]> + '_ {
+        self.pages.iter().map(|page| &**page)
+    }
+
+    pub(crate) fn len(&self) -> usize {
+        self.pages.len() * SNAPSHOT_PAGE_SIZE
+    }
+}
+
+/// Keeps track of which pages of a region were written to since the last snapshot that was
+/// taken or restored.
+pub(crate) struct RegionTracker {
+    dirty: Box<[bool]>,
+    /// What the region looked like at the last snapshot, which is also what every page that
+    /// isn't dirty still looks like. Every page is dirty if there wasn't one yet.
+    base: Option<PagedRegion>,
+}
+
+impl RegionTracker {
+    fn new(size: usize) -> Self {
+        Self {
+            dirty: vec![true; size / SNAPSHOT_PAGE_SIZE].into_boxed_slice(),
+            base: None,
+        }
+    }
+
+    #[inline(always)]
+    pub(crate) fn mark(&mut self, offset: usize) {
+        self.dirty[offset >> SNAPSHOT_PAGE_SHIFT] = true;
+    }
+
+    /// Copies every page that was written to since the last snapshot and shares the rest.
+    pub(crate) fn snapshot(&mut self, memory: &[u8]) -> PagedRegion {
+        let snapshot = match &self.base {
+            Some(base) => {
+                let pages = base
+                    .pages
+                    .iter()
+                    .zip(memory.chunks_exact(SNAPSHOT_PAGE_SIZE))
+                    .zip(self.dirty.iter())
+                    .map(|((page, memory), &dirty)| {
+                        if dirty {
+                            Arc::new(memory.try_into().unwrap())
+                        } else {
+                            page.clone()
+                        }
+                    })
+                    .collect();
+                PagedRegion { pages }
+            }
+            None => PagedRegion::from_bytes(memory),
+        };
+        self.dirty.fill(false);
+        self.base = Some(snapshot.clone());
+        snapshot
+    }
+
+    /// Copies every page of `snapshot` that is different from `memory` into it and calls
+    /// `changed` with the offset of each one.
+    pub(crate) fn restore(
+        &mut self,
+        memory: &mut [u8],
+        snapshot: &PagedRegion,
+        mut changed: impl FnMut(usize),
+    ) {
+        assert_eq!(memory.len(), snapshot.len(), "snapshot is the wrong size");
+
+        let pages = memory
+            .chunks_exact_mut(SNAPSHOT_PAGE_SIZE)
+            .zip(&*snapshot.pages);
+        for (index, (memory, page)) in pages.enumerate() {
+            // Pages are never changed once they're in a snapshot, so a page that's shared with
+            // the last snapshot still has the same contents as the memory unless it's dirty.
+            let same = !self.dirty[index]
+                && matches!(&self.base, Some(base) if Arc::ptr_eq(&base.pages[index], page));
+            if !same {
+                memory.copy_from_slice(&page[..]);
+                changed(index * SNAPSHOT_PAGE_SIZE);
+            }
+        }
+        self.dirty.fill(false);
+        self.base = Some(snapshot.clone());
+    }
+}
+
+/// Tracks writes to the memory regions that are snapshotted a page at a time.
+pub(crate) struct DirtyPages {
+    pub(crate) ewram: RegionTracker,
+    pub(crate) iwram: RegionTracker,
+    pub(crate) vram: RegionTracker,
+}
+
+impl DirtyPages {
+    /// Called after the CPU wrote to `address` in EWRAM or IWRAM, which are the only regions
+    /// that are mapped for writes in the page table.
+    #[inline(always)]
+    pub(crate) fn ram_written(&mut self, address: u32) {
+        if address & 0x01000000 == 0 {
+            self.ewram.mark((address & EWRAM_MASK) as usize);
+        } else {
+            self.iwram.mark((address & IWRAM_MASK) as usize);
+        }
+    }
+
+    /// Same as [`DirtyPages::ram_written`] for the `len` bytes starting at `address`. They
+    /// must all be in the same page of the page table.
+    pub(crate) fn ram_range_written(&mut self, address: u32, len: u32) {
+        let mut offset = 0;
+        while offset < len {
+            self.ram_written(address.wrapping_add(offset));
+            offset += SNAPSHOT_PAGE_SIZE as u32;
+        }
+        if len > 0 {
+            self.ram_written(address.wrapping_add(len - 1));
+        }
+    }
+}
+
+impl Default for DirtyPages {
+    fn default() -> Self {
+        Self {
+            ewram: RegionTracker::new(EWRAM_SIZE),
+            iwram: RegionTracker::new(IWRAM_SIZE),
+            vram: RegionTracker::new(VRAM_SIZE),
+        }
+    }
+}
+
+#[cfg(test)]
+mod test {
+    use std::sync::Arc;
+
+    use super::{RegionTracker, SNAPSHOT_PAGE_SIZE};
+
+    #[test]
+    fn test_unchanged_pages_are_shared() {
+        let mut memory = vec![0u8; SNAPSHOT_PAGE_SIZE * 4];
+        let mut tracker = RegionTracker::new(memory.len());
+        let first = tracker.snapshot(&memory);
+
+        memory[SNAPSHOT_PAGE_SIZE * 2 + 5] = 1;
+        tracker.mark(SNAPSHOT_PAGE_SIZE * 2 + 5);
+        let second = tracker.snapshot(&memory);
+        assert!(Arc::ptr_eq(&first.pages[0], &second.pages[0]));
+        assert!(!Arc::ptr_eq(&first.pages[2], &second.pages[2]));
+        assert_eq!(second.pages[2][5], 1);
+        assert_eq!(first.pages[2][5], 0);
+    }
+
+    #[test]
+    fn test_restore_copies_changed_pages() {
+        let mut memory = vec![0u8; SNAPSHOT_PAGE_SIZE * 4];
+        let mut tracker = RegionTracker::new(memory.len());
+        memory[0] = 1;
+        let first = tracker.snapshot(&memory);
+
+        memory[SNAPSHOT_PAGE_SIZE * 3] = 2;
+        tracker.mark(SNAPSHOT_PAGE_SIZE * 3);
+        let second = tracker.snapshot(&memory);
+        memory[SNAPSHOT_PAGE_SIZE] = 3;
+        tracker.mark(SNAPSHOT_PAGE_SIZE);
+
+        let mut changed = Vec::new();
+        tracker.restore(&mut memory, &first, |offset| changed.push(offset));
+        assert_eq!(changed, [SNAPSHOT_PAGE_SIZE, SNAPSHOT_PAGE_SIZE * 3]);
+        assert_eq!(memory[SNAPSHOT_PAGE_SIZE], 0);
+        assert_eq!(memory[SNAPSHOT_PAGE_SIZE * 3], 0);
+        assert_eq!(memory[0], 1);
+
+        changed.clear();
+        tracker.restore(&mut memory, &second, |offset| changed.push(offset));
+        assert_eq!(changed, [SNAPSHOT_PAGE_SIZE * 3]);
+        assert_eq!(memory[SNAPSHOT_PAGE_SIZE * 3], 2);
+    }
+}
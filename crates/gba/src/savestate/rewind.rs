@@ -0,0 +1,231 @@
+//! A history of snapshots for rewinding.
+//!
+//! Only the newest state is kept as a whole savestate. Every older one is kept as the XOR of
+//! its savestate with the savestate after it, which is almost all zeroes because only a few
+//! pages of memory change between frames, and the zeroes are run-length encoded. Going back
+//! a state applies the newest delta to the newest savestate.
+
+use std::collections::VecDeque;
+
+use super::Snapshot;
+
+/// Keeps the most recent snapshots that fit into a memory budget.
+pub struct RewindBuffer {
+    /// The savestate of the newest snapshot, with every page of memory.
+    newest: Option<Vec<u8>>,
+    /// Deltas that turn each savestate into the one before it, oldest first.
+    deltas: VecDeque<Vec<u8>>,
+    /// The number of bytes in `newest` and `deltas`.
+    used: usize,
+    budget: usize,
+}
+
+impl RewindBuffer {
+    /// A rewind buffer that drops its oldest states once they use more than `budget` bytes.
+    /// The newest state is always kept even if it's larger than that on its own.
+    pub fn new(budget: usize) -> Self {
+        RewindBuffer {
+            newest: None,
+            deltas: VecDeque::new(),
+            used: 0,
+            budget,
+        }
+    }
+
+    pub fn set_budget(&mut self, budget: usize) {
+        self.budget = budget;
+        self.evict();
+    }
+
+    pub fn budget(&self) -> usize {
+        self.budget
+    }
+
+    /// The number of bytes that the states use.
+    pub fn memory_used(&self) -> usize {
+        self.used
+    }
+
+    /// The number of states that can be rewound to.
+    pub fn len(&self) -> usize {
+        self.newest.as_ref().map_or(0, |_| self.deltas.len() + 1)
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.newest.is_none()
+    }
+
+    pub fn clear(&mut self) {
+        self.newest = None;
+        self.deltas.clear();
+        self.used = 0;
+    }
+
+    /// Adds a snapshot as the newest state.
+    pub fn push(&mut self, snapshot: &Snapshot) {
+        #[cfg(feature = "puffin")]
+        puffin::profile_function!();
+
+        let savestate = snapshot.to_bytes_with_zero_pages();
+        self.used += savestate.len();
+        if let Some(previous) = self.newest.replace(savestate) {
+            let delta = encode_delta(&previous, self.newest.as_deref().unwrap());
+            self.used -= previous.len();
+            self.used += delta.len();
+            self.deltas.push_back(delta);
+        }
+        self.evict();
+    }
+
+    /// Removes the newest state and returns it. The state before it becomes the newest.
+    pub fn pop(&mut self) -> Option<Snapshot> {
+        #[cfg(feature = "puffin")]
+        puffin::profile_function!();
+
+        let newest = self.newest.take()?;
+        self.used -= newest.len();
+        if let Some(delta) = self.deltas.pop_back() {
+            let previous = decode_delta(&delta, &newest);
+            self.used -= delta.len();
+            self.used += previous.len();
+            self.newest = Some(previous);
+        }
+        let snapshot =
+            Snapshot::from_bytes(&newest).expect("rewind buffer contains an invalid state");
+        Some(snapshot)
+    }
+
+    fn evict(&mut self) {
+        while self.used > self.budget {
+            let Some(oldest) = self.deltas.pop_front() else {
+                break;
+            };
+            self.used -= oldest.len();
+        }
+    }
+}
+
+/// Runs of fewer equal bytes than this are kept in the literal around them, because ending
+/// a literal and starting another costs about as much as the bytes would.
+const MIN_ZERO_RUN: usize = 8;
+
+/// Encodes `older` as its length followed by a sequence of runs of bytes that are the same as
+/// in `newer` and literal bytes that are XORed with `newer`. Bytes past the end of `newer` are
+/// XORed with zero.
+fn encode_delta(older: &[u8], newer: &[u8]) -> Vec<u8> {
+    let xor = |index: usize| older[index] ^ newer.get(index).copied().unwrap_or(0);
+    let zero_run = |start: usize| {
+        let mut end = start;
+        let common = older.len().min(newer.len());
+        while end + 8 <= common && older[end..end + 8] == newer[end..end + 8] {
+            end += 8;
+        }
+        while end < older.len() && xor(end) == 0 {
+            end += 1;
+        }
+        end - start
+    };
+
+    let mut delta = Vec::new();
+    write_varint(&mut delta, older.len());
+    let mut index = 0;
+    while index < older.len() {
+        let zeroes = zero_run(index);
+        index += zeroes;
+
+        let start = index;
+        while index < older.len() {
+            let run = zero_run(index);
+            if run >= MIN_ZERO_RUN || index + run == older.len() {
+                break;
+            }
+            index += run.max(1);
+        }
+
+        write_varint(&mut delta, zeroes);
+        write_varint(&mut delta, index - start);
+        delta.extend((start..index).map(xor));
+    }
+    delta
+}
+
+/// Returns the `older` bytes that were passed to [`encode_delta`] along with `newer`.
+fn decode_delta(delta: &[u8], newer: &[u8]) -> Vec<u8> {
+    let mut delta = delta;
+    let len = read_varint(&mut delta);
+    let mut older = vec![0; len];
+    let common = len.min(newer.len());
+    older[..common].copy_from_slice(&newer[..common]);
+
+    let mut index = 0;
+    while !delta.is_empty() {
+        index += read_varint(&mut delta);
+        let literal_len = read_varint(&mut delta);
+        let (literal, rest) = delta.split_at(literal_len);
+        for (byte, &xor) in older[index..index + literal_len].iter_mut().zip(literal) {
+            *byte ^= xor;
+        }
+        index += literal_len;
+        delta = rest;
+    }
+    older
+}
+
+fn write_varint(bytes: &mut Vec<u8>, mut value: usize) {
+    while value >= 0x80 {
+        bytes.push(value as u8 | 0x80);
+        value >>= 7;
+    }
+    bytes.push(value as u8);
+}
+
+fn read_varint(bytes: &mut &[u8]) -> usize {
+    let mut value = 0;
+    let mut shift = 0;
+    loop {
+        let byte = bytes[0];
+        *bytes = &bytes[1..];
+        value |= ((byte & 0x7F) as usize) << shift;
+        if byte & 0x80 == 0 {
+            return value;
+        }
+        shift += 7;
+    }
+}
+
+#[cfg(test)]
+mod test {
+    use super::{decode_delta, encode_delta};
+
+    #[test]
+    fn test_delta_round_trip() {
+        let newer: Vec<u8> = (0..4096).map(|index| (index * 7) as u8).collect();
+        let mut older = newer.clone();
+        older[3] ^= 0xFF;
+        older[100..140].fill(0x55);
+        older[4095] = 0;
+
+        let delta = encode_delta(&older, &newer);
+        assert!(delta.len() < 64, "delta is {} bytes", delta.len());
+        assert_eq!(decode_delta(&delta, &newer), older);
+
+        assert_eq!(decode_delta(&encode_delta(&newer, &newer), &newer), newer);
+    }
+
+    #[test]
+    fn test_delta_different_lengths() {
+        let newer = vec![1u8; 100];
+        let longer: Vec<u8> = (0..130).map(|index| index as u8).collect();
+        let shorter = vec![1u8; 60];
+
+        assert_eq!(decode_delta(&encode_delta(&longer, &newer), &newer), longer);
+        assert_eq!(
+            decode_delta(&encode_delta(&shorter, &newer), &newer),
+            shorter
+        );
+        assert_eq!(
+            decode_delta(&encode_delta(&[], &newer), &newer),
+            Vec::<u8>::new()
+        );
+    }
+}
@@ -16,8 +16,9 @@ use gba::{
     NoopGbaVideoOutput,
 };
 
+/// Assembles ARM source into a ROM that starts executing at the first instruction.
 #[allow(dead_code)]
-pub fn execute(original_source: &str) -> Gba {
+pub fn assemble(original_source: &str) -> Vec<u8> {
     let preamble = ".text\n.arm\n.global _start\n_start:\n";
     let mut source = String::with_capacity(original_source.len() + preamble.len());
     source.push_str(preamble);
@@ -27,9 +28,18 @@ pub fn execute(original_source: &str) -> Gba {
     // Use cargo's temp file directory. Good to have this set epecially on Windows
     // where you're likely to have your code ignored by your antivirus (e.g. Windows Defender)
     arm_devkit::set_internal_tempfile_directory(env!("CARGO_TARGET_TMPDIR"));
+    arm_devkit::set_assembly_cache_directory(concat!(
+        env!("CARGO_TARGET_TMPDIR"),
+        "/assembly-cache"
+    ));
+
+    arm_devkit::arm::assemble(&source, simple_linker_script()).unwrap()
+}
 
+#[allow(dead_code)]
+pub fn execute(original_source: &str) -> Gba {
     let mut gba = Gba::new();
-    gba.set_gamepak(arm_devkit::arm::assemble(&source, simple_linker_script()).unwrap());
+    gba.set_gamepak(assemble(original_source));
     gba.reset();
 
     let execution_ended: Arc<AtomicBool> = Arc::default();
@@ -111,13 +121,13 @@ where
     gba
 }
 
-struct GbaVideoFnOutput<F> {
+pub struct GbaVideoFnOutput<F> {
     f: F,
 }
 
 impl<F> GbaVideoFnOutput<F> {
     #[allow(dead_code)]
-    fn new(f: F) -> Self {
+    pub fn new(f: F) -> Self {
         Self { f }
     }
 }
@@ -0,0 +1,135 @@
+use arm::{disasm::MemoryView as _, emu::Memory as _};
+use gba::{NoopGbaAudioOutput, NoopGbaVideoOutput};
+
+#[macro_use]
+mod common;
+
+/// Writes the words 0, 1, 2, ... 15 to the start of IWRAM.
+const WRITE_SOURCE: &str = "
+    ldr r1, =#0x03000000
+    mov r2, #0
+1:
+    str r2, [r1, r2, lsl #2]
+    add r2, r2, #1
+    cmp r2, #16
+    blt 1b
+";
+
+#[test]
+fn test_immediate_copy_to_ewram() {
+    let gba = emu_arm! {"
+        {WRITE_SOURCE}
+        ldr r0, =#0x040000D4
+        ldr r1, =#0x03000000
+        str r1, [r0]
+        ldr r1, =#0x02000100
+        str r1, [r0, #4]
+        @ 16 words, 32-bit, enabled
+        ldr r1, =#0x84000010
+        str r1, [r0, #8]
+        swi #0xCE
+    "};
+
+    for index in 0..16 {
+        assert_eq!(gba.mapped.view32(0x02000100 + index * 4), index);
+    }
+    assert_eq!(gba.mapped.view32(0x02000140), 0);
+}
+
+#[test]
+fn test_immediate_fill_to_vram() {
+    let gba = emu_arm! {"
+        ldr r1, =#0x03000000
+        ldr r2, =#0x1234
+        strh r2, [r1]
+        ldr r0, =#0x040000D4
+        str r1, [r0]
+        ldr r1, =#0x06000010
+        str r1, [r0, #4]
+        @ 24 halfwords, fixed source, enabled
+        ldr r1, =#0x81000018
+        str r1, [r0, #8]
+        swi #0xCE
+    "};
+
+    assert_eq!(gba.mapped.view16(0x0600000E), 0);
+    for index in 0..24 {
+        assert_eq!(gba.mapped.view16(0x06000010 + index * 2), 0x1234);
+    }
+    assert_eq!(gba.mapped.view16(0x06000040), 0);
+}
+
+#[test]
+fn test_immediate_copy_to_palette() {
+    // Palette RAM isn't in the page table, so this goes through the memory map.
+    let gba = emu_arm! {"
+        {WRITE_SOURCE}
+        ldr r0, =#0x040000D4
+        ldr r1, =#0x03000000
+        str r1, [r0]
+        ldr r1, =#0x05000000
+        str r1, [r0, #4]
+        ldr r1, =#0x84000004
+        str r1, [r0, #8]
+        swi #0xCE
+    "};
+
+    for index in 0..4 {
+        assert_eq!(gba.mapped.view32(0x05000000 + index * 4), index);
+    }
+}
+
+#[test]
+fn test_decrementing_copy() {
+    let gba = emu_arm! {"
+        {WRITE_SOURCE}
+        ldr r0, =#0x040000D4
+        ldr r1, =#0x03000000
+        str r1, [r0]
+        ldr r1, =#0x0200003C
+        str r1, [r0, #4]
+        @ 16 words, 32-bit, decrementing destination, enabled
+        ldr r1, =#0x84200010
+        str r1, [r0, #8]
+        swi #0xCE
+    "};
+
+    for index in 0..16 {
+        assert_eq!(gba.mapped.view32(0x0200003C - index * 4), index);
+    }
+}
+
+#[test]
+fn test_vblank_transfer() {
+    let mut gba = emu_arm! {"
+        {WRITE_SOURCE}
+        ldr r0, =#0x040000B0
+        ldr r1, =#0x03000000
+        str r1, [r0]
+        ldr r1, =#0x02000000
+        str r1, [r0, #4]
+        @ 8 words, 32-bit, V-Blank, IRQ, enabled
+        ldr r1, =#0xD4000008
+        str r1, [r0, #8]
+        swi #0xCE
+        b .
+    "};
+
+    // Nothing is copied before V-Blank.
+    assert_eq!(gba.mapped.view32(0x0200001C), 0);
+
+    gba.run_frame(&mut NoopGbaVideoOutput, &mut NoopGbaAudioOutput);
+    gba.run_frame(&mut NoopGbaVideoOutput, &mut NoopGbaAudioOutput);
+
+    for index in 0..8 {
+        assert_eq!(gba.mapped.view32(0x02000000 + index * 4), index);
+    }
+    assert_eq!(gba.mapped.view32(0x02000020), 0);
+
+    // The channel doesn't repeat, so it was disabled once it finished.
+    let (control, _) = gba.mapped.load16(0x040000BA, &mut gba.cpu);
+    assert_eq!(control & 0x8000, 0);
+    // DMA0's interrupt was requested.
+    let (interrupts, _) = gba.mapped.load16(0x04000202, &mut gba.cpu);
+    assert_eq!(interrupts & 0x0100, 0x0100);
+}
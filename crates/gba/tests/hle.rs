@@ -0,0 +1,183 @@
+use arm::disasm::MemoryView as _;
+use common::assemble;
+use gba::{Gba, NoopGbaAudioOutput, NoopGbaVideoOutput};
+
+#[macro_use]
+mod common;
+
+/// Runs `source` until it writes a non-zero value to the start of EWRAM and returns that value.
+fn run_until_result(source: &str) -> (Gba, u32) {
+    run_until_result_on(Gba::new(), source)
+}
+
+fn run_until_result_on(mut gba: Gba, source: &str) -> (Gba, u32) {
+    gba.set_gamepak(assemble(source));
+    gba.reset();
+
+    let start_time = std::time::Instant::now();
+    loop {
+        let result = gba.mapped.view32(0x02000000);
+        if result != 0 {
+            return (gba, result);
+        }
+
+        if start_time.elapsed() > std::time::Duration::from_secs(5) {
+            let next_pc = gba.cpu.next_execution_address();
+            panic!("emulator timeout: 0x{next_pc:08X}");
+        }
+        gba.step(&mut NoopGbaVideoOutput, &mut NoopGbaAudioOutput);
+    }
+}
+
+#[test]
+pub fn test_vblank_intr_wait() {
+    let (gba, vcount) = run_until_result(
+        "
+        ldr     r4, =0x04000000
+        mov     r1, #0x8            @ DISPSTAT: V-Blank IRQ enable
+        strh    r1, [r4, #4]
+        swi     #0x050000           @ VBlankIntrWait (clobbers r0 and r1)
+        ldrh    r1, [r4, #6]        @ VCOUNT
+        orr     r1, r1, #0x10000
+        ldr     r2, =0x02000000
+        str     r1, [r2]
+    loop:
+        b       loop
+        ",
+    );
+    assert_eq!(vcount, 0x10000 | 160);
+    assert!(!gba.cpu.halted());
+}
+
+#[test]
+pub fn test_halt_waits_for_enabled_interrupt() {
+    let (gba, dispstat) = run_until_result(
+        "
+        ldr     r0, =0x04000000
+        mov     r1, #0x10           @ DISPSTAT: H-Blank IRQ enable
+        strh    r1, [r0, #4]
+        ldr     r2, =0x04000200
+        mov     r1, #0x2            @ IE: H-Blank
+        strh    r1, [r2]
+        ldr     r2, =0x04000301
+        strb    r1, [r2]            @ HALTCNT
+        ldrh    r1, [r0, #4]        @ DISPSTAT
+        orr     r1, r1, #0x10000
+        ldr     r2, =0x02000000
+        str     r1, [r2]
+    loop:
+        b       loop
+        ",
+    );
+    assert_eq!(dispstat & 0x2, 0x2, "H-Blank flag should be set");
+    assert!(gba.cycles() >= 960);
+}
+
+#[test]
+pub fn test_idle_loop_detection_is_exact() {
+    let source = "
+        ldr     r0, =0x04000000
+        ldr     r2, =0x02000000
+        mov     r3, #0
+    wait_for_vblank:
+        ldrh    r1, [r0, #6]        @ VCOUNT
+        cmp     r1, #160
+        bne     wait_for_vblank
+        add     r3, r3, #1
+        str     r3, [r2]
+    wait_for_vdraw:
+        ldrh    r1, [r0, #6]
+        cmp     r1, #160
+        beq     wait_for_vdraw
+        b       wait_for_vblank
+        ";
+    let rom = assemble(source);
+
+    let run = |idle_loop_detection: bool| {
+        let mut gba = Gba::new();
+        gba.cpu.set_idle_loop_detection_enabled(idle_loop_detection);
+        gba.set_gamepak(rom.clone());
+        gba.reset();
+        for _ in 0..3 {
+            gba.run_frame(&mut NoopGbaVideoOutput, &mut NoopGbaAudioOutput);
+        }
+        let registers = [0, 1, 2, 3, 15].map(|r| gba.cpu.registers.read(r));
+        (gba.cycles(), registers, gba.mapped.view32(0x02000000))
+    };
+
+    let with_detection = run(true);
+    assert_eq!(with_detection, run(false));
+    // The first frame ends right before the first V-Blank.
+    assert_eq!(with_detection.2, 2);
+}
+
+#[test]
+pub fn test_swi_comment_is_not_a_memory_access() {
+    let mut gba = Gba::new();
+    gba.set_hle_math_enabled(true);
+    gba.set_gamepak(assemble(
+        "
+        swi     #0x060000           @ Div
+    loop:
+        b       loop
+        ",
+    ));
+    gba.reset();
+    gba.cpu.branch(0x08000000, &mut gba.mapped);
+
+    let before = gba.counters().memory;
+    gba.cpu.step(&mut gba.mapped);
+    // Only the opcode after the SWI is fetched.
+    assert_eq!(gba.counters().memory.since(&before).accesses[0x08], 1);
+}
+
+#[test]
+pub fn test_hle_div() {
+    let gba = Gba::new();
+    // The custom BIOS doesn't have its own versions of the math functions yet.
+    assert!(gba.hle_math_enabled());
+    let (gba, _) = run_until_result_on(
+        gba,
+        "
+        ldr     r0, =-1234
+        mov     r1, #10
+        swi     #0x060000           @ Div
+        ldr     r2, =0x02000000
+        mov     r4, #1
+        str     r4, [r2]
+    loop:
+        b       loop
+        ",
+    );
+    assert_eq!(gba.cpu.registers.read(0) as i32, -123);
+    assert_eq!(gba.cpu.registers.read(1) as i32, -4);
+    assert_eq!(gba.cpu.registers.read(3), 123);
+}
+
+#[test]
+pub fn test_hle_cpu_fast_set() {
+    let gba = Gba::new();
+    // The custom BIOS doesn't have its own versions of the memory functions yet.
+    assert!(gba.hle_memory_enabled());
+    let (gba, _) = run_until_result_on(
+        gba,
+        "
+        ldr     r0, =value
+        ldr     r1, =0x06000000
+        ldr     r2, =0x01000010     @ fill 16 words
+        swi     #0x0C0000           @ CpuFastSet
+        ldr     r2, =0x02000000
+        mov     r4, #1
+        str     r4, [r2]
+    loop:
+        b       loop
+    value:
+        .word   0x12345678
+        ",
+    );
+    assert_eq!(gba.cpu.registers.read(1), 0x06000040);
+    for address in (0x06000000..0x06000040).step_by(4) {
+        assert_eq!(gba.mapped.view32(address), 0x12345678);
+    }
+    assert_eq!(gba.mapped.view32(0x06000040), 0);
+}
@@ -0,0 +1,202 @@
+//! Checks the high level emulation of the BIOS math functions against the custom BIOS's
+//! implementation of them.
+
+use arm::emu::{Cpu, CpuMode, Cycles, InstructionSet, Memory, Registers, Waitstates};
+use common::assemble;
+use gba::hle::math;
+
+mod common;
+
+static MATH_SOURCE: &str = include_str!("../../../gba-programs/custom-bios/source/math.s");
+
+const ROM_START: u32 = 0x08000000;
+
+/// Memory without any waitstates, which is what the BIOS runs with.
+struct BiosMemory {
+    data: Vec<u8>,
+}
+
+impl Memory for BiosMemory {
+    fn load8(&mut self, address: u32, _cpu: &mut Cpu) -> (u8, Waitstates) {
+        let address = address as usize % self.data.len();
+        (self.data[address], Waitstates::zero())
+    }
+
+    fn store8(&mut self, address: u32, value: u8, _cpu: &mut Cpu) -> Waitstates {
+        let address = address as usize % self.data.len();
+        self.data[address] = value;
+        Waitstates::zero()
+    }
+
+    fn as_any(&self) -> &dyn std::any::Any {
+        self
+    }
+
+    fn as_mut_any(&mut self) -> &mut dyn std::any::Any {
+        self
+    }
+}
+
+/// Calls a BIOS function with the given arguments in r0 and r1.
+struct Lle {
+    cpu: Cpu,
+    memory: BiosMemory,
+}
+
+impl Lle {
+    fn new(function: &str) -> Self {
+        let source = format!("bl {function}\nb .\n{MATH_SOURCE}");
+        let rom = assemble(&source);
+
+        let mut memory = BiosMemory {
+            data: vec![0; 0x10000],
+        };
+        memory.data[..rom.len()].copy_from_slice(&rom);
+        let cpu = Cpu::new(InstructionSet::Arm, CpuMode::System, &mut memory);
+        Lle { cpu, memory }
+    }
+
+    fn call(&mut self, registers: &Registers) -> (Registers, Cycles) {
+        self.cpu.registers = registers.clone();
+        self.cpu.branch(ROM_START, &mut self.memory);
+
+        let mut cycles = Cycles::zero();
+        while self.cpu.next_execution_address() != ROM_START + 4 {
+            cycles += self.cpu.step(&mut self.memory);
+        }
+        (self.cpu.registers.clone(), cycles)
+    }
+}
+
+fn check(function: &str, hle: fn(&mut Registers) -> Cycles, inputs: &[(u32, u32)]) {
+    let mut lle = Lle::new(function);
+
+    for &(r0, r1) in inputs {
+        let mut registers = lle.cpu.registers.clone();
+        registers.write(0, r0);
+        registers.write(1, r1);
+        registers.write(2, 0xDEAD2222);
+        registers.write(3, 0xDEAD3333);
+        registers.write(13, 0x03007F00);
+
+        let (expected, expected_cycles) = lle.call(&registers);
+        let cycles = hle(&mut registers);
+
+        for r in 0..=3 {
+            assert_eq!(
+                registers.read(r),
+                expected.read(r),
+                "{function}(0x{r0:08X}, 0x{r1:08X}): r{r}",
+            );
+        }
+        assert_eq!(
+            u32::from(cycles),
+            u32::from(expected_cycles),
+            "{function}(0x{r0:08X}, 0x{r1:08X}): cycles",
+        );
+    }
+}
+
+/// Interesting values followed by some pseudo random ones.
+fn inputs(interesting: &[u32], count: usize, mask: u32) -> Vec<(u32, u32)> {
+    let mut inputs = Vec::new();
+    for &a in interesting {
+        for &b in interesting {
+            inputs.push((a, b));
+        }
+    }
+
+    let mut state = 0x12345678u32;
+    let mut next = move || {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        state
+    };
+    for _ in 0..count {
+        let a = next() & mask;
+        let b = next() & mask;
+        inputs.push((sign_extend(a, mask), sign_extend(b, mask)));
+    }
+    inputs
+}
+
+fn sign_extend(value: u32, mask: u32) -> u32 {
+    let shift = mask.leading_zeros();
+    (((value << shift) as i32) >> shift) as u32
+}
+
+const DIV_VALUES: &[u32] = &[
+    0,
+    1,
+    2,
+    3,
+    7,
+    10,
+    1234,
+    (-1i32) as u32,
+    (-10i32) as u32,
+    (-1234i32) as u32,
+    0x7FFFFFFF,
+    0x80000000,
+];
+
+const FIXED_VALUES: &[u32] = &[
+    0,
+    1,
+    0x2000,
+    0x3FFF,
+    0x4000,
+    (-1i32) as u32,
+    (-0x2000i32) as u32,
+    (-0x4000i32) as u32,
+];
+
+#[test]
+pub fn test_div() {
+    check("swi_Div", math::div, &inputs(DIV_VALUES, 64, u32::MAX));
+}
+
+#[test]
+pub fn test_div_arm() {
+    check(
+        "swi_DivArm",
+        math::div_arm,
+        &inputs(DIV_VALUES, 64, u32::MAX),
+    );
+}
+
+#[test]
+pub fn test_div_results() {
+    let mut registers = Registers::new(CpuMode::System);
+    registers.write(0, (-1234i32) as u32);
+    registers.write(1, 10);
+    math::div(&mut registers);
+    assert_eq!(registers.read(0) as i32, -123);
+    assert_eq!(registers.read(1) as i32, -4);
+    assert_eq!(registers.read(3), 123);
+}
+
+#[test]
+pub fn test_sqrt() {
+    let values = &[0, 1, 2, 3, 4, 15, 16, 17, 0x10000, 0xFFFE0001, u32::MAX];
+    check("swi_Sqrt", math::sqrt, &inputs(values, 64, u32::MAX));
+}
+
+#[test]
+pub fn test_arctan() {
+    check(
+        "swi_ArcTan",
+        math::arctan,
+        &inputs(FIXED_VALUES, 64, 0x7FFF),
+    );
+}
+
+#[test]
+pub fn test_arctan2() {
+    check(
+        "swi_ArcTan2",
+        math::arctan2,
+        &inputs(FIXED_VALUES, 256, 0xFFFF),
+    );
+}
@@ -0,0 +1,430 @@
+//! Checks the high level emulation of the BIOS memory functions against the custom BIOS's
+//! implementation of them. The BIOS functions are run from IWRAM, which has the same timing
+//! as the BIOS.
+
+use arm::{
+    disasm::MemoryView as _,
+    emu::{Cpu, Cycles, Memory as _},
+};
+use common::assemble;
+use gba::{
+    counters::MEMORY_REGION_NAMES,
+    hle::memory,
+    memory::{REGION_IWRAM, REGION_VRAM},
+    Gba, GbaMemoryMappedHardware,
+};
+
+mod common;
+
+static MEMORY_SOURCE: &str = include_str!("../../../gba-programs/custom-bios/source/memory.s");
+
+/// Where the BIOS functions are loaded. The first instruction is where they return to.
+const CODE: u32 = 0x03001000;
+
+const CPU_SET: u32 = CODE + 0x04;
+const CPU_FAST_SET: u32 = CODE + 0x08;
+const LZ77_WRITE8: u32 = CODE + 0x0C;
+const LZ77_WRITE16: u32 = CODE + 0x10;
+const RL_WRITE8: u32 = CODE + 0x14;
+const RL_WRITE16: u32 = CODE + 0x18;
+
+const ROM: u32 = 0x08000000;
+const ROM_LZ77: u32 = ROM + 0x4000;
+const ROM_RL: u32 = ROM + 0x8000;
+const EWRAM: u32 = 0x02000000;
+const IWRAM: u32 = 0x03004000;
+const VRAM: u32 = 0x06000000;
+const PALETTE: u32 = 0x05000000;
+
+type Hle = fn(&mut Cpu, &mut GbaMemoryMappedHardware) -> Cycles;
+
+fn test_data(len: usize) -> Vec<u8> {
+    let mut state = 0x2468ACE1u32;
+    let mut data = Vec::with_capacity(len);
+    while data.len() < len {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        let run = (state >> 28) as usize + 1;
+        let value = if state & 0x100 != 0 {
+            (state >> 16) as u8
+        } else {
+            (state >> 16) as u8 & 0x3
+        };
+        data.extend(std::iter::repeat_n(value, run));
+        // Repeat something from earlier now and then so that LZ77 has something to find.
+        if state & 0x3000 == 0 && data.len() > 64 {
+            let start = data.len() - 40 + (state as usize % 16);
+            let repeat = data[start..start + 12].to_vec();
+            data.extend(repeat);
+        }
+    }
+    data.truncate(len);
+    data
+}
+
+fn lz77_compress(data: &[u8]) -> Vec<u8> {
+    let mut out = ((data.len() as u32) << 8 | 0x10).to_le_bytes().to_vec();
+    let mut position = 0;
+    while position < data.len() {
+        let flags_index = out.len();
+        out.push(0);
+        for block in 0..8 {
+            if position >= data.len() {
+                break;
+            }
+
+            // Displacements of 1 don't work with the 16-bit version.
+            let mut best = (0, 0);
+            for distance in 2..=position.min(4096) {
+                let length = (0..18)
+                    .take_while(|&i| {
+                        position + i < data.len()
+                            && data[position + i] == data[position + i - distance]
+                    })
+                    .count();
+                if length > best.0 {
+                    best = (length, distance);
+                }
+            }
+
+            if best.0 >= 3 {
+                let (length, distance) = best;
+                out[flags_index] |= 0x80 >> block;
+                out.push((((length - 3) << 4) | ((distance - 1) >> 8)) as u8);
+                out.push((distance - 1) as u8);
+                position += length;
+            } else {
+                out.push(data[position]);
+                position += 1;
+            }
+        }
+    }
+    out
+}
+
+fn rl_compress(data: &[u8]) -> Vec<u8> {
+    let mut out = ((data.len() as u32) << 8 | 0x30).to_le_bytes().to_vec();
+    let mut position = 0;
+    while position < data.len() {
+        let run = data[position..]
+            .iter()
+            .take(130)
+            .take_while(|&&b| b == data[position])
+            .count();
+        if run >= 3 {
+            out.push(0x80 | (run - 3) as u8);
+            out.push(data[position]);
+            position += run;
+        } else {
+            let start = position;
+            while position < data.len() && position - start < 128 {
+                let run = data[position..]
+                    .iter()
+                    .take(3)
+                    .take_while(|&&b| b == data[position])
+                    .count();
+                if run >= 3 {
+                    break;
+                }
+                position += 1;
+            }
+            out.push((position - start - 1) as u8);
+            out.extend_from_slice(&data[start..position]);
+        }
+    }
+    out
+}
+
+/// The data that is decompressed. 0x1000 bytes.
+fn uncompressed() -> Vec<u8> {
+    test_data(0x1000)
+}
+
+fn setup() -> Gba {
+    let mut rom = test_data(0x4000);
+    rom.extend(lz77_compress(&uncompressed()));
+    rom.resize(0x8000, 0);
+    rom.extend(rl_compress(&uncompressed()));
+
+    let mut gba = Gba::new();
+    gba.set_gamepak(rom);
+    gba.reset();
+
+    let code = assemble(&format!(
+        "
+        b       .
+        b       swi_CpuSet
+        b       swi_CpuFastSet
+        b       swi_LZ77UnCompReadNormalWrite8bit
+        b       swi_LZ77UnCompReadNormalWrite16bit
+        b       swi_RLUnCompReadNormalWrite8bit
+        b       swi_RLUnCompReadNormalWrite16bit
+        {MEMORY_SOURCE}
+        "
+    ));
+    for (offset, word) in code.chunks(4).enumerate() {
+        let mut bytes = [0u8; 4];
+        bytes[..word.len()].copy_from_slice(word);
+        let address = CODE + offset as u32 * 4;
+        gba.mapped
+            .store32(address, u32::from_le_bytes(bytes), &mut gba.cpu);
+    }
+
+    for (offset, value) in test_data(0x8000).into_iter().enumerate() {
+        gba.mapped
+            .store8(EWRAM + 0x8000 + offset as u32, value, &mut gba.cpu);
+    }
+
+    gba
+}
+
+fn call_setup(gba: &mut Gba, args: [u32; 3]) {
+    for (r, value) in args.into_iter().enumerate() {
+        gba.cpu.registers.write(r as u32, value);
+    }
+    gba.cpu.registers.write(3, 0xDEAD3333);
+    gba.cpu.registers.write(13, 0x03007F00);
+    gba.cpu.registers.write(14, CODE);
+}
+
+fn check(entry: u32, hle: Hle, args: [u32; 3], destination: u32, len: u32) {
+    let mut lle_gba = setup();
+    call_setup(&mut lle_gba, args);
+    lle_gba.cpu.branch(entry, &mut lle_gba.mapped);
+    let mut lle_cycles = Cycles::zero();
+    while lle_gba.cpu.next_execution_address() != CODE {
+        lle_cycles += lle_gba.cpu.step(&mut lle_gba.mapped);
+    }
+
+    let mut hle_gba = setup();
+    call_setup(&mut hle_gba, args);
+    let hle_cycles = hle(&mut hle_gba.cpu, &mut hle_gba.mapped);
+
+    for r in 0..=3 {
+        assert_eq!(
+            hle_gba.cpu.registers.read(r),
+            lle_gba.cpu.registers.read(r),
+            "{args:08X?}: r{r}",
+        );
+    }
+    for address in (destination.saturating_sub(8)..(destination + len + 8)).step_by(2) {
+        assert_eq!(
+            hle_gba.mapped.view16(address),
+            lle_gba.mapped.view16(address),
+            "{args:08X?}: [0x{address:08X}]",
+        );
+    }
+    assert_eq!(
+        u32::from(hle_cycles),
+        u32::from(lle_cycles),
+        "{args:08X?}: cycles"
+    );
+
+    // Every load and store is counted the same way whether it was copied directly or not.
+    // IWRAM is left out because that's where the BIOS functions' code and stack are.
+    let hle_counters = hle_gba.counters().memory;
+    let lle_counters = lle_gba.counters().memory;
+    for (region, name) in MEMORY_REGION_NAMES.iter().enumerate() {
+        if region == REGION_IWRAM as usize {
+            continue;
+        }
+        assert_eq!(
+            (
+                hle_counters.accesses[region],
+                hle_counters.waitstates[region]
+            ),
+            (
+                lle_counters.accesses[region],
+                lle_counters.waitstates[region]
+            ),
+            "{args:08X?}: {name} accesses and waitstates",
+        );
+    }
+}
+
+const FILL: u32 = 1 << 24;
+const WORDS: u32 = 1 << 26;
+
+#[test]
+pub fn test_cpu_set_copy() {
+    check(CPU_SET, memory::cpu_set, [ROM, VRAM, 0x300], VRAM, 0x600);
+    check(
+        CPU_SET,
+        memory::cpu_set,
+        [ROM + 2, EWRAM, WORDS | 0x101],
+        EWRAM,
+        0x404,
+    );
+    check(
+        CPU_SET,
+        memory::cpu_set,
+        [ROM, PALETTE, 0x100],
+        PALETTE,
+        0x200,
+    );
+    // Crosses from one EWRAM page to the next and starts unaligned.
+    check(
+        CPU_SET,
+        memory::cpu_set,
+        [EWRAM + 0x8000, EWRAM + 0x3F01, WORDS | 0x40],
+        EWRAM + 0x3F00,
+        0x100,
+    );
+}
+
+#[test]
+pub fn test_cpu_set_overlapping_copy() {
+    check(
+        CPU_SET,
+        memory::cpu_set,
+        [EWRAM + 0x8000, EWRAM + 0x8002, 0x80],
+        EWRAM + 0x8000,
+        0x104,
+    );
+    check(
+        CPU_SET,
+        memory::cpu_set,
+        [EWRAM + 0x8004, EWRAM + 0x8000, WORDS | 0x40],
+        EWRAM + 0x8000,
+        0x104,
+    );
+}
+
+#[test]
+pub fn test_cpu_set_fill() {
+    check(
+        CPU_SET,
+        memory::cpu_set,
+        [EWRAM + 0x8000, VRAM, FILL | 0x200],
+        VRAM,
+        0x400,
+    );
+    check(
+        CPU_SET,
+        memory::cpu_set,
+        [ROM, IWRAM, FILL | WORDS | 0x80],
+        IWRAM,
+        0x200,
+    );
+}
+
+#[test]
+pub fn test_cpu_set_rejected() {
+    check(CPU_SET, memory::cpu_set, [ROM, EWRAM, 0], EWRAM, 0x10);
+    check(CPU_SET, memory::cpu_set, [0x100, EWRAM, 0x10], EWRAM, 0x20);
+}
+
+#[test]
+pub fn test_cpu_fast_set() {
+    check(
+        CPU_FAST_SET,
+        memory::cpu_fast_set,
+        [ROM, VRAM, 100],
+        VRAM,
+        0x1A0,
+    );
+    check(
+        CPU_FAST_SET,
+        memory::cpu_fast_set,
+        [EWRAM + 0x8000, IWRAM, 0x100],
+        IWRAM,
+        0x400,
+    );
+    check(
+        CPU_FAST_SET,
+        memory::cpu_fast_set,
+        [ROM, EWRAM, FILL | 0x81],
+        EWRAM,
+        0x220,
+    );
+    check(
+        CPU_FAST_SET,
+        memory::cpu_fast_set,
+        [0x100, EWRAM, 0x10],
+        EWRAM,
+        0x40,
+    );
+    check(
+        CPU_FAST_SET,
+        memory::cpu_fast_set,
+        [ROM, EWRAM, 0],
+        EWRAM,
+        0x40,
+    );
+}
+
+#[test]
+pub fn test_lz77_uncomp() {
+    check(
+        LZ77_WRITE8,
+        memory::lz77_uncomp_write8,
+        [ROM_LZ77, EWRAM, 0],
+        EWRAM,
+        0x1000,
+    );
+    check(
+        LZ77_WRITE16,
+        memory::lz77_uncomp_write16,
+        [ROM_LZ77, VRAM, 0],
+        VRAM,
+        0x1000,
+    );
+}
+
+#[test]
+pub fn test_rl_uncomp() {
+    check(
+        RL_WRITE8,
+        memory::rl_uncomp_write8,
+        [ROM_RL, EWRAM, 0],
+        EWRAM,
+        0x1000,
+    );
+    check(
+        RL_WRITE16,
+        memory::rl_uncomp_write16,
+        [ROM_RL, VRAM, 0],
+        VRAM,
+        0x1000,
+    );
+}
+
+#[test]
+pub fn test_uncomp_output() {
+    let mut gba = setup();
+    call_setup(&mut gba, [ROM_LZ77, EWRAM, 0]);
+    memory::lz77_uncomp_write8(&mut gba.cpu, &mut gba.mapped);
+    let data = uncompressed();
+    for (offset, pair) in data.chunks(2).enumerate() {
+        let address = EWRAM + offset as u32 * 2;
+        let expected = u16::from_le_bytes([pair[0], pair[1]]);
+        assert_eq!(gba.mapped.view16(address), expected, "[0x{address:08X}]");
+    }
+    assert_eq!(gba.cpu.registers.read(1), EWRAM + data.len() as u32);
+}
+
+#[test]
+pub fn test_uncomp_into_vram() {
+    let mut gba = setup();
+    let before = gba.counters().memory;
+    call_setup(&mut gba, [ROM_RL, VRAM + 0x100, 0]);
+    memory::rl_uncomp_write16(&mut gba.cpu, &mut gba.mapped);
+    let after = gba.counters().memory;
+
+    let data = uncompressed();
+    for (offset, pair) in data.chunks(2).enumerate() {
+        let address = VRAM + 0x100 + offset as u32 * 2;
+        let expected = u16::from_le_bytes([pair[0], pair[1]]);
+        assert_eq!(gba.mapped.view16(address), expected, "[0x{address:08X}]");
+    }
+
+    // One store for every halfword and nothing else, since the run-length encoding never
+    // reads back from the destination. 16-bit stores to VRAM have no waitstates.
+    let vram = REGION_VRAM as usize;
+    assert_eq!(
+        after.accesses[vram] - before.accesses[vram],
+        data.len() as u64 / 2
+    );
+    assert_eq!(after.waitstates[vram], before.waitstates[vram]);
+}
@@ -1,4 +1,5 @@
 use arm::disasm::MemoryView as _;
+use gba::{Gba, NoopGbaAudioOutput, NoopGbaVideoOutput};
 
 #[macro_use]
 mod common;
@@ -371,3 +372,156 @@ fn test_swi_using_custom_bios() {
     "};
     assert_eq!(gba.mapped.view32(0x02000000), 0xDEADBEEF);
 }
+
+#[test]
+fn test_counters_count_accesses_by_region() {
+    let gba = emu_arm! {"
+        ldr r0, =#0x02000000
+        str r0, [r0]
+        str r0, [r0, #4]
+        ldr r1, [r0]
+        swi #0xCE
+    "};
+
+    let counters = gba.counters();
+    assert_eq!(
+        counters.memory.accesses[gba::memory::REGION_EWRAM as usize],
+        3
+    );
+    // Every instruction was fetched from the gamepak, along with the literal pool.
+    assert!(counters.memory.accesses[gba::memory::REGION_GAMEPAK0_LO as usize] > 5);
+    assert_ne!(
+        counters.memory.waitstates[gba::memory::REGION_GAMEPAK0_LO as usize],
+        0
+    );
+    assert_eq!(counters.cpu.thumb_instructions, 0);
+    assert_eq!(counters.cpu.instructions(), gba.cpu.instruction_count());
+    assert_eq!(
+        counters.cpu.exceptions[arm::emu::CpuException::Swi as usize],
+        1
+    );
+}
+
+#[test]
+fn test_block_cache_is_exact() {
+    let rom = common::assemble(
+        "
+        ldr     r0, =routine
+        ldr     r1, =0x03000000
+        ldr     r2, =routine_end
+    copy:
+        ldr     r3, [r0], #4
+        str     r3, [r1], #4
+        cmp     r0, r2
+        blo     copy
+
+        ldr     r4, =0x02000000
+        ldr     r8, =0x03008000     @ mirror of the routine in IWRAM
+        ldr     r9, =0xE2855002     @ add r5, r5, #2
+        ldr     r11, =0x04000000
+        mov     r5, #0
+        mov     r7, #0
+    main:
+        mov     lr, pc
+        ldr     pc, =0x03000000
+        add     r7, r7, #1
+        ldrh    r10, [r11, #6]      @ VCOUNT
+        add     r1, r1, r10
+        stmia   r4, {r1, r5, r7}
+        cmp     r7, #64
+        streq   r9, [r8, #12]
+        adr     r0, thumb_part + 1
+        bx      r0
+    .thumb
+    thumb_part:
+        mov     r3, #3
+        lsl     r3, r3, #4
+        add     r1, r3
+        adr     r0, arm_part
+        bx      r0
+    .align 2
+    .arm
+    arm_part:
+        @ An idle loop that waits for the next line.
+        ldrh    r10, [r11, #6]
+    wait:
+        ldrh    r12, [r11, #6]
+        cmp     r12, r10
+        beq     wait
+        b       main
+
+    routine:
+        mov     r0, #8
+    inner:
+        add     r1, r1, r0
+        eor     r2, r2, r1, ror #3
+        add     r5, r5, #1
+        subs    r0, r0, #1
+        bne     inner
+        bx      lr
+    routine_end:
+        ",
+    );
+
+    let run = |block_cache: bool, idle_loop_detection: bool| {
+        let mut gba = Gba::new();
+        gba.cpu.set_block_cache_enabled(block_cache);
+        gba.cpu.set_idle_loop_detection_enabled(idle_loop_detection);
+        gba.set_gamepak(rom.clone());
+        gba.reset();
+        for _ in 0..3 {
+            gba.run_frame(&mut NoopGbaVideoOutput, &mut NoopGbaAudioOutput);
+        }
+        let counters = gba.counters();
+        (
+            gba.save_state(),
+            counters.cpu,
+            counters.memory.accesses,
+            counters.memory.waitstates,
+        )
+    };
+
+    for idle_loop_detection in [false, true] {
+        let cached = run(true, idle_loop_detection);
+        assert!(
+            cached == run(false, idle_loop_detection),
+            "block cache changed the outcome (idle loop detection: {idle_loop_detection})"
+        );
+    }
+
+    // Make sure that the idle loop was actually skipped with the block cache.
+    let idle = run(true, true).1.instructions();
+    assert!(idle < run(true, false).1.instructions());
+}
+
+#[test]
+fn test_block_cache_is_cleared_by_set_gamepak() {
+    // Both ROMs start with the same two instructions at the same addresses, which is all that a
+    // cached block is checked against, but store a different marker.
+    let rom = |marker: u32| {
+        common::assemble(&format!(
+            "
+            ldr     r4, =0x02000000
+            mov     r0, #0
+        loop:
+            add     r0, r0, #1
+            add     r1, r1, #1
+            mov     r2, #{marker}
+            str     r2, [r4]
+            b       loop
+            "
+        ))
+    };
+
+    let mut gba = Gba::new();
+    gba.cpu.set_block_cache_enabled(true);
+    gba.set_gamepak(rom(1));
+    gba.reset();
+    gba.run_frame(&mut NoopGbaVideoOutput, &mut NoopGbaAudioOutput);
+    assert_eq!(gba.mapped.view32(0x02000000), 1);
+
+    gba.set_gamepak(rom(2));
+    gba.reset();
+    gba.run_frame(&mut NoopGbaVideoOutput, &mut NoopGbaAudioOutput);
+    assert_eq!(gba.mapped.view32(0x02000000), 2);
+}
@@ -0,0 +1,214 @@
+use arm::disasm::MemoryView as _;
+use common::assemble;
+use gba::{
+    memory::{EWRAM_SIZE, IWRAM_SIZE, VRAM_SIZE},
+    savestate::{RewindBuffer, SavestateError, Snapshot, SAVESTATE_MAGIC},
+    video::{ScreenBuffer, VISIBLE_PIXELS},
+    Gba, NoopGbaAudioOutput,
+};
+
+mod common;
+
+/// Keeps writing a counter to EWRAM, IWRAM, VRAM and the palette so that every frame is
+/// different from the last.
+static SOURCE: &str = "
+    ldr r0, =0x04000000
+    ldr r1, =0x0403
+    strh r1, [r0]
+    mov r2, #0
+    ldr r3, =0x06000000
+    ldr r4, =0x02000000
+    ldr r5, =0x03001000
+    ldr r8, =0x05000000
+    ldr r7, =0x7FFC
+loop:
+    add r2, r2, #1
+    and r6, r7, r2, lsl #2
+    str r2, [r3, r6]
+    str r2, [r4, r6]
+    str r2, [r5, r6]
+    strh r2, [r8]
+    b loop
+";
+
+fn setup() -> Gba {
+    let mut gba = Gba::new();
+    gba.set_gamepak(assemble(SOURCE));
+    gba.reset();
+    gba
+}
+
+/// Everything that's checked after running from a snapshot.
+#[derive(Debug, PartialEq)]
+struct Outcome {
+    frame_hash: u64,
+    cycles: u64,
+    instructions: u64,
+    ewram: u32,
+    iwram: u32,
+}
+
+fn run_frames(gba: &mut Gba, frames: usize) -> Outcome {
+    let mut frame: Box<ScreenBuffer> = Box::new([0; VISIBLE_PIXELS]);
+    for _ in 0..frames {
+        gba.run_frame_into(&mut frame, &mut NoopGbaAudioOutput);
+    }
+    Outcome {
+        frame_hash: hash_frame(&frame),
+        cycles: gba.cycles(),
+        instructions: gba.cpu.instruction_count(),
+        ewram: gba.mapped.view32(0x02000100),
+        iwram: gba.mapped.view32(0x03001100),
+    }
+}
+
+fn hash_frame(frame: &ScreenBuffer) -> u64 {
+    frame.iter().fold(0xcbf29ce484222325, |hash, &pixel| {
+        (hash ^ pixel as u64).wrapping_mul(0x100000001b3)
+    })
+}
+
+#[test]
+pub fn restore_snapshot_test() {
+    let mut gba = setup();
+    run_frames(&mut gba, 2);
+
+    let snapshot = gba.snapshot();
+    assert_eq!(snapshot.frame_count(), 2);
+    let before = run_frames(&mut gba, 0);
+    let expected = run_frames(&mut gba, 3);
+    assert_ne!(before.ewram, expected.ewram);
+    assert_eq!(gba.frame_count(), 5);
+
+    // Restoring the same snapshot again has to work after only copying what changed.
+    for _ in 0..2 {
+        gba.restore(&snapshot);
+        assert_eq!(gba.frame_count(), 2);
+        assert_eq!(gba.cycles(), snapshot.cycles());
+        assert_eq!(run_frames(&mut gba, 3), expected);
+    }
+
+    // Going back and forth between snapshots that share some of their memory.
+    let later = gba.snapshot();
+    let after_later = run_frames(&mut gba, 1);
+    gba.restore(&snapshot);
+    gba.restore(&later);
+    assert_eq!(run_frames(&mut gba, 1), after_later);
+}
+
+#[test]
+pub fn savestate_round_trip_test() {
+    let mut gba = setup();
+    run_frames(&mut gba, 2);
+    let savestate = gba.save_state();
+    assert!(savestate.starts_with(&SAVESTATE_MAGIC));
+    let expected = run_frames(&mut gba, 3);
+
+    let mut loaded = setup();
+    loaded.load_state(&savestate).unwrap();
+    assert_eq!(run_frames(&mut loaded, 3), expected);
+
+    // Lines rendered on another thread have to come from the loaded VRAM too.
+    let mut parallel = setup();
+    parallel.set_parallel_rendering(true);
+    run_frames(&mut parallel, 1);
+    parallel.load_state(&savestate).unwrap();
+    assert_eq!(run_frames(&mut parallel, 3), expected);
+
+    // Encoding a decoded savestate gives back the same bytes.
+    let snapshot = Snapshot::from_bytes(&savestate).unwrap();
+    assert_eq!(snapshot.to_bytes(), savestate);
+}
+
+#[test]
+pub fn savestate_errors_test() {
+    let mut gba = setup();
+    let mut savestate = gba.save_state();
+
+    assert_eq!(
+        gba.load_state(b"not a savestate"),
+        Err(SavestateError::NotASavestate)
+    );
+    assert_eq!(
+        gba.load_state(&savestate[..savestate.len() - 1]),
+        Err(SavestateError::Truncated)
+    );
+
+    // The CPSR and SPSRs come right after the magic and version, at the end of the registers.
+    let cpsr = 12 + 36 * 4;
+    let mut bad_mode = savestate.clone();
+    bad_mode[cpsr] = 0x00;
+    assert_eq!(
+        gba.load_state(&bad_mode),
+        Err(SavestateError::Invalid("cpsr mode"))
+    );
+    let spsr_svc = 12 + 32 * 4;
+    let mut bad_mode = savestate.clone();
+    bad_mode[spsr_svc] = 0x15;
+    assert_eq!(
+        gba.load_state(&bad_mode),
+        Err(SavestateError::Invalid("spsr mode"))
+    );
+
+    savestate[8] = 0xFF;
+    assert!(matches!(
+        gba.load_state(&savestate),
+        Err(SavestateError::UnsupportedVersion(_))
+    ));
+}
+
+#[test]
+pub fn rewind_buffer_test() {
+    let mut gba = setup();
+    let mut rewind = RewindBuffer::new(usize::MAX);
+    let mut expected = Vec::new();
+    for _ in 0..4 {
+        rewind.push(&gba.snapshot());
+        expected.push(run_frames(&mut gba, 1));
+    }
+    assert_eq!(rewind.len(), 4);
+
+    // Only the newest state has all of memory, the others are deltas of what changed.
+    let memory_len = EWRAM_SIZE + IWRAM_SIZE + VRAM_SIZE;
+    assert!(rewind.memory_used() < memory_len * 2);
+
+    while let Some(snapshot) = rewind.pop() {
+        gba.restore(&snapshot);
+        assert_eq!(run_frames(&mut gba, 1), expected.pop().unwrap());
+    }
+    assert!(expected.is_empty());
+
+    // Only the newest states are kept when they don't fit.
+    for _ in 0..4 {
+        rewind.push(&gba.snapshot());
+        run_frames(&mut gba, 1);
+    }
+    rewind.set_budget(rewind.memory_used() - 1);
+    assert_eq!(rewind.len(), 3);
+}
+
+#[test]
+pub fn run_frame_ahead_test() {
+    let mut gba = setup();
+    run_frames(&mut gba, 2);
+    let mut frame: Box<ScreenBuffer> = Box::new([0; VISIBLE_PIXELS]);
+    gba.run_frame_ahead(2, &mut frame, &mut NoopGbaAudioOutput);
+    let after = run_frames(&mut gba, 0);
+
+    // The GBA only moves forward by a frame but shows the frame two frames after that one.
+    let mut expected = setup();
+    run_frames(&mut expected, 3);
+    assert_eq!(after, run_frames(&mut expected, 0));
+    assert_eq!(hash_frame(&frame), run_frames(&mut expected, 2).frame_hash);
+
+    // Frames that aren't rendered leave the frame alone and take the same time.
+    let mut skipped = setup();
+    skipped.set_rendering_enabled(false);
+    let mut frame: Box<ScreenBuffer> = Box::new([0; VISIBLE_PIXELS]);
+    for _ in 0..3 {
+        skipped.run_frame_into(&mut frame, &mut NoopGbaAudioOutput);
+    }
+    assert!(frame.iter().all(|&pixel| pixel == 0));
+    assert_eq!(skipped.frame_count(), 3);
+    assert_eq!(skipped.cycles(), after.cycles);
+}
@@ -1,8 +1,11 @@
-use arm::disasm::MemoryView as _;
-use common::{audio_noop, execute_until};
+use arm::{disasm::MemoryView as _, emu::Memory as _};
+use common::{audio_noop, execute_until, GbaVideoFnOutput};
 use gba::{
-    video::{rgb5, LineBuffer, VISIBLE_LINE_COUNT, VISIBLE_LINE_WIDTH},
-    Gba,
+    video::{
+        rgb5, to_rgb565, to_rgba8888, LineBuffer, PixelFormat, RgbaLineBuffer, VISIBLE_LINE_COUNT,
+        VISIBLE_LINE_WIDTH,
+    },
+    Gba, GbaVideoOutput, NoopGbaAudioOutput,
 };
 
 #[macro_use]
@@ -37,3 +40,270 @@ pub fn simple_mode3_test() {
         }
     }
 }
+
+#[test]
+pub fn run_frame_test() {
+    let mut gba = Gba::new();
+    gba.set_noop_gamepak();
+    gba.reset();
+
+    let mut lines = Vec::new();
+    let mut video = GbaVideoFnOutput::new(|line: usize, _: &LineBuffer| lines.push(line));
+    gba.run_frame(&mut video, &mut NoopGbaAudioOutput);
+    gba.run_frame(&mut video, &mut NoopGbaAudioOutput);
+
+    assert_eq!(gba.frame_count(), 2);
+    let expected: Vec<usize> = (0..VISIBLE_LINE_COUNT)
+        .chain(0..VISIBLE_LINE_COUNT)
+        .collect();
+    assert_eq!(lines, expected);
+}
+
+#[test]
+pub fn run_frame_into_test() {
+    let rom = std::fs::read("../../roms/custom/mode3-test.gba").expect("error reading ROM file");
+    let mut lines_gba = Gba::new();
+    let mut frame_gba = Gba::new();
+    for gba in [&mut lines_gba, &mut frame_gba] {
+        gba.set_gamepak(rom.clone());
+        gba.reset();
+    }
+
+    let mut expected = vec![0u16; VISIBLE_LINE_WIDTH * VISIBLE_LINE_COUNT];
+    let mut frame = Box::new([0u16; VISIBLE_LINE_WIDTH * VISIBLE_LINE_COUNT]);
+    for _ in 0..4 {
+        let mut video = GbaVideoFnOutput::new(|line: usize, data: &LineBuffer| {
+            expected[line * VISIBLE_LINE_WIDTH..][..VISIBLE_LINE_WIDTH].copy_from_slice(data)
+        });
+        lines_gba.run_frame(&mut video, &mut NoopGbaAudioOutput);
+        frame_gba.run_frame_into(&mut frame, &mut NoopGbaAudioOutput);
+
+        assert_eq!(frame_gba.frame_count(), lines_gba.frame_count());
+        assert_eq!(frame_gba.cycles(), lines_gba.cycles());
+        assert!(expected[..] == frame[..], "frames are different");
+    }
+}
+
+#[test]
+pub fn step_into_test() {
+    let mut gba = Gba::new();
+    gba.set_noop_gamepak();
+    gba.reset();
+
+    let mut frame = Box::new([0u16; VISIBLE_LINE_WIDTH * VISIBLE_LINE_COUNT]);
+    let mut frames = 0;
+    while frames < 2 {
+        if gba.step_into(&mut frame, &mut NoopGbaAudioOutput) {
+            frames += 1;
+            assert_eq!(gba.frame_count(), frames);
+        }
+    }
+    // No backgrounds are enabled so every pixel is the backdrop.
+    assert!(frame.iter().all(|&pixel| pixel == 0));
+}
+
+#[test]
+pub fn cached_lines_test() {
+    let mut gba = Gba::new();
+    gba.set_noop_gamepak();
+    gba.reset();
+    // Mode 3 with BG2 enabled.
+    gba.mapped.store16(0x04000000, 0x0403, &mut gba.cpu);
+
+    let mut frame = Box::new([0u16; VISIBLE_LINE_WIDTH * VISIBLE_LINE_COUNT]);
+    gba.run_frame_into(&mut frame, &mut NoopGbaAudioOutput);
+    assert!(frame.iter().all(|&pixel| pixel == 0));
+
+    // Only the line that was written to changes.
+    let pixel = 10 * VISIBLE_LINE_WIDTH + 5;
+    gba.mapped
+        .store16(0x06000000 + pixel as u32 * 2, rgb5(3, 4, 5), &mut gba.cpu);
+    gba.run_frame_into(&mut frame, &mut NoopGbaAudioOutput);
+    for (index, &color) in frame.iter().enumerate() {
+        let expected = if index == pixel { rgb5(3, 4, 5) } else { 0 };
+        assert_eq!(color, expected, "pixel {index}");
+    }
+
+    // Brightening BG2 all the way changes every line.
+    gba.mapped.store16(0x04000050, 0x0084, &mut gba.cpu);
+    gba.mapped.store16(0x04000054, 16, &mut gba.cpu);
+    gba.run_frame_into(&mut frame, &mut NoopGbaAudioOutput);
+    assert!(frame.iter().all(|&pixel| pixel == rgb5(0x1F, 0x1F, 0x1F)));
+}
+
+/// Runs a frame with everything that was set up before it and returns it.
+fn render_frame(gba: &mut Gba) -> Box<[u16; VISIBLE_LINE_WIDTH * VISIBLE_LINE_COUNT]> {
+    let mut frame = Box::new([0u16; VISIBLE_LINE_WIDTH * VISIBLE_LINE_COUNT]);
+    gba.run_frame_into(&mut frame, &mut NoopGbaAudioOutput);
+    frame
+}
+
+#[test]
+pub fn text_background_test() {
+    let mut gba = Gba::new();
+    gba.set_noop_gamepak();
+    gba.reset();
+
+    let red = rgb5(0x1F, 0, 0);
+    let blue = rgb5(0, 0, 0x1F);
+    gba.mapped.store16(0x05000000, blue, &mut gba.cpu);
+    gba.mapped.store16(0x05000000 + 17 * 2, red, &mut gba.cpu);
+    // 4bpp tile 1 has entry 1 in the leftmost pixel of every row.
+    for row in 0..8 {
+        gba.mapped.store32(0x06000020 + row * 4, 1, &mut gba.cpu);
+    }
+    // Tile 1 flipped horizontally with palette 1 in the second column of the first row.
+    gba.mapped
+        .store16(0x0600F800 + 2, 1 | (1 << 10) | (1 << 12), &mut gba.cpu);
+    // Mode 0 with BG0 using screen block 31, scrolled 4 pixels to the right.
+    gba.mapped.store16(0x04000008, 0x1F00, &mut gba.cpu);
+    gba.mapped.store16(0x04000010, 4, &mut gba.cpu);
+    gba.mapped.store16(0x04000000, 0x0100, &mut gba.cpu);
+
+    let frame = render_frame(&mut gba);
+    for (index, &color) in frame.iter().enumerate() {
+        let (x, y) = (index % VISIBLE_LINE_WIDTH, index / VISIBLE_LINE_WIDTH);
+        let expected = if x == 11 && y < 8 { red } else { blue };
+        assert_eq!(color, expected, "pixel ({x}, {y})");
+    }
+
+    // The tile is decoded again after it changes.
+    gba.mapped.store32(0x06000020, 0x10, &mut gba.cpu);
+    let frame = render_frame(&mut gba);
+    assert_eq!(frame[10], red);
+    assert_eq!(frame[11], blue);
+}
+
+#[test]
+pub fn affine_background_test() {
+    let mut gba = Gba::new();
+    gba.set_noop_gamepak();
+    gba.reset();
+
+    let green = rgb5(0, 0x1F, 0);
+    let blue = rgb5(0, 0, 0x1F);
+    gba.mapped.store16(0x05000000, blue, &mut gba.cpu);
+    gba.mapped.store16(0x05000000 + 2 * 2, green, &mut gba.cpu);
+    // 8bpp tile 1 is filled with entry 2.
+    for offset in (0..64).step_by(4) {
+        gba.mapped
+            .store32(0x06000040 + offset, 0x02020202, &mut gba.cpu);
+    }
+    // The map is at screen block 8 and has tile 1 in its top left corner.
+    gba.mapped.store16(0x06004000, 1, &mut gba.cpu);
+    // Mode 2 with a 128x128 BG2 that starts 4 pixels into the map and doesn't wrap around.
+    gba.mapped.store16(0x0400000C, 0x0800, &mut gba.cpu);
+    gba.mapped.store16(0x04000020, 0x100, &mut gba.cpu);
+    gba.mapped.store16(0x04000026, 0x100, &mut gba.cpu);
+    gba.mapped.store16(0x04000028, 4 << 8, &mut gba.cpu);
+    gba.mapped.store16(0x04000000, 0x0402, &mut gba.cpu);
+
+    let frame = render_frame(&mut gba);
+    for (index, &color) in frame.iter().enumerate() {
+        let (x, y) = (index % VISIBLE_LINE_WIDTH, index / VISIBLE_LINE_WIDTH);
+        let expected = if x < 4 && y < 8 { green } else { blue };
+        assert_eq!(color, expected, "pixel ({x}, {y})");
+    }
+
+    // Scaled up by 2 horizontally.
+    gba.mapped.store16(0x04000020, 0x80, &mut gba.cpu);
+    let frame = render_frame(&mut gba);
+    assert_eq!(frame[7], green);
+    assert_eq!(frame[8], blue);
+}
+
+#[test]
+pub fn parallel_rendering_test() {
+    let rom = std::fs::read("../../roms/custom/mode3-test.gba").expect("error reading ROM file");
+    let mut inline_gba = Gba::new();
+    let mut parallel_gba = Gba::new();
+    parallel_gba.set_parallel_rendering(true);
+    assert!(parallel_gba.parallel_rendering());
+
+    for gba in [&mut inline_gba, &mut parallel_gba] {
+        gba.set_gamepak(rom.clone());
+        gba.reset();
+    }
+    let mut expected = Box::new([0u16; VISIBLE_LINE_WIDTH * VISIBLE_LINE_COUNT]);
+    let mut frame = Box::new([0u16; VISIBLE_LINE_WIDTH * VISIBLE_LINE_COUNT]);
+    for _ in 0..4 {
+        inline_gba.run_frame_into(&mut expected, &mut NoopGbaAudioOutput);
+        parallel_gba.run_frame_into(&mut frame, &mut NoopGbaAudioOutput);
+        assert!(expected[..] == frame[..], "frames are different");
+    }
+
+    // Changes in the middle of a frame only affect the lines after them.
+    let mut frames = 0;
+    while frames < 4 {
+        let color = rgb5(frames as u16 * 4, 0, 0);
+        for gba in [&mut inline_gba, &mut parallel_gba] {
+            if gba.mapped.video.current_scanline() == 80 {
+                gba.mapped.store16(0x04000000, 0x0000, &mut gba.cpu);
+                gba.mapped.store16(0x05000000, color, &mut gba.cpu);
+            } else if gba.mapped.video.current_scanline() == 0 {
+                gba.mapped.store16(0x04000000, 0x0403, &mut gba.cpu);
+            }
+        }
+        let inline_done = inline_gba.step_into(&mut expected, &mut NoopGbaAudioOutput);
+        let parallel_done = parallel_gba.step_into(&mut frame, &mut NoopGbaAudioOutput);
+        assert_eq!(inline_done, parallel_done);
+        if inline_done {
+            assert!(expected[..] == frame[..], "frames are different");
+            frames += 1;
+        }
+    }
+    assert_eq!(
+        frame[159 * VISIBLE_LINE_WIDTH],
+        rgb5(12, 0, 0),
+        "backdrop below the middle of the frame"
+    );
+}
+
+/// Collects lines in any pixel format.
+struct FormatOutput {
+    format: PixelFormat,
+    lines: Vec<u32>,
+}
+
+impl GbaVideoOutput for FormatOutput {
+    fn gba_line_ready(&mut self, _line: usize, data: &LineBuffer) {
+        self.lines.extend(data.iter().map(|&pixel| pixel as u32));
+    }
+
+    fn pixel_format(&self) -> PixelFormat {
+        self.format
+    }
+
+    fn gba_rgba_line_ready(&mut self, _line: usize, data: &RgbaLineBuffer) {
+        self.lines.extend_from_slice(data);
+    }
+}
+
+#[test]
+pub fn pixel_format_test() {
+    let rom = std::fs::read("../../roms/custom/mode3-test.gba").expect("error reading ROM file");
+    let formats = [
+        (
+            PixelFormat::Rgb555,
+            (|pixel| pixel as u32) as fn(u16) -> u32,
+        ),
+        (PixelFormat::Rgb565, |pixel| to_rgb565(pixel) as u32),
+        (PixelFormat::Rgba8888, to_rgba8888),
+    ];
+    for (format, convert) in formats {
+        let mut gba = Gba::new();
+        gba.set_gamepak(rom.clone());
+        gba.reset();
+
+        let mut frame = Box::new([0u16; VISIBLE_LINE_WIDTH * VISIBLE_LINE_COUNT]);
+        gba.run_frame_into(&mut frame, &mut NoopGbaAudioOutput);
+        let mut output = FormatOutput {
+            format,
+            lines: Vec::new(),
+        };
+        gba.run_frame(&mut output, &mut NoopGbaAudioOutput);
+
+        let expected: Vec<u32> = frame.iter().map(|&pixel| convert(pixel)).collect();
+        assert!(output.lines == expected, "{format:?}: frames are different");
+    }
+}
@@ -0,0 +1,204 @@
+use std::{
+    collections::VecDeque,
+    fs::File,
+    io::{self, BufReader, BufWriter, Write},
+    path::{Path, PathBuf},
+    process::ExitCode,
+};
+
+use arm::{
+    disasm::AnyInstr,
+    emu::trace::{TraceEvent, TraceReader},
+};
+use clap::{Parser, Subcommand};
+
+/// Prints and compares traces recorded with `pyrite-headless --trace`.
+#[derive(Parser)]
+#[command(author, version, about)]
+struct TraceCli {
+    #[command(subcommand)]
+    command: Command,
+}
+
+#[derive(Subcommand)]
+enum Command {
+    /// Prints the events in a trace, one per line. Loads and stores are printed before the
+    /// instruction that made them.
+    Show {
+        trace: PathBuf,
+
+        /// Number of instructions to skip before printing anything.
+        #[arg(long, default_value_t = 0)]
+        skip: u64,
+
+        /// Stops after printing this many instructions.
+        #[arg(short = 'n', long)]
+        count: Option<u64>,
+    },
+
+    /// Finds the first event where two traces differ. Exits with an error if there is one.
+    Diff {
+        a: PathBuf,
+        b: PathBuf,
+
+        /// Number of matching events to print before the first difference.
+        #[arg(short, long, default_value_t = 16)]
+        context: usize,
+    },
+}
+
+fn main() -> ExitCode {
+    let cli = TraceCli::parse();
+    let result = match cli.command {
+        Command::Show { trace, skip, count } => show(&trace, skip, count),
+        Command::Diff { a, b, context } => diff(&a, &b, context),
+    };
+
+    match result {
+        Ok(true) => ExitCode::SUCCESS,
+        Ok(false) => ExitCode::FAILURE,
+        Err(err) => {
+            eprintln!("error: {err}");
+            ExitCode::FAILURE
+        }
+    }
+}
+
+fn open(path: &Path) -> Result<TraceReader<BufReader<File>>, String> {
+    File::open(path)
+        .and_then(|file| TraceReader::new(BufReader::new(file)))
+        .map_err(|err| read_error(path, err))
+}
+
+fn read_error(path: &Path, err: io::Error) -> String {
+    format!("{}: error while reading trace: {err}", path.display())
+}
+
+fn show(path: &Path, skip: u64, count: Option<u64>) -> Result<bool, String> {
+    let mut out = BufWriter::new(io::stdout().lock());
+
+    let mut instructions = 0;
+    for (index, event) in open(path)?.enumerate() {
+        let event = event.map_err(|err| read_error(path, err))?;
+        if count.is_some_and(|count| instructions >= skip.saturating_add(count)) {
+            break;
+        }
+        if instructions >= skip {
+            // Nothing useful can be done if stdout was closed (e.g. piped into `head`).
+            if write_event(&mut out, index, &event).is_err() {
+                return Ok(true);
+            }
+        }
+        if matches!(event, TraceEvent::Instruction { .. }) {
+            instructions += 1;
+        }
+    }
+    let _ = out.flush();
+    Ok(true)
+}
+
+/// Returns true if the traces are identical.
+fn diff(a_path: &Path, b_path: &Path, context: usize) -> Result<bool, String> {
+    let mut a = open(a_path)?;
+    let mut b = open(b_path)?;
+    let mut out = io::stdout().lock();
+
+    let mut recent: VecDeque<(usize, TraceEvent)> = VecDeque::with_capacity(context);
+    let mut instructions = 0u64;
+    let mut index = 0;
+    loop {
+        let a_event = a.read().map_err(|err| read_error(a_path, err))?;
+        let b_event = b.read().map_err(|err| read_error(b_path, err))?;
+
+        if a_event == b_event {
+            let Some(event) = a_event else {
+                let _ = writeln!(
+                    out,
+                    "traces are identical ({index} events, {instructions} instructions)"
+                );
+                return Ok(true);
+            };
+            if matches!(event, TraceEvent::Instruction { .. }) {
+                instructions += 1;
+            }
+            if context > 0 {
+                if recent.len() == context {
+                    recent.pop_front();
+                }
+                recent.push_back((index, event));
+            }
+            index += 1;
+            continue;
+        }
+
+        let _ = writeln!(
+            out,
+            "traces differ at event {index} (after {instructions} matching instructions)"
+        );
+        for (index, event) in &recent {
+            let _ = write!(out, "  ");
+            let _ = write_event(&mut out, *index, event);
+        }
+        for (sign, path, event) in [("-", a_path, a_event), ("+", b_path, b_event)] {
+            let _ = write!(out, "{sign} ");
+            match event {
+                Some(event) => {
+                    let _ = write_event(&mut out, index, &event);
+                }
+                None => {
+                    let _ = writeln!(out, "{index:>10}  end of {}", path.display());
+                }
+            }
+        }
+        return Ok(false);
+    }
+}
+
+fn write_event(out: &mut impl Write, index: usize, event: &TraceEvent) -> io::Result<()> {
+    match *event {
+        TraceEvent::Instruction {
+            address,
+            opcode,
+            thumb,
+            cycles,
+        } => {
+            let (instr, opcode) = if thumb {
+                (
+                    AnyInstr::from(arm::disasm::thumb::disasm(opcode as u16, address)),
+                    format!("{opcode:04X}"),
+                )
+            } else {
+                (
+                    AnyInstr::from(arm::disasm::arm::disasm(opcode, address)),
+                    format!("{opcode:08X}"),
+                )
+            };
+            writeln!(
+                out,
+                "{index:>10}  {address:08X}  {opcode:<8}  {:<8} {:<28} cycles={cycles}",
+                instr.mnemonic(),
+                instr.arguments(address, None),
+            )
+        }
+        TraceEvent::Load {
+            address,
+            value,
+            size,
+        } => writeln!(
+            out,
+            "{index:>10}      load{:<2}  [{address:08X}] -> {value:0width$X}",
+            size * 8,
+            width = size as usize * 2,
+        ),
+        TraceEvent::Store {
+            address,
+            value,
+            size,
+        } => writeln!(
+            out,
+            "{index:>10}      store{:<2} [{address:08X}] <- {value:0width$X}",
+            size * 8,
+            width = size as usize * 2,
+        ),
+    }
+}
@@ -0,0 +1,48 @@
+use std::path::PathBuf;
+
+use clap::Parser;
+
+/// Runs GBA ROMs as fast as possible without a GUI and reports how fast they ran.
+#[derive(Parser)]
+#[command(author, version, about)]
+pub struct HeadlessCli {
+    /// ROMs to run. Each one is run on its own GBA.
+    #[arg(required = true)]
+    pub roms: Vec<PathBuf>,
+
+    /// Number of frames to run each ROM for.
+    #[arg(short, long, default_value_t = 600, value_parser = clap::value_parser!(u64).range(1..))]
+    pub frames: u64,
+
+    /// BIOS to use instead of the custom BIOS.
+    #[arg(long)]
+    pub bios: Option<PathBuf>,
+
+    /// Number of ROMs to run at the same time. Defaults to the number of cores.
+    #[arg(short, long, value_parser = clap::value_parser!(u32).range(1..))]
+    pub jobs: Option<u32>,
+
+    /// Runs the BIOS's code for the math and memory functions instead of emulating them at
+    /// a high level.
+    #[arg(long)]
+    pub no_hle: bool,
+
+    /// Renders lines on a second thread for every ROM while its CPU keeps running.
+    #[arg(long)]
+    pub parallel_rendering: bool,
+
+    /// Prints what each ROM spent its frames on: instructions by instruction set, scheduler
+    /// events, exceptions, and memory accesses and waitstates by region.
+    #[arg(long)]
+    pub counters: bool,
+
+    /// Exits with an error if any ROM runs at fewer frames per second than this.
+    #[arg(long)]
+    pub min_fps: Option<f64>,
+
+    /// Writes a trace of every instruction and memory access to `<DIR>/<ROM name>.trace` for
+    /// each ROM. These can be read with `pyrite-trace`.
+    #[cfg(feature = "trace")]
+    #[arg(long, value_name = "DIR")]
+    pub trace: Option<PathBuf>,
+}
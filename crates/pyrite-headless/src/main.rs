@@ -0,0 +1,180 @@
+mod cli;
+mod runner;
+
+use std::{
+    num::NonZeroUsize,
+    path::Path,
+    process::ExitCode,
+    sync::{
+        atomic::{AtomicUsize, Ordering},
+        Mutex,
+    },
+    time::Instant,
+};
+
+use clap::Parser;
+use cli::HeadlessCli;
+use gba::counters::MEMORY_REGION_NAMES;
+use runner::{RunOptions, RunReport};
+
+fn main() -> ExitCode {
+    let cli = HeadlessCli::parse();
+
+    let bios = match cli.bios.as_deref().map(read_bios).transpose() {
+        Ok(bios) => bios,
+        Err(err) => {
+            eprintln!("error: {err}");
+            return ExitCode::FAILURE;
+        }
+    };
+    let options = RunOptions {
+        frames: cli.frames,
+        bios: bios.as_deref(),
+        hle: !cli.no_hle,
+        parallel_rendering: cli.parallel_rendering,
+    };
+
+    let jobs = cli
+        .jobs
+        .map(|jobs| jobs as usize)
+        .unwrap_or_else(|| std::thread::available_parallelism().map_or(1, NonZeroUsize::get))
+        .min(cli.roms.len());
+
+    // Each worker takes the next ROM that hasn't been started yet until there are none left.
+    let next_rom = AtomicUsize::new(0);
+    let reports: Mutex<Vec<Option<Result<RunReport, String>>>> =
+        Mutex::new((0..cli.roms.len()).map(|_| None).collect());
+    let start = Instant::now();
+    std::thread::scope(|scope| {
+        for _ in 0..jobs {
+            scope.spawn(|| loop {
+                let index = next_rom.fetch_add(1, Ordering::Relaxed);
+                let Some(path) = cli.roms.get(index) else {
+                    break;
+                };
+                // SAFETY: ROM files are expected to be left alone while they run, the same
+                //         as any other emulator that maps them.
+                let report = unsafe { gba::Gamepak::map_file(path) }
+                    .map_err(|err| format!("error while reading ROM: {err}"))
+                    .and_then(|rom| run_rom(rom, path, &cli, &options));
+                reports.lock().unwrap()[index] = Some(report);
+            });
+        }
+    });
+    let elapsed = start.elapsed();
+
+    let mut failed = false;
+    let mut total_frames = 0;
+    let reports = reports.into_inner().unwrap();
+    for (path, report) in cli.roms.iter().zip(reports) {
+        match report.expect("ROM was never run") {
+            Ok(report) => {
+                print_report(path, &report);
+                if cli.counters {
+                    print_counters(&report);
+                }
+                total_frames += report.frames;
+                if let Some(min_fps) = cli.min_fps {
+                    if report.frames_per_second() < min_fps {
+                        eprintln!(
+                            "error: {}: {:.1} fps is below the minimum of {min_fps:.1} fps",
+                            path.display(),
+                            report.frames_per_second(),
+                        );
+                        failed = true;
+                    }
+                }
+            }
+            Err(err) => {
+                eprintln!("error: {}: {err}", path.display());
+                failed = true;
+            }
+        }
+    }
+
+    if cli.roms.len() > 1 {
+        println!(
+            "total roms={} jobs={jobs} seconds={:.3} fps={:.1}",
+            cli.roms.len(),
+            elapsed.as_secs_f64(),
+            total_frames as f64 / elapsed.as_secs_f64(),
+        );
+    }
+
+    if failed {
+        ExitCode::FAILURE
+    } else {
+        ExitCode::SUCCESS
+    }
+}
+
+#[cfg_attr(not(feature = "trace"), allow(unused_variables))]
+fn run_rom(
+    rom: gba::Gamepak,
+    path: &Path,
+    cli: &HeadlessCli,
+    options: &RunOptions,
+) -> Result<RunReport, String> {
+    #[cfg(feature = "trace")]
+    if let Some(dir) = cli.trace.as_deref() {
+        let name = path.file_stem().unwrap_or(path.as_os_str());
+        let trace = dir.join(format!("{}.trace", name.to_string_lossy()));
+        return runner::run_traced(rom, options, &trace)
+            .map_err(|err| format!("{}: error while writing trace: {err}", trace.display()));
+    }
+    Ok(runner::run(rom, options))
+}
+
+fn read_bios(path: &Path) -> Result<Vec<u8>, String> {
+    let bios = std::fs::read(path)
+        .map_err(|err| format!("{}: error while reading BIOS: {err}", path.display()))?;
+    if bios.len() > gba::memory::BIOS_SIZE {
+        return Err(format!(
+            "{}: BIOS is {} bytes but must be at most {} bytes",
+            path.display(),
+            bios.len(),
+            gba::memory::BIOS_SIZE,
+        ));
+    }
+    Ok(bios)
+}
+
+fn print_report(path: &Path, report: &RunReport) {
+    println!(
+        "rom={} frames={} seconds={:.3} fps={:.1} ns_per_instruction={:.2} instructions={} cycles={} hash={:016x}",
+        path.display(),
+        report.frames,
+        report.elapsed.as_secs_f64(),
+        report.frames_per_second(),
+        report.nanoseconds_per_instruction(),
+        report.instructions,
+        report.cycles,
+        report.framebuffer_hash,
+    );
+}
+
+fn print_counters(report: &RunReport) {
+    let counters = &report.counters;
+    let per_frame = |count: u64| count as f64 / counters.frames.max(1) as f64;
+    println!(
+        "  per frame: arm_instructions={:.0} thumb_instructions={:.0} events={:.1} exceptions={:.1} waitstates={:.0} ({:.1}% of cycles) host_ms={:.3}",
+        per_frame(counters.cpu.arm_instructions),
+        per_frame(counters.cpu.thumb_instructions),
+        per_frame(counters.events),
+        per_frame(counters.cpu.exceptions_taken()),
+        per_frame(counters.memory.total_waitstates()),
+        per_frame(counters.memory.total_waitstates()) / gba::video::FRAME_CYCLES as f64 * 100.0,
+        counters.time_per_frame().as_secs_f64() * 1000.0,
+    );
+    for (region, name) in MEMORY_REGION_NAMES.iter().enumerate() {
+        let accesses = counters.memory.accesses[region];
+        if accesses == 0 {
+            continue;
+        }
+        println!(
+            "  region={name:?} accesses_per_frame={:.0} waitstates_per_frame={:.0}",
+            per_frame(accesses),
+            per_frame(counters.memory.waitstates[region]),
+        );
+    }
+}
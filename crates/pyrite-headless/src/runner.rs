@@ -0,0 +1,185 @@
+use std::time::{Duration, Instant};
+#[cfg(feature = "trace")]
+use std::{
+    fs::File,
+    io::{self, BufWriter},
+    path::Path,
+};
+
+use gba::{
+    counters::GbaCounters,
+    video::{ScreenBuffer, VISIBLE_PIXELS},
+    Gamepak, Gba, NoopGbaAudioOutput,
+};
+
+pub struct RunOptions<'a> {
+    pub frames: u64,
+    pub bios: Option<&'a [u8]>,
+    pub hle: bool,
+    pub parallel_rendering: bool,
+}
+
+pub struct RunReport {
+    pub frames: u64,
+    pub elapsed: Duration,
+    pub instructions: u64,
+    pub cycles: u64,
+    /// FNV-1a hash of the last frame.
+    pub framebuffer_hash: u64,
+    /// What the GBA did while the frames were run.
+    pub counters: GbaCounters,
+}
+
+impl RunReport {
+    pub fn frames_per_second(&self) -> f64 {
+        self.frames as f64 / self.elapsed.as_secs_f64()
+    }
+
+    pub fn nanoseconds_per_instruction(&self) -> f64 {
+        self.elapsed.as_nanos() as f64 / self.instructions.max(1) as f64
+    }
+}
+
+/// Number of events that can be waiting to be written to a trace before the CPU has to wait.
+#[cfg(feature = "trace")]
+const TRACE_BUFFER_CAPACITY: usize = 1 << 16;
+
+/// Runs `rom` for `options.frames` frames as fast as possible. Every frame is rendered into
+/// the same buffer so only the last one is kept.
+pub fn run(rom: Gamepak, options: &RunOptions) -> RunReport {
+    let mut gba = new_gba(rom, options);
+    run_frames(&mut gba, options)
+}
+
+/// Same as [`run`] but also writes every instruction and memory access to the file at `trace`.
+/// The trace is written on another thread and the time that the CPU spends waiting for it is
+/// included in the report.
+#[cfg(feature = "trace")]
+pub fn run_traced(rom: Gamepak, options: &RunOptions, trace: &Path) -> io::Result<RunReport> {
+    use arm::emu::trace::{trace_buffer, TraceWriter};
+
+    let mut writer = TraceWriter::new(BufWriter::new(File::create(trace)?))?;
+    let (producer, mut consumer) = trace_buffer(TRACE_BUFFER_CAPACITY);
+    let drain = std::thread::spawn(move || {
+        consumer.drain_into(&mut writer)?;
+        writer.flush()
+    });
+
+    let mut gba = new_gba(rom, options);
+    gba.cpu.set_tracer(Some(producer));
+    let report = run_frames(&mut gba, options);
+    // Dropping the producer lets the other thread know that the trace is done.
+    gba.cpu.set_tracer(None);
+    drain.join().expect("trace writer panicked")?;
+    Ok(report)
+}
+
+fn new_gba(rom: Gamepak, options: &RunOptions) -> Gba {
+    let mut gba = Gba::new();
+    if let Some(bios) = options.bios {
+        gba.set_bios(bios);
+    }
+    gba.set_hle_math_enabled(options.hle);
+    gba.set_hle_memory_enabled(options.hle);
+    gba.set_parallel_rendering(options.parallel_rendering);
+    gba.set_gamepak(rom);
+    gba.reset();
+    gba
+}
+
+fn run_frames(gba: &mut Gba, options: &RunOptions) -> RunReport {
+    let mut frame: Box<ScreenBuffer> = Box::new([0; VISIBLE_PIXELS]);
+    let start_instructions = gba.cpu.instruction_count();
+    let start_counters = gba.counters();
+    let start = Instant::now();
+    for _ in 0..options.frames {
+        gba.run_frame_into(&mut frame, &mut NoopGbaAudioOutput);
+    }
+    let elapsed = start.elapsed();
+
+    RunReport {
+        frames: options.frames,
+        elapsed,
+        instructions: gba.cpu.instruction_count() - start_instructions,
+        cycles: gba.cycles(),
+        framebuffer_hash: hash_frame(&frame),
+        counters: gba.counters().since(&start_counters),
+    }
+}
+
+/// FNV-1a hash of the pixels in `frame`.
+fn hash_frame(frame: &ScreenBuffer) -> u64 {
+    frame
+        .iter()
+        .flat_map(|pixel| pixel.to_le_bytes())
+        .fold(0xcbf29ce484222325, |hash, byte| {
+            (hash ^ byte as u64).wrapping_mul(0x100000001b3)
+        })
+}
+
+#[cfg(test)]
+mod test {
+    use gba::Gamepak;
+
+    use super::{run, RunOptions};
+
+    #[test]
+    fn test_run_is_deterministic() {
+        // Every run shares the same ROM.
+        let rom = Gamepak::from(&include_bytes!("../../../roms/custom/mode3-test.gba")[..]);
+        let options = RunOptions {
+            frames: 4,
+            bios: None,
+            hle: false,
+            parallel_rendering: false,
+        };
+
+        let first = run(rom.clone(), &options);
+        let second = run(rom.clone(), &options);
+        assert_eq!(first.frames, 4);
+        assert_ne!(first.instructions, 0);
+        assert_eq!(first.instructions, second.instructions);
+        assert_eq!(first.cycles, second.cycles);
+        assert_eq!(first.framebuffer_hash, second.framebuffer_hash);
+        assert_eq!(first.counters.frames, 4);
+        assert_eq!(first.counters.cpu.instructions(), first.instructions);
+        assert_eq!(first.counters.memory, second.counters.memory);
+
+        let options = RunOptions {
+            parallel_rendering: true,
+            ..options
+        };
+        let parallel = run(rom.clone(), &options);
+        assert_eq!(first.cycles, parallel.cycles);
+        assert_eq!(first.framebuffer_hash, parallel.framebuffer_hash);
+    }
+
+    #[cfg(feature = "trace")]
+    #[test]
+    fn test_trace_has_every_instruction() {
+        use arm::emu::trace::{TraceEvent, TraceReader};
+
+        let rom = Gamepak::from(&include_bytes!("../../../roms/custom/mode3-test.gba")[..]);
+        let options = RunOptions {
+            frames: 1,
+            bios: None,
+            hle: false,
+            parallel_rendering: false,
+        };
+        let path = std::env::temp_dir().join("pyrite-headless-test.trace");
+
+        let report = super::run_traced(rom.clone(), &options, &path).unwrap();
+        let trace = std::fs::read(&path).unwrap();
+        std::fs::remove_file(&path).unwrap();
+
+        let mut instructions = 0;
+        for event in TraceReader::new(&trace[..]).unwrap() {
+            if let TraceEvent::Instruction { .. } = event.unwrap() {
+                instructions += 1;
+            }
+        }
+        assert_eq!(instructions, report.instructions);
+        // Tracing doesn't change what runs.
+        assert_eq!(report.cycles, run(rom, &options).cycles);
+    }
+}
@@ -22,6 +22,19 @@ impl Default for Config {
                 extra_filters: Vec::new(),
                 reload_handle: None,
             },
+
+            rewind: RewindConfig::default(),
+            emulation: EmulationConfig::default(),
+        }
+    }
+}
+
+impl Default for RewindConfig {
+    fn default() -> Self {
+        RewindConfig {
+            enabled: true,
+            interval: 4,
+            memory_budget_mb: 64,
         }
     }
 }
@@ -81,6 +94,12 @@ impl Config {
 pub struct Config {
     pub gui: GuiConfig,
     pub logging: LoggingConfig,
+
+    #[serde(default)]
+    pub rewind: RewindConfig,
+
+    #[serde(default)]
+    pub emulation: EmulationConfig,
 }
 
 #[derive(Serialize, Deserialize, Clone)]
@@ -103,6 +122,22 @@ pub struct LoggingConfig {
     pub reload_handle: Option<LoggingReloadHandle>,
 }
 
+#[derive(Serialize, Deserialize, Clone)]
+pub struct RewindConfig {
+    pub enabled: bool,
+    /// The number of frames between the states that are saved for rewinding.
+    pub interval: u32,
+    /// The most memory that saved states can use, in megabytes.
+    pub memory_budget_mb: usize,
+}
+
+#[derive(Serialize, Deserialize, Clone, Default)]
+pub struct EmulationConfig {
+    /// The number of frames to run ahead of the frame that's shown to hide a game's input
+    /// lag, or 0 to disable running ahead.
+    pub run_ahead_frames: u32,
+}
+
 fn get_config_path() -> anyhow::Result<PathBuf> {
     let config_dir = dirs::config_dir();
     let config_dir = if let Some(config_dir) = config_dir {
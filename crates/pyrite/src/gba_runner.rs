@@ -1,29 +1,43 @@
 use gba::{
-    video::{ScreenBuffer, VISIBLE_LINE_WIDTH, VISIBLE_PIXELS},
-    Gba, GbaVideoOutput,
+    savestate::RewindBuffer,
+    video::{ScreenBuffer, VISIBLE_PIXELS},
+    Gba,
 };
 use parking_lot::{Condvar, Mutex, RwLock, RwLockReadGuard, RwLockWriteGuard};
 use spin_sleep::LoopHelper;
 use std::sync::Arc;
+use util::triple_buffer::{triple_buffer, TripleBufferReader, TripleBufferWriter};
+
+use crate::config::{EmulationConfig, RewindConfig};
+
+/// Receives completed frames from the GBA thread without locking [`GbaData`].
+pub type FrameReader = TripleBufferReader<Box<ScreenBuffer>>;
 
 #[derive(Clone)]
 pub struct SharedGba {
     inner: Arc<RwLock<GbaData>>,
+    frame_reader: Arc<Mutex<Option<FrameReader>>>,
 }
 
 impl SharedGba {
     pub fn new() -> Self {
+        let blank_frame = Box::new([gba::video::rgb5(31, 0, 31); VISIBLE_PIXELS]);
+        let (frame_writer, frame_reader) = triple_buffer(blank_frame.clone());
         let shared = SharedGba {
             inner: Arc::new(RwLock::new(GbaData {
                 gba: Gba::new(),
-                frame_buffer: Box::new([gba::video::rgb5(31, 0, 31); VISIBLE_PIXELS]),
-                ready_buffer: Box::new([gba::video::rgb5(31, 0, 31); VISIBLE_PIXELS]),
+                frame_buffer: blank_frame,
+                frame_writer,
                 current_mode: GbaRunMode::Paused,
                 paused_cond: Arc::new((Mutex::new(true), Condvar::new())),
                 request_repaint: None,
-                painted: false,
                 profling_enabled: false,
+                rewind: RewindBuffer::new(0),
+                rewind_interval: 0,
+                frames_until_rewind_state: 0,
+                run_ahead_frames: 0,
             })),
+            frame_reader: Arc::new(Mutex::new(Some(frame_reader))),
         };
 
         let locked = shared.inner.write();
@@ -72,6 +86,31 @@ impl SharedGba {
         (f)(&mut locked)
     }
 
+    /// Starts or stops saving states for rewinding. Changing the settings throws away the
+    /// states that were already saved.
+    pub fn configure_rewind(&self, config: &RewindConfig) {
+        let mut inner = self.inner.write();
+        inner.rewind.clear();
+        inner.rewind.set_budget(config.memory_budget_mb << 20);
+        inner.rewind_interval = if config.enabled { config.interval } else { 0 };
+        inner.frames_until_rewind_state = 0;
+    }
+
+    pub fn configure_emulation(&self, config: &EmulationConfig) {
+        self.inner.write().run_ahead_frames = config.run_ahead_frames;
+    }
+
+    /// While rewinding, the GBA goes back to an earlier saved state every frame instead of
+    /// running forward. This only does anything while the GBA is running.
+    pub fn set_rewinding(&self, rewinding: bool) {
+        let mut inner = self.inner.write();
+        match (inner.current_mode, rewinding) {
+            (GbaRunMode::Run, true) => inner.current_mode = GbaRunMode::Rewind,
+            (GbaRunMode::Rewind, false) => inner.current_mode = GbaRunMode::Run,
+            _ => {}
+        }
+    }
+
     #[allow(dead_code)]
     pub fn read(&self) -> RwLockReadGuard<'_, GbaData> {
         self.inner.read()
@@ -80,30 +119,49 @@ impl SharedGba {
     pub fn write(&self) -> RwLockWriteGuard<'_, GbaData> {
         self.inner.write()
     }
+
+    /// Takes the reader for the frames that the GBA thread publishes. There is only one
+    /// reader so this returns `None` if it was already taken.
+    pub fn take_frame_reader(&self) -> Option<FrameReader> {
+        self.frame_reader.lock().take()
+    }
 }
 
 pub struct GbaData {
     pub gba: Gba,
     /// The frame buffer that the GBA is currently drawing into.
     pub frame_buffer: Box<ScreenBuffer>,
-    /// The last completed frame buffer ready for display.
-    pub ready_buffer: Box<ScreenBuffer>,
+    /// Hands copies of [`GbaData::frame_buffer`] to the [`FrameReader`] so that painting
+    /// never has to lock the GBA.
+    frame_writer: TripleBufferWriter<Box<ScreenBuffer>>,
     pub current_mode: GbaRunMode,
     paused_cond: Arc<(Mutex<bool>, Condvar)>,
 
-    /// This function will be called when the GBA wants to request a repaint.
-    /// The first argument passed to the callback is the `ready` flag. When this
-    /// is `true` the [`GbaData::ready_buffer`] should be displayed on screen. If is
-    /// `false` the `frame_buffer` should be used instead.
+    /// This function will be called when the GBA wants to request a repaint, after a new
+    /// frame has been published to the [`FrameReader`]. The first argument passed to the
+    /// callback is the `ready` flag, which is `true` if the frame is complete and `false`
+    /// if it was only partially drawn while stepping.
     #[allow(clippy::type_complexity)]
     pub request_repaint: Option<Box<dyn Fn(bool, &mut GbaData) + Send + Sync>>,
 
-    /// This is set to false before [`GbaData::request_repaint`] is called. It is
-    /// the responsibility of whatever is doing the painting to set and maintain
-    /// this flag in order to reduce work done.
-    pub painted: bool,
-
     pub profling_enabled: bool,
+
+    /// States saved every [`GbaData::rewind_interval`] frames while running.
+    pub rewind: RewindBuffer,
+    /// The number of frames between saved states, or 0 if rewinding is disabled.
+    rewind_interval: u32,
+    frames_until_rewind_state: u32,
+    /// Frames are shown this many frames ahead of the GBA, see [`gba::Gba::run_frame_ahead`].
+    run_ahead_frames: u32,
+}
+
+impl GbaData {
+    fn publish_frame(&mut self) {
+        self.frame_writer
+            .buffer_mut()
+            .copy_from_slice(&self.frame_buffer[..]);
+        self.frame_writer.publish();
+    }
 }
 
 fn gba_run_loop(gba: SharedGba) {
@@ -126,6 +184,11 @@ fn gba_run_loop(gba: SharedGba) {
                 RwLockWriteGuard::unlock_fair(data);
                 loop_helper.loop_sleep();
             }
+            GbaRunMode::Rewind => {
+                gba_rewind_tick(&mut data);
+                RwLockWriteGuard::unlock_fair(data);
+                loop_helper.loop_sleep();
+            }
             GbaRunMode::Frame => {
                 gba_frame_tick(&mut data);
                 data.current_mode = GbaRunMode::Paused;
@@ -155,7 +218,31 @@ fn gba_run_loop(gba: SharedGba) {
 }
 
 fn gba_frame_tick(data: &mut GbaData) {
-    let mut fb = FrameBuffer::new(&mut data.frame_buffer);
+    if data.rewind_interval > 0 {
+        if data.frames_until_rewind_state == 0 {
+            let snapshot = data.gba.snapshot();
+            data.rewind.push(&snapshot);
+            data.frames_until_rewind_state = data.rewind_interval;
+        }
+        data.frames_until_rewind_state -= 1;
+    }
+
+    gba_run_frame(data);
+}
+
+/// Goes back to the newest saved state and runs the frame after it to show it. The state is
+/// removed so that the next tick goes back further.
+fn gba_rewind_tick(data: &mut GbaData) {
+    let Some(snapshot) = data.rewind.pop() else {
+        return;
+    };
+    data.gba.restore(&snapshot);
+    // Save a state again as soon as the GBA runs forward so that there's no gap.
+    data.frames_until_rewind_state = 0;
+    gba_run_frame(data);
+}
+
+fn gba_run_frame(data: &mut GbaData) {
     let mut ab = gba::NoopGbaAudioOutput;
 
     {
@@ -165,32 +252,26 @@ fn gba_frame_tick(data: &mut GbaData) {
         #[cfg(feature = "puffin")]
         puffin::profile_scope!("render_frame");
 
-        while !fb.ready {
-            data.gba.step(&mut fb, &mut ab);
-        }
+        data.gba
+            .run_frame_ahead(data.run_ahead_frames, &mut data.frame_buffer, &mut ab);
     }
 
-    std::mem::swap::<Box<ScreenBuffer>>(&mut data.frame_buffer, &mut data.ready_buffer);
+    data.publish_frame();
 
     if let Some(request_repaint) = data.request_repaint.take() {
-        data.painted = false;
         request_repaint(true, data);
         data.request_repaint = Some(request_repaint);
     }
 }
 
 fn gba_step_tick(data: &mut GbaData) {
-    let mut fb = FrameBuffer::new(&mut data.frame_buffer);
     let mut ab = gba::NoopGbaAudioOutput;
-    data.gba.step(&mut fb, &mut ab);
-    let frame_ready = fb.ready;
+    let frame_ready = data.gba.step_into(&mut data.frame_buffer, &mut ab);
 
-    if frame_ready {
-        std::mem::swap::<Box<ScreenBuffer>>(&mut data.frame_buffer, &mut data.ready_buffer);
-    }
+    // Publish partially drawn frames too so that stepping shows each line as it's drawn.
+    data.publish_frame();
 
     if let Some(request_repaint) = data.request_repaint.take() {
-        data.painted = false;
         request_repaint(frame_ready, data);
         data.request_repaint = Some(request_repaint);
     }
@@ -199,6 +280,7 @@ fn gba_step_tick(data: &mut GbaData) {
 #[derive(Copy, Clone, PartialEq, Eq)]
 pub enum GbaRunMode {
     Run,
+    Rewind,
     #[allow(dead_code)]
     Frame,
     Step,
@@ -206,27 +288,3 @@ pub enum GbaRunMode {
     #[allow(dead_code)]
     Shutdown,
 }
-
-struct FrameBuffer<'b> {
-    buffer: &'b mut ScreenBuffer,
-    ready: bool,
-}
-
-impl<'b> FrameBuffer<'b> {
-    fn new(buffer: &'b mut ScreenBuffer) -> Self {
-        Self {
-            buffer,
-            ready: false,
-        }
-    }
-}
-
-impl<'b> GbaVideoOutput for FrameBuffer<'b> {
-    fn gba_line_ready(&mut self, line: usize, data: &gba::video::LineBuffer) {
-        let pos = VISIBLE_LINE_WIDTH * line;
-        self.buffer[pos..(pos + VISIBLE_LINE_WIDTH)].copy_from_slice(data);
-        if line == gba::video::VISIBLE_LINE_COUNT - 1 {
-            self.ready = true;
-        }
-    }
-}
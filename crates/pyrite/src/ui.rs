@@ -24,7 +24,10 @@ use self::{
 
 pub struct App {
     config: Config,
+    gba: SharedGba,
     screen: GbaImage,
+    /// True while the rewind key is held down.
+    rewinding: bool,
     windows: Vec<app_window::AppWindowWrapper>,
     windows_visible: Arc<Mutex<HashSet<ViewportId>>>,
 }
@@ -78,11 +81,14 @@ impl App {
 
             data.gba.reset();
         });
+        gba.configure_rewind(&config.rewind);
+        gba.configure_emulation(&config.emulation);
         gba.unpause();
 
         let windows_visible = Arc::new(Mutex::new(HashSet::default()));
         #[cfg(feature = "profiling")]
-        let profiler_window = ProfilerWindow::wrapped(windows_visible.clone(), context.storage);
+        let profiler_window =
+            ProfilerWindow::wrapped(windows_visible.clone(), gba.clone(), context.storage);
         let windows = vec![
             DisassemblyWindow::wrapped(windows_visible.clone(), gba.clone()),
             #[cfg(feature = "profiling")]
@@ -96,7 +102,9 @@ impl App {
 
         Ok(Self {
             config,
+            gba,
             screen,
+            rewinding: false,
             windows,
             windows_visible,
         })
@@ -136,6 +144,12 @@ impl App {
 
 impl eframe::App for App {
     fn update(&mut self, ctx: &eframe::egui::Context, _frame: &mut eframe::Frame) {
+        let rewinding = ctx.input(|input| input.key_down(egui::Key::Backspace));
+        if rewinding != self.rewinding {
+            self.rewinding = rewinding;
+            self.gba.set_rewinding(rewinding);
+        }
+
         egui::TopBottomPanel::top("menu_bar_panel").show(ctx, |ui| self.render_menu(ui));
         egui::CentralPanel::default().show(ctx, |ui| {
             let screen_width = ui.available_width();
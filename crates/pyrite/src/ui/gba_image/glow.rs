@@ -1,6 +1,7 @@
 use std::sync::Arc;
 
-use crate::gba_runner::SharedGba;
+use crate::gba_runner::{FrameReader, SharedGba};
+use anyhow::Context as _;
 use eframe::{
     egui_glow::{CallbackFn, Painter},
     glow::{self, Buffer, HasContext, Program, Shader, Texture, VertexArray},
@@ -15,7 +16,10 @@ pub struct GbaImageGlow {
 
 impl GbaImageGlow {
     pub fn new(gba: SharedGba) -> anyhow::Result<Self> {
-        let glow_painter = Arc::new(Mutex::new(GlowPainter::new(gba)));
+        let frames = gba
+            .take_frame_reader()
+            .context("GBA frames are already being painted")?;
+        let glow_painter = Arc::new(Mutex::new(GlowPainter::new(frames)));
 
         let callback = Arc::new({
             let glow_painter = glow_painter.clone();
@@ -43,7 +47,7 @@ impl GbaImageGlow {
 }
 
 struct GlowPainter {
-    gba: SharedGba,
+    frames: FrameReader,
     vertex_shader: Option<Shader>,
     fragment_shader: Option<Shader>,
     program: Option<Program>,
@@ -54,9 +58,9 @@ struct GlowPainter {
 }
 
 impl GlowPainter {
-    fn new(gba: SharedGba) -> Self {
+    fn new(frames: FrameReader) -> Self {
         Self {
-            gba,
+            frames,
             vertex_shader: None,
             fragment_shader: None,
             program: None,
@@ -84,8 +88,7 @@ impl GlowPainter {
             gl.bind_texture(eframe::glow::TEXTURE_2D, self.texture);
         }
 
-        let mut gba_data = self.gba.write();
-        if !gba_data.painted {
+        if self.frames.update() {
             unsafe {
                 gl.tex_sub_image_2d(
                     eframe::glow::TEXTURE_2D,
@@ -97,13 +100,11 @@ impl GlowPainter {
                     eframe::glow::RGBA,
                     eframe::glow::UNSIGNED_SHORT_1_5_5_5_REV,
                     eframe::glow::PixelUnpackData::Slice(bytemuck::cast_slice(
-                        &gba_data.ready_buffer[..],
+                        &self.frames.buffer()[..],
                     )),
                 );
             }
         }
-        gba_data.painted = true;
-        drop(gba_data);
 
         unsafe { gl.draw_arrays(eframe::glow::TRIANGLES, 0, 6) };
     }
@@ -193,7 +194,7 @@ impl GlowPainter {
             self.texture = Some(texture);
             gl.bind_texture(glow::TEXTURE_2D, self.texture);
 
-            let mut gba_data = self.gba.write();
+            self.frames.update();
             gl.tex_image_2d(
                 eframe::glow::TEXTURE_2D,
                 0,
@@ -203,10 +204,8 @@ impl GlowPainter {
                 0,
                 eframe::glow::RGBA,
                 eframe::glow::UNSIGNED_SHORT_1_5_5_5_REV,
-                Some(bytemuck::cast_slice(&gba_data.ready_buffer[..])),
+                Some(bytemuck::cast_slice(&self.frames.buffer()[..])),
             );
-            gba_data.painted = true;
-            drop(gba_data);
 
             gl.tex_parameter_i32(
                 eframe::glow::TEXTURE_2D,
@@ -7,8 +7,10 @@ use eframe::{
 };
 use egui::PaintCallback;
 use gba::video::{VISIBLE_LINE_COUNT, VISIBLE_LINE_WIDTH};
+use parking_lot::Mutex;
 
-use crate::gba_runner::{GbaRunMode, SharedGba};
+use crate::gba_runner::{FrameReader, SharedGba};
+use anyhow::Context as _;
 
 pub struct GbaImageWgpu {
     callback: PaintCallback,
@@ -16,7 +18,10 @@ pub struct GbaImageWgpu {
 
 impl GbaImageWgpu {
     pub fn new(gba: SharedGba) -> anyhow::Result<Self> {
-        let wgpu_painter = WgpuPainter::new(gba);
+        let frames = gba
+            .take_frame_reader()
+            .context("GBA frames are already being painted")?;
+        let wgpu_painter = WgpuPainter::new(frames);
         let callback = Callback::new_paint_callback(egui::Rect::NOTHING, wgpu_painter);
         Ok(Self { callback })
     }
@@ -40,12 +45,15 @@ struct WgpuPainterResources {
 }
 
 struct WgpuPainter {
-    gba: SharedGba,
+    /// Only locked by the UI thread, the GBA thread publishes frames without locking this.
+    frames: Mutex<FrameReader>,
 }
 
 impl WgpuPainter {
-    fn new(gba: SharedGba) -> Self {
-        Self { gba }
+    fn new(frames: FrameReader) -> Self {
+        Self {
+            frames: Mutex::new(frames),
+        }
     }
 }
 
@@ -78,7 +86,8 @@ impl CallbackTrait for WgpuPainter {
             view_formats: &[],
         });
 
-        let mut gba_data = self.gba.write();
+        let mut frames = self.frames.lock();
+        frames.update();
         queue.write_texture(
             eframe::wgpu::ImageCopyTexture {
                 texture: &texture,
@@ -86,7 +95,7 @@ impl CallbackTrait for WgpuPainter {
                 origin: eframe::wgpu::Origin3d::ZERO,
                 aspect: eframe::wgpu::TextureAspect::All,
             },
-            bytemuck::cast_slice(&gba_data.ready_buffer[..]),
+            bytemuck::cast_slice(&frames.buffer()[..]),
             eframe::wgpu::ImageDataLayout {
                 offset: 0,
                 bytes_per_row: Some(2 * texture_size.width),
@@ -94,8 +103,7 @@ impl CallbackTrait for WgpuPainter {
             },
             texture_size,
         );
-        gba_data.painted = true;
-        drop(gba_data);
+        drop(frames);
         tracing::debug!("GBA screen wgpu texture initialized");
 
         let texture_view = texture.create_view(&TextureViewDescriptor {
@@ -230,19 +238,15 @@ impl CallbackTrait for WgpuPainter {
             return Vec::new();
         };
 
-        let mut gba_data = self.gba.write();
-        if !gba_data.painted {
+        let mut frames = self.frames.lock();
+        if frames.update() {
             let texture_size = eframe::wgpu::Extent3d {
                 width: VISIBLE_LINE_WIDTH as u32,
                 height: VISIBLE_LINE_COUNT as u32,
                 depth_or_array_layers: 1,
             };
 
-            let buffer = if gba_data.current_mode == GbaRunMode::Frame {
-                bytemuck::cast_slice(&gba_data.ready_buffer[..])
-            } else {
-                bytemuck::cast_slice(&gba_data.frame_buffer[..])
-            };
+            let buffer = bytemuck::cast_slice(&frames.buffer()[..]);
 
             queue.write_texture(
                 eframe::wgpu::ImageCopyTexture {
@@ -259,9 +263,8 @@ impl CallbackTrait for WgpuPainter {
                 },
                 texture_size,
             );
-            gba_data.painted = true;
         }
-        drop(gba_data);
+        drop(frames);
         Vec::new()
     }
 
@@ -1,29 +1,43 @@
-use std::sync::Arc;
+use std::{collections::VecDeque, sync::Arc, time::Duration};
 
 use eframe::Storage;
-use egui::Ui;
+use egui::{Sense, Stroke, Ui};
+use gba::{
+    counters::{GbaCounters, MEMORY_REGION_COUNT, MEMORY_REGION_NAMES},
+    video::FRAME_CYCLES,
+};
 use parking_lot::Mutex;
 use puffin::GlobalFrameView;
 use puffin_egui::ProfilerUi;
 
 use super::app_window::{AppWindow, AppWindowCategory, AppWindowWrapper};
+use crate::gba_runner::SharedGba;
+
+/// Number of samples of the GBA's counters that are kept for the graphs.
+const COUNTER_HISTORY: usize = 240;
+const GRAPH_HEIGHT: f32 = 40.0;
 
 pub struct ProfilerWindow {
+    gba: SharedGba,
+    counters: CounterGraphs,
     profiler: Profiler,
 }
 
 impl ProfilerWindow {
-    fn new(storage: Option<&dyn eframe::Storage>) -> Self {
+    fn new(gba: SharedGba, storage: Option<&dyn eframe::Storage>) -> Self {
         Self {
+            gba,
+            counters: CounterGraphs::default(),
             profiler: Profiler::new(storage),
         }
     }
 
     pub fn wrapped(
         windows: Arc<Mutex<egui::ahash::HashSet<egui::ViewportId>>>,
+        gba: SharedGba,
         storage: Option<&dyn eframe::Storage>,
     ) -> AppWindowWrapper {
-        AppWindowWrapper::new::<Self>(windows, Self::new(storage))
+        AppWindowWrapper::new::<Self>(windows, Self::new(gba, storage))
     }
 }
 
@@ -31,8 +45,16 @@ impl AppWindow for ProfilerWindow {
     type State = Self;
 
     fn ui(state: &mut Self::State, ctx: &egui::Context) {
+        let counters = state.gba.read().gba.counters();
+        state.counters.push(counters);
+        // The graphs keep moving while the GBA runs even if nothing else causes a repaint.
+        ctx.request_repaint_after(Duration::from_millis(100));
+
         egui::CentralPanel::default().show(ctx, |ui| {
             ui.heading("Profiler");
+            egui::CollapsingHeader::new("Counters")
+                .default_open(true)
+                .show(ui, |ui| state.counters.ui(ui));
             render(ui, &mut state.profiler);
         });
     }
@@ -110,3 +132,141 @@ impl Profiler {
         }
     }
 }
+
+/// Per frame averages of the GBA's counters between each time that the window was drawn.
+#[derive(Default)]
+struct CounterGraphs {
+    last: Option<GbaCounters>,
+    history: VecDeque<CounterSample>,
+}
+
+#[derive(Clone, Copy)]
+struct CounterSample {
+    arm_instructions: f32,
+    thumb_instructions: f32,
+    waitstates: f32,
+    events: f32,
+    exceptions: f32,
+    frame_ms: f32,
+    accesses: [f32; MEMORY_REGION_COUNT],
+    region_waitstates: [f32; MEMORY_REGION_COUNT],
+}
+
+impl CounterSample {
+    /// Averages `delta` over the frames that it covers, or returns `None` if it has none.
+    fn per_frame(delta: &GbaCounters) -> Option<Self> {
+        if delta.frames == 0 {
+            return None;
+        }
+        let per_frame = |count: u64| count as f32 / delta.frames as f32;
+        Some(CounterSample {
+            arm_instructions: per_frame(delta.cpu.arm_instructions),
+            thumb_instructions: per_frame(delta.cpu.thumb_instructions),
+            waitstates: per_frame(delta.memory.total_waitstates()),
+            events: per_frame(delta.events),
+            exceptions: per_frame(delta.cpu.exceptions_taken()),
+            frame_ms: delta.time_per_frame().as_secs_f32() * 1000.0,
+            accesses: delta.memory.accesses.map(per_frame),
+            region_waitstates: delta.memory.waitstates.map(per_frame),
+        })
+    }
+}
+
+impl CounterGraphs {
+    fn push(&mut self, counters: GbaCounters) {
+        if let Some(last) = &self.last {
+            // Samples without any frames in them are skipped so that the next one covers
+            // the time since the last frame instead.
+            let Some(sample) = CounterSample::per_frame(&counters.since(last)) else {
+                return;
+            };
+            if self.history.len() == COUNTER_HISTORY {
+                self.history.pop_front();
+            }
+            self.history.push_back(sample);
+        }
+        self.last = Some(counters);
+    }
+
+    fn ui(&self, ui: &mut Ui) {
+        let Some(latest) = self.history.back() else {
+            ui.label("No frames have been run yet.");
+            return;
+        };
+
+        let frame_budget_ms = 1000.0 / 60.0;
+        ui.label(format!(
+            "{:.2} ms per frame on the host ({:.0}% of a 60 fps frame), waitstates are {:.0}% of emulated cycles",
+            latest.frame_ms,
+            latest.frame_ms / frame_budget_ms * 100.0,
+            latest.waitstates / FRAME_CYCLES as f32 * 100.0,
+        ));
+
+        self.graph(ui, "Host ms / frame", |sample| sample.frame_ms);
+        self.graph(ui, "ARM instructions / frame", |sample| {
+            sample.arm_instructions
+        });
+        self.graph(ui, "THUMB instructions / frame", |sample| {
+            sample.thumb_instructions
+        });
+        self.graph(ui, "Waitstates / frame", |sample| sample.waitstates);
+        self.graph(ui, "Scheduler events / frame", |sample| sample.events);
+        self.graph(ui, "Exceptions / frame", |sample| sample.exceptions);
+
+        ui.add_space(4.0);
+        egui::Grid::new("profiler_memory_regions")
+            .striped(true)
+            .show(ui, |ui| {
+                ui.strong("Region");
+                ui.strong("Accesses / frame");
+                ui.strong("Waitstates / frame");
+                ui.end_row();
+
+                for region in 0..MEMORY_REGION_COUNT {
+                    if latest.accesses[region] == 0.0 {
+                        continue;
+                    }
+                    ui.label(MEMORY_REGION_NAMES[region]);
+                    ui.monospace(format!("{:.0}", latest.accesses[region]));
+                    ui.monospace(format!("{:.0}", latest.region_waitstates[region]));
+                    ui.end_row();
+                }
+            });
+    }
+
+    /// Draws `value` for every sample as a line, scaled to the largest value.
+    fn graph(&self, ui: &mut Ui, label: &str, value: impl Fn(&CounterSample) -> f32) {
+        let latest = self.history.back().map_or(0.0, &value);
+        let max = self.history.iter().map(&value).fold(0.0, f32::max);
+        ui.label(format!("{label}: {latest:.1} (max {max:.1})"));
+
+        let (rect, _) = ui.allocate_exact_size(
+            egui::vec2(ui.available_width(), GRAPH_HEIGHT),
+            Sense::hover(),
+        );
+        let painter = ui.painter_at(rect);
+        painter.rect_filled(rect, 0.0, ui.visuals().extreme_bg_color);
+        if max <= 0.0 || self.history.len() < 2 {
+            return;
+        }
+
+        // The newest sample is on the right edge.
+        let step = rect.width() / (COUNTER_HISTORY - 1) as f32;
+        let oldest = self.history.len() - 1;
+        let points = self
+            .history
+            .iter()
+            .enumerate()
+            .map(|(index, sample)| {
+                egui::pos2(
+                    rect.right() - (oldest - index) as f32 * step,
+                    rect.bottom() - value(sample) / max * rect.height(),
+                )
+            })
+            .collect();
+        painter.add(egui::Shape::line(
+            points,
+            Stroke::new(1.0, ui.visuals().text_color()),
+        ));
+    }
+}
@@ -1,3 +1,4 @@
 pub mod bits;
 pub mod display;
+pub mod triple_buffer;
 pub mod wyhash;
@@ -0,0 +1,150 @@
+//! Lock-free triple buffer for handing values from one thread to another.
+//!
+//! The writer always has a buffer to write into and the reader always has a buffer to read
+//! from, and the third buffer sits between them. Publishing swaps the writer's buffer with the
+//! middle one and updating the reader swaps the reader's buffer with it if something new was
+//! published since the last update. Neither side ever waits for the other: a writer that is
+//! faster than the reader overwrites the middle buffer and the reader only sees the latest
+//! value.
+
+use std::{
+    cell::UnsafeCell,
+    sync::{
+        atomic::{AtomicU8, Ordering},
+        Arc,
+    },
+};
+
+/// Set in [`Shared::middle`] when the middle buffer was published and hasn't been read yet.
+const FRESH: u8 = 0x4;
+const INDEX_MASK: u8 = 0x3;
+
+struct Shared<T> {
+    buffers: [UnsafeCell<T>; 3],
+
+    /// Index of the buffer that is owned by neither the writer nor the reader, and [`FRESH`].
+    middle: AtomicU8,
+}
+
+// SAFETY: every buffer is only ever accessed by whichever of the writer or the reader owns its
+// index, and ownership of an index only changes hands through `middle`.
+unsafe impl<T: Send> Sync for Shared<T> {}
+
+/// Creates a triple buffer with all three buffers set to `initial`.
+pub fn triple_buffer<T: Clone>(initial: T) -> (TripleBufferWriter<T>, TripleBufferReader<T>) {
+    let shared = Arc::new(Shared {
+        buffers: [
+            UnsafeCell::new(initial.clone()),
+            UnsafeCell::new(initial.clone()),
+            UnsafeCell::new(initial),
+        ],
+        middle: AtomicU8::new(1),
+    });
+
+    let writer = TripleBufferWriter {
+        shared: Arc::clone(&shared),
+        index: 0,
+    };
+    let reader = TripleBufferReader { shared, index: 2 };
+    (writer, reader)
+}
+
+pub struct TripleBufferWriter<T> {
+    shared: Arc<Shared<T>>,
+    index: u8,
+}
+
+impl<T> TripleBufferWriter<T> {
+    /// The buffer that will be handed to the reader by the next [`TripleBufferWriter::publish`].
+    /// This holds whatever was in it the last time the reader gave it back, not necessarily
+    /// the last value that was published.
+    #[inline]
+    pub fn buffer_mut(&mut self) -> &mut T {
+        // SAFETY: the writer owns this buffer until it publishes it.
+        unsafe { &mut *self.shared.buffers[self.index as usize].get() }
+    }
+
+    /// Makes the current buffer available to the reader and takes the middle buffer in return.
+    pub fn publish(&mut self) {
+        let previous = self
+            .shared
+            .middle
+            .swap(self.index | FRESH, Ordering::AcqRel);
+        self.index = previous & INDEX_MASK;
+    }
+}
+
+pub struct TripleBufferReader<T> {
+    shared: Arc<Shared<T>>,
+    index: u8,
+}
+
+impl<T> TripleBufferReader<T> {
+    /// Takes the most recently published buffer if there is one that hasn't been read yet.
+    /// Returns true if the buffer returned by [`TripleBufferReader::buffer`] changed.
+    pub fn update(&mut self) -> bool {
+        if self.shared.middle.load(Ordering::Relaxed) & FRESH == 0 {
+            return false;
+        }
+
+        let previous = self.shared.middle.swap(self.index, Ordering::AcqRel);
+        self.index = previous & INDEX_MASK;
+        true
+    }
+
+    /// The buffer that was taken by the last [`TripleBufferReader::update`].
+    #[inline]
+    pub fn buffer(&self) -> &T {
+        // SAFETY: the reader owns this buffer until it updates.
+        unsafe { &*self.shared.buffers[self.index as usize].get() }
+    }
+}
+
+#[cfg(test)]
+mod test {
+    use super::triple_buffer;
+
+    #[test]
+    fn test_update_without_publish() {
+        let (_writer, mut reader) = triple_buffer(0);
+        assert!(!reader.update());
+        assert_eq!(*reader.buffer(), 0);
+    }
+
+    #[test]
+    fn test_reader_sees_latest() {
+        let (mut writer, mut reader) = triple_buffer(0);
+        for value in 1..=3 {
+            *writer.buffer_mut() = value;
+            writer.publish();
+        }
+        assert!(reader.update());
+        assert_eq!(*reader.buffer(), 3);
+        assert!(!reader.update());
+        assert_eq!(*reader.buffer(), 3);
+    }
+
+    #[test]
+    fn test_threads() {
+        const VALUES: u64 = 100_000;
+        let (mut writer, mut reader) = triple_buffer([0u64; 16]);
+
+        let writer_thread = std::thread::spawn(move || {
+            for value in 1..=VALUES {
+                writer.buffer_mut().fill(value);
+                writer.publish();
+            }
+        });
+
+        let mut last = 0;
+        while last < VALUES {
+            if reader.update() {
+                let buffer = reader.buffer();
+                assert!(buffer.iter().all(|&value| value == buffer[0]), "torn read");
+                assert!(buffer[0] > last);
+                last = buffer[0];
+            }
+        }
+        writer_thread.join().unwrap();
+    }
+}
@@ -11,9 +11,6 @@ void reset_handler() {
     );
 }
 
-void irq_handler() {
-}
-
 void swi_Debug(int arg0, int UNUSED(arg1), int UNUSED(arg2), int UNUSED(arg3)) {
     *((volatile int*)0x02000000) = arg0;
 }
@@ -89,38 +86,64 @@ __asm__ (
 void swi_RegisterRamReset(int UNUSED(arg0), int UNUSED(arg1), int UNUSED(arg2), int UNUSED(arg3)) {
 }
 
-void swi_Halt(int UNUSED(arg0), int UNUSED(arg1), int UNUSED(arg2), int UNUSED(arg3)) {
-}
-
-void swi_Stop_or_Sleep(int UNUSED(arg0), int UNUSED(arg1), int UNUSED(arg2), int UNUSED(arg3)) {
-}
-
-void swi_IntrWait(int UNUSED(arg0), int UNUSED(arg1), int UNUSED(arg2), int UNUSED(arg3)) {
-}
+#define REG_IME     (*((volatile unsigned short*)0x04000208))
+#define REG_HALTCNT (*((volatile unsigned char*)0x04000301))
 
-void swi_VBlankIntrWait(int UNUSED(arg0), int UNUSED(arg1), int UNUSED(arg2), int UNUSED(arg3)) {
-}
+// Interrupt flags that the game's interrupt handler is expected to set after
+// acknowledging an interrupt in IF.
+#define BIOS_IF     (*((volatile unsigned short*)0x03007FF8))
 
-void swi_Div(int UNUSED(arg0), int UNUSED(arg1), int UNUSED(arg2), int UNUSED(arg3)) {
+// SWI 02h (GBA) - Halt
+// Halts the CPU until an interrupt request occurs. The CPU is switched into low-power mode,
+// all other circuits (video, sound, timers, serial, keypad, system clock) are kept operating.
+// Halt mode is terminated when any enabled interrupts are requested, that is when (IE AND IF)
+// is not zero, the GBA locks up if that condition doesn't get true.
+void swi_Halt(int UNUSED(arg0), int UNUSED(arg1), int UNUSED(arg2), int UNUSED(arg3)) {
+    REG_HALTCNT = 0;
 }
 
-void swi_DivArm(int UNUSED(arg0), int UNUSED(arg1), int UNUSED(arg2), int UNUSED(arg3)) {
+void swi_Stop_or_Sleep(int UNUSED(arg0), int UNUSED(arg1), int UNUSED(arg2), int UNUSED(arg3)) {
 }
 
-void swi_Sqrt(int UNUSED(arg0), int UNUSED(arg1), int UNUSED(arg2), int UNUSED(arg3)) {
-}
+// SWI 04h (GBA/NDS7/NDS9) - IntrWait
+// Continues to wait in Halt state until one (or more) of the specified interrupt(s) do occur.
+//   r0    0=Return immediately if an old flag was already set
+//         1=Discard old flags, wait until a NEW flag becomes set
+//   r1    Interrupt flag(s) to wait for (same format as IE/IF registers)
+// The function forcefully sets IME=1. When using multiple interrupts at the same time, this
+// function is having less overhead than repeatedly calling the Halt function.
+void swi_IntrWait(int discard, int flags, int UNUSED(arg2), int UNUSED(arg3)) {
+    // SWIs are called with IRQs disabled, but the game's interrupt handler has to run
+    // in order for BIOS_IF to ever change.
+    asm volatile (
+        "mrs r2, cpsr       \n\t"
+        "bic r2, r2, #0x80  \n\t"
+        "msr cpsr_c, r2     \n\t"
+        : /* NO OUTPUTS */
+        : /* NO INPUTS */
+        : "r2"
+    );
 
-void swi_ArcTan(int UNUSED(arg0), int UNUSED(arg1), int UNUSED(arg2), int UNUSED(arg3)) {
-}
+    REG_IME = 1;
+    if (discard) {
+        BIOS_IF &= ~flags;
+    }
 
-void swi_ArcTan2(int UNUSED(arg0), int UNUSED(arg1), int UNUSED(arg2), int UNUSED(arg3)) {
+    while ((BIOS_IF & flags) == 0) {
+        REG_HALTCNT = 0;
+    }
+    BIOS_IF &= ~flags;
 }
 
-void swi_CpuSet(int UNUSED(arg0), int UNUSED(arg1), int UNUSED(arg2), int UNUSED(arg3)) {
+// SWI 05h (GBA/NDS7/NDS9) - VBlankIntrWait
+// Continues to wait in Halt status until a new V-Blank interrupt occurs.
+// The function sets r0=1 and r1=1 and then executes IntrWait.
+void swi_VBlankIntrWait(int UNUSED(arg0), int UNUSED(arg1), int UNUSED(arg2), int UNUSED(arg3)) {
+    swi_IntrWait(1, 1, 0, 0);
 }
 
-void swi_CpuFastSet(int UNUSED(arg0), int UNUSED(arg1), int UNUSED(arg2), int UNUSED(arg3)) {
-}
+// SWI 06h..0Ah (Div, DivArm, Sqrt, ArcTan, ArcTan2) are in math.s
+// SWI 0Bh, 0Ch (CpuSet, CpuFastSet), 11h, 12h (LZ77UnComp) and 14h, 15h (RLUnComp) are in memory.s
 
 void swi_GetBiosChecksum(int UNUSED(arg0), int UNUSED(arg1), int UNUSED(arg2), int UNUSED(arg3)) {
 }
@@ -134,21 +157,9 @@ void swi_ObjAffineSet(int UNUSED(arg0), int UNUSED(arg1), int UNUSED(arg2), int
 void swi_BitUnPack(int UNUSED(arg0), int UNUSED(arg1), int UNUSED(arg2), int UNUSED(arg3)) {
 }
 
-void swi_LZ77UnCompReadNormalWrite8bit(int UNUSED(arg0), int UNUSED(arg1), int UNUSED(arg2), int UNUSED(arg3)) {
-}
-
-void swi_LZ77UnCompReadNormalWrite16bit(int UNUSED(arg0), int UNUSED(arg1), int UNUSED(arg2), int UNUSED(arg3)) {
-}
-
 void swi_HuffUnCompReadNormal(int UNUSED(arg0), int UNUSED(arg1), int UNUSED(arg2), int UNUSED(arg3)) {
 }
 
-void swi_RLUnCompReadNormalWrite8bit(int UNUSED(arg0), int UNUSED(arg1), int UNUSED(arg2), int UNUSED(arg3)) {
-}
-
-void swi_RLUnCompReadNormalWrite16bit(int UNUSED(arg0), int UNUSED(arg1), int UNUSED(arg2), int UNUSED(arg3)) {
-}
-
 void swi_Diff8bitUnFilterWrite8bit(int UNUSED(arg0), int UNUSED(arg1), int UNUSED(arg2), int UNUSED(arg3)) {
 }
 
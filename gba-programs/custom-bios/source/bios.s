@@ -46,8 +46,12 @@ ev_software_interrupt:
     pop {r11, r12, lr}
     movs pc, lr
 ev_irq_interrupt:
-    ldr lr, =irq_handler
-    bx lr
+    push {r0-r3, r12, lr}
+    mov r0, #0x04000000
+    add lr, pc, #0              @ return to the pop after the handler
+    ldr pc, [r0, #-4]           @ the game's handler is at 0x03FFFFFC (mirror of 0x03007FFC)
+    pop {r0-r3, r12, lr}
+    subs pc, lr, #4
 
 ev_undefined_instruction:
     ldr r0, =ev_reset
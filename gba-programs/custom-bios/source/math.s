@@ -0,0 +1,166 @@
+@ BIOS math functions.
+@
+@ These are written so that the number of cycles that they take only depends on their inputs
+@ in ways that are easy to predict (multiplies and a few branches), which lets the high level
+@ emulation of them in the emulator charge exactly the same number of cycles.
+
+.section ".text"
+.arm
+
+@ SWI 06h (GBA/NDS7/NDS9) - Div
+@ Signed Division, r0/r1.
+@   r0  signed 32bit Number
+@   r1  signed 32bit Denom
+@ Return:
+@   r0  Number DIV Denom ; signed
+@   r1  Number MOD Denom ; signed
+@   r3  ABS (Number DIV Denom) ; unsigned
+@ Division by zero hangs the real BIOS. Here it returns r0=-1 (or 1 for negative numbers),
+@ r1=Number and r3=FFFFFFFFh, which is just what the division loop ends up with.
+.global swi_Div
+swi_Div:
+    push    {r2, r4}
+    eor     r4, r0, r1
+    and     r4, r4, #0x80000000         @ bit 31: sign of the quotient
+    orr     r4, r4, r0, lsr #31         @ bit 0: sign of the remainder
+    cmp     r0, #0
+    rsblt   r0, r0, #0                  @ r0 = abs(number)
+    cmp     r1, #0
+    rsblt   r1, r1, #0                  @ r1 = abs(denominator)
+    mov     r2, #0                      @ remainder
+    mov     r3, #0                      @ quotient
+    mov     r12, #32
+1:
+    movs    r0, r0, lsl #1              @ shift the next bit of the number into the remainder
+    adc     r2, r2, r2
+    cmp     r2, r1
+    subcs   r2, r2, r1
+    adc     r3, r3, r3                  @ shift (remainder >= denominator) into the quotient
+    subs    r12, r12, #1
+    bne     1b
+
+    mov     r1, r2
+    tst     r4, #1
+    rsbne   r1, r1, #0
+    mov     r0, r3
+    tst     r4, #0x80000000
+    rsbne   r0, r0, #0
+    pop     {r2, r4}
+    bx      lr
+
+@ SWI 07h (GBA) - DivArm
+@ Same as Div but with r0 and r1 swapped (r0=Denom, r1=Number).
+.global swi_DivArm
+swi_DivArm:
+    mov     r3, r0
+    mov     r0, r1
+    mov     r1, r3
+    b       swi_Div
+
+@ SWI 08h (GBA/NDS7/NDS9) - Sqrt
+@ Calculate square root.
+@   r0  unsigned 32bit number
+@ Return:
+@   r0  unsigned 16bit number
+@ r1 and r3 are destroyed.
+.global swi_Sqrt
+swi_Sqrt:
+    mov     r1, #0                      @ root
+    mov     r12, #0x40000000            @ bit
+1:
+    add     r3, r1, r12
+    cmp     r0, r3
+    subcs   r0, r0, r3
+    mov     r1, r1, lsr #1
+    addcs   r1, r1, r12
+    movs    r12, r12, lsr #2
+    bne     1b
+
+    mov     r0, r1
+    bx      lr
+
+.macro arctan_step coefficient
+    mul     r3, r1, r3
+    mov     r3, r3, asr #14
+    add     r3, r3, #(\coefficient & 0xFF00)
+    add     r3, r3, #(\coefficient & 0x00FF)
+.endm
+
+@ SWI 09h (GBA) - ArcTan
+@ Calculates the arc tangent.
+@   r0  Tan, 16bit (1bit sign, 1bit integral part, 14bit decimal part)
+@ Return:
+@   r0  "-PI/2<THETA/<PI/2" in a range of C000h-4000h.
+@ r1 and r3 are destroyed.
+.global swi_ArcTan
+swi_ArcTan:
+    mul     r1, r0, r0
+    mov     r1, r1, asr #14
+    rsb     r1, r1, #0                  @ r1 = -(tan * tan) >> 14
+    mov     r3, #0xA9
+    arctan_step 0x0390
+    arctan_step 0x091C
+    arctan_step 0x0FB6
+    arctan_step 0x16AA
+    arctan_step 0x2081
+    arctan_step 0x3651
+    arctan_step 0xA2F9
+    mul     r0, r3, r0
+    mov     r0, r0, asr #16
+    bx      lr
+
+@ SWI 0Ah (GBA) - ArcTan2
+@ Calculates the arc tangent after correction processing.
+@   r0  X, 16bit (1bit sign, 1bit integral part, 14bit decimal part)
+@   r1  Y, 16bit (1bit sign, 1bit integral part, 14bit decimal part)
+@ Return:
+@   r0  0000h-FFFFh for 0<=THETA<2PI.
+@ r1 and r3 are destroyed.
+.global swi_ArcTan2
+swi_ArcTan2:
+    cmp     r1, #0
+    bne     1f
+    cmp     r0, #0                      @ y = 0: the angle is 0 or PI
+    movge   r0, #0
+    movlt   r0, #0x8000
+    bx      lr
+1:
+    cmp     r0, #0
+    bne     2f
+    cmp     r1, #0                      @ x = 0: the angle is PI/2 or 3PI/2
+    movge   r0, #0x4000
+    movlt   r0, #0xC000
+    bx      lr
+2:
+    push    {r4, r5, lr}
+    mov     r4, r0                      @ x
+    mov     r5, r1                      @ y
+    cmp     r0, #0
+    rsblt   r0, r0, #0
+    cmp     r1, #0
+    rsblt   r1, r1, #0
+    cmp     r0, r1
+    blt     3f
+
+    @ |y| <= |x|: arctan(y/x), plus PI if x is negative.
+    mov     r0, r5, lsl #14
+    mov     r1, r4
+    bl      swi_Div
+    bl      swi_ArcTan
+    cmp     r4, #0
+    addlt   r0, r0, #0x8000
+    b       4f
+3:
+    @ |x| < |y|: PI/2 - arctan(x/y), or 3PI/2 - arctan(x/y) if y is negative.
+    mov     r0, r4, lsl #14
+    mov     r1, r5
+    bl      swi_Div
+    bl      swi_ArcTan
+    cmp     r5, #0
+    rsbge   r0, r0, #0x4000
+    rsblt   r0, r0, #0xC000
+4:
+    mov     r0, r0, lsl #16
+    mov     r0, r0, lsr #16
+    pop     {r4, r5, lr}
+    bx      lr
@@ -0,0 +1,271 @@
+@ BIOS memory copy and decompression functions.
+@
+@ Like the math functions, these are written so that the number of cycles that they take is
+@ easy to predict from their inputs, which lets the high level emulation of them in the
+@ emulator charge the same number of cycles.
+@
+@ All of these return immediately if the source address is in the BIOS, like the real ones.
+@ They return with r0 pointing after the last source byte that was read, r1 pointing after
+@ the last destination byte that was written and r2 and r3 set to 0.
+
+.section ".text"
+.arm
+.syntax unified
+
+.equ CPUSET_FILL,   (1 << 24)
+.equ CPUSET_32BIT,  (1 << 26)
+
+@ SWI 0Bh (GBA/NDS7/NDS9) - CpuSet
+@ Memory copy/fill in units of 4 bytes or 2 bytes.
+@   r0    Source address        (must be aligned by 4 for 32bit, by 2 for 16bit)
+@   r1    Destination address   (must be aligned by 4 for 32bit, by 2 for 16bit)
+@   r2    Length/Mode
+@           Bit 0-20  Wordcount (for 32bit), or Halfwordcount (for 16bit)
+@           Bit 24    Fixed Source Address (0=Copy, 1=Fill by {HALF}WORD[r0])
+@           Bit 26    Datasize (0=16bit, 1=32bit)
+.global swi_CpuSet
+swi_CpuSet:
+    tst     r0, #0x0E000000
+    beq     cpuset_done
+    mov     r12, r2, lsl #11
+    movs    r12, r12, lsr #11           @ count
+    beq     cpuset_done
+    tst     r2, #CPUSET_32BIT
+    bne     cpuset_32bit
+
+    bic     r0, r0, #1
+    bic     r1, r1, #1
+    tst     r2, #CPUSET_FILL
+    bne     cpuset_fill16
+1:
+    ldrh    r3, [r0], #2
+    strh    r3, [r1], #2
+    subs    r12, r12, #1
+    bne     1b
+    b       cpuset_done
+cpuset_fill16:
+    ldrh    r3, [r0]
+1:
+    strh    r3, [r1], #2
+    subs    r12, r12, #1
+    bne     1b
+    b       cpuset_done
+
+cpuset_32bit:
+    bic     r0, r0, #3
+    bic     r1, r1, #3
+    tst     r2, #CPUSET_FILL
+    bne     cpuset_fill32
+1:
+    ldr     r3, [r0], #4
+    str     r3, [r1], #4
+    subs    r12, r12, #1
+    bne     1b
+    b       cpuset_done
+cpuset_fill32:
+    ldr     r3, [r0]
+1:
+    str     r3, [r1], #4
+    subs    r12, r12, #1
+    bne     1b
+
+cpuset_done:
+    mov     r2, #0
+    mov     r3, #0
+    bx      lr
+
+@ SWI 0Ch (GBA/NDS7/NDS9) - CpuFastSet
+@ Memory copy/fill in units of 32 bytes.
+@   r0    Source address        (must be aligned by 4)
+@   r1    Destination address   (must be aligned by 4)
+@   r2    Length/Mode
+@           Bit 0-20  Wordcount (GBA: rounded up to multiple of 8 words)
+@           Bit 24    Fixed Source Address (0=Copy, 1=Fill by WORD[r0])
+.global swi_CpuFastSet
+swi_CpuFastSet:
+    push    {r4-r9}
+    tst     r0, #0x0E000000
+    beq     cpufastset_done
+    mov     r12, r2, lsl #11
+    movs    r12, r12, lsr #11           @ count
+    beq     cpufastset_done
+    add     r12, r12, #7
+    mov     r12, r12, lsr #3            @ blocks of 8 words
+    bic     r0, r0, #3
+    bic     r1, r1, #3
+    tst     r2, #CPUSET_FILL
+    bne     cpufastset_fill
+1:
+    ldmia   r0!, {r2-r9}
+    stmia   r1!, {r2-r9}
+    subs    r12, r12, #1
+    bne     1b
+    b       cpufastset_done
+cpufastset_fill:
+    ldr     r2, [r0]
+    mov     r3, r2
+    mov     r4, r2
+    mov     r5, r2
+    mov     r6, r2
+    mov     r7, r2
+    mov     r8, r2
+    mov     r9, r2
+1:
+    stmia   r1!, {r2-r9}
+    subs    r12, r12, #1
+    bne     1b
+
+cpufastset_done:
+    pop     {r4-r9}
+    mov     r2, #0
+    mov     r3, #0
+    bx      lr
+
+@ Writes the byte in r4 to [r1] and increments r1.
+.macro emit8
+    strb    r4, [r1], #1
+.endm
+
+@ Writes the byte in r4 to [r1] and increments r1. Bytes are written in pairs as halfwords
+@ so the byte at even addresses is kept in r7 until the byte after it is written.
+.macro emit16
+    tst     r1, #1
+    orrne   r7, r7, r4, lsl #8
+    strhne  r7, [r1, #-1]
+    moveq   r7, r4
+    add     r1, r1, #1
+.endm
+
+@ Reads the 32-bit compression header at [r0] and sets r2 to the decompressed size.
+.macro read_header done
+    tst     r0, #0x0E000000
+    beq     \done
+    ldr     r2, [r0], #4
+    movs    r2, r2, lsr #8
+    beq     \done
+.endm
+
+@ SWI 11h (GBA/NDS7/NDS9) - LZ77UnCompReadNormalWrite8bit (Wram)
+@ SWI 12h (GBA/NDS7/NDS9) - LZ77UnCompReadNormalWrite16bit (Vram)
+@   r0  Source address, pointing to data as such:
+@        Data header (32bit)
+@          Bit 0-3   Reserved
+@          Bit 4-7   Compressed type (must be 1 for LZ77)
+@          Bit 8-31  Size of decompressed data
+@        Repeat below. Each Flag Byte followed by eight Blocks.
+@        Flag data (8bit)
+@          Bit 0-7   Type Flags for next 8 Blocks, MSB first
+@        Block Type 0 - Uncompressed - Copy 1 Byte from Source to Dest
+@          Bit 0-7   One data byte to be copied to dest
+@        Block Type 1 - Compressed - Copy N+3 Bytes from Dest-Disp-1 to Dest
+@          Bit 0-3   Disp MSBs
+@          Bit 4-7   Number of bytes to copy (minus 3)
+@          Bit 8-15  Disp LSBs
+@   r1  Destination address
+@ The Write16bit version must not be used with Disp=0 because it reads back bytes that
+@ haven't been written to VRAM yet. Its decompressed size should be a multiple of 2.
+.macro lz77 emit, done
+    push    {r4-r7}
+    read_header \done
+1:
+    ldrb    r3, [r0], #1                @ flags
+    mov     r12, #8
+2:
+    tst     r3, #0x80
+    bne     3f
+    ldrb    r4, [r0], #1
+    \emit
+    subs    r2, r2, #1
+    beq     \done
+    b       5f
+3:
+    ldrb    r4, [r0], #1
+    ldrb    r5, [r0], #1
+    mov     r6, r4, lsr #4
+    add     r6, r6, #3                  @ length
+    and     r4, r4, #0xF
+    orr     r5, r5, r4, lsl #8
+    add     r5, r5, #1                  @ displacement
+    sub     r5, r1, r5
+4:
+    ldrb    r4, [r5], #1
+    \emit
+    subs    r2, r2, #1
+    beq     \done
+    subs    r6, r6, #1
+    bne     4b
+5:
+    mov     r3, r3, lsl #1
+    subs    r12, r12, #1
+    bne     2b
+    b       1b
+\done:
+    pop     {r4-r7}
+    mov     r2, #0
+    mov     r3, #0
+    bx      lr
+.endm
+
+.global swi_LZ77UnCompReadNormalWrite8bit
+swi_LZ77UnCompReadNormalWrite8bit:
+    lz77 emit8, lz77_8bit_done
+
+.global swi_LZ77UnCompReadNormalWrite16bit
+swi_LZ77UnCompReadNormalWrite16bit:
+    lz77 emit16, lz77_16bit_done
+
+@ SWI 14h (GBA/NDS7/NDS9) - RLUnCompReadNormalWrite8bit (Wram)
+@ SWI 15h (GBA/NDS7/NDS9) - RLUnCompReadNormalWrite16bit (Vram)
+@   r0  Source Address, pointing to data as such:
+@        Data header (32bit)
+@          Bit 0-3   Reserved
+@          Bit 4-7   Compressed type (must be 3 for run-length)
+@          Bit 8-31  Size of decompressed data
+@        Repeat below. Each Flag Byte followed by one or more Data Bytes.
+@        Flag data (8bit)
+@          Bit 0-6   Expanded Data Length (uncompressed N-1, compressed N-3)
+@          Bit 7     Flag (0=uncompressed, 1=compressed)
+@        Data Byte(s) - N uncompressed bytes, or 1 byte repeated N times
+@   r1  Destination Address
+@ The decompressed size of the Write16bit version should be a multiple of 2.
+.macro rl emit, done
+    push    {r4-r7}
+    read_header \done
+1:
+    ldrb    r3, [r0], #1                @ flag
+    tst     r3, #0x80
+    and     r12, r3, #0x7F
+    bne     3f
+    add     r12, r12, #1
+2:
+    ldrb    r4, [r0], #1
+    \emit
+    subs    r2, r2, #1
+    beq     \done
+    subs    r12, r12, #1
+    bne     2b
+    b       1b
+3:
+    add     r12, r12, #3
+    ldrb    r4, [r0], #1
+4:
+    \emit
+    subs    r2, r2, #1
+    beq     \done
+    subs    r12, r12, #1
+    bne     4b
+    b       1b
+\done:
+    pop     {r4-r7}
+    mov     r2, #0
+    mov     r3, #0
+    bx      lr
+.endm
+
+.global swi_RLUnCompReadNormalWrite8bit
+swi_RLUnCompReadNormalWrite8bit:
+    rl emit8, rl_8bit_done
+
+.global swi_RLUnCompReadNormalWrite16bit
+swi_RLUnCompReadNormalWrite16bit:
+    rl emit16, rl_16bit_done